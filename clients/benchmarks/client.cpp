@@ -30,9 +30,15 @@
 #include "testing_asum.hpp"
 #include "testing_asum_batched.hpp"
 #include "testing_asum_strided_batched.hpp"
+#include "testing_axpby.hpp"
+#include "testing_axpby_batched.hpp"
+#include "testing_axpby_strided_batched.hpp"
 #include "testing_axpy.hpp"
 #include "testing_axpy_batched.hpp"
 #include "testing_axpy_batched_ex.hpp"
+#include "testing_axpy_dot.hpp"
+#include "testing_axpy_dot_batched.hpp"
+#include "testing_axpy_dot_strided_batched.hpp"
 #include "testing_axpy_ex.hpp"
 #include "testing_axpy_strided_batched.hpp"
 #include "testing_axpy_strided_batched_ex.hpp"
@@ -40,6 +46,9 @@
 #include "testing_copy_batched.hpp"
 #include "testing_copy_strided_batched.hpp"
 #include "testing_dot.hpp"
+#include "testing_dot2.hpp"
+#include "testing_dot2_batched.hpp"
+#include "testing_dot2_strided_batched.hpp"
 #include "testing_dot_batched.hpp"
 #include "testing_dot_batched_ex.hpp"
 #include "testing_dot_ex.hpp"
@@ -78,6 +87,9 @@
 #include "testing_swap.hpp"
 #include "testing_swap_batched.hpp"
 #include "testing_swap_strided_batched.hpp"
+#include "testing_waxpby.hpp"
+#include "testing_waxpby_batched.hpp"
+#include "testing_waxpby_strided_batched.hpp"
 // blas2
 #include "testing_gbmv.hpp"
 #include "testing_gbmv_batched.hpp"
@@ -297,15 +309,24 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
                 {"asum", testing_asum<T>},
                 {"asum_batched", testing_asum_batched<T>},
                 {"asum_strided_batched", testing_asum_strided_batched<T>},
+                {"axpby", testing_axpby<T>},
+                {"axpby_batched", testing_axpby_batched<T>},
+                {"axpby_strided_batched", testing_axpby_strided_batched<T>},
                 {"axpy", testing_axpy<T>},
                 {"axpy_batched", testing_axpy_batched<T>},
                 {"axpy_strided_batched", testing_axpy_strided_batched<T>},
+                {"axpy_dot", testing_axpy_dot<T>},
+                {"axpy_dot_batched", testing_axpy_dot_batched<T>},
+                {"axpy_dot_strided_batched", testing_axpy_dot_strided_batched<T>},
                 {"copy", testing_copy<T>},
                 {"copy_batched", testing_copy_batched<T>},
                 {"copy_strided_batched", testing_copy_strided_batched<T>},
                 {"dot", testing_dot<T>},
                 {"dot_batched", testing_dot_batched<T>},
                 {"dot_strided_batched", testing_dot_strided_batched<T>},
+                {"dot2", testing_dot2<T>},
+                {"dot2_batched", testing_dot2_batched<T>},
+                {"dot2_strided_batched", testing_dot2_strided_batched<T>},
                 {"iamax", testing_iamax<T>},
                 {"iamax_batched", testing_iamax_batched<T>},
                 {"iamax_strided_batched", testing_iamax_strided_batched<T>},
@@ -324,6 +345,9 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
                 {"swap", testing_swap<T>},
                 {"swap_batched", testing_swap_batched<T>},
                 {"swap_strided_batched", testing_swap_strided_batched<T>},
+                {"waxpby", testing_waxpby<T>},
+                {"waxpby_batched", testing_waxpby_batched<T>},
+                {"waxpby_strided_batched", testing_waxpby_strided_batched<T>},
                 // L2
                 {"gbmv", testing_gbmv<T>},
                 {"gbmv_batched", testing_gbmv_batched<T>},
@@ -470,9 +494,15 @@ struct perf_blas<T,
                 {"asum", testing_asum<T>},
                 {"asum_batched", testing_asum_batched<T>},
                 {"asum_strided_batched", testing_asum_strided_batched<T>},
+                {"axpby", testing_axpby<T>},
+                {"axpby_batched", testing_axpby_batched<T>},
+                {"axpby_strided_batched", testing_axpby_strided_batched<T>},
                 {"axpy", testing_axpy<T>},
                 {"axpy_batched", testing_axpy_batched<T>},
                 {"axpy_strided_batched", testing_axpy_strided_batched<T>},
+                {"axpy_dot", testing_axpy_dot<T>},
+                {"axpy_dot_batched", testing_axpy_dot_batched<T>},
+                {"axpy_dot_strided_batched", testing_axpy_dot_strided_batched<T>},
                 {"copy", testing_copy<T>},
                 {"copy_batched", testing_copy_batched<T>},
                 {"copy_strided_batched", testing_copy_strided_batched<T>},
@@ -482,6 +512,9 @@ struct perf_blas<T,
                 {"dotc", testing_dotc<T>},
                 {"dotc_batched", testing_dotc_batched<T>},
                 {"dotc_strided_batched", testing_dotc_strided_batched<T>},
+                {"dot2", testing_dot2<T>},
+                {"dot2_batched", testing_dot2_batched<T>},
+                {"dot2_strided_batched", testing_dot2_strided_batched<T>},
                 {"iamax", testing_iamax<T>},
                 {"iamax_batched", testing_iamax_batched<T>},
                 {"iamax_strided_batched", testing_iamax_strided_batched<T>},
@@ -494,6 +527,9 @@ struct perf_blas<T,
                 {"swap", testing_swap<T>},
                 {"swap_batched", testing_swap_batched<T>},
                 {"swap_strided_batched", testing_swap_strided_batched<T>},
+                {"waxpby", testing_waxpby<T>},
+                {"waxpby_batched", testing_waxpby_batched<T>},
+                {"waxpby_strided_batched", testing_waxpby_strided_batched<T>},
                 // L2
                 {"gbmv", testing_gbmv<T>},
                 {"gbmv_batched", testing_gbmv_batched<T>},
@@ -1152,6 +1188,8 @@ try
     int         flags               = 0;
     bool        datafile            = rocblas_parse_data(argc, argv);
     bool        atomics_not_allowed = false;
+    bool        reproducible        = false;
+    bool        nrm2_scaled         = false;
     bool        log_function_name   = false;
     bool        any_stride          = false;
 
@@ -1243,6 +1281,10 @@ try
          value<rocblas_int>(&arg.incy)->default_value(1),
          "increment between values in y vector")
 
+        ("incz",
+         value<rocblas_int>(&arg.incz)->default_value(1),
+         "increment between values in z vector")
+
         ("incb",
          value<rocblas_int>(&arg.incb)->default_value(1),
          "increment between values in b vector")
@@ -1348,6 +1390,14 @@ try
          bool_switch(&atomics_not_allowed)->default_value(false),
          "Atomic operations with non-determinism in results are not allowed")
 
+        ("reproducible",
+         bool_switch(&reproducible)->default_value(false),
+         "dot, asum and nrm2 sums are bitwise reproducible (rocblas_reduction_mode_reproducible)")
+
+        ("nrm2_scaled",
+         bool_switch(&nrm2_scaled)->default_value(false),
+         "nrm2 sums scaled squares in one pass without overflow (rocblas_nrm2_mode_scaled)")
+
         ("device",
          value<rocblas_int>(&device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
@@ -1401,6 +1451,9 @@ try
     // transfer local variable state
 
     arg.atomics_mode = atomics_not_allowed ? rocblas_atomics_not_allowed : rocblas_atomics_allowed;
+    arg.reduction_mode
+        = reproducible ? rocblas_reduction_mode_reproducible : rocblas_reduction_mode_default;
+    arg.nrm2_mode = nrm2_scaled ? rocblas_nrm2_mode_scaled : rocblas_nrm2_mode_default;
 
     static const char* fp16AltImplEnvStr = std::getenv("ROCBLAS_INTERNAL_FP16_ALT_IMPL");
     static const int   fp16AltImplEnv
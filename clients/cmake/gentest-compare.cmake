@@ -0,0 +1,43 @@
+# ########################################################################
+# Copyright 2022 Advanced Micro Devices, Inc.
+# ########################################################################
+
+# Expands each YAML file in YAML_DIR with rocblas_gentest.py and with rocblas-gentest, and fails
+# if the records differ, or if only one of them accepts the file.
+#
+# Usage: cmake -DPYTHON=... -DGENTEST_PY=... -DGENTEST=... -DYAML_DIR=... -DINCLUDE_DIR=...
+#              -DWORK_DIR=... -P gentest-compare.cmake
+
+file( GLOB yaml_files "${YAML_DIR}/*.yaml" )
+file( MAKE_DIRECTORY "${WORK_DIR}" )
+
+set( failures "" )
+foreach( yaml_file ${yaml_files} )
+  get_filename_component( name "${yaml_file}" NAME_WE )
+  set( py_data "${WORK_DIR}/${name}_py.data" )
+  set( native_data "${WORK_DIR}/${name}_native.data" )
+
+  execute_process( COMMAND ${PYTHON} ${GENTEST_PY} -I ${INCLUDE_DIR} ${yaml_file} -o ${py_data}
+                   RESULT_VARIABLE py_result
+                   OUTPUT_QUIET ERROR_QUIET )
+  execute_process( COMMAND ${GENTEST} -I ${INCLUDE_DIR} ${yaml_file} -o ${native_data}
+                   RESULT_VARIABLE native_result
+                   OUTPUT_QUIET ERROR_QUIET )
+
+  if( py_result EQUAL 0 AND native_result EQUAL 0 )
+    execute_process( COMMAND ${CMAKE_COMMAND} -E compare_files ${py_data} ${native_data}
+                     RESULT_VARIABLE compare_result )
+    if( NOT compare_result EQUAL 0 )
+      list( APPEND failures "${name}.yaml: the records differ" )
+    endif()
+  elseif( py_result EQUAL 0 OR native_result EQUAL 0 )
+    list( APPEND failures "${name}.yaml: rocblas_gentest.py exited with ${py_result}, rocblas-gentest exited with ${native_result}" )
+  endif()
+endforeach()
+
+list( LENGTH yaml_files yaml_count )
+if( failures )
+  string( REPLACE ";" "\n" failures "${failures}" )
+  message( FATAL_ERROR "rocblas-gentest does not match rocblas_gentest.py:\n${failures}" )
+endif()
+message( STATUS "rocblas-gentest matches rocblas_gentest.py on ${yaml_count} YAML files" )
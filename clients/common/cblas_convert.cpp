@@ -0,0 +1,330 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "cblas_convert.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <omp.h>
+#include <type_traits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CBLAS_CONVERT_X86
+#endif
+
+static_assert(sizeof(rocblas_half) == sizeof(uint16_t), "rocblas_half is not 16 bits");
+static_assert(sizeof(rocblas_bfloat16) == sizeof(uint16_t), "rocblas_bfloat16 is not 16 bits");
+
+namespace
+{
+    // Matrices with fewer elements than this are converted by the calling thread
+    constexpr size_t parallel_threshold = 1 << 16;
+
+    // Contiguous data is split into blocks of this many elements between threads
+    constexpr size_t block_size = 1 << 14;
+
+    // A vectorized kernel converts a prefix of n contiguous elements, and returns its length.
+    // The rest of the elements are converted by convert_element().
+    template <typename Ti, typename To>
+    using kernel_t = size_t (*)(size_t n, const Ti* x, To* y);
+
+    template <typename Ti, typename To>
+    inline To convert_element(Ti x, bool alt)
+    {
+        if constexpr(std::is_same<Ti, rocblas_half>{})
+            if(alt)
+                return float(rocblas_bfloat16(float(x), rocblas_bfloat16::truncate_t::truncate));
+        return static_cast<To>(x);
+    }
+
+#ifdef CBLAS_CONVERT_X86
+    /***********************************************************************
+     * F16C and AVX2                                                       *
+     ***********************************************************************/
+    __attribute__((target("avx2,f16c"))) size_t
+        half_to_float_avx2(size_t n, const rocblas_half* x, float* y)
+    {
+        auto   src = reinterpret_cast<const uint16_t*>(x);
+        size_t i   = 0;
+        for(; i + 8 <= n; i += 8)
+            _mm256_storeu_ps(
+                y + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+        return i;
+    }
+
+    __attribute__((target("avx2,f16c"))) size_t
+        float_to_half_avx2(size_t n, const float* x, rocblas_half* y)
+    {
+        auto   dst = reinterpret_cast<uint16_t*>(y);
+        size_t i   = 0;
+        for(; i + 8 <= n; i += 8)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                             _mm256_cvtps_ph(_mm256_loadu_ps(x + i),
+                                             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        return i;
+    }
+
+    __attribute__((target("avx2"))) size_t
+        bfloat16_to_float_avx2(size_t n, const rocblas_bfloat16* x, float* y)
+    {
+        auto   src = reinterpret_cast<const uint16_t*>(x);
+        size_t i   = 0;
+        for(; i + 8 <= n; i += 8)
+        {
+            __m256i u = _mm256_cvtepu16_epi32(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(y + i), _mm256_slli_epi32(u, 16));
+        }
+        return i;
+    }
+
+    // Round 8 floats to bfloat16 as rocblas_bfloat16(float) does, in the low 16 bits of each
+    // 32-bit lane
+    __attribute__((target("avx2"))) __m256i round_bfloat16_avx2(__m256i u)
+    {
+        const __m256i exponent = _mm256_set1_epi32(0x7f800000);
+        const __m256i low      = _mm256_set1_epi32(0xffff);
+        const __m256i one      = _mm256_set1_epi32(1);
+
+        // Round to nearest, round to even
+        __m256i rounded = _mm256_add_epi32(
+            u,
+            _mm256_add_epi32(_mm256_set1_epi32(0x7fff),
+                             _mm256_and_si256(_mm256_srli_epi32(u, 16), one)));
+
+        // Inf and NaN are not rounded, but NaN keeps a nonzero mantissa
+        __m256i low_zero = _mm256_cmpeq_epi32(_mm256_and_si256(u, low), _mm256_setzero_si256());
+        __m256i nan
+            = _mm256_or_si256(u, _mm256_andnot_si256(low_zero, _mm256_set1_epi32(0x10000)));
+        __m256i special = _mm256_cmpeq_epi32(_mm256_and_si256(u, exponent), exponent);
+
+        return _mm256_srli_epi32(_mm256_blendv_epi8(rounded, nan, special), 16);
+    }
+
+    __attribute__((target("avx2"))) size_t
+        float_to_bfloat16_avx2(size_t n, const float* x, rocblas_bfloat16* y)
+    {
+        auto   dst = reinterpret_cast<uint16_t*>(y);
+        size_t i   = 0;
+        for(; i + 16 <= n; i += 16)
+        {
+            __m256i lo = round_bfloat16_avx2(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i)));
+            __m256i hi = round_bfloat16_avx2(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i + 8)));
+
+            // packus interleaves the 128-bit lanes of its operands, so reorder them
+            __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xd8);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), packed);
+        }
+        return i;
+    }
+
+    /***********************************************************************
+     * AVX-512                                                             *
+     ***********************************************************************/
+    __attribute__((target("avx512f"))) size_t
+        half_to_float_avx512(size_t n, const rocblas_half* x, float* y)
+    {
+        auto   src = reinterpret_cast<const uint16_t*>(x);
+        size_t i   = 0;
+        for(; i + 16 <= n; i += 16)
+            _mm512_storeu_ps(y + i,
+                             _mm512_cvtph_ps(
+                                 _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i))));
+        return i;
+    }
+
+    __attribute__((target("avx512f"))) size_t
+        float_to_half_avx512(size_t n, const float* x, rocblas_half* y)
+    {
+        auto   dst = reinterpret_cast<uint16_t*>(y);
+        size_t i   = 0;
+        for(; i + 16 <= n; i += 16)
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                                _mm512_cvtps_ph(_mm512_loadu_ps(x + i),
+                                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        return i;
+    }
+
+    __attribute__((target("avx512f"))) size_t
+        bfloat16_to_float_avx512(size_t n, const rocblas_bfloat16* x, float* y)
+    {
+        auto   src = reinterpret_cast<const uint16_t*>(x);
+        size_t i   = 0;
+        for(; i + 16 <= n; i += 16)
+        {
+            __m512i u = _mm512_cvtepu16_epi32(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+            _mm512_storeu_si512(y + i, _mm512_slli_epi32(u, 16));
+        }
+        return i;
+    }
+
+    __attribute__((target("avx512f"))) size_t
+        float_to_bfloat16_avx512(size_t n, const float* x, rocblas_bfloat16* y)
+    {
+        auto          dst      = reinterpret_cast<uint16_t*>(y);
+        const __m512i exponent = _mm512_set1_epi32(0x7f800000);
+        const __m512i one      = _mm512_set1_epi32(1);
+        size_t        i        = 0;
+        for(; i + 16 <= n; i += 16)
+        {
+            __m512i u = _mm512_loadu_si512(x + i);
+
+            // Round to nearest, round to even
+            __m512i rounded = _mm512_add_epi32(
+                u,
+                _mm512_add_epi32(_mm512_set1_epi32(0x7fff),
+                                 _mm512_and_si512(_mm512_srli_epi32(u, 16), one)));
+
+            // Inf and NaN are not rounded, but NaN keeps a nonzero mantissa
+            __mmask16 special
+                = _mm512_cmpeq_epi32_mask(_mm512_and_si512(u, exponent), exponent);
+            __mmask16 low = _mm512_test_epi32_mask(u, _mm512_set1_epi32(0xffff));
+            __m512i   nan = _mm512_mask_or_epi32(u, low, u, _mm512_set1_epi32(0x10000));
+
+            __m512i r = _mm512_mask_blend_epi32(special, rounded, nan);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                                _mm512_cvtepi32_epi16(_mm512_srli_epi32(r, 16)));
+        }
+        return i;
+    }
+#endif
+
+    // Kernels for the instructions supported by the CPU, or nullptr if there are none
+    struct convert_kernels
+    {
+        kernel_t<rocblas_half, float>     half_to_float     = nullptr;
+        kernel_t<float, rocblas_half>     float_to_half     = nullptr;
+        kernel_t<rocblas_bfloat16, float> bfloat16_to_float = nullptr;
+        kernel_t<float, rocblas_bfloat16> float_to_bfloat16 = nullptr;
+    };
+
+    const convert_kernels& kernels()
+    {
+        static const convert_kernels k = [] {
+            convert_kernels k;
+#ifdef CBLAS_CONVERT_X86
+            __builtin_cpu_init();
+            if(__builtin_cpu_supports("avx512f"))
+            {
+                k.half_to_float     = half_to_float_avx512;
+                k.float_to_half     = float_to_half_avx512;
+                k.bfloat16_to_float = bfloat16_to_float_avx512;
+                k.float_to_bfloat16 = float_to_bfloat16_avx512;
+            }
+            else if(__builtin_cpu_supports("avx2"))
+            {
+                if(__builtin_cpu_supports("f16c"))
+                {
+                    k.half_to_float = half_to_float_avx2;
+                    k.float_to_half = float_to_half_avx2;
+                }
+                k.bfloat16_to_float = bfloat16_to_float_avx2;
+                k.float_to_bfloat16 = float_to_bfloat16_avx2;
+            }
+#endif
+            return k;
+        }();
+        return k;
+    }
+
+    // Convert n contiguous elements
+    template <typename Ti, typename To>
+    void convert_contiguous(size_t n, const Ti* x, To* y, kernel_t<Ti, To> kernel, bool alt)
+    {
+        size_t i = 0;
+        if(kernel)
+        {
+            i = kernel(n, x, y);
+            if constexpr(std::is_same<Ti, rocblas_half>{})
+                if(alt)
+                    for(size_t j = 0; j < i; ++j)
+                        y[j] = float(
+                            rocblas_bfloat16(y[j], rocblas_bfloat16::truncate_t::truncate));
+        }
+        for(; i < n; ++i)
+            y[i] = convert_element<Ti, To>(x[i], alt);
+    }
+
+    template <typename Ti, typename To>
+    void convert(rocblas_int      m,
+                 rocblas_int      n,
+                 const Ti*        A,
+                 size_t           lda,
+                 To*              B,
+                 size_t           ldb,
+                 kernel_t<Ti, To> kernel,
+                 bool             alt)
+    {
+        if(m <= 0 || n <= 0)
+            return;
+
+        size_t rows     = m;
+        size_t cols     = n;
+        size_t size     = rows * cols;
+        bool   parallel = size >= parallel_threshold;
+
+        if(rows == 1 && (lda != 1 || ldb != 1))
+        {
+            // Strided vector
+#pragma omp parallel for if(parallel)
+            for(size_t j = 0; j < cols; ++j)
+                B[j * ldb] = convert_element<Ti, To>(A[j * lda], alt);
+        }
+        else if(rows == 1 || (lda == rows && ldb == rows))
+        {
+            // Contiguous data, split into blocks
+            size_t blocks = (size - 1) / block_size + 1;
+#pragma omp parallel for if(parallel)
+            for(size_t b = 0; b < blocks; ++b)
+            {
+                size_t offset = b * block_size;
+                convert_contiguous(
+                    std::min(block_size, size - offset), A + offset, B + offset, kernel, alt);
+            }
+        }
+        else
+        {
+            // Matrix with padding between its columns
+#pragma omp parallel for if(parallel)
+            for(size_t j = 0; j < cols; ++j)
+                convert_contiguous(rows, A + j * lda, B + j * ldb, kernel, alt);
+        }
+    }
+} // namespace
+
+void cblas_convert(rocblas_int         m,
+                   rocblas_int         n,
+                   const rocblas_half* A,
+                   size_t              lda,
+                   float*              B,
+                   size_t              ldb,
+                   bool                alt)
+{
+    convert(m, n, A, lda, B, ldb, kernels().half_to_float, alt);
+}
+
+void cblas_convert(rocblas_int             m,
+                   rocblas_int             n,
+                   const rocblas_bfloat16* A,
+                   size_t                  lda,
+                   float*                  B,
+                   size_t                  ldb)
+{
+    convert(m, n, A, lda, B, ldb, kernels().bfloat16_to_float, false);
+}
+
+void cblas_convert(
+    rocblas_int m, rocblas_int n, const float* A, size_t lda, rocblas_half* B, size_t ldb)
+{
+    convert(m, n, A, lda, B, ldb, kernels().float_to_half, false);
+}
+
+void cblas_convert(
+    rocblas_int m, rocblas_int n, const float* A, size_t lda, rocblas_bfloat16* B, size_t ldb)
+{
+    convert(m, n, A, lda, B, ldb, kernels().float_to_bfloat16, false);
+}
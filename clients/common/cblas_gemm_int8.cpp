@@ -0,0 +1,288 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "cblas_interface.hpp"
+#include "host_vector.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <omp.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CBLAS_GEMM_INT8_X86
+#endif
+
+/*
+ * ===========================================================================
+ *    int8 gemm
+ *
+ *    The reference computes C = alpha * op(A) * op(B) + beta * C exactly in
+ *    32-bit integers, wrapping around on overflow as the GPU does. All of the
+ *    arithmetic is done in uint32_t, where wraparound is well defined, and
+ *    since it is modulo 2^32, the result does not depend on the order in which
+ *    the products are summed.
+ *
+ *    The rows of op(A) and the columns of op(B) are packed contiguously in k,
+ *    zero-padded to a multiple of KP bytes, so that every product is a dot
+ *    product of two contiguous vectors. C is computed in tiles of MB x NB,
+ *    which are spread across OpenMP threads, accumulating over blocks of KB
+ *    bytes of k so that the packed rows and columns of a tile stay in cache.
+ * ===========================================================================
+ */
+
+namespace
+{
+    constexpr size_t KP = 64; // Padding of k, the width of the widest kernel
+    constexpr size_t KB = 1024; // Block size in k
+    constexpr size_t MB = 64; // Rows of a tile
+    constexpr size_t NB = 64; // Columns of a tile, a multiple of 4
+
+    // Tiles of products with fewer multiplications than this are computed by the calling thread
+    constexpr size_t parallel_threshold = size_t(1) << 24;
+
+    // A kernel adds the dot products of the n bytes of a with the n bytes of each of the 4
+    // columns b, b + ldb, b + 2 * ldb and b + 3 * ldb to sum[0..3]. n is a multiple of KP.
+    using kernel_t
+        = void (*)(const int8_t* a, const int8_t* b, size_t ldb, size_t n, uint32_t* sum);
+
+    void dot4_scalar(const int8_t* a, const int8_t* b, size_t ldb, size_t n, uint32_t* sum)
+    {
+        for(size_t c = 0; c < 4; ++c)
+        {
+            uint32_t s = 0;
+            for(size_t p = 0; p < n; ++p)
+                s += uint32_t(int32_t(a[p]) * b[c * ldb + p]);
+            sum[c] += s;
+        }
+    }
+
+#ifdef CBLAS_GEMM_INT8_X86
+    // Horizontal sum of 8 32-bit lanes
+    __attribute__((target("avx2"))) uint32_t reduce_avx2(__m256i v)
+    {
+        __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        s         = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4e));
+        s         = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xb1));
+        return uint32_t(_mm_cvtsi128_si32(s));
+    }
+
+    // Load 16 bytes, sign-extended to 16 bits
+    __attribute__((target("avx2"))) inline __m256i load_avx2(const int8_t* x)
+    {
+        return _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)x));
+    }
+
+    // Sign-extend to 16 bits and multiply-add pairs of products into 32-bit lanes. The
+    // accumulators are separate variables so that they are kept in registers.
+    __attribute__((target("avx2"))) void
+        dot4_avx2(const int8_t* a, const int8_t* b, size_t ldb, size_t n, uint32_t* sum)
+    {
+        const int8_t *b0 = b, *b1 = b0 + ldb, *b2 = b1 + ldb, *b3 = b2 + ldb;
+
+        __m256i acc0 = _mm256_setzero_si256(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        for(size_t p = 0; p < n; p += 16)
+        {
+            __m256i va = load_avx2(a + p);
+            acc0       = _mm256_add_epi32(acc0, _mm256_madd_epi16(va, load_avx2(b0 + p)));
+            acc1       = _mm256_add_epi32(acc1, _mm256_madd_epi16(va, load_avx2(b1 + p)));
+            acc2       = _mm256_add_epi32(acc2, _mm256_madd_epi16(va, load_avx2(b2 + p)));
+            acc3       = _mm256_add_epi32(acc3, _mm256_madd_epi16(va, load_avx2(b3 + p)));
+        }
+        sum[0] += reduce_avx2(acc0);
+        sum[1] += reduce_avx2(acc1);
+        sum[2] += reduce_avx2(acc2);
+        sum[3] += reduce_avx2(acc3);
+    }
+
+    // Load 32 bytes, sign-extended to 16 bits
+    __attribute__((target("avx512f,avx512bw"))) inline __m512i load_avx512(const int8_t* x)
+    {
+        return _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i*)x));
+    }
+
+    __attribute__((target("avx512f,avx512bw"))) void
+        dot4_avx512(const int8_t* a, const int8_t* b, size_t ldb, size_t n, uint32_t* sum)
+    {
+        const int8_t *b0 = b, *b1 = b0 + ldb, *b2 = b1 + ldb, *b3 = b2 + ldb;
+
+        __m512i acc0 = _mm512_setzero_si512(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        for(size_t p = 0; p < n; p += 32)
+        {
+            __m512i va = load_avx512(a + p);
+            acc0       = _mm512_add_epi32(acc0, _mm512_madd_epi16(va, load_avx512(b0 + p)));
+            acc1       = _mm512_add_epi32(acc1, _mm512_madd_epi16(va, load_avx512(b1 + p)));
+            acc2       = _mm512_add_epi32(acc2, _mm512_madd_epi16(va, load_avx512(b2 + p)));
+            acc3       = _mm512_add_epi32(acc3, _mm512_madd_epi16(va, load_avx512(b3 + p)));
+        }
+        sum[0] += uint32_t(_mm512_reduce_add_epi32(acc0));
+        sum[1] += uint32_t(_mm512_reduce_add_epi32(acc1));
+        sum[2] += uint32_t(_mm512_reduce_add_epi32(acc2));
+        sum[3] += uint32_t(_mm512_reduce_add_epi32(acc3));
+    }
+
+    // Load 64 bytes, biased by 128 to make them unsigned
+    __attribute__((target("avx512f,avx512bw"))) inline __m512i load_biased_avx512(const int8_t* x)
+    {
+        return _mm512_xor_si512(_mm512_loadu_si512(x), _mm512_set1_epi8(-128));
+    }
+
+    // vpdpbusd multiplies unsigned by signed bytes, so b is biased by 128 to make it
+    // unsigned, and 128 times the sum of a, computed with the same instruction, is subtracted
+    __attribute__((target("avx512f,avx512bw,avx512vnni"))) void
+        dot4_avx512_vnni(const int8_t* a, const int8_t* b, size_t ldb, size_t n, uint32_t* sum)
+    {
+        const int8_t *b0 = b, *b1 = b0 + ldb, *b2 = b1 + ldb, *b3 = b2 + ldb;
+        const __m512i ones = _mm512_set1_epi8(1);
+
+        __m512i acc0 = _mm512_setzero_si512(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        __m512i asum = acc0;
+        for(size_t p = 0; p < n; p += 64)
+        {
+            __m512i va = _mm512_loadu_si512(a + p);
+            asum       = _mm512_dpbusd_epi32(asum, ones, va);
+            acc0       = _mm512_dpbusd_epi32(acc0, load_biased_avx512(b0 + p), va);
+            acc1       = _mm512_dpbusd_epi32(acc1, load_biased_avx512(b1 + p), va);
+            acc2       = _mm512_dpbusd_epi32(acc2, load_biased_avx512(b2 + p), va);
+            acc3       = _mm512_dpbusd_epi32(acc3, load_biased_avx512(b3 + p), va);
+        }
+
+        uint32_t correction = uint32_t(_mm512_reduce_add_epi32(asum)) << 7;
+        sum[0] += uint32_t(_mm512_reduce_add_epi32(acc0)) - correction;
+        sum[1] += uint32_t(_mm512_reduce_add_epi32(acc1)) - correction;
+        sum[2] += uint32_t(_mm512_reduce_add_epi32(acc2)) - correction;
+        sum[3] += uint32_t(_mm512_reduce_add_epi32(acc3)) - correction;
+    }
+#endif
+
+    // Kernel for the instructions supported by the CPU
+    kernel_t dot4_kernel()
+    {
+        static const kernel_t kernel = [] {
+#ifdef CBLAS_GEMM_INT8_X86
+            __builtin_cpu_init();
+            if(__builtin_cpu_supports("avx512vnni") && __builtin_cpu_supports("avx512bw"))
+                return dot4_avx512_vnni;
+            if(__builtin_cpu_supports("avx512bw"))
+                return dot4_avx512;
+            if(__builtin_cpu_supports("avx2"))
+                return dot4_avx2;
+#endif
+            return dot4_scalar;
+        }();
+        return kernel;
+    }
+
+    // Pack the rows rows of op(X), where X has leading dimension ldx, into consecutive
+    // vectors of kp bytes, contiguous in k and zero-padded. op(X)(r, p) is X[r + p * ldx]
+    // if trans is false, and X[p + r * ldx] if it is true.
+    void pack(bool          trans,
+              size_t        rows,
+              size_t        k,
+              const int8_t* X,
+              size_t        ldx,
+              int8_t*       packed,
+              size_t        kp,
+              bool          parallel)
+    {
+        if(trans)
+        {
+#pragma omp parallel for if(parallel)
+            for(size_t r = 0; r < rows; ++r)
+                std::copy(X + r * ldx, X + r * ldx + k, packed + r * kp);
+        }
+        else
+        {
+            // Transpose in blocks of rows, reading each column of X contiguously
+            constexpr size_t R = 64;
+#pragma omp parallel for if(parallel)
+            for(size_t r0 = 0; r0 < rows; r0 += R)
+            {
+                size_t r1 = std::min(rows, r0 + R);
+                for(size_t p = 0; p < k; ++p)
+                    for(size_t r = r0; r < r1; ++r)
+                        packed[r * kp + p] = X[r + p * ldx];
+            }
+        }
+    }
+} // namespace
+
+template <>
+void cblas_gemm<int8_t, int32_t, int32_t>(rocblas_operation transA,
+                                          rocblas_operation transB,
+                                          rocblas_int       m,
+                                          rocblas_int       n,
+                                          rocblas_int       k,
+                                          int32_t           alpha,
+                                          const int8_t*     A,
+                                          rocblas_int       lda,
+                                          const int8_t*     B,
+                                          rocblas_int       ldb,
+                                          int32_t           beta,
+                                          int32_t*          C,
+                                          rocblas_int       ldc,
+                                          bool              alt)
+{
+    if(m <= 0 || n <= 0)
+        return;
+
+    size_t rows = m;
+    size_t cols = n;
+    size_t kp   = k > 0 ? (size_t(k) - 1) / KP * KP + KP : 0;
+
+    // C = beta * C when there is no product. C is not read when beta is 0.
+    auto scale = [&](size_t i, size_t j, uint32_t product) {
+        int32_t& c = C[i + j * size_t(ldc)];
+        uint32_t r = uint32_t(alpha) * product;
+        if(beta)
+            r += uint32_t(beta) * uint32_t(c);
+        c = int32_t(r);
+    };
+
+    if(!kp || !alpha)
+    {
+        for(size_t j = 0; j < cols; ++j)
+            for(size_t i = 0; i < rows; ++i)
+                scale(i, j, 0);
+        return;
+    }
+
+    bool parallel = rows * cols * kp >= parallel_threshold;
+
+    // Packed rows of op(A), and columns of op(B), padded with zero columns to a multiple of 4
+    size_t              cols_padded = (cols + 3) / 4 * 4;
+    host_vector<int8_t> A_packed(rows * kp), B_packed(cols_padded * kp);
+    int8_t*             Ap = A_packed.data();
+    int8_t*             Bp = B_packed.data();
+    pack(transA != rocblas_operation_none, rows, k, A, lda, Ap, kp, parallel);
+    pack(transB == rocblas_operation_none, cols, k, B, ldb, Bp, kp, parallel);
+
+    kernel_t kernel = dot4_kernel();
+
+    size_t row_tiles = (rows - 1) / MB + 1;
+    size_t col_tiles = (cols - 1) / NB + 1;
+
+#pragma omp parallel for schedule(dynamic) if(parallel)
+    for(size_t t = 0; t < row_tiles * col_tiles; ++t)
+    {
+        size_t i0 = t % row_tiles * MB, i1 = std::min(rows, i0 + MB);
+        size_t j0 = t / row_tiles * NB, j1 = std::min(cols_padded, j0 + NB);
+
+        uint32_t sum[MB * NB] = {};
+        for(size_t p0 = 0; p0 < kp; p0 += KB)
+        {
+            size_t len = std::min(KB, kp - p0);
+            for(size_t j = j0; j < j1; j += 4)
+                for(size_t i = i0; i < i1; ++i)
+                    kernel(Ap + i * kp + p0,
+                           Bp + j * kp + p0,
+                           kp,
+                           len,
+                           sum + (i - i0) * NB + (j - j0));
+        }
+
+        for(size_t j = j0; j < std::min(cols, j1); ++j)
+            for(size_t i = i0; i < i1; ++i)
+                scale(i, j, sum[(i - i0) * NB + (j - j0)]);
+    }
+}
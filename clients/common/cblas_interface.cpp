@@ -2,6 +2,7 @@
  * Copyright 2018-2022 Advanced Micro Devices, Inc.
  * ************************************************************************/
 #include "cblas_interface.hpp"
+#include "cblas_convert.hpp"
 #include "rocblas_vector.hpp"
 #include "utility.hpp"
 #include <bitset>
@@ -24,8 +25,7 @@ void cblas_nrm2<rocblas_half>(rocblas_int         n,
 
     host_vector<float> x_float(n * incx);
 
-    for(size_t i = 0; i < n; i++)
-        x_float[i * incx] = x[i * incx];
+    cblas_convert(n, x, incx, x_float.data(), incx);
 
     *result = rocblas_half(cblas_snrm2(n, x_float, incx));
 }
@@ -48,19 +48,13 @@ void cblas_axpy<rocblas_half>(rocblas_int   n,
         size_y = 1;
     host_vector<float> x_float(size_x), y_float(size_y);
 
-    for(size_t i = 0; i < n; i++)
-    {
-        x_float[i * abs_incx] = x[i * abs_incx];
-        y_float[i * abs_incy] = y[i * abs_incy];
-    }
+    cblas_convert(n, x, abs_incx, x_float.data(), abs_incx);
+    cblas_convert(n, y, abs_incy, y_float.data(), abs_incy);
 
     cblas_saxpy(n, alpha, x_float, incx, y_float, incy);
 
-    for(size_t i = 0; i < n; i++)
-    {
-        x[i * abs_incx] = rocblas_half(x_float[i * abs_incx]);
-        y[i * abs_incy] = rocblas_half(y_float[i * abs_incy]);
-    }
+    cblas_convert(n, x_float.data(), abs_incx, x, abs_incx);
+    cblas_convert(n, y_float.data(), abs_incy, y, abs_incy);
 }
 
 /**
@@ -147,11 +141,8 @@ void cblas_dot<rocblas_half>(rocblas_int         n,
     host_vector<float> x_float(size_x);
     host_vector<float> y_float(size_y);
 
-    for(size_t i = 0; i < n; i++)
-    {
-        x_float[i * abs_incx] = x[i * abs_incx];
-        y_float[i * abs_incy] = y[i * abs_incy];
-    }
+    cblas_convert(n, x, abs_incx, x_float.data(), abs_incx);
+    cblas_convert(n, y, abs_incy, y_float.data(), abs_incy);
 
     *result = rocblas_half(cblas_sdot(n, x_float, incx, y_float, incy));
 }
@@ -175,11 +166,8 @@ void cblas_dot<rocblas_bfloat16>(rocblas_int             n,
     host_vector<float> x_float(size_x);
     host_vector<float> y_float(size_y);
 
-    for(size_t i = 0; i < n; i++)
-    {
-        x_float[i * abs_incx] = float(x[i * abs_incx]);
-        y_float[i * abs_incy] = float(y[i * abs_incy]);
-    }
+    cblas_convert(n, x, abs_incx, x_float.data(), abs_incx);
+    cblas_convert(n, y, abs_incy, y_float.data(), abs_incy);
 
     *result = rocblas_bfloat16(cblas_sdot(n, x_float, incx, y_float, incy));
 }
@@ -249,22 +237,16 @@ void cblas_rot<rocblas_half>(rocblas_int         n,
     host_vector<float> x_float(size_x);
     host_vector<float> y_float(size_y);
 
-    for(size_t i = 0; i < n; i++)
-    {
-        x_float[i * abs_incx] = x[i * abs_incx];
-        y_float[i * abs_incy] = y[i * abs_incy];
-    }
+    cblas_convert(n, x, abs_incx, x_float.data(), abs_incx);
+    cblas_convert(n, y, abs_incy, y_float.data(), abs_incy);
 
     const float c_float = float(*c);
     const float s_float = float(*s);
 
     cblas_srot(n, x_float, incx, y_float, incy, c_float, s_float);
 
-    for(size_t i = 0; i < n; i++)
-    {
-        x[i * abs_incx] = x_float[i * abs_incx];
-        y[i * abs_incy] = y_float[i * abs_incy];
-    }
+    cblas_convert(n, x_float.data(), abs_incx, x, abs_incx);
+    cblas_convert(n, y_float.data(), abs_incy, y, abs_incy);
 }
 
 template <>
@@ -287,22 +269,16 @@ void cblas_rot<rocblas_bfloat16>(rocblas_int             n,
     host_vector<float> x_float(size_x);
     host_vector<float> y_float(size_y);
 
-    for(size_t i = 0; i < n; i++)
-    {
-        x_float[i * abs_incx] = x[i * abs_incx];
-        y_float[i * abs_incy] = y[i * abs_incy];
-    }
+    cblas_convert(n, x, abs_incx, x_float.data(), abs_incx);
+    cblas_convert(n, y, abs_incy, y_float.data(), abs_incy);
 
     const float c_float = rocblas_bfloat16(*c);
     const float s_float = rocblas_bfloat16(*s);
 
     cblas_srot(n, x_float, incx, y_float, incy, c_float, s_float);
 
-    for(size_t i = 0; i < n; i++)
-    {
-        x[i * abs_incx] = rocblas_bfloat16(x_float[i * abs_incx]);
-        y[i * abs_incy] = rocblas_bfloat16(y_float[i * abs_incy]);
-    }
+    cblas_convert(n, x_float.data(), abs_incx, x, abs_incx);
+    cblas_convert(n, y_float.data(), abs_incy, y, abs_incy);
 }
 
 /*
@@ -459,15 +435,18 @@ void cblas_gemm<rocblas_bfloat16, float, float>(rocblas_operation       transA,
     // cblas does not support rocblas_bfloat16, so convert to higher precision float
     // This will give more precise result which is acceptable for testing
 
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
+    rocblas_int rowsA = transA == rocblas_operation_none ? m : k;
+    rocblas_int colsA = transA == rocblas_operation_none ? k : m;
+    rocblas_int rowsB = transB == rocblas_operation_none ? k : n;
+    rocblas_int colsB = transB == rocblas_operation_none ? n : k;
+
+    size_t sizeA = colsA * size_t(lda);
+    size_t sizeB = colsB * size_t(ldb);
 
     host_vector<float> A_float(sizeA), B_float(sizeB);
 
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = static_cast<float>(A[i]);
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = static_cast<float>(B[i]);
+    cblas_convert(rowsA, colsA, A, lda, A_float.data(), lda);
+    cblas_convert(rowsB, colsB, B, ldb, B_float.data(), ldb);
 
     // just directly cast, since transA, transB are integers in the enum
     // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
@@ -506,18 +485,20 @@ void cblas_gemm<rocblas_bfloat16, rocblas_bfloat16, float>(rocblas_operation
     // cblas does not support rocblas_bfloat16, so convert to higher precision float
     // This will give more precise result which is acceptable for testing
 
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
+    rocblas_int rowsA = transA == rocblas_operation_none ? m : k;
+    rocblas_int colsA = transA == rocblas_operation_none ? k : m;
+    rocblas_int rowsB = transB == rocblas_operation_none ? k : n;
+    rocblas_int colsB = transB == rocblas_operation_none ? n : k;
+
+    size_t sizeA = colsA * size_t(lda);
+    size_t sizeB = colsB * size_t(ldb);
     size_t sizeC = n * size_t(ldc);
 
     host_vector<float> A_float(sizeA), B_float(sizeB), C_float(sizeC);
 
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = static_cast<float>(A[i]);
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = static_cast<float>(B[i]);
-    for(size_t i = 0; i < sizeC; i++)
-        C_float[i] = static_cast<float>(C[i]);
+    cblas_convert(rowsA, colsA, A, lda, A_float.data(), lda);
+    cblas_convert(rowsB, colsB, B, ldb, B_float.data(), ldb);
+    cblas_convert(m, n, C, ldc, C_float.data(), ldc);
 
     // just directly cast, since transA, transB are integers in the enum
     // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
@@ -536,8 +517,7 @@ void cblas_gemm<rocblas_bfloat16, rocblas_bfloat16, float>(rocblas_operation
                 C_float,
                 ldc);
 
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = static_cast<rocblas_bfloat16>(C_float[i]);
+    cblas_convert(m, n, C_float.data(), ldc, C, ldc);
 }
 
 template <>
@@ -559,15 +539,18 @@ void cblas_gemm<rocblas_half, float, float>(rocblas_operation   transA,
     // cblas does not support rocblas_half, so convert to higher precision float
     // This will give more precise result which is acceptable for testing
 
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
+    rocblas_int rowsA = transA == rocblas_operation_none ? m : k;
+    rocblas_int colsA = transA == rocblas_operation_none ? k : m;
+    rocblas_int rowsB = transB == rocblas_operation_none ? k : n;
+    rocblas_int colsB = transB == rocblas_operation_none ? n : k;
+
+    size_t sizeA = colsA * size_t(lda);
+    size_t sizeB = colsB * size_t(ldb);
 
     host_vector<float> A_float(sizeA), B_float(sizeB);
 
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = A[i];
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = B[i];
+    cblas_convert(rowsA, colsA, A, lda, A_float.data(), lda);
+    cblas_convert(rowsB, colsB, B, ldb, B_float.data(), ldb);
 
     // just directly cast, since transA, transB are integers in the enum
     // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
@@ -606,30 +589,21 @@ void cblas_gemm<rocblas_half, rocblas_half, float>(rocblas_operation   transA,
     // cblas does not support rocblas_half, so convert to higher precision float
     // This will give more precise result which is acceptable for testing
 
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
+    rocblas_int rowsA = transA == rocblas_operation_none ? m : k;
+    rocblas_int colsA = transA == rocblas_operation_none ? k : m;
+    rocblas_int rowsB = transB == rocblas_operation_none ? k : n;
+    rocblas_int colsB = transB == rocblas_operation_none ? n : k;
+
+    size_t sizeA = colsA * size_t(lda);
+    size_t sizeB = colsB * size_t(ldb);
     size_t sizeC = n * size_t(ldc);
 
     host_vector<float> A_float(sizeA), B_float(sizeB), C_float(sizeC);
 
-    if(alt)
-    {
-        for(size_t i = 0; i < sizeA; i++)
-            A_float[i] = rocblas_bfloat16(float(A[i]), rocblas_bfloat16::truncate_t::truncate);
-        for(size_t i = 0; i < sizeB; i++)
-            B_float[i] = rocblas_bfloat16(float(B[i]), rocblas_bfloat16::truncate_t::truncate);
-        for(size_t i = 0; i < sizeC; i++)
-            C_float[i] = rocblas_bfloat16(float(C[i]), rocblas_bfloat16::truncate_t::truncate);
-    }
-    else
-    {
-        for(size_t i = 0; i < sizeA; i++)
-            A_float[i] = A[i];
-        for(size_t i = 0; i < sizeB; i++)
-            B_float[i] = B[i];
-        for(size_t i = 0; i < sizeC; i++)
-            C_float[i] = C[i];
-    }
+    // With alt, the inputs are truncated to bfloat16 precision
+    cblas_convert(rowsA, colsA, A, lda, A_float.data(), lda, alt);
+    cblas_convert(rowsB, colsB, B, ldb, B_float.data(), ldb, alt);
+    cblas_convert(m, n, C, ldc, C_float.data(), ldc, alt);
 
     // just directly cast, since transA, transB are integers in the enum
     // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
@@ -648,8 +622,7 @@ void cblas_gemm<rocblas_half, rocblas_half, float>(rocblas_operation   transA,
                 C_float,
                 ldc);
 
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = rocblas_half(C_float[i]);
+    cblas_convert(m, n, C_float.data(), ldc, C, ldc);
 }
 
 template <>
@@ -673,18 +646,20 @@ void cblas_gemm<rocblas_half, rocblas_half, rocblas_half>(rocblas_operation   tr
     float alpha_float = alpha;
     float beta_float  = beta;
 
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
+    rocblas_int rowsA = transA == rocblas_operation_none ? m : k;
+    rocblas_int colsA = transA == rocblas_operation_none ? k : m;
+    rocblas_int rowsB = transB == rocblas_operation_none ? k : n;
+    rocblas_int colsB = transB == rocblas_operation_none ? n : k;
+
+    size_t sizeA = colsA * size_t(lda);
+    size_t sizeB = colsB * size_t(ldb);
     size_t sizeC = n * size_t(ldc);
 
     host_vector<float> A_float(sizeA), B_float(sizeB), C_float(sizeC);
 
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = A[i];
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = B[i];
-    for(size_t i = 0; i < sizeC; i++)
-        C_float[i] = C[i];
+    cblas_convert(rowsA, colsA, A, lda, A_float.data(), lda);
+    cblas_convert(rowsB, colsB, B, ldb, B_float.data(), ldb);
+    cblas_convert(m, n, C, ldc, C_float.data(), ldc);
 
     // just directly cast, since transA, transB are integers in the enum
     // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
@@ -703,65 +678,7 @@ void cblas_gemm<rocblas_half, rocblas_half, rocblas_half>(rocblas_operation   tr
                 C_float,
                 ldc);
 
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = rocblas_half(C_float[i]);
-}
-
-template <>
-void cblas_gemm<int8_t, int32_t, int32_t>(rocblas_operation transA,
-                                          rocblas_operation transB,
-                                          rocblas_int       m,
-                                          rocblas_int       n,
-                                          rocblas_int       k,
-                                          int32_t           alpha,
-                                          const int8_t*     A,
-                                          rocblas_int       lda,
-                                          const int8_t*     B,
-                                          rocblas_int       ldb,
-                                          int32_t           beta,
-                                          int32_t*          C,
-                                          rocblas_int       ldc,
-                                          bool              alt)
-{
-    // cblas does not support int8_t input / int32_t output, however non-overflowing
-    // 32-bit integer operations can be represented accurately with double-precision
-    // floats, so convert to doubles and downcast result down to int32_t.
-    // NOTE: This will not properly account for 32-bit integer overflow, however
-    //       the result should be acceptable for testing.
-
-    size_t const sizeA = ((transA == rocblas_operation_none) ? k : m) * size_t(lda);
-    size_t const sizeB = ((transB == rocblas_operation_none) ? n : k) * size_t(ldb);
-    size_t const sizeC = n * size_t(ldc);
-
-    host_vector<double> A_double(sizeA);
-    host_vector<double> B_double(sizeB);
-    host_vector<double> C_double(sizeC);
-
-    for(size_t i = 0; i < sizeA; i++)
-        A_double[i] = static_cast<double>(A[i]);
-    for(size_t i = 0; i < sizeB; i++)
-        B_double[i] = static_cast<double>(B[i]);
-    for(size_t i = 0; i < sizeC; i++)
-        C_double[i] = static_cast<double>(C[i]);
-
-    // just directly cast, since transA, transB are integers in the enum
-    cblas_dgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha,
-                A_double,
-                lda,
-                B_double,
-                ldb,
-                beta,
-                C_double,
-                ldc);
-
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = static_cast<int32_t>(C_double[i]);
+    cblas_convert(m, n, C_float.data(), ldc, C, ldc);
 }
 
 template <typename T, typename U>
@@ -9,23 +9,35 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/sysinfo.h>
 #endif
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <stdlib.h>
 
 #include "host_alloc.hpp"
 #include "rocblas_test.hpp"
 
+// Allocations smaller than this are not checked against the free memory
+constexpr size_t host_mem_check_threshold = 100 * 1024 * 1024; // 100 MB
+
+// How long a reading of the free memory is reused
+constexpr auto host_mem_cache_time = std::chrono::milliseconds(250);
+
 //!
-//! @brief Memory free helper.  Returns kB or -1 if unknown.
+//! @brief Reads the free host memory from the OS.  Returns bytes or -1 if unknown.
 //!
-ptrdiff_t host_bytes_available()
+static ptrdiff_t host_bytes_free()
 {
 #ifdef WIN32
 
     MEMORYSTATUSEX status;
     status.dwLength = sizeof(status);
-    GlobalMemoryStatusEx(&status);
+    if(!GlobalMemoryStatusEx(&status))
+        return -1;
     return (ptrdiff_t)status.ullAvailPhys;
 
 #else
@@ -35,85 +47,192 @@ ptrdiff_t host_bytes_available()
 
     ptrdiff_t n_bytes = -1; // unknown
 
-    FILE* fp = popen("cat /proc/meminfo", "r");
-    if(fp == NULL)
+    // Read the file directly, rather than through a shell
+    FILE* fp = fopen("/proc/meminfo", "r");
+    if(fp)
     {
-        return n_bytes;
+        while(fgets(buf, BUF_MAX, fp) != NULL)
+        {
+            const char cMemTok[] = "MemFree"; // Can consider MemAvailable if too many SKIPS occur
+            if(!strncmp(buf, cMemTok, sizeof(cMemTok) - 1))
+            {
+                if(sscanf(buf, "%*s %td", &n_bytes) == 1) // kB assumed as 3rd column and ignored
+                    n_bytes *= 1024;
+                break;
+            }
+        }
+        fclose(fp);
     }
 
-    while(fgets(buf, BUF_MAX, fp) != NULL)
+    // sysinfo reports the same free memory, when /proc is not mounted
+    struct sysinfo info;
+    if(n_bytes < 0 && !sysinfo(&info))
+        n_bytes = (ptrdiff_t)info.freeram * info.mem_unit;
+
+    return n_bytes;
+
+#endif
+}
+
+//!
+//! @brief Governs the large host allocations of concurrent test threads.
+//!
+//! The live large allocations of all threads are counted against a budget, which is the free
+//! memory plus the allocations which were live when it was read. The free memory is read again
+//! at most once per host_mem_cache_time, so the budget follows the memory used outside the
+//! clients. An allocation which does not fit in the budget waits until other threads free theirs,
+//! and fails only if the calling thread holds large allocations itself, or if it does not fit when
+//! no large allocations are live.
+//!
+class host_memory_governor
+{
+    std::mutex              m_mutex;
+    std::condition_variable m_freed;
+
+    ptrdiff_t                             m_free = -1;
+    std::chrono::steady_clock::time_point m_read_time;
+    bool                                  m_read = false;
+
+    size_t m_allocated         = 0;
+    size_t m_allocated_at_read = 0;
+
+    // Read the free memory from the OS only if the cached value is too old
+    void refresh(std::unique_lock<std::mutex>&)
     {
-        const char cMemTok[] = "MemFree"; // Can consider MemAvailable if too many SKIPS occur
-        if(!strncmp(buf, cMemTok, sizeof(cMemTok) - 1))
+        auto now = std::chrono::steady_clock::now();
+        if(!m_read || now - m_read_time >= host_mem_cache_time)
         {
-            sscanf(buf, "%*s %td", &n_bytes); // kB assumed as 3rd column and ignored
-            n_bytes *= 1024;
-            break;
+            m_free              = host_bytes_free();
+            m_allocated_at_read = m_allocated;
+            m_read_time         = now;
+            m_read              = true;
         }
     }
 
-    int status = pclose(fp);
-    if(status == -1)
+public:
+    ptrdiff_t bytes_available()
     {
-        return -1;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        refresh(lock);
+        return m_free;
     }
-    else
+
+    //! Count an allocation of n_bytes, waiting for other allocations to be freed if wait is true.
+    //! Returns false if the allocation does not fit.
+    bool allocate(size_t n_bytes, bool wait)
     {
-        return n_bytes;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while(true)
+        {
+            refresh(lock);
+
+            // When the free memory is unknown, everything fits
+            if(m_free < 0 || m_allocated + n_bytes <= size_t(m_free) + m_allocated_at_read)
+            {
+                m_allocated += n_bytes;
+                return true;
+            }
+
+            if(!m_allocated || !wait)
+                return false;
+
+            // Wake up to read the free memory again, in case memory is freed outside the clients
+            m_freed.wait_for(lock, host_mem_cache_time);
+        }
     }
 
-#endif
+    void free(size_t n_bytes)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_allocated -= n_bytes;
+        }
+        m_freed.notify_all();
+    }
+};
+
+static host_memory_governor& host_governor()
+{
+    static host_memory_governor governor;
+    return governor;
 }
 
-inline bool host_mem_safe(size_t n_bytes)
+// Bytes of the live large allocations made by the calling thread
+static thread_local size_t t_host_allocated = 0;
+
+static bool host_mem_check_disabled()
 {
 #if defined(ROCBLAS_BENCH)
     return true; // roll out to rocblas-bench when CI does perf testing
 #else
     static auto* no_alloc_check = getenv("ROCBLAS_CLIENT_NO_ALLOC_CHECK");
-    if(no_alloc_check)
+    return no_alloc_check != nullptr;
+#endif
+}
+
+// Whether an allocation of n_bytes is counted by the governor
+static bool host_mem_counted(size_t n_bytes)
+{
+    return n_bytes > host_mem_check_threshold && !host_mem_check_disabled();
+}
+
+//!
+//! @brief Memory free helper.  Returns bytes or -1 if unknown.
+//!
+ptrdiff_t host_bytes_available()
+{
+    return host_governor().bytes_available();
+}
+
+static bool host_mem_acquire(size_t n_bytes)
+{
+    if(!host_mem_counted(n_bytes))
+        return true;
+
+    // A thread which holds large allocations does not wait, so that two threads cannot each wait
+    // for the other's allocations to be freed
+    if(host_governor().allocate(n_bytes, !t_host_allocated))
     {
+        t_host_allocated += n_bytes;
         return true;
     }
 
-    constexpr size_t threshold = 100 * 1024 * 1024; // 100 MB
-    if(n_bytes > threshold)
-    {
-        ptrdiff_t avail_bytes = host_bytes_available(); // negative if unknown
-        if(avail_bytes >= 0 && n_bytes > avail_bytes)
-        {
-            rocblas_cerr << "Warning: skipped allocating " << n_bytes << " bytes ("
-                         << (n_bytes >> 30) << " GB) as more than free memory ("
-                         << (avail_bytes >> 30) << " GB)" << std::endl;
+    rocblas_cerr << "Warning: skipped allocating " << n_bytes << " bytes (" << (n_bytes >> 30)
+                 << " GB) as more than free memory (" << (host_bytes_available() >> 30) << " GB)"
+                 << std::endl;
 
-            // we don't try if it looks to push load into swap
-            return false;
-        }
-    }
-    return true;
-#endif
+    // we don't try if it looks to push load into swap
+    return false;
+}
+
+static void host_mem_release(size_t n_bytes)
+{
+    if(!host_mem_counted(n_bytes))
+        return;
+
+    // Memory allocated by another thread is not counted for the calling thread
+    t_host_allocated -= std::min(t_host_allocated, n_bytes);
+    host_governor().free(n_bytes);
 }
 
 void* host_malloc(size_t size)
 {
-    if(host_mem_safe(size))
+    if(host_mem_acquire(size))
     {
         void* ptr = malloc(size);
-
-        static int value = -1;
-
-        static auto once = false;
-        if(!once)
+        if(!ptr)
         {
-            auto* alloc_byte_str = getenv("ROCBLAS_CLIENT_ALLOC_FILL_HEX_BYTE");
-            if(alloc_byte_str)
-            {
-                value = strtol(alloc_byte_str, nullptr, 16); // hex
-            }
-            once = true;
+            host_mem_release(size);
+            return nullptr;
         }
 
-        if(value != -1 && ptr)
+        // Initialized once, safely for the threads of batched reference computations
+        static const int value = [] {
+            auto* alloc_byte_str = getenv("ROCBLAS_CLIENT_ALLOC_FILL_HEX_BYTE");
+            return alloc_byte_str ? int(strtol(alloc_byte_str, nullptr, 16)) : -1; // hex
+        }();
+
+        if(value != -1)
             memset(ptr, value, size);
 
         return ptr;
@@ -124,8 +243,20 @@ void* host_malloc(size_t size)
 
 void* host_calloc(size_t nmemb, size_t size)
 {
-    if(host_mem_safe(nmemb * size))
-        return calloc(nmemb, size);
-    else
+    if(!host_mem_acquire(nmemb * size))
         return nullptr;
+
+    void* ptr = calloc(nmemb, size);
+    if(!ptr)
+        host_mem_release(nmemb * size);
+    return ptr;
+}
+
+void host_free(void* ptr, size_t size)
+{
+    if(ptr)
+    {
+        free(ptr);
+        host_mem_release(size);
+    }
 }
@@ -52,6 +52,7 @@ void Arguments::init()
 
     incx = 0;
     incy = 0;
+    incz = 0;
     incd = 0;
     incb = 0;
 
@@ -75,6 +76,10 @@ void Arguments::init()
 
     atomics_mode = rocblas_atomics_allowed;
 
+    reduction_mode = rocblas_reduction_mode_default;
+
+    nrm2_mode = rocblas_nrm2_mode_default;
+
     // memory padding for testing write out of bounds
     pad = 4096;
 
@@ -191,8 +196,8 @@ static void validation_error [[noreturn]] (const char* name)
     rocblas_abort();
 }
 
-// rocblas_gentest.py is expected to conform to this format.
-// rocblas_gentest.py uses rocblas_common.yaml to generate this format.
+// rocblas_gentest.py and rocblas_gentest() are expected to conform to this format.
+// They use rocblas_common.yaml to generate this format.
 void Arguments::validate(std::istream& ifs)
 {
     char      header[8]{}, trailer[8]{};
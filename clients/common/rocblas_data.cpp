@@ -0,0 +1,127 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "utility.hpp"
+#include <cerrno>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    // read-only stream over the signature at the start of the data, for Arguments::validate()
+    class signature_stream : private std::streambuf, public std::istream
+    {
+    public:
+        signature_stream(const char* data, size_t size)
+            : std::istream(static_cast<std::streambuf*>(this))
+        {
+            char* begin = const_cast<char*>(data);
+            setg(begin, begin, begin + size);
+        }
+    };
+
+    // size of the signature which precedes the records
+    constexpr size_t signature_size = 8 + sizeof(Arguments) + 8;
+
+    [[noreturn]] void cannot_open(const std::string& file)
+    {
+        rocblas_cerr << "Cannot open " << file << ": " << strerror(errno) << std::endl;
+        exit(EXIT_FAILURE);
+    }
+}
+
+RocBLAS_TestData::records::~records()
+{
+#ifndef WIN32
+    if(mapping)
+        munmap(mapping, mapping_size);
+#endif
+}
+
+const RocBLAS_TestData::records& RocBLAS_TestData::get_records()
+{
+    static records* recs = nullptr;
+    if(recs)
+        return *recs;
+
+    // Allocate the records and register them to be deleted during cleanup
+    recs = test_cleanup::allocate(&recs);
+
+    const char* bytes = data().data();
+    size_t      size  = data().size();
+
+    if(data().empty())
+    {
+        const std::string& file = filename();
+
+#ifndef WIN32
+        // Map regular files, which are only read where the tests use them
+        int fd = open(file.c_str(), O_RDONLY);
+        if(fd < 0)
+            cannot_open(file);
+
+        struct stat st;
+        if(!fstat(fd, &st) && S_ISREG(st.st_mode) && st.st_size > 0)
+        {
+            void* mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(mapping != MAP_FAILED)
+            {
+                recs->mapping      = mapping;
+                recs->mapping_size = st.st_size;
+                bytes              = static_cast<const char*>(mapping);
+                size               = st.st_size;
+            }
+        }
+        close(fd);
+#endif
+
+        // Read other files, such as pipes, into memory
+        if(!recs->mapping)
+        {
+            std::ifstream ifs(file, std::ifstream::in | std::ifstream::binary);
+            if(!ifs)
+                cannot_open(file);
+            std::ostringstream contents;
+            contents << ifs.rdbuf();
+            recs->buffer = contents.str();
+            bytes        = recs->buffer.data();
+            size         = recs->buffer.size();
+        }
+    }
+
+    // Validate the data file format
+    signature_stream signature(bytes, std::min(size, signature_size));
+    Arguments::validate(signature);
+
+    recs->base  = bytes + signature_size;
+    recs->count = size > signature_size ? (size - signature_size) / sizeof(Arguments) : 0;
+
+    // Index the records by function name, as ranges of consecutive records
+    const char*    last = nullptr;
+    record_ranges* ranges = nullptr;
+    for(size_t i = 0; i < recs->count; ++i)
+    {
+        const char* function = recs->base + i * sizeof(Arguments) + offsetof(Arguments, function);
+        if(!last || strncmp(function, last, sizeof(Arguments::function)))
+        {
+            std::string name(function, strnlen(function, sizeof(Arguments::function)));
+            ranges = &recs->functions[name];
+            ranges->emplace_back(i, i);
+            last = function;
+        }
+        ranges->back().second = i + 1;
+    }
+
+    return *recs;
+}
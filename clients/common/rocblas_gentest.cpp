@@ -0,0 +1,1893 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*
+ * Native implementation of rocblas_gentest.py, used by the --yaml option of rocblas-test and
+ * rocblas-bench. It parses the subset of YAML used by the rocBLAS test files: block and flow
+ * collections, plain and quoted scalars, anchors, aliases and merge keys, with the scalar types
+ * resolved as PyYAML resolves them. The tests are then expanded as rocblas_gentest.py expands
+ * them, so that both generate the same records.
+ */
+
+#include "rocblas_gentest.hpp"
+#include "rocblas_arguments.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
+
+#ifdef __cpp_lib_filesystem
+#include <filesystem>
+namespace fs = std::filesystem;
+#else
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#endif
+
+namespace
+{
+    /* ========================================================================================
+     * Values of the YAML documents and test cases, as Python represents them
+     * ======================================================================================== */
+
+    struct gentest_value;
+    using gentest_ptr  = std::shared_ptr<const gentest_value>;
+    using gentest_dict = std::map<std::string, gentest_ptr>;
+
+    struct gentest_value
+    {
+        enum kind_t
+        {
+            null_v,
+            bool_v,
+            int_v,
+            float_v,
+            str_v,
+            list_v,
+            dict_v
+        } kind = null_v;
+
+        bool                     b = false;
+        int64_t                  i = 0;
+        double                   f = 0;
+        std::string              s;
+        std::vector<gentest_ptr> list;
+        gentest_dict             dict;
+
+        bool is_number() const
+        {
+            return kind == bool_v || kind == int_v || kind == float_v;
+        }
+
+        bool is_integer() const
+        {
+            return kind == bool_v || kind == int_v;
+        }
+
+        int64_t as_int() const
+        {
+            return kind == bool_v ? b : i;
+        }
+
+        double as_float() const
+        {
+            return kind == float_v ? f : double(as_int());
+        }
+    };
+
+    gentest_ptr make_int(int64_t i)
+    {
+        auto v  = std::make_shared<gentest_value>();
+        v->kind = gentest_value::int_v;
+        v->i    = i;
+        return v;
+    }
+
+    gentest_ptr make_float(double f)
+    {
+        auto v  = std::make_shared<gentest_value>();
+        v->kind = gentest_value::float_v;
+        v->f    = f;
+        return v;
+    }
+
+    gentest_ptr make_str(std::string s)
+    {
+        auto v  = std::make_shared<gentest_value>();
+        v->kind = gentest_value::str_v;
+        v->s    = std::move(s);
+        return v;
+    }
+
+    // Python's == between values
+    bool operator==(const gentest_value& a, const gentest_value& b)
+    {
+        if(a.is_number() && b.is_number())
+            return a.is_integer() && b.is_integer() ? a.as_int() == b.as_int()
+                                                    : a.as_float() == b.as_float();
+        if(a.kind != b.kind)
+            return false;
+        switch(a.kind)
+        {
+        case gentest_value::null_v:
+            return true;
+        case gentest_value::str_v:
+            return a.s == b.s;
+        case gentest_value::list_v:
+            return std::equal(
+                a.list.begin(),
+                a.list.end(),
+                b.list.begin(),
+                b.list.end(),
+                [](const gentest_ptr& x, const gentest_ptr& y) { return *x == *y; });
+        case gentest_value::dict_v:
+            return std::equal(a.dict.begin(),
+                              a.dict.end(),
+                              b.dict.begin(),
+                              b.dict.end(),
+                              [](const auto& x, const auto& y) {
+                                  return x.first == y.first && *x.second == *y.second;
+                              });
+        default:
+            return false;
+        }
+    }
+
+    // Python's truth value
+    bool truth(const gentest_value& v)
+    {
+        switch(v.kind)
+        {
+        case gentest_value::null_v:
+            return false;
+        case gentest_value::str_v:
+            return !v.s.empty();
+        case gentest_value::list_v:
+            return !v.list.empty();
+        case gentest_value::dict_v:
+            return !v.dict.empty();
+        default:
+            return v.as_float() != 0;
+        }
+    }
+
+    // Print a value for error messages
+    std::ostream& operator<<(std::ostream& os, const gentest_value& v)
+    {
+        switch(v.kind)
+        {
+        case gentest_value::null_v:
+            return os << "None";
+        case gentest_value::bool_v:
+            return os << (v.b ? "True" : "False");
+        case gentest_value::int_v:
+            return os << v.i;
+        case gentest_value::float_v:
+            return os << v.f << (std::isfinite(v.f) && v.f == std::trunc(v.f) ? ".0" : "");
+        case gentest_value::str_v:
+            return os << "'" << v.s << "'";
+        case gentest_value::list_v:
+        {
+            const char* sep = "";
+            os << "[";
+            for(auto& e : v.list)
+                os << sep << *e, sep = ", ";
+            return os << "]";
+        }
+        case gentest_value::dict_v:
+        {
+            const char* sep = "";
+            os << "{";
+            for(auto& e : v.dict)
+                os << sep << "'" << e.first << "': " << *e.second, sep = ", ";
+            return os << "}";
+        }
+        }
+        return os;
+    }
+
+    const char* type_name(const gentest_value& v)
+    {
+        static const char* names[]{"NoneType", "bool", "int", "float", "str", "list", "dict"};
+        return names[v.kind];
+    }
+
+    // Errors which stop the expansion, with their message
+    struct gentest_error : std::runtime_error
+    {
+        using std::runtime_error::runtime_error;
+    };
+
+    /* ========================================================================================
+     * Reading the YAML source, with include: lines replaced by the files they name
+     * ======================================================================================== */
+
+    struct gentest_line
+    {
+        std::string                        text;
+        std::shared_ptr<const std::string> file;
+        size_t                             line_no;
+    };
+
+    // Message pointing to a column of a line of the source
+    std::string mark(const gentest_line& line, size_t col)
+    {
+        std::ostringstream msg;
+        msg << "In file " << *line.file << ", line " << line.line_no << ", column " << col + 1
+            << ":\n"
+            << line.text << "\n"
+            << std::string(col, ' ') << "^\n";
+        return msg.str();
+    }
+
+    void read_yaml_file(const std::string&              path,
+                        const std::vector<std::string>& include_dirs,
+                        std::vector<gentest_line>&      source)
+    {
+        std::ifstream file(path);
+        if(!file)
+            throw gentest_error("Cannot open " + path + ": " + strerror(errno) + "\n");
+
+        auto        name     = std::make_shared<const std::string>(path);
+        std::string file_dir = fs::path(path).parent_path().string();
+        if(file_dir.empty())
+            file_dir = fs::current_path().string();
+
+        std::string text;
+        for(size_t line_no = 1; std::getline(file, text); ++line_no)
+        {
+            if(!text.empty() && text.back() == '\r')
+                text.pop_back();
+
+            // include\s*:\s*([-.\w/]+)
+            size_t pos = 0;
+            if(!text.compare(0, 7, "include"))
+            {
+                pos = text.find_first_not_of(" \t", 7);
+                pos = pos != std::string::npos && text[pos] == ':'
+                          ? text.find_first_not_of(" \t", pos + 1)
+                          : std::string::npos;
+            }
+            size_t end = pos;
+            while(end < text.size()
+                  && (isalnum((unsigned char)text[end]) || strchr("-._/", text[end])))
+                ++end;
+            if(!pos || pos == std::string::npos || end == pos)
+            {
+                source.push_back({std::move(text), name, line_no});
+                continue;
+            }
+
+            std::string include_file = text.substr(pos, end - pos);
+            std::string found;
+            std::string searched = file_dir;
+            if(fs::exists(fs::path(file_dir) / include_file))
+                found = (fs::path(file_dir) / include_file).string();
+            for(auto& dir : include_dirs)
+            {
+                searched += "\n" + dir;
+                if(found.empty() && fs::exists(fs::path(dir) / include_file))
+                    found = (fs::path(dir) / include_file).string();
+            }
+            if(found.empty())
+                throw gentest_error(mark({text, name, line_no}, pos) + "Cannot open "
+                                    + include_file + "\n\nInclude paths:\n" + searched + "\n");
+            read_yaml_file(found, include_dirs, source);
+        }
+    }
+
+    /* ========================================================================================
+     * Parser of one YAML document
+     * ======================================================================================== */
+
+    // Whether s[b, e) is not empty, and all of its characters are in chars
+    bool all_of(const std::string& s, size_t b, size_t e, const char* chars)
+    {
+        for(size_t k = b; k < e; ++k)
+            if(!strchr(chars, s[k]))
+                return false;
+        return b < e;
+    }
+
+    // [-+]?[0-9][0-9_]*(?::[0-5]?[0-9])+ followed by the suffix checked by rest(), from b
+    template <typename REST>
+    bool sexagesimal(const std::string& s, size_t b, bool first_nonzero, REST rest)
+    {
+        size_t k = b;
+        if(k >= s.size() || !isdigit((unsigned char)s[k]) || (first_nonzero && s[k] == '0'))
+            return false;
+        while(k < s.size() && (isdigit((unsigned char)s[k]) || s[k] == '_'))
+            ++k;
+        size_t groups = 0;
+        while(k < s.size() && s[k] == ':')
+        {
+            size_t d = ++k;
+            while(k < s.size() && isdigit((unsigned char)s[k]) && k - d < 2)
+                ++k;
+            if(k == d || (k - d == 2 && s[d] > '5'))
+                return false;
+            ++groups;
+        }
+        return groups && rest(k);
+    }
+
+    int64_t sexagesimal_value(const std::string& digits)
+    {
+        int64_t value = 0;
+        size_t  b     = 0;
+        for(size_t e; b <= digits.size(); b = e + 1)
+        {
+            e     = std::min(digits.find(':', b), digits.size());
+            value = value * 60 + std::stoll(digits.substr(b, e - b));
+        }
+        return value;
+    }
+
+    // Value of a plain scalar, with the types which PyYAML resolves, or a string
+    gentest_ptr resolve_plain(const std::string& s)
+    {
+        auto v = std::make_shared<gentest_value>();
+        if(s.empty() || s == "~" || s == "null" || s == "Null" || s == "NULL")
+            return v;
+
+        static const std::set<std::string> trues{"yes", "Yes", "YES", "true", "True", "TRUE",
+                                                 "on",  "On",  "ON"};
+        static const std::set<std::string> falses{"no", "No", "NO", "false", "False", "FALSE",
+                                                  "off", "Off", "OFF"};
+        if(trues.count(s) || falses.count(s))
+        {
+            v->kind = gentest_value::bool_v;
+            v->b    = trues.count(s);
+            return v;
+        }
+
+        size_t b    = s[0] == '-' || s[0] == '+' ? 1 : 0;
+        int    sign = s[0] == '-' ? -1 : 1;
+
+        std::string digits;
+        for(size_t k = b; k < s.size(); ++k)
+            if(s[k] != '_')
+                digits += s[k];
+
+        // Floats, with a mandatory '.', and an optional exponent with a mandatory sign
+        auto exponent = [&](size_t k) {
+            if(k == s.size())
+                return true;
+            return (s[k] == 'e' || s[k] == 'E') && k + 1 < s.size()
+                   && (s[k + 1] == '-' || s[k + 1] == '+')
+                   && all_of(s, k + 2, s.size(), "0123456789");
+        };
+        auto decimal = [&](size_t k) {
+            size_t d = k;
+            while(k < s.size() && (isdigit((unsigned char)s[k]) || s[k] == '_'))
+                ++k;
+            if(k == d || !isdigit((unsigned char)s[d]) || k == s.size() || s[k] != '.')
+                return false;
+            ++k;
+            while(k < s.size() && (isdigit((unsigned char)s[k]) || s[k] == '_'))
+                ++k;
+            return exponent(k);
+        };
+        auto fraction = [&](size_t k) {
+            if(k + 1 >= s.size() || s[k] != '.' || !isdigit((unsigned char)s[k + 1]))
+                return false;
+            k += 2;
+            while(k < s.size() && (isdigit((unsigned char)s[k]) || s[k] == '_'))
+                ++k;
+            return exponent(k);
+        };
+        auto sexagesimal_float = [&](size_t k) {
+            return (k < s.size() && s[k] == '.' && all_of(s, k + 1, s.size(), "0123456789_"))
+                   || (k + 1 == s.size() && s[k] == '.');
+        };
+
+        std::string special = s.substr(b);
+        if(decimal(b) || (b == 0 && fraction(0)) || sexagesimal(s, b, false, sexagesimal_float))
+        {
+            std::string lower = digits;
+            v->kind           = gentest_value::float_v;
+            if(lower.find(':') != std::string::npos)
+            {
+                size_t dot = lower.find('.');
+                v->f       = sign
+                       * (double(sexagesimal_value(lower.substr(0, dot)))
+                          + std::stod("0" + lower.substr(dot)));
+            }
+            else
+                v->f = sign * std::stod(lower);
+            return v;
+        }
+        if(special == ".inf" || special == ".Inf" || special == ".INF")
+        {
+            v->kind = gentest_value::float_v;
+            v->f    = sign * INFINITY;
+            return v;
+        }
+        if(b == 0 && (s == ".nan" || s == ".NaN" || s == ".NAN"))
+        {
+            // PyYAML computes .nan as -inf / inf, which has the sign bit set on x86
+            v->kind = gentest_value::float_v;
+            v->f    = -NAN;
+            return v;
+        }
+
+        // Integers
+        int base = 0;
+        if(!s.compare(b, 2, "0b") && all_of(s, b + 2, s.size(), "01_"))
+            base = 2;
+        else if(!s.compare(b, 2, "0x") && all_of(s, b + 2, s.size(), "0123456789abcdefABCDEF_"))
+            base = 16;
+        else if(s[b] == '0' && all_of(s, b + 1, s.size(), "01234567_"))
+            base = 8;
+        else if((s.size() == b + 1 && s[b] == '0')
+                || (b < s.size() && s[b] >= '1' && s[b] <= '9'
+                    && all_of(s, b, s.size(), "0123456789_")))
+            base = 10;
+        else if(sexagesimal(s, b, true, [&](size_t k) { return k == s.size(); }))
+        {
+            v->kind = gentest_value::int_v;
+            v->i    = sign * sexagesimal_value(digits);
+            return v;
+        }
+
+        if(base)
+        {
+            v->kind = gentest_value::int_v;
+            v->i    = sign
+                   * int64_t(std::stoull(base == 2 || base == 16 ? digits.substr(2) : digits,
+                                         nullptr,
+                                         base));
+            return v;
+        }
+
+        return make_str(s);
+    }
+
+    class gentest_parser
+    {
+        const std::vector<gentest_line>& m_src;
+        size_t                           m_end;
+        size_t                           m_ln;
+        size_t                           m_col = 0;
+        gentest_dict                     m_anchors;
+
+        [[noreturn]] void error(const std::string& problem) const
+        {
+            size_t ln = std::min(m_ln, m_end - 1);
+            throw gentest_error(mark(m_src[ln], ln == m_ln ? m_col : 0) + problem + "\n");
+        }
+
+        char peek(size_t k = 0) const
+        {
+            if(m_ln >= m_end)
+                return '\0';
+            auto& text = m_src[m_ln].text;
+            return m_col + k < text.size() ? text[m_col + k] : '\0';
+        }
+
+        static bool is_space(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\0';
+        }
+
+        void skip_spaces()
+        {
+            while(peek() == ' ' || peek() == '\t')
+                ++m_col;
+        }
+
+        // Whether the rest of the line is empty or a comment
+        bool at_eol()
+        {
+            skip_spaces();
+            return peek() == '\0' || peek() == '#';
+        }
+
+        // Move to the next content, returning false at the end of the document
+        bool next_content()
+        {
+            while(m_ln < m_end)
+            {
+                if(!at_eol())
+                    return true;
+                ++m_ln;
+                m_col = 0;
+            }
+            return false;
+        }
+
+        // Move to the next content inside a flow collection, which may span lines
+        void next_flow_content()
+        {
+            if(!next_content())
+            {
+                --m_ln;
+                m_col = m_src[m_ln].text.size();
+                error("found the end of the document inside a flow collection");
+            }
+        }
+
+        bool is_seq_entry() const
+        {
+            return peek() == '-' && is_space(peek(1));
+        }
+
+        std::string scan_name()
+        {
+            size_t b = ++m_col;
+            while(isalnum((unsigned char)peek()) || peek() == '-' || peek() == '_')
+                ++m_col;
+            if(m_col == b)
+                error("expected an alphabetic or numeric character for an anchor or alias");
+            return m_src[m_ln].text.substr(b, m_col - b);
+        }
+
+        gentest_ptr scan_alias()
+        {
+            std::string name = scan_name();
+            auto        it   = m_anchors.find(name);
+            if(it == m_anchors.end())
+                error("found undefined alias " + name);
+            return it->second;
+        }
+
+        // Append the UTF-8 encoding of a code point
+        static void append_utf8(std::string& s, unsigned long cp)
+        {
+            if(cp < 0x80)
+                s += char(cp);
+            else if(cp < 0x800)
+            {
+                s += char(0xC0 | cp >> 6);
+                s += char(0x80 | (cp & 0x3F));
+            }
+            else if(cp < 0x10000)
+            {
+                s += char(0xE0 | cp >> 12);
+                s += char(0x80 | (cp >> 6 & 0x3F));
+                s += char(0x80 | (cp & 0x3F));
+            }
+            else
+            {
+                s += char(0xF0 | cp >> 18);
+                s += char(0x80 | (cp >> 12 & 0x3F));
+                s += char(0x80 | (cp >> 6 & 0x3F));
+                s += char(0x80 | (cp & 0x3F));
+            }
+        }
+
+        // Single-quoted scalar, where '' is a quote, or double-quoted scalar with escapes
+        std::string scan_quoted()
+        {
+            static const std::map<char, char> escapes{
+                {'0', '\0'}, {'a', '\a'}, {'b', '\b'}, {'t', '\t'}, {'\t', '\t'},
+                {'n', '\n'}, {'v', '\v'}, {'f', '\f'}, {'r', '\r'}, {'e', '\x1b'},
+                {' ', ' '},  {'"', '"'},  {'/', '/'},  {'\\', '\\'}};
+
+            char        quote = peek();
+            std::string s;
+            for(++m_col;; ++m_col)
+            {
+                char c = peek();
+                if(!c)
+                    error("found unterminated or multi-line quoted scalar, which is not supported");
+                if(c == quote && (quote == '"' || peek(1) != '\''))
+                    break;
+                if(c == '\'')
+                {
+                    s += c;
+                    ++m_col;
+                }
+                else if(c == '\\' && quote == '"')
+                {
+                    char e  = peek(1);
+                    auto it = escapes.find(e);
+                    m_col += 2;
+                    if(it != escapes.end())
+                        s += it->second;
+                    else if(e == 'x' || e == 'u' || e == 'U')
+                    {
+                        size_t      n   = e == 'x' ? 2 : e == 'u' ? 4 : 8;
+                        std::string hex = m_src[m_ln].text.substr(m_col, n);
+                        if(hex.size() != n || !all_of(hex, 0, n, "0123456789abcdefABCDEF"))
+                            error("expected an escape sequence of hexadecimal numbers");
+                        append_utf8(s, std::stoul(hex, nullptr, 16));
+                        m_col += n;
+                    }
+                    else
+                        error("found unknown escape character");
+                    --m_col;
+                }
+                else
+                    s += c;
+            }
+            ++m_col;
+            return s;
+        }
+
+        // Plain scalar ending at the end of the line, at a comment, at ": ", or, in a flow
+        // collection, at a flow indicator. Multi-line plain scalars are not supported.
+        std::string scan_plain(bool flow)
+        {
+            auto&  text = m_src[m_ln].text;
+            size_t b = m_col, e = m_col;
+            for(char c; (c = peek()); ++m_col)
+            {
+                if(c == ' ' || c == '\t')
+                {
+                    skip_spaces();
+                    if(peek() == '#' || !peek())
+                        break;
+                    --m_col;
+                    continue;
+                }
+                if(c == ':' && (is_space(peek(1)) || (flow && strchr(",[]{}", peek(1)))))
+                    break;
+                if(flow && strchr(",?[]{}", c))
+                    break;
+                e = m_col + 1;
+            }
+            return text.substr(b, e - b);
+        }
+
+        bool starts_plain() const
+        {
+            char c = peek();
+            return (c && !strchr("-?:,[]{}#&*!|>'\"%@`", c))
+                   || (c && strchr("-?:", c) && !is_space(peek(1)));
+        }
+
+        // Whether a block mapping key starts here
+        bool is_key()
+        {
+            size_t col = m_col;
+            if(peek() == '"' || peek() == '\'')
+                scan_quoted();
+            else if(starts_plain())
+                scan_plain(false);
+            else
+                return false;
+            skip_spaces();
+            bool key = peek() == ':' && is_space(peek(1));
+            m_col    = col;
+            return key;
+        }
+
+        // Build a mapping from its entries, applying merge keys as PyYAML does
+        gentest_ptr make_dict(const std::vector<std::pair<std::string, gentest_ptr>>& pairs,
+                              const std::vector<gentest_ptr>&                         merges)
+        {
+            auto v  = std::make_shared<gentest_value>();
+            v->kind = gentest_value::dict_v;
+            for(auto& merge : merges)
+            {
+                std::vector<gentest_ptr> items{merge};
+                if(merge->kind == gentest_value::list_v)
+                    items.assign(merge->list.rbegin(), merge->list.rend());
+                for(auto& item : items)
+                {
+                    if(item->kind != gentest_value::dict_v)
+                        error("expected a mapping or list of mappings for merging");
+                    for(auto& e : item->dict)
+                        v->dict[e.first] = e.second;
+                }
+            }
+            for(auto& e : pairs)
+                v->dict[e.first] = e.second;
+            return v;
+        }
+
+        gentest_ptr parse_flow_node()
+        {
+            next_flow_content();
+            std::string anchor;
+            if(peek() == '&')
+            {
+                anchor = scan_name();
+                next_flow_content();
+            }
+
+            gentest_ptr node;
+            char        c = peek();
+            if(c == '{' || c == '[')
+            {
+                std::vector<std::pair<std::string, gentest_ptr>> pairs;
+                std::vector<gentest_ptr>                         merges;
+
+                auto list  = std::make_shared<gentest_value>();
+                list->kind = gentest_value::list_v;
+                char close = c == '{' ? '}' : ']';
+                ++m_col;
+                while(next_flow_content(), peek() != close)
+                {
+                    if(c == '[')
+                        list->list.push_back(parse_flow_node());
+                    else
+                    {
+                        if(peek() != '"' && peek() != '\'' && !starts_plain())
+                            error("expected a mapping key");
+                        bool        merge = peek() == '<' && peek(1) == '<' && !starts_key_char(2);
+                        std::string key
+                            = peek() == '"' || peek() == '\'' ? scan_quoted() : scan_plain(true);
+                        next_flow_content();
+                        gentest_ptr value = std::make_shared<gentest_value>();
+                        if(peek() == ':')
+                        {
+                            ++m_col;
+                            next_flow_content();
+                            if(peek() != ',' && peek() != '}')
+                                value = parse_flow_node();
+                        }
+                        if(merge)
+                            merges.push_back(value);
+                        else
+                            pairs.emplace_back(std::move(key), value);
+                    }
+                    next_flow_content();
+                    if(peek() == ',')
+                        ++m_col;
+                    else if(peek() != close)
+                        error(std::string("expected ',' or '") + close + "'");
+                }
+                ++m_col;
+                node = c == '{' ? make_dict(pairs, merges) : list;
+            }
+            else if(c == '*')
+                node = scan_alias();
+            else if(c == '"' || c == '\'')
+                node = make_str(scan_quoted());
+            else if(starts_plain())
+                node = resolve_plain(scan_plain(true));
+            else
+                error(std::string("found unexpected character '") + c + "'");
+
+            if(!anchor.empty())
+                m_anchors[anchor] = node;
+            return node;
+        }
+
+        bool starts_key_char(size_t k) const
+        {
+            char c = peek(k);
+            return c && !is_space(c) && !strchr(":,[]{}", c);
+        }
+
+        // Node on the rest of the line, which may continue on more lines if it is a flow
+        // collection. After "- ", it may also be a compact block sequence or mapping.
+        gentest_ptr parse_inline(bool compact)
+        {
+            if(compact && is_seq_entry())
+                return parse_block_sequence(m_col);
+            if(compact && is_key())
+                return parse_block_mapping(m_col);
+
+            gentest_ptr node;
+            char        c = peek();
+            if(c == '{' || c == '[')
+                node = parse_flow_node();
+            else if(c == '*')
+                node = scan_alias();
+            else if(c == '"' || c == '\'')
+                node = make_str(scan_quoted());
+            else if(starts_plain())
+                node = resolve_plain(scan_plain(false));
+            else
+                error(std::string("found unexpected character '") + c + "'");
+
+            if(!at_eol())
+                error(is_seq_entry() || peek() == ':' ? "mapping values or sequence entries are "
+                                                        "not allowed here"
+                                                      : "expected the end of the line");
+            return node;
+        }
+
+        // Node following "key:" or "-" at the given indentation, on the rest of the line, or
+        // on the following lines if they are more indented. A sequence following a key may
+        // have the same indentation as the key.
+        gentest_ptr parse_block_value(size_t indent, bool key)
+        {
+            std::string anchor;
+            skip_spaces();
+            if(peek() == '&')
+                anchor = scan_name();
+
+            gentest_ptr node;
+            if(!at_eol())
+                node = parse_inline(!key);
+            else if(next_content()
+                    && (m_col > indent || (key && m_col == indent && is_seq_entry())))
+                node = parse_block_node();
+            else
+                node = std::make_shared<gentest_value>();
+
+            if(!anchor.empty())
+                m_anchors[anchor] = node;
+            return node;
+        }
+
+        gentest_ptr parse_block_sequence(size_t indent)
+        {
+            auto seq  = std::make_shared<gentest_value>();
+            seq->kind = gentest_value::list_v;
+            do
+            {
+                ++m_col;
+                seq->list.push_back(parse_block_value(indent, false));
+                if(!next_content() || m_col < indent)
+                    break;
+                if(m_col > indent)
+                    error("bad indentation of a sequence entry");
+            } while(is_seq_entry());
+            return seq;
+        }
+
+        gentest_ptr parse_block_mapping(size_t indent)
+        {
+            std::vector<std::pair<std::string, gentest_ptr>> pairs;
+            std::vector<gentest_ptr>                         merges;
+            while(true)
+            {
+                if(!is_key())
+                    error("expected a mapping key");
+                bool        merge = peek() == '<' && peek(1) == '<' && !starts_key_char(2);
+                std::string key
+                    = peek() == '"' || peek() == '\'' ? scan_quoted() : scan_plain(false);
+                skip_spaces();
+                ++m_col; // ':'
+
+                auto value = parse_block_value(indent, true);
+                if(merge)
+                    merges.push_back(value);
+                else
+                    pairs.emplace_back(std::move(key), value);
+
+                if(!next_content() || m_col < indent)
+                    break;
+                if(m_col > indent)
+                    error("bad indentation of a mapping entry");
+            }
+            return make_dict(pairs, merges);
+        }
+
+        // Block collection or inline node starting at the current content
+        gentest_ptr parse_block_node()
+        {
+            if(is_seq_entry())
+                return parse_block_sequence(m_col);
+            if(is_key())
+                return parse_block_mapping(m_col);
+            return parse_inline(false);
+        }
+
+    public:
+        gentest_parser(const std::vector<gentest_line>& src, size_t begin, size_t end)
+            : m_src(src)
+            , m_end(end)
+            , m_ln(begin)
+        {
+        }
+
+        // The document, or nullptr if it is empty
+        gentest_ptr parse_document()
+        {
+            if(!next_content())
+                return nullptr;
+            if(peek() == '&')
+            {
+                std::string anchor = scan_name();
+                auto        node   = parse_block_value(m_col, false);
+                m_anchors[anchor]  = node;
+                return node;
+            }
+            auto node = parse_block_node();
+            if(next_content())
+                error("expected the end of the document");
+            return node;
+        }
+    };
+
+    /* ========================================================================================
+     * Expansion of one document into Arguments records
+     * ======================================================================================== */
+
+    // Python's fnmatch.fnmatchcase()
+    bool fnmatchcase(const char* name, const char* pat)
+    {
+        for(; *pat; ++pat, ++name)
+        {
+            if(*pat == '*')
+            {
+                for(const char* n = name;; ++n)
+                {
+                    if(fnmatchcase(n, pat + 1))
+                        return true;
+                    if(!*n)
+                        return false;
+                }
+            }
+            if(!*name)
+                return false;
+            if(*pat == '[')
+            {
+                const char* p      = pat + 1;
+                bool        negate = *p == '!';
+                p += negate;
+                const char* first = p;
+                while(*p && (*p != ']' || p == first))
+                    ++p;
+                if(*p)
+                {
+                    bool match = false;
+                    for(const char* q = first; q < p; ++q)
+                        if(q + 2 < p && q[1] == '-' ? (*q <= *name && *name <= q[2] && (q += 2))
+                                                    : *q == *name)
+                            match = true;
+                    if(match == negate)
+                        return false;
+                    pat = p;
+                    continue;
+                }
+            }
+            if(*pat != '?' && *pat != *name)
+                return false;
+        }
+        return !*name;
+    }
+
+    class gentest_document
+    {
+        // Names of the Datatypes, with their values, or -1 for types which are not values
+        std::map<std::string, std::pair<bool, int64_t>> m_datatypes;
+        std::set<std::string>                           m_enum_args;
+        gentest_ptr                                     m_dict_lists_to_expand;
+        gentest_ptr                                     m_lists_to_not_expand;
+        gentest_ptr                                     m_known_bugs;
+        gentest_ptr                                     m_functions;
+
+        std::vector<std::string>& m_records;
+        std::unordered_set<std::string> m_seen;
+
+        static gentest_ptr get(const gentest_value& doc, const char* key)
+        {
+            auto it = doc.dict.find(key);
+            return it != doc.dict.end() ? it->second : nullptr;
+        }
+
+        static bool is_valid_type(const std::string& name)
+        {
+            // [a-z_A-Z]\w*(:?\s*\*\s*\d+)?
+            return !name.empty() && (isalpha((unsigned char)name[0]) || name[0] == '_');
+        }
+
+        void get_datatypes(const gentest_value& doc)
+        {
+            auto decls = get(doc, "Datatypes");
+            if(!decls || !truth(*decls))
+                return;
+            if(decls->kind != gentest_value::list_v)
+                throw gentest_error("Datatypes must be a list\n");
+            for(auto& declaration : decls->list)
+            {
+                if(declaration->kind != gentest_value::dict_v)
+                    throw gentest_error("Unrecognized data type declaration\n");
+                for(auto& e : declaration->dict)
+                {
+                    auto& decl = *e.second;
+                    if(decl.kind == gentest_value::dict_v)
+                    {
+                        m_datatypes[e.first] = {false, -1};
+                        if(auto attr = get(decl, "attr"))
+                            for(auto& a : attr->dict)
+                                if(is_valid_type(a.first) && a.second->is_integer())
+                                    m_datatypes[a.first] = {true, a.second->as_int()};
+                    }
+                    else if(decl.kind == gentest_value::str_v && is_valid_type(decl.s))
+                    {
+                        auto it = m_datatypes.find(decl.s);
+                        if(it != m_datatypes.end())
+                            m_datatypes[e.first] = it->second;
+                        else if(!decl.s.compare(0, 2, "c_"))
+                            m_datatypes[e.first] = {false, -1};
+                        else
+                            throw gentest_error("Unrecognized data type " + e.first + ": '"
+                                                + decl.s + "'\n");
+                    }
+                    else
+                    {
+                        std::ostringstream msg;
+                        msg << "Unrecognized data type " << e.first << ": " << decl << "\n";
+                        throw gentest_error(msg.str());
+                    }
+                }
+            }
+        }
+
+        // The Arguments declared in the YAML must be the fields of the Arguments struct
+        void get_arguments(const gentest_value& doc)
+        {
+            std::vector<std::string> names;
+            if(auto decls = get(doc, "Arguments"))
+                for(auto& decl : decls->list)
+                    if(decl->kind == gentest_value::dict_v && decl->dict.size() == 1)
+                    {
+                        auto& e = *decl->dict.begin();
+                        if(e.second->kind == gentest_value::str_v && is_valid_type(e.second->s))
+                        {
+                            names.push_back(e.first);
+                            auto it = m_datatypes.find(e.second->s);
+                            if(it != m_datatypes.end() && !it->second.first
+                               && e.second->s.compare(0, 2, "c_"))
+                                m_enum_args.insert(e.first);
+                        }
+                    }
+
+            std::vector<std::string> fields;
+#define FIELD_NAME(NAME) fields.push_back(#NAME)
+            FOR_EACH_ARGUMENT(FIELD_NAME, ;);
+#undef FIELD_NAME
+
+            if(names != fields)
+                throw gentest_error("The Arguments declared in the YAML file do not match the "
+                                    "Arguments in rocblas_arguments.hpp\n");
+        }
+
+        // Python's "value in datatypes", for the enum replacement
+        const std::pair<bool, int64_t>* datatype(const gentest_value& v) const
+        {
+            if(v.kind != gentest_value::str_v)
+                return nullptr;
+            auto it = m_datatypes.find(v.s);
+            return it != m_datatypes.end() ? &it->second : nullptr;
+        }
+
+        /* ------------------------------------------------------------------------------------
+         * setdefaults() of rocblas_gentest.py
+         * ------------------------------------------------------------------------------------ */
+
+        static const gentest_value& at(const gentest_dict& test, const std::string& key)
+        {
+            auto it = test.find(key);
+            if(it == test.end())
+                throw std::out_of_range(key);
+            return *it->second;
+        }
+
+        static const std::string& str(const gentest_dict& test, const std::string& key)
+        {
+            auto& v = at(test, key);
+            if(v.kind != gentest_value::str_v)
+                throw gentest_error(std::string("'") + type_name(v)
+                                    + "' object has no attribute 'upper' for " + key + "\n");
+            return v.s;
+        }
+
+        static std::string upper(const gentest_dict& test, const std::string& key)
+        {
+            std::string s = str(test, key);
+            for(auto& c : s)
+                c = toupper((unsigned char)c);
+            return s;
+        }
+
+        static const gentest_value& num(const gentest_dict& test, const std::string& key)
+        {
+            auto& v = at(test, key);
+            if(!v.is_number())
+                throw gentest_error(std::string("TypeError: unsupported operand type ")
+                                    + type_name(v) + " for " + key + "\n");
+            return v;
+        }
+
+        static gentest_ptr mul(const gentest_value& a, const gentest_value& b)
+        {
+            return a.is_integer() && b.is_integer() ? make_int(a.as_int() * b.as_int())
+                                                    : make_float(a.as_float() * b.as_float());
+        }
+
+        // Python's int() of a number
+        static gentest_ptr to_int(const gentest_value& v)
+        {
+            return make_int(v.is_integer() ? v.as_int() : int64_t(std::trunc(v.f)));
+        }
+
+        static void setdefault(gentest_dict& test, const std::string& key, gentest_ptr value)
+        {
+            test.emplace(key, std::move(value));
+        }
+
+        static void setkey_product(gentest_dict&            test,
+                                   const std::string&       key,
+                                   std::vector<const char*> vals)
+        {
+            for(auto x : vals)
+                if(!test.count(x))
+                    return;
+            gentest_ptr result = make_int(1);
+            for(auto x : vals)
+            {
+                auto& v = num(test, x);
+                if(!strcmp(x, "incx") || !strcmp(x, "incy"))
+                {
+                    auto abs = v.is_integer() ? make_int(std::abs(v.as_int()))
+                                              : make_float(std::abs(v.f));
+                    result   = mul(*result, *abs);
+                }
+                else
+                    result = mul(*result, v);
+            }
+            test[key] = to_int(*result);
+        }
+
+        static bool in(const std::string& f, std::initializer_list<const char*> names)
+        {
+            for(auto name : names)
+                if(f == name)
+                    return true;
+            return false;
+        }
+
+        // Python's "f in 'string'", which is a substring test
+        static bool in(const std::string& f, const char* s)
+        {
+            return strstr(s, f.c_str()) != nullptr;
+        }
+
+        static void setdefaults(gentest_dict& test)
+        {
+            const std::string& f     = str(test, "function");
+            auto               scale = [&] { return test.count("stride_scale") != 0; };
+
+            if(in(f, {"asum_strided_batched",    "nrm2_strided_batched",
+                      "scal_strided_batched",    "swap_strided_batched",
+                      "copy_strided_batched",    "dot_strided_batched",
+                      "dotc_strided_batched",    "dot_strided_batched_ex",
+                      "dotc_strided_batched_ex", "rot_strided_batched",
+                      "rot_strided_batched_ex",  "rotm_strided_batched",
+                      "iamax_strided_batched",   "iamin_strided_batched",
+                      "axpy_strided_batched",    "axpy_strided_batched_ex",
+                      "nrm2_strided_batched_ex", "scal_strided_batched_ex",
+                      "axpby_strided_batched",   "waxpby_strided_batched",
+                      "dot2_strided_batched",    "axpy_dot_strided_batched"}))
+            {
+                setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+                setkey_product(test, "stride_y", {"N", "incy", "stride_scale"});
+                // all(x in test for x in ('stride_scale')) tests the characters of the string
+                bool all = true;
+                for(char c : std::string("stride_scale"))
+                    all = all && test.count(std::string(1, c));
+                if(all)
+                {
+                    auto s = to_int(num(test, "stride_scale"));
+                    setdefault(test, "stride_c", make_int(s->i * 5));
+                }
+            }
+            else if(in(f, "tpmv_strided_batched"))
+            {
+                setkey_product(test, "stride_x", {"M", "incx", "stride_scale"});
+                setkey_product(test, "stride_a", {"M", "M", "stride_scale"});
+            }
+            else if(in(f, "trmv_strided_batched"))
+            {
+                setkey_product(test, "stride_x", {"M", "incx", "stride_scale"});
+                setkey_product(test, "stride_a", {"M", "lda", "stride_scale"});
+            }
+            else if(in(f, {"gemv_strided_batched", "gbmv_strided_batched", "ger_strided_batched",
+                           "geru_strided_batched", "gerc_strided_batched", "trsv_strided_batched"}))
+            {
+                if(in(f,
+                      {"ger_strided_batched",
+                       "geru_strided_batched",
+                       "gerc_strided_batched",
+                       "trsv_strided_batched"})
+                   || in(str(test, "transA"), {"T", "C"}))
+                {
+                    setkey_product(test, "stride_x", {"M", "incx", "stride_scale"});
+                    setkey_product(test, "stride_y", {"N", "incy", "stride_scale"});
+                }
+                else
+                {
+                    setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+                    setkey_product(test, "stride_y", {"M", "incy", "stride_scale"});
+                }
+                if(in(f, "gbmv_strided_batched"))
+                    setkey_product(test, "stride_a", {"lda", "N", "stride_scale"});
+            }
+            else if(in(f, {"hemv_strided_batched", "hbmv_strided_batched", "sbmv_strided_batched"}))
+            {
+                if(test.count("N") && test.count("incx") && test.count("incy") && scale())
+                {
+                    setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+                    setkey_product(test, "stride_y", {"N", "incy", "stride_scale"});
+                    setkey_product(test, "stride_a", {"N", "lda", "stride_scale"});
+                }
+            }
+            else if(in(f, "hpmv_strided_batched"))
+            {
+                if(test.count("N") && test.count("incx") && test.count("incy") && scale())
+                {
+                    setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+                    setkey_product(test, "stride_y", {"N", "incy", "stride_scale"});
+                    auto& N  = num(test, "N");
+                    auto  np = mul(*mul(N, *make_int(N.as_int() + 1)), num(test, "stride_scale"));
+                    if(N.kind == gentest_value::float_v)
+                        np = mul(*mul(N, *make_float(N.f + 1)), num(test, "stride_scale"));
+                    setdefault(test, "stride_a", make_int(int64_t(np->as_float() / 2)));
+                }
+            }
+            else if(in(f, {"spr_strided_batched", "spr2_strided_batched", "hpr_strided_batched",
+                           "hpr2_strided_batched", "tpsv_strided_batched"}))
+            {
+                setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+                setkey_product(test, "stride_y", {"N", "incy", "stride_scale"});
+                setkey_product(test, "stride_a", {"N", "N", "stride_scale"});
+            }
+            else if(in(f, {"her_strided_batched", "her2_strided_batched", "syr2_strided_batched"}))
+            {
+                setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+                setkey_product(test, "stride_y", {"N", "incy", "stride_scale"});
+                setkey_product(test, "stride_a", {"N", "lda", "stride_scale"});
+            }
+            else if(in(f, "rotg_strided_batched"))
+            {
+                if(scale())
+                {
+                    auto s = to_int(num(test, "stride_scale"));
+                    for(auto key : {"stride_a", "stride_b", "stride_c", "stride_d"})
+                        setdefault(test, key, s);
+                }
+            }
+            else if(in(f, "rotmg_strided_batched"))
+            {
+                if(scale())
+                {
+                    auto s = to_int(num(test, "stride_scale"));
+                    setdefault(test, "stride_a", s);
+                    setdefault(test, "stride_b", s);
+                    setdefault(test, "stride_c", make_int(s->i * 5));
+                    setdefault(test, "stride_x", s);
+                    setdefault(test, "stride_y", s);
+                }
+            }
+            else if(in(f, "dgmm_strided_batched"))
+            {
+                setkey_product(test, "stride_c", {"N", "ldc", "stride_scale"});
+                setkey_product(test, "stride_a", {"N", "lda", "stride_scale"});
+                if(upper(test, "side") == "L")
+                    setkey_product(test, "stride_x", {"M", "incx", "stride_scale"});
+                else
+                    setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+            }
+            else if(in(f, "geam_strided_batched"))
+            {
+                setkey_product(test, "stride_c", {"N", "ldc", "stride_scale"});
+                if(upper(test, "transA") == "N")
+                    setkey_product(test, "stride_a", {"N", "lda", "stride_scale"});
+                else
+                    setkey_product(test, "stride_a", {"M", "lda", "stride_scale"});
+                if(upper(test, "transB") == "N")
+                    setkey_product(test, "stride_b", {"N", "ldb", "stride_scale"});
+                else
+                    setkey_product(test, "stride_b", {"M", "ldb", "stride_scale"});
+            }
+            else if(in(f, {"trmm_strided_batched", "trmm_outofplace_strided_batched"}))
+            {
+                setkey_product(test, "stride_b", {"N", "ldb", "stride_scale"});
+                setkey_product(test, "stride_c", {"N", "ldc", "stride_scale"});
+                if(upper(test, "side") == "L")
+                    setkey_product(test, "stride_a", {"M", "lda", "stride_scale"});
+                else
+                    setkey_product(test, "stride_a", {"N", "lda", "stride_scale"});
+            }
+            else if(in(f, {"trsm_strided_batched", "trsm_strided_batched_ex"}))
+            {
+                setkey_product(test, "stride_b", {"N", "ldb", "stride_scale"});
+                if(upper(test, "side") == "L")
+                    setkey_product(test, "stride_a", {"M", "lda", "stride_scale"});
+                else
+                    setkey_product(test, "stride_a", {"N", "lda", "stride_scale"});
+            }
+            else if(in(f, "tbmv_strided_batched"))
+            {
+                if(test.count("M") && test.count("lda") && scale())
+                {
+                    auto ld = mul(*mul(num(test, "M"), num(test, "lda")),
+                                  num(test, "stride_scale"));
+                    setdefault(test, "stride_a", to_int(*ld));
+                }
+                if(test.count("M") && test.count("incx") && scale())
+                {
+                    gentest_dict t{{"M", test["M"]},
+                                   {"incx", test["incx"]},
+                                   {"stride_scale", test["stride_scale"]}};
+                    setkey_product(t, "stride_x", {"M", "incx", "stride_scale"});
+                    setdefault(test, "stride_x", t["stride_x"]);
+                }
+            }
+            else if(in(f, "tbsv_strided_batched"))
+            {
+                setkey_product(test, "stride_a", {"N", "lda", "stride_scale"});
+                setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+            }
+
+            setdefault(test, "stride_x", make_int(0));
+            setdefault(test, "stride_y", make_int(0));
+
+            auto& transA = at(test, "transA");
+            auto& transB = at(test, "transB");
+            if((transA.kind == gentest_value::str_v && transA.s == "*")
+               || (transB.kind == gentest_value::str_v && transB.s == "*"))
+            {
+                for(auto key : {"lda", "ldb", "ldc", "ldd"})
+                    setdefault(test, key, make_int(0));
+            }
+            else
+            {
+                // Catered to gemm default behaviour
+                auto nonzero = [&](const char* key) {
+                    auto& v = num(test, key);
+                    return v.as_float() != 0 ? test[key] : make_int(1);
+                };
+                auto lda = upper(test, "transA") == "N" ? nonzero("M") : nonzero("K");
+                setdefault(test, "lda", lda);
+                auto ldb = upper(test, "transB") == "N" ? nonzero("K") : nonzero("N");
+                setdefault(test, "ldb", ldb);
+                setdefault(test, "ldc", nonzero("M"));
+                setdefault(test, "ldd", nonzero("M"));
+                if(num(test, "batch_count").as_float() > 0)
+                {
+                    setdefault(test,
+                               "stride_a",
+                               mul(num(test, "lda"),
+                                   num(test, upper(test, "transA") == "N" ? "K" : "M")));
+                    setdefault(test,
+                               "stride_b",
+                               mul(num(test, "ldb"),
+                                   num(test, upper(test, "transB") == "N" ? "N" : "K")));
+                    setdefault(test, "stride_c", mul(num(test, "ldc"), num(test, "N")));
+                    setdefault(test, "stride_d", mul(num(test, "ldd"), num(test, "N")));
+                    return;
+                }
+            }
+
+            for(auto key : {"stride_a", "stride_b", "stride_c", "stride_d"})
+                setdefault(test, key, make_int(0));
+        }
+
+        /* ------------------------------------------------------------------------------------
+         * Conversion of a test case to Arguments, as ctypes converts them
+         * ------------------------------------------------------------------------------------ */
+
+        [[noreturn]] static void type_error(const char* name, const gentest_value& v)
+        {
+            throw gentest_error(std::string("TypeError: invalid value for ") + name
+                                + ", which has type " + type_name(v) + "\n");
+        }
+
+        template <size_t N>
+        static void set_field(char (&field)[N], const char* name, const gentest_value& v)
+        {
+            if(v.kind != gentest_value::str_v)
+                type_error(name, v);
+            if(v.s.size() > N)
+                throw gentest_error("ValueError: bytes too long (" + std::to_string(v.s.size())
+                                    + ", maximum length " + std::to_string(N) + ") for " + name
+                                    + "\n");
+            memcpy(field, v.s.data(), v.s.size());
+        }
+
+        static void set_field(char& field, const char* name, const gentest_value& v)
+        {
+            if(v.kind != gentest_value::str_v || v.s.size() != 1)
+                type_error(name, v);
+            field = v.s[0];
+        }
+
+        static void set_field(bool& field, const char*, const gentest_value& v)
+        {
+            field = truth(v);
+        }
+
+        static void set_field(double& field, const char* name, const gentest_value& v)
+        {
+            if(!v.is_number())
+                type_error(name, v);
+            field = v.as_float();
+        }
+
+        // Integers and enums, which are truncated to their size
+        template <typename T>
+        static void set_field(T& field, const char* name, const gentest_value& v)
+        {
+            static_assert(std::is_integral<T>{} || std::is_enum<T>{}, "Unsupported field type");
+            if(!v.is_integer())
+                type_error(name, v);
+            // The low bytes of the value, on little-endian hosts
+            uint64_t bits = uint64_t(v.as_int());
+            memcpy(&field, &bits, sizeof(field));
+        }
+
+        void write_test(const gentest_dict& test)
+        {
+            Arguments arg;
+            memset(&arg, 0, sizeof(arg));
+
+#define SET_FIELD(NAME) set_field(arg.NAME, #NAME, at(test, #NAME))
+            FOR_EACH_ARGUMENT(SET_FIELD, ;);
+#undef SET_FIELD
+
+            std::string record(reinterpret_cast<const char*>(&arg), sizeof(arg));
+            if(m_seen.insert(record).second)
+                m_records.push_back(std::move(record));
+        }
+
+        void instantiate(gentest_dict test)
+        {
+            try
+            {
+                setdefaults(test);
+
+                // For enum arguments, replace name with value
+                for(auto& name : m_enum_args)
+                    if(auto dt = datatype(at(test, name)))
+                    {
+                        if(!dt->first)
+                            type_error(name.c_str(), at(test, name));
+                        test[name] = make_int(dt->second);
+                    }
+
+                std::set<std::string> known_bug_platforms;
+                auto&                 category = at(test, "category");
+                auto                  not_known_bug = [&] {
+                    return category.kind == gentest_value::str_v && !in(category.s, "known_bug");
+                };
+
+                // Match known bugs
+                if(not_known_bug() && m_known_bugs)
+                {
+                    for(auto& bug : m_known_bugs->list)
+                    {
+                        bool match = true;
+                        for(auto& e : bug->dict)
+                        {
+                            auto& key = e.first;
+                            auto& value = *e.second;
+                            if(key == "known_bug_platforms" || key == "category")
+                                continue;
+                            auto it = test.find(key);
+                            if(it == test.end())
+                            {
+                                match = false;
+                                break;
+                            }
+                            if(key == "function")
+                            {
+                                if(it->second->kind != gentest_value::str_v
+                                   || value.kind != gentest_value::str_v)
+                                    type_error("function", value);
+                                if(!fnmatchcase(it->second->s.c_str(), value.s.c_str()))
+                                {
+                                    match = false;
+                                    break;
+                                }
+                            }
+                            else
+                            {
+                                auto dt = m_enum_args.count(key) ? datatype(value) : nullptr;
+                                if(dt ? !(*it->second == *make_int(dt->second))
+                                      : !(*it->second == value))
+                                {
+                                    match = false;
+                                    break;
+                                }
+                            }
+                        }
+                        if(!match)
+                            continue;
+
+                        // All values specified in known bug match the test case
+                        auto        it        = bug->dict.find("known_bug_platforms");
+                        std::string platforms = it != bug->dict.end()
+                                                    && it->second->kind == gentest_value::str_v
+                                                    ? it->second->s
+                                                    : "";
+                        const char* seps = " :,\f\n\r\t\v";
+                        if(platforms.find_first_not_of(seps) != std::string::npos)
+                        {
+                            size_t b = 0;
+                            for(size_t e; b <= platforms.size(); b = e + 1)
+                            {
+                                e = std::min(platforms.find_first_of(seps, b), platforms.size());
+                                known_bug_platforms.insert(platforms.substr(b, e - b));
+                                e = std::min(platforms.find_first_not_of(seps, e),
+                                             platforms.size() + 1)
+                                    - 1;
+                            }
+                        }
+                        else
+                            test["category"] = make_str("known_bug");
+                        break;
+                    }
+                }
+
+                // Unless category is already set to known_bug or disabled, set
+                // known_bug_platforms to a sorted, space-separated list of platforms
+                std::string platforms;
+                if(not_known_bug())
+                    for(auto& p : known_bug_platforms)
+                        platforms += (&p == &*known_bug_platforms.begin() ? "" : " ") + p;
+                test["known_bug_platforms"] = make_str(platforms);
+
+                write_test(test);
+            }
+            catch(const std::out_of_range& err)
+            {
+                gentest_value v;
+                v.kind = gentest_value::dict_v;
+                v.dict = test;
+                std::ostringstream msg;
+                msg << "Undefined value '" << err.what() << "'\n" << v << "\n";
+                throw gentest_error(msg.str());
+            }
+        }
+
+        static bool is_int_range(const gentest_value& v, int64_t& a, int64_t& b, int64_t& c)
+        {
+            // \s*(-?\d+)\s*\.\.\s*(-?\d+)\s*(?:\.\.\s*(-?\d+)\s*)?$
+            if(v.kind != gentest_value::str_v)
+                return false;
+            const char* p = v.s.c_str();
+            auto        number = [&](int64_t& n) {
+                while(isspace((unsigned char)*p))
+                    ++p;
+                const char* d = p + (*p == '-');
+                if(!isdigit((unsigned char)*d))
+                    return false;
+                char* end;
+                n = strtoll(p, &end, 10);
+                p = end;
+                while(isspace((unsigned char)*p))
+                    ++p;
+                return true;
+            };
+            auto dots = [&] { return p[0] == '.' && p[1] == '.' && (p += 2); };
+            c         = 1;
+            if(!number(a) || !dots() || !number(b))
+                return false;
+            if(*p && (!dots() || !number(c)))
+                return false;
+            return !*p;
+        }
+
+        bool in_list(const gentest_ptr& list, const std::string& name) const
+        {
+            if(list && list->kind == gentest_value::list_v)
+                for(auto& e : list->list)
+                    if(e->kind == gentest_value::str_v && e->s == name)
+                        return true;
+            return false;
+        }
+
+        // Generate test combinations by iterating across lists recursively
+        void generate(gentest_dict test)
+        {
+            if(m_dict_lists_to_expand)
+                for(auto& argname : m_dict_lists_to_expand->list)
+                {
+                    if(argname->kind == gentest_value::dict_v)
+                    {
+                        if(argname->dict.size() == 1)
+                        {
+                            auto& arg    = argname->dict.begin()->first;
+                            auto& target = *argname->dict.begin()->second;
+                            auto  it     = test.find(arg);
+                            if(it != test.end() && it->second->kind == gentest_value::dict_v)
+                            {
+                                if(target.kind != gentest_value::str_v)
+                                    type_error(arg.c_str(), target);
+                                auto pairs = it->second;
+                                for(auto& pair : pairs->dict)
+                                {
+                                    test[arg]      = make_str(pair.first);
+                                    test[target.s] = pair.second;
+                                    generate(test);
+                                }
+                                return;
+                            }
+                        }
+                    }
+                    else if(argname->kind == gentest_value::str_v)
+                    {
+                        auto it = test.find(argname->s);
+                        if(it != test.end()
+                           && (it->second->kind == gentest_value::list_v
+                               || it->second->kind == gentest_value::dict_v))
+                        {
+                            // Pop the list and iterate across it
+                            auto ilist = it->second;
+                            test.erase(it);
+
+                            // For a bare dictionary, wrap it in a list and apply it once
+                            std::vector<gentest_ptr> items{ilist};
+                            if(ilist->kind == gentest_value::list_v)
+                                items = ilist->list;
+                            for(auto& item : items)
+                            {
+                                if(item->kind != gentest_value::dict_v)
+                                    throw gentest_error(
+                                        std::string("TypeError: ") + type_name(*item) + " for "
+                                        + argname->s
+                                        + "\nA name listed in \"Dictionary lists to expand\" "
+                                          "must be a defined as a dictionary.\n");
+                                gentest_dict test_case = test;
+                                for(auto& e : item->dict)
+                                    test_case[e.first] = e.second;
+                                generate(std::move(test_case));
+                            }
+                            return;
+                        }
+                    }
+                }
+
+            for(auto& e : test)
+            {
+                // Integer arguments which are ranges (A..B[..C]) are expanded
+                int64_t a, b, c;
+                if(is_int_range(*e.second, a, b, c))
+                {
+                    if(!c)
+                        throw gentest_error("ValueError: range() arg 3 must not be zero\n");
+                    for(int64_t i = a; c > 0 ? i < b + 1 : i > b + 1; i += c)
+                    {
+                        test[e.first] = make_int(i);
+                        generate(test);
+                    }
+                    return;
+                }
+
+                // For sequence arguments, they are expanded into scalars
+                if(e.second->kind == gentest_value::list_v
+                   && !in_list(m_lists_to_not_expand, e.first))
+                {
+                    auto list = e.second;
+                    auto key  = e.first;
+                    for(auto& item : list->list)
+                    {
+                        test[key] = item;
+                        generate(test);
+                    }
+                    return;
+                }
+            }
+
+            // Replace typed function names with generic functions and types
+            auto it = test.find("rocblas_function");
+            if(it != test.end())
+            {
+                auto func = it->second;
+                test.erase(it);
+                gentest_ptr entry;
+                if(func->kind == gentest_value::str_v && m_functions
+                   && m_functions->kind == gentest_value::dict_v)
+                {
+                    auto f = m_functions->dict.find(func->s);
+                    if(f != m_functions->dict.end())
+                        entry = f->second;
+                }
+                if(entry)
+                {
+                    if(entry->kind != gentest_value::dict_v)
+                        type_error(func->s.c_str(), *entry);
+                    for(auto& e : entry->dict)
+                        test[e.first] = e.second;
+                }
+                else
+                {
+                    if(func->kind != gentest_value::str_v)
+                        type_error("rocblas_function", *func);
+                    size_t pos       = func->s.rfind("rocblas_");
+                    test["function"] = make_str(
+                        pos == std::string::npos ? func->s : func->s.substr(pos + 8));
+                }
+                generate(std::move(test));
+                return;
+            }
+
+            instantiate(std::move(test));
+        }
+
+    public:
+        explicit gentest_document(std::vector<std::string>& records)
+            : m_records(records)
+        {
+        }
+
+        // Process one document in the YAML file
+        void process(const gentest_value* doc)
+        {
+            // Ignore empty documents
+            if(!doc || doc->kind != gentest_value::dict_v)
+                return;
+            auto tests = get(*doc, "Tests");
+            if(!tests || !truth(*tests))
+                return;
+            if(tests->kind != gentest_value::list_v)
+                throw gentest_error("Tests must be a list\n");
+
+            get_datatypes(*doc);
+            get_arguments(*doc);
+            m_dict_lists_to_expand = get(*doc, "Dictionary lists to expand");
+            m_lists_to_not_expand  = get(*doc, "Lists to not expand");
+            m_known_bugs           = get(*doc, "Known bugs");
+            m_functions            = get(*doc, "Functions");
+            auto defaults          = get(*doc, "Defaults");
+
+            if(m_known_bugs && m_known_bugs->kind != gentest_value::list_v)
+                m_known_bugs = nullptr;
+
+            // Instantiate all of the tests, starting with defaults
+            for(auto& test : tests->list)
+            {
+                if(test->kind != gentest_value::dict_v)
+                    throw gentest_error("Each test must be a dictionary\n");
+                gentest_dict test_case;
+                if(defaults && defaults->kind == gentest_value::dict_v)
+                    test_case = defaults->dict;
+                for(auto& e : test->dict)
+                    test_case[e.first] = e.second;
+                generate(std::move(test_case));
+            }
+        }
+    };
+
+    // The record which identifies the format of the binary file, checked by Arguments::validate()
+    std::string signature()
+    {
+        Arguments arg;
+        memset(&arg, 0, sizeof(arg));
+        unsigned sig = 0;
+
+        auto fill = [&](auto& field) {
+            auto* bytes = reinterpret_cast<unsigned char*>(&field);
+            for(size_t i = 0; i < sizeof(field); ++i)
+                bytes[i] = sig ^ i;
+            sig = (sig + 89) % 256;
+        };
+#define FILL(NAME) fill(arg.NAME)
+        FOR_EACH_ARGUMENT(FILL, ;);
+#undef FILL
+
+        std::string record("rocBLAS", 8);
+        record.append(reinterpret_cast<const char*>(&arg), sizeof(arg));
+        record.append("ROCblas", 8);
+        return record;
+    }
+
+    // Whether a line of the source starts or ends a document
+    bool is_marker(const std::string& text, const char* marker)
+    {
+        return !text.compare(0, 3, marker)
+               && (text.size() == 3 || text[3] == ' ' || text[3] == '\t');
+    }
+}
+
+std::string rocblas_gentest(const std::string&              yaml_file,
+                            const std::string&              template_file,
+                            const std::vector<std::string>& include_dirs)
+{
+    std::vector<gentest_line>                source;
+    std::vector<std::pair<size_t, size_t>>   docs;
+    std::vector<std::vector<std::string>>    records;
+    std::vector<std::string>                 errors;
+
+    try
+    {
+        if(!template_file.empty())
+            read_yaml_file(template_file, include_dirs, source);
+        read_yaml_file(yaml_file, include_dirs, source);
+
+        // Split the source into documents at the "---" and "..." lines
+        size_t begin = 0;
+        bool   open  = true;
+        for(size_t ln = 0; ln <= source.size(); ++ln)
+        {
+            bool start = ln < source.size() && is_marker(source[ln].text, "---");
+            bool end   = ln < source.size() && is_marker(source[ln].text, "...");
+            if(ln == source.size() || start || end)
+            {
+                if(open)
+                    docs.emplace_back(begin, ln);
+                begin = ln + 1;
+                open  = start;
+                if(start || end)
+                {
+                    auto rest = source[ln].text.find_first_not_of(" \t", 3);
+                    if(rest != std::string::npos && source[ln].text[rest] != '#')
+                        throw gentest_error(mark(source[ln], rest)
+                                            + "content on a document marker line is not "
+                                              "supported\n");
+                }
+            }
+            else if(!open)
+            {
+                auto content = source[ln].text.find_first_not_of(" \t");
+                if(content != std::string::npos && source[ln].text[content] != '#')
+                    throw gentest_error(mark(source[ln], content)
+                                        + "expected '<document start>'\n");
+            }
+        }
+    }
+    catch(const gentest_error& err)
+    {
+        rocblas_cerr << err.what();
+        exit(EXIT_FAILURE);
+    }
+
+    // Parse and expand the documents in parallel
+    records.resize(docs.size());
+    errors.resize(docs.size());
+
+#pragma omp parallel for schedule(dynamic)
+    for(size_t d = 0; d < docs.size(); ++d)
+    {
+        try
+        {
+            auto doc = gentest_parser(source, docs[d].first, docs[d].second).parse_document();
+            gentest_document(records[d]).process(doc.get());
+        }
+        catch(const std::exception& err)
+        {
+            errors[d] = err.what();
+        }
+    }
+
+    // Report the first error, as processing the documents in order would
+    for(auto& err : errors)
+        if(!err.empty())
+        {
+            rocblas_cerr << err;
+            exit(EXIT_FAILURE);
+        }
+
+    // Concatenate the records of the documents in order, keeping the first of any duplicates
+    size_t count = 0;
+    for(auto& r : records)
+        count += r.size();
+
+    std::string data = signature();
+    data.reserve(data.size() + count * sizeof(Arguments));
+
+    auto hash = [&](size_t ofs) {
+        return std::hash<std::string>{}(data.substr(ofs, sizeof(Arguments)));
+    };
+    auto equal = [&](size_t a, size_t b) {
+        return !memcmp(&data[a], &data[b], sizeof(Arguments));
+    };
+    std::unordered_set<size_t, decltype(hash), decltype(equal)> seen(count, hash, equal);
+
+    for(auto& r : records)
+    {
+        for(auto& record : r)
+        {
+            size_t ofs = data.size();
+            data += record;
+            if(!seen.insert(ofs).second)
+                data.resize(ofs);
+        }
+        std::vector<std::string>().swap(r);
+    }
+
+    // As in rocblas_gentest.py, the signature is only written with the first record
+    if(!count)
+        data.clear();
+
+    return data;
+}
@@ -217,7 +217,9 @@ def setdefaults(test):
                             'rotm_strided_batched', 'iamax_strided_batched',
                             'iamin_strided_batched', 'axpy_strided_batched',
                             'axpy_strided_batched_ex', 'nrm2_strided_batched_ex',
-                            'scal_strided_batched_ex'):
+                            'scal_strided_batched_ex', 'axpby_strided_batched',
+                            'waxpby_strided_batched', 'axpy_dot_strided_batched',
+                            'dot2_strided_batched'):
         setkey_product(test, 'stride_x', ['N', 'incx', 'stride_scale'])
         setkey_product(test, 'stride_y', ['N', 'incy', 'stride_scale'])
         # we are using stride_c for param in rotm
@@ -477,8 +479,9 @@ def instantiate(test):
                     break
 
         # Unless category is already set to known_bug or disabled, set
-        # known_bug_platforms to a space-separated list of platforms
-        test['known_bug_platforms'] = ' ' . join(known_bug_platforms) if test[
+        # known_bug_platforms to a sorted, space-separated list of platforms
+        test['known_bug_platforms'] = ' ' . join(
+            sorted(known_bug_platforms)) if test[
             'category'] not in ('known_bug') else ''
 
         write_test(test)
@@ -0,0 +1,67 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas_gentest.hpp"
+#include "../../library/src/include/rocblas_ostream.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/*
+ * rocblas-gentest expands a YAML test file with rocblas_gentest(), the expander used by the
+ * --yaml option of rocblas-test and rocblas-bench. It takes the command line of
+ * rocblas_gentest.py, so that the records of both can be compared.
+ */
+
+static int usage(const char* prog)
+{
+    rocblas_cerr << "Usage: " << prog << " [-I include_dir]... [-t template] [-o outfile] infile"
+                 << std::endl;
+    return EXIT_FAILURE;
+}
+
+int main(int argc, char* argv[])
+{
+    std::string              infile, outfile, template_file;
+    std::vector<std::string> include_dirs;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        if(!strncmp(arg, "-I", 2) && arg[2])
+            include_dirs.push_back(arg + 2);
+        else if(!strcmp(arg, "-I") && i + 1 < argc)
+            include_dirs.push_back(argv[++i]);
+        else if((!strcmp(arg, "-t") || !strcmp(arg, "--template")) && i + 1 < argc)
+            template_file = argv[++i];
+        else if((!strcmp(arg, "-o") || !strcmp(arg, "--out")) && i + 1 < argc)
+            outfile = argv[++i];
+        else if(arg[0] != '-' && infile.empty())
+            infile = arg;
+        else
+            return usage(argv[0]);
+    }
+
+    if(infile.empty())
+        return usage(argv[0]);
+
+    std::string data = rocblas_gentest(infile, template_file, include_dirs);
+
+    if(outfile.empty())
+        return fwrite(data.data(), 1, data.size(), stdout) == data.size() ? EXIT_SUCCESS
+                                                                          : EXIT_FAILURE;
+
+    std::ofstream out(outfile, std::ios::binary);
+    out.write(data.data(), data.size());
+    out.close();
+    if(!out)
+    {
+        rocblas_cerr << "Cannot write " << outfile << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -4,6 +4,8 @@
 
 #include "rocblas_parse_data.hpp"
 #include "rocblas_data.hpp"
+#include "rocblas_gentest.hpp"
+#include "rocblas_random.hpp"
 #include "utility.hpp"
 #include <cstdio>
 #include <cstdlib>
@@ -25,36 +27,21 @@ namespace std
 #endif
 #endif // WIN32
 
-// Parse YAML data
+// Parse YAML data into Arguments records, with the template installed with the clients
 static std::string rocblas_parse_yaml(const std::string& yaml)
 {
-    std::string tmp     = rocblas_tempname();
-    auto        exepath = rocblas_exepath();
-    auto cmd = exepath + "rocblas_gentest.py --template " + exepath + "rocblas_template.yaml -o "
-               + tmp + " " + yaml;
-    rocblas_cerr << cmd << std::endl;
-
-#ifdef WIN32
-    int status = std::system(cmd.c_str());
-    if(status == -1)
-        exit(EXIT_FAILURE);
-#else
-    int status = system(cmd.c_str());
-    if(status == -1 || !WIFEXITED(status) || WEXITSTATUS(status))
-        exit(EXIT_FAILURE);
-#endif
-
-    return tmp;
+    auto exepath = rocblas_exepath();
+    return rocblas_gentest(yaml, exepath + "rocblas_template.yaml", {exepath});
 }
 
-// Parse --data and --yaml command-line arguments
+// Parse --data, --yaml and --seed command-line arguments
 bool rocblas_parse_data(int& argc, char** argv, const std::string& default_file)
 {
     std::string filename;
     char**      argv_p = argv + 1;
     bool        help = false, yaml = false;
 
-    // Scan, process and remove any --yaml or --data options
+    // Scan, process and remove any --yaml, --data or --seed options
     for(int i = 1; argv[i]; ++i)
     {
         if(!strcmp(argv[i], "--data") || !strcmp(argv[i], "--yaml"))
@@ -78,6 +65,22 @@ bool rocblas_parse_data(int& argc, char** argv, const std::string& default_file)
             }
             filename = argv[++i];
         }
+        else if(!strcmp(argv[i], "--seed"))
+        {
+            if(!argv[i + 1] || !argv[i + 1][0])
+            {
+                rocblas_cerr << "The " << argv[i] << " option requires an argument" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            char*    end  = nullptr;
+            uint64_t seed = strtoull(argv[++i], &end, 0);
+            if(*end)
+            {
+                rocblas_cerr << "Invalid value for --seed: " << argv[i] << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            rocblas_set_seed(seed);
+        }
         else
         {
             *argv_p++ = argv[i];
@@ -85,7 +88,8 @@ bool rocblas_parse_data(int& argc, char** argv, const std::string& default_file)
             {
                 help = true;
                 rocblas_cout << "\n"
-                             << argv[0] << " [ --data <path> | --yaml <path> ] <options> ...\n"
+                             << argv[0]
+                             << " [ --data <path> | --yaml <path> ] [ --seed <n> ] <options> ...\n"
                              << std::endl;
             }
         }
@@ -100,12 +104,11 @@ bool rocblas_parse_data(int& argc, char** argv, const std::string& default_file)
     else if(filename == "")
         filename = default_file;
 
-    if(yaml)
-        filename = rocblas_parse_yaml(filename);
-
     if(filename != "")
     {
-        RocBLAS_TestData::set_filename(filename, yaml);
+        if(yaml)
+            RocBLAS_TestData::set_data(rocblas_parse_yaml(filename));
+        RocBLAS_TestData::set_filename(filename);
         return true;
     }
 
@@ -6,109 +6,93 @@
 
 // Random number generator
 // Note: We do not use random_device to initialize the RNG, because we want
-// repeatability in case of test failure. TODO: Add seed as an optional CLI
-// argument, and print the seed on output, to ensure repeatability.
-rocblas_rng_t g_rocblas_seed(69069); // A fixed seed to start at
+// repeatability in case of test failure. The seed can be changed with the
+// --seed option.
+uint64_t g_rocblas_seed = 69069; // A fixed seed to start at
 
 // This records the main thread ID at startup
 std::thread::id g_main_thread_id = std::this_thread::get_id();
 
-// For the main thread, we use g_rocblas_seed; for other threads, we start with a different seed but
-// deterministically based on the thread id's hash function.
+// For the main thread, we use the main stream of g_rocblas_seed; for other threads, we use a
+// different stream, starting at an index based on the thread id's hash function.
 thread_local rocblas_rng_t t_rocblas_rng = get_seed();
 
-thread_local int t_rocblas_rand_idx;
-
-// length to allow use as bitmask to wraparound
-#define RANDLEN 1024
-#define RANDWIN 256
-#define RANDBUF RANDLEN + RANDWIN
-static thread_local int    t_rand_init = 0;
-static thread_local float  t_rand_f_array[RANDBUF];
-static thread_local double t_rand_d_array[RANDBUF];
+thread_local uint32_t t_rocblas_matrix_id;
 
 /* ============================================================================================ */
 
-float rocblas_uniform_int_1_10()
+// Map a random 32-bit word to an integer in [1, 10]
+static inline float uniform_int_1_10(uint32_t word)
 {
-    if(!t_rand_init)
-    {
-        for(int i = 0; i < RANDBUF; i++)
-        {
-            t_rand_f_array[i]
-                = (float)std::uniform_int_distribution<unsigned>(1, 10)(t_rocblas_rng);
-            t_rand_d_array[i] = (double)t_rand_f_array[i];
-        }
-        t_rand_init = 1;
-    }
-    t_rocblas_rand_idx = (t_rocblas_rand_idx + 1) & (RANDLEN - 1);
-    return t_rand_f_array[t_rocblas_rand_idx];
+    return float(1 + ((uint64_t(word) * 10) >> 32));
 }
 
-inline int pseudo_rand_ptr_offset()
+float rocblas_uniform_int_1_10()
 {
-    t_rocblas_rand_idx = (t_rocblas_rand_idx + 1) & (RANDWIN - 1);
-    return t_rocblas_rand_idx;
+    return uniform_int_1_10(t_rocblas_rng());
 }
 
-void rocblas_uniform_int_1_10_run_float(float* ptr, size_t num)
+// The first two words of element index of a matrix, as drawn after rocblas_seek_rand()
+static inline void element_words(uint32_t matrix, uint64_t index, uint32_t& w0, uint32_t& w1)
 {
-    if(!t_rand_init)
-        rocblas_uniform_int_1_10();
+    uint32_t out[4];
+    rocblas_philox::block(0,
+                          uint32_t(index),
+                          uint32_t(index >> 32),
+                          matrix,
+                          uint32_t(g_rocblas_seed),
+                          uint32_t(g_rocblas_seed >> 32),
+                          out);
+    w0 = out[0];
+    w1 = out[1];
+}
 
-    for(size_t i = 0; i < num; i += RANDLEN)
+// The loops are independent across elements, so that they can be vectorized
+
+void rocblas_uniform_int_1_10_run_float(float* ptr, size_t num, uint32_t matrix, uint64_t index)
+{
+#pragma omp simd
+    for(size_t i = 0; i < num; i++)
     {
-        float* rptr = t_rand_f_array + pseudo_rand_ptr_offset();
-        size_t n    = i + RANDLEN < num ? RANDLEN : num - i;
-        memcpy(ptr, rptr, sizeof(float) * n);
-        ptr += RANDLEN;
+        uint32_t w0, w1;
+        element_words(matrix, index + i, w0, w1);
+        ptr[i] = uniform_int_1_10(w0);
     }
 }
 
-void rocblas_uniform_int_1_10_run_double(double* ptr, size_t num)
+void rocblas_uniform_int_1_10_run_double(double* ptr, size_t num, uint32_t matrix, uint64_t index)
 {
-    if(!t_rand_init)
-        rocblas_uniform_int_1_10();
-
-    for(size_t i = 0; i < num; i += RANDLEN)
+#pragma omp simd
+    for(size_t i = 0; i < num; i++)
     {
-        double* rptr = t_rand_d_array + pseudo_rand_ptr_offset();
-        size_t  n    = i + RANDLEN < num ? RANDLEN : num - i;
-        memcpy(ptr, rptr, sizeof(double) * n);
-        ptr += RANDLEN;
+        uint32_t w0, w1;
+        element_words(matrix, index + i, w0, w1);
+        ptr[i] = uniform_int_1_10(w0);
     }
 }
 
-void rocblas_uniform_int_1_10_run_float_complex(rocblas_float_complex* ptr, size_t num)
+void rocblas_uniform_int_1_10_run_float_complex(rocblas_float_complex* ptr,
+                                                size_t                 num,
+                                                uint32_t               matrix,
+                                                uint64_t               index)
 {
-    if(!t_rand_init)
-        rocblas_uniform_int_1_10();
-
-    constexpr int rand_len = RANDLEN / 2;
-    for(size_t i = 0; i < num; i += rand_len)
+    for(size_t i = 0; i < num; i++)
     {
-        float* rptr = t_rand_f_array + pseudo_rand_ptr_offset();
-        size_t n    = i + rand_len < num ? rand_len : num - i;
-        memcpy(ptr, rptr, sizeof(float) * 2 * n);
-        ptr += rand_len;
+        uint32_t w0, w1;
+        element_words(matrix, index + i, w0, w1);
+        ptr[i] = {uniform_int_1_10(w0), uniform_int_1_10(w1)};
     }
 }
 
-void rocblas_uniform_int_1_10_run_double_complex(rocblas_double_complex* ptr, size_t num)
+void rocblas_uniform_int_1_10_run_double_complex(rocblas_double_complex* ptr,
+                                                 size_t                  num,
+                                                 uint32_t                matrix,
+                                                 uint64_t                index)
 {
-    if(!t_rand_init)
-        rocblas_uniform_int_1_10();
-
-    constexpr int rand_len = RANDLEN / 2;
-    for(size_t i = 0; i < num; i += rand_len)
+    for(size_t i = 0; i < num; i++)
     {
-        double* rptr = t_rand_d_array + pseudo_rand_ptr_offset();
-        size_t  n    = i + rand_len < num ? rand_len : num - i;
-        memcpy(ptr, rptr, sizeof(double) * 2 * n);
-        ptr += rand_len;
+        uint32_t w0, w1;
+        element_words(matrix, index + i, w0, w1);
+        ptr[i] = {double(uniform_int_1_10(w0)), double(uniform_int_1_10(w1))};
     }
 }
-
-#undef RANDLEN
-#undef RANDWIN
-#undef RANDBUF
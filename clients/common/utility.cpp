@@ -265,6 +265,14 @@ rocblas_local_handle::rocblas_local_handle(const Arguments& arg)
     // Set the atomics mode
     auto status = rocblas_set_atomics_mode(m_handle, arg.atomics_mode);
 
+    // Set the reduction mode
+    if(status == rocblas_status_success)
+        status = rocblas_set_reduction_mode(m_handle, arg.reduction_mode);
+
+    // Set the nrm2 mode
+    if(status == rocblas_status_success)
+        status = rocblas_set_nrm2_mode(m_handle, arg.nrm2_mode);
+
     if(status == rocblas_status_success)
     {
         // If the test specifies user allocated workspace, allocate and use it
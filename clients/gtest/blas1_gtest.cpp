@@ -4,21 +4,36 @@
 #include "rocblas_data.hpp"
 #include "rocblas_datatype2string.hpp"
 #include "testing_asum.hpp"
+#include "testing_asum_64.hpp"
 #include "testing_asum_batched.hpp"
 #include "testing_asum_strided_batched.hpp"
+#include "testing_axpby.hpp"
+#include "testing_axpby_batched.hpp"
+#include "testing_axpby_strided_batched.hpp"
 #include "testing_axpy.hpp"
+#include "testing_axpy_64.hpp"
 #include "testing_axpy_batched.hpp"
+#include "testing_axpy_dot.hpp"
+#include "testing_axpy_dot_batched.hpp"
+#include "testing_axpy_dot_strided_batched.hpp"
 #include "testing_axpy_strided_batched.hpp"
 #include "testing_copy.hpp"
+#include "testing_copy_64.hpp"
 #include "testing_copy_batched.hpp"
 #include "testing_copy_strided_batched.hpp"
 #include "testing_dot.hpp"
+#include "testing_dot2.hpp"
+#include "testing_dot2_batched.hpp"
+#include "testing_dot2_strided_batched.hpp"
+#include "testing_dot_64.hpp"
 #include "testing_dot_batched.hpp"
 #include "testing_dot_strided_batched.hpp"
 #include "testing_iamax_iamin.hpp"
+#include "testing_iamax_iamin_64.hpp"
 #include "testing_iamax_iamin_batched.hpp"
 #include "testing_iamax_iamin_strided_batched.hpp"
 #include "testing_nrm2.hpp"
+#include "testing_nrm2_64.hpp"
 #include "testing_nrm2_batched.hpp"
 #include "testing_nrm2_strided_batched.hpp"
 #include "testing_rot.hpp"
@@ -34,11 +49,16 @@
 #include "testing_rotmg_batched.hpp"
 #include "testing_rotmg_strided_batched.hpp"
 #include "testing_scal.hpp"
+#include "testing_scal_64.hpp"
 #include "testing_scal_batched.hpp"
 #include "testing_scal_strided_batched.hpp"
 #include "testing_swap.hpp"
+#include "testing_swap_64.hpp"
 #include "testing_swap_batched.hpp"
 #include "testing_swap_strided_batched.hpp"
+#include "testing_waxpby.hpp"
+#include "testing_waxpby_batched.hpp"
+#include "testing_waxpby_strided_batched.hpp"
 #include "type_dispatch.hpp"
 #include "utility.hpp"
 
@@ -47,33 +67,43 @@ namespace
     enum class blas1
     {
         nrm2,
+        nrm2_64,
         nrm2_batched,
         nrm2_strided_batched,
         asum,
+        asum_64,
         asum_batched,
         asum_strided_batched,
         iamax,
+        iamax_64,
         iamax_batched,
         iamax_strided_batched,
         iamin,
+        iamin_64,
         iamin_batched,
         iamin_strided_batched,
         axpy,
+        axpy_64,
         axpy_batched,
         axpy_strided_batched,
         copy,
+        copy_64,
         copy_batched,
         copy_strided_batched,
         dot,
         dotc,
+        dot_64,
+        dotc_64,
         dot_batched,
         dotc_batched,
         dot_strided_batched,
         dotc_strided_batched,
         scal,
+        scal_64,
         scal_batched,
         scal_strided_batched,
         swap,
+        swap_64,
         swap_batched,
         swap_strided_batched,
         rot,
@@ -88,6 +118,18 @@ namespace
         rotmg,
         rotmg_batched,
         rotmg_strided_batched,
+        axpby,
+        axpby_batched,
+        axpby_strided_batched,
+        waxpby,
+        waxpby_batched,
+        waxpby_strided_batched,
+        axpy_dot,
+        axpy_dot_batched,
+        axpy_dot_strided_batched,
+        dot2,
+        dot2_batched,
+        dot2_strided_batched,
     };
 
     // ----------------------------------------------------------------------------
@@ -120,17 +162,30 @@ namespace
                 bool is_dot
                     = (BLAS1 == blas1::dot || BLAS1 == blas1::dot_batched
                        || BLAS1 == blas1::dot_strided_batched || BLAS1 == blas1::dotc
-                       || BLAS1 == blas1::dotc_batched || BLAS1 == blas1::dotc_strided_batched);
+                       || BLAS1 == blas1::dotc_batched || BLAS1 == blas1::dotc_strided_batched
+                       || BLAS1 == blas1::dot_64 || BLAS1 == blas1::dotc_64);
                 bool is_axpy  = (BLAS1 == blas1::axpy || BLAS1 == blas1::axpy_batched
-                                || BLAS1 == blas1::axpy_strided_batched);
+                                || BLAS1 == blas1::axpy_strided_batched
+                                || BLAS1 == blas1::axpy_64);
                 bool is_scal  = (BLAS1 == blas1::scal || BLAS1 == blas1::scal_batched
-                                || BLAS1 == blas1::scal_strided_batched);
+                                || BLAS1 == blas1::scal_strided_batched
+                                || BLAS1 == blas1::scal_64);
                 bool is_rot   = (BLAS1 == blas1::rot || BLAS1 == blas1::rot_batched
                                || BLAS1 == blas1::rot_strided_batched);
                 bool is_rotg  = (BLAS1 == blas1::rotg || BLAS1 == blas1::rotg_batched
                                 || BLAS1 == blas1::rotg_strided_batched);
                 bool is_rotmg = (BLAS1 == blas1::rotmg || BLAS1 == blas1::rotmg_batched
                                  || BLAS1 == blas1::rotmg_strided_batched);
+
+                bool is_axpby    = (BLAS1 == blas1::axpby || BLAS1 == blas1::axpby_batched
+                                 || BLAS1 == blas1::axpby_strided_batched || BLAS1 == blas1::waxpby
+                                 || BLAS1 == blas1::waxpby_batched
+                                 || BLAS1 == blas1::waxpby_strided_batched);
+                bool is_axpy_dot = (BLAS1 == blas1::axpy_dot || BLAS1 == blas1::axpy_dot_batched
+                                    || BLAS1 == blas1::axpy_dot_strided_batched);
+                bool is_dot2     = (BLAS1 == blas1::dot2 || BLAS1 == blas1::dot2_batched
+                                || BLAS1 == blas1::dot2_strided_batched);
+
                 bool is_batched
                     = (BLAS1 == blas1::nrm2_batched || BLAS1 == blas1::asum_batched
                        || BLAS1 == blas1::scal_batched || BLAS1 == blas1::swap_batched
@@ -138,7 +193,9 @@ namespace
                        || BLAS1 == blas1::dotc_batched || BLAS1 == blas1::rot_batched
                        || BLAS1 == blas1::rotm_batched || BLAS1 == blas1::rotg_batched
                        || BLAS1 == blas1::iamax_batched || BLAS1 == blas1::iamin_batched
-                       || BLAS1 == blas1::rotmg_batched || BLAS1 == blas1::axpy_batched);
+                       || BLAS1 == blas1::rotmg_batched || BLAS1 == blas1::axpy_batched
+                       || BLAS1 == blas1::axpby_batched || BLAS1 == blas1::waxpby_batched
+                       || BLAS1 == blas1::axpy_dot_batched || BLAS1 == blas1::dot2_batched);
                 bool is_strided
                     = (BLAS1 == blas1::nrm2_strided_batched || BLAS1 == blas1::asum_strided_batched
                        || BLAS1 == blas1::scal_strided_batched
@@ -152,7 +209,11 @@ namespace
                        || BLAS1 == blas1::rotmg_strided_batched
                        || BLAS1 == blas1::iamax_strided_batched
                        || BLAS1 == blas1::iamin_strided_batched
-                       || BLAS1 == blas1::axpy_strided_batched);
+                       || BLAS1 == blas1::axpy_strided_batched
+                       || BLAS1 == blas1::axpby_strided_batched
+                       || BLAS1 == blas1::waxpby_strided_batched
+                       || BLAS1 == blas1::axpy_dot_strided_batched
+                       || BLAS1 == blas1::dot2_strided_batched);
 
                 if((is_scal || is_rotg || is_rot) && arg.a_type != arg.b_type)
                     name << '_' << rocblas_datatype2string(arg.b_type);
@@ -162,9 +223,12 @@ namespace
                 if(!is_rotg && !is_rotmg)
                     name << '_' << arg.N;
 
-                if(is_axpy || is_scal)
+                if(is_axpy || is_scal || is_axpby || is_axpy_dot)
                     name << '_' << arg.alpha << "_" << arg.alphai;
 
+                if(is_axpby)
+                    name << '_' << arg.beta << "_" << arg.betai;
+
                 if(!is_rotg && !is_rotmg)
                     name << '_' << arg.incx;
 
@@ -177,15 +241,24 @@ namespace
                    || BLAS1 == blas1::copy_batched || is_dot || BLAS1 == blas1::swap
                    || BLAS1 == blas1::swap_batched || BLAS1 == blas1::swap_strided_batched || is_rot
                    || BLAS1 == blas1::rotm || BLAS1 == blas1::rotm_batched
-                   || BLAS1 == blas1::rotm_strided_batched)
+                   || BLAS1 == blas1::rotm_strided_batched || BLAS1 == blas1::copy_64
+                   || BLAS1 == blas1::swap_64 || is_axpby || is_axpy_dot || is_dot2)
                 {
                     name << '_' << arg.incy;
                 }
 
+                if(is_axpy_dot || is_dot2)
+                {
+                    name << '_' << arg.incz;
+                }
+
                 if(BLAS1 == blas1::swap_strided_batched || BLAS1 == blas1::copy_strided_batched
                    || BLAS1 == blas1::dot_strided_batched || BLAS1 == blas1::dotc_strided_batched
                    || BLAS1 == blas1::rot_strided_batched || BLAS1 == blas1::rotm_strided_batched
-                   || BLAS1 == blas1::axpy_strided_batched)
+                   || BLAS1 == blas1::axpy_strided_batched || BLAS1 == blas1::axpby_strided_batched
+                   || BLAS1 == blas1::waxpby_strided_batched
+                   || BLAS1 == blas1::axpy_dot_strided_batched
+                   || BLAS1 == blas1::dot2_strided_batched)
                 {
                     name << '_' << arg.stride_y;
                 }
@@ -226,20 +299,22 @@ namespace
     using blas1_enabled = std::integral_constant<
         bool,
         ((BLAS1 == blas1::asum || BLAS1 == blas1::asum_batched
-          || BLAS1 == blas1::asum_strided_batched)
+          || BLAS1 == blas1::asum_strided_batched || BLAS1 == blas1::asum_64)
          && std::is_same<Ti, To>{} && std::is_same<To, Tc>{}
          && (std::is_same<Ti, rocblas_float_complex>{} || std::is_same<Ti, rocblas_double_complex>{}
              || std::is_same<Ti, float>{} || std::is_same<Ti, double>{}))
 
             || ((BLAS1 == blas1::axpy || BLAS1 == blas1::axpy_batched
-                 || BLAS1 == blas1::axpy_strided_batched)
+                 || BLAS1 == blas1::axpy_strided_batched
+                 || BLAS1 == blas1::axpy_64)
                 && std::is_same<Ti, To>{} && std::is_same<To, Tc>{}
                 && (std::is_same<Ti, rocblas_half>{} || std::is_same<Ti, rocblas_float_complex>{}
                     || std::is_same<Ti, rocblas_double_complex>{} || std::is_same<Ti, float>{}
                     || std::is_same<Ti, double>{}))
 
             || ((BLAS1 == blas1::dot || BLAS1 == blas1::dot_batched
-                 || BLAS1 == blas1::dot_strided_batched)
+                 || BLAS1 == blas1::dot_strided_batched
+                 || BLAS1 == blas1::dot_64)
                     && (std::is_same<Ti, To>{} && std::is_same<To, Tc>{}
                         && (std::is_same<Ti, rocblas_half>{}
                             || std::is_same<Ti, rocblas_float_complex>{}
@@ -249,20 +324,23 @@ namespace
                     && std::is_same<Tc, float>{}))
 
             || ((BLAS1 == blas1::dotc || BLAS1 == blas1::dotc_batched
-                 || BLAS1 == blas1::dotc_strided_batched)
+                 || BLAS1 == blas1::dotc_strided_batched
+                 || BLAS1 == blas1::dotc_64)
                 && std::is_same<To, Ti>{} && std::is_same<To, Tc>{}
                 && (std::is_same<Ti, rocblas_float_complex>{}
                     || std::is_same<Ti, rocblas_double_complex>{}))
 
             || ((BLAS1 == blas1::nrm2 || BLAS1 == blas1::nrm2_batched
-                 || BLAS1 == blas1::nrm2_strided_batched)
+                 || BLAS1 == blas1::nrm2_strided_batched
+                 || BLAS1 == blas1::nrm2_64)
                 && std::is_same<Ti, To>{} && std::is_same<To, Tc>{}
                 && (std::is_same<Ti, rocblas_float_complex>{}
                     || std::is_same<Ti, rocblas_double_complex>{} || std::is_same<Ti, float>{}
                     || std::is_same<Ti, double>{}))
 
             || ((BLAS1 == blas1::scal || BLAS1 == blas1::scal_batched
-                 || BLAS1 == blas1::scal_strided_batched)
+                 || BLAS1 == blas1::scal_strided_batched
+                 || BLAS1 == blas1::scal_64)
                 && std::is_same<To, Tc>{}
                 && ((std::is_same<Ti, rocblas_float_complex>{} && std::is_same<Ti, To>{})
                     || (std::is_same<Ti, rocblas_double_complex>{} && std::is_same<Ti, To>{})
@@ -272,28 +350,32 @@ namespace
                     || (std::is_same<Ti, rocblas_double_complex>{} && std::is_same<To, double>{})))
 
             || ((BLAS1 == blas1::iamax || BLAS1 == blas1::iamax_batched
-                 || BLAS1 == blas1::iamax_strided_batched)
+                 || BLAS1 == blas1::iamax_strided_batched
+                 || BLAS1 == blas1::iamax_64)
                 && std::is_same<To, Ti>{} && std::is_same<To, Tc>{}
                 && (std::is_same<Ti, rocblas_float_complex>{}
                     || std::is_same<Ti, rocblas_double_complex>{} || std::is_same<Ti, float>{}
                     || std::is_same<Ti, double>{}))
 
             || ((BLAS1 == blas1::iamin || BLAS1 == blas1::iamin_batched
-                 || BLAS1 == blas1::iamin_strided_batched)
+                 || BLAS1 == blas1::iamin_strided_batched
+                 || BLAS1 == blas1::iamin_64)
                 && std::is_same<To, Ti>{} && std::is_same<To, Tc>{}
                 && (std::is_same<Ti, rocblas_float_complex>{}
                     || std::is_same<Ti, rocblas_double_complex>{} || std::is_same<Ti, float>{}
                     || std::is_same<Ti, double>{}))
 
             || ((BLAS1 == blas1::copy || BLAS1 == blas1::copy_batched
-                 || BLAS1 == blas1::copy_strided_batched)
+                 || BLAS1 == blas1::copy_strided_batched
+                 || BLAS1 == blas1::copy_64)
                 && std::is_same<To, Ti>{} && std::is_same<To, Tc>{}
                 && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
                     || std::is_same<Ti, rocblas_float_complex>{}
                     || std::is_same<Ti, rocblas_double_complex>{}))
 
             || ((BLAS1 == blas1::swap || BLAS1 == blas1::swap_batched
-                 || BLAS1 == blas1::swap_strided_batched)
+                 || BLAS1 == blas1::swap_strided_batched
+                 || BLAS1 == blas1::swap_64)
                 && std::is_same<To, Ti>{} && std::is_same<To, Tc>{}
                 && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
                     || std::is_same<Ti, rocblas_float_complex>{}
@@ -329,7 +411,18 @@ namespace
             || ((BLAS1 == blas1::rotmg || BLAS1 == blas1::rotmg_batched
                  || BLAS1 == blas1::rotmg_strided_batched)
                 && std::is_same<To, Ti>{} && std::is_same<To, Tc>{}
-                && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}))>;
+                && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}))
+
+            || ((BLAS1 == blas1::axpby || BLAS1 == blas1::axpby_batched
+                 || BLAS1 == blas1::axpby_strided_batched || BLAS1 == blas1::waxpby
+                 || BLAS1 == blas1::waxpby_batched || BLAS1 == blas1::waxpby_strided_batched
+                 || BLAS1 == blas1::axpy_dot || BLAS1 == blas1::axpy_dot_batched
+                 || BLAS1 == blas1::axpy_dot_strided_batched || BLAS1 == blas1::dot2
+                 || BLAS1 == blas1::dot2_batched || BLAS1 == blas1::dot2_strided_batched)
+                && std::is_same<To, Ti>{} && std::is_same<To, Tc>{}
+                && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                    || std::is_same<Ti, rocblas_float_complex>{}
+                    || std::is_same<Ti, rocblas_double_complex>{}))>;
 
 // Creates tests for one of the BLAS 1 functions
 // ARG passes 1-3 template arguments to the testing_* function
@@ -379,33 +472,43 @@ namespace
 #define ARG3(Ti, To, Tc) Ti, To, Tc
 
     BLAS1_TESTING(asum, ARG1)
+    BLAS1_TESTING(asum_64, ARG1)
     BLAS1_TESTING(asum_batched, ARG1)
     BLAS1_TESTING(asum_strided_batched, ARG1)
     BLAS1_TESTING(nrm2, ARG1)
+    BLAS1_TESTING(nrm2_64, ARG1)
     BLAS1_TESTING(nrm2_batched, ARG1)
     BLAS1_TESTING(nrm2_strided_batched, ARG1)
     BLAS1_TESTING(iamax, ARG1)
+    BLAS1_TESTING(iamax_64, ARG1)
     BLAS1_TESTING(iamax_batched, ARG1)
     BLAS1_TESTING(iamax_strided_batched, ARG1)
     BLAS1_TESTING(iamin, ARG1)
+    BLAS1_TESTING(iamin_64, ARG1)
     BLAS1_TESTING(iamin_batched, ARG1)
     BLAS1_TESTING(iamin_strided_batched, ARG1)
     BLAS1_TESTING(axpy, ARG1)
+    BLAS1_TESTING(axpy_64, ARG1)
     BLAS1_TESTING(axpy_batched, ARG1)
     BLAS1_TESTING(axpy_strided_batched, ARG1)
     BLAS1_TESTING(copy, ARG1)
+    BLAS1_TESTING(copy_64, ARG1)
     BLAS1_TESTING(copy_batched, ARG1)
     BLAS1_TESTING(copy_strided_batched, ARG1)
     BLAS1_TESTING(dot, ARG1)
     BLAS1_TESTING(dotc, ARG1)
+    BLAS1_TESTING(dot_64, ARG1)
+    BLAS1_TESTING(dotc_64, ARG1)
     BLAS1_TESTING(dot_batched, ARG1)
     BLAS1_TESTING(dotc_batched, ARG1)
     BLAS1_TESTING(dot_strided_batched, ARG1)
     BLAS1_TESTING(dotc_strided_batched, ARG1)
     BLAS1_TESTING(scal, ARG2)
+    BLAS1_TESTING(scal_64, ARG2)
     BLAS1_TESTING(scal_batched, ARG2)
     BLAS1_TESTING(scal_strided_batched, ARG2)
     BLAS1_TESTING(swap, ARG1)
+    BLAS1_TESTING(swap_64, ARG1)
     BLAS1_TESTING(swap_batched, ARG1)
     BLAS1_TESTING(swap_strided_batched, ARG1)
     BLAS1_TESTING(rot, ARG3)
@@ -420,5 +523,17 @@ namespace
     BLAS1_TESTING(rotmg, ARG1)
     BLAS1_TESTING(rotmg_batched, ARG1)
     BLAS1_TESTING(rotmg_strided_batched, ARG1)
+    BLAS1_TESTING(axpby, ARG1)
+    BLAS1_TESTING(axpby_batched, ARG1)
+    BLAS1_TESTING(axpby_strided_batched, ARG1)
+    BLAS1_TESTING(waxpby, ARG1)
+    BLAS1_TESTING(waxpby_batched, ARG1)
+    BLAS1_TESTING(waxpby_strided_batched, ARG1)
+    BLAS1_TESTING(axpy_dot, ARG1)
+    BLAS1_TESTING(axpy_dot_batched, ARG1)
+    BLAS1_TESTING(axpy_dot_strided_batched, ARG1)
+    BLAS1_TESTING(dot2, ARG1)
+    BLAS1_TESTING(dot2_batched, ARG1)
+    BLAS1_TESTING(dot2_strided_batched, ARG1)
 
 } // namespace
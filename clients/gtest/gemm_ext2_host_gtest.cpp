@@ -0,0 +1,272 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "../../library/src/blas_ex/rocblas_gemm_ext2_host.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Compare the blocked host gemm_ext2 against the naive reference, which it must match
+    // exactly, since this file and the library are compiled without floating-point contraction
+    template <typename Ti, typename To, typename Tc>
+    void check_gemm_ext2_host(rocblas_int M,
+                              rocblas_int N,
+                              rocblas_int K,
+                              bool        row_major,
+                              rocblas_int pad,
+                              Tc          alpha,
+                              Tc          beta)
+    {
+        std::mt19937 gen(M * 1009 + N * 101 + K);
+        auto         random = [&] { return int(gen() % 9) - 4; };
+
+        // Size of an r x c matrix, and its strides in either layout
+        auto layout = [=](rocblas_int     r,
+                          rocblas_int     c,
+                          bool            rows,
+                          rocblas_stride& row_stride,
+                          rocblas_stride& col_stride) {
+            row_stride = rows ? c + pad : 1;
+            col_stride = rows ? 1 : r + pad;
+            return r > 0 && c > 0 ? size_t((r - 1) * row_stride + (c - 1) * col_stride + 1) : 0;
+        };
+
+        rocblas_stride rsa, csa, rsb, csb, rsc, csc, rsd, csd;
+        std::vector<Ti> A(layout(M, K, row_major, rsa, csa));
+        std::vector<Ti> B(layout(K, N, !row_major, rsb, csb));
+        std::vector<To> C(layout(M, N, false, rsc, csc));
+        std::vector<To> D(layout(M, N, row_major, rsd, csd));
+
+        for(auto& a : A)
+            a = Ti(random());
+        for(auto& b : B)
+            b = Ti(random());
+        for(auto& c : C)
+            c = To(random());
+        for(auto& d : D)
+            d = To(random());
+        std::vector<To> D_ref = D;
+
+        reference_gemm_ext2<Ti, To, Tc>(M,
+                                        N,
+                                        K,
+                                        &alpha,
+                                        A.data(),
+                                        rsa,
+                                        csa,
+                                        B.data(),
+                                        rsb,
+                                        csb,
+                                        &beta,
+                                        C.data(),
+                                        rsc,
+                                        csc,
+                                        D_ref.data(),
+                                        rsd,
+                                        csd);
+
+        // Compute the columns in two ranges, as the pipelined fallback does
+        gemm_ext2_host<Ti, To, Tc> gemm(M,
+                                        N,
+                                        K,
+                                        alpha,
+                                        A.data(),
+                                        rsa,
+                                        csa,
+                                        B.data(),
+                                        rsb,
+                                        csb,
+                                        beta,
+                                        C.data(),
+                                        rsc,
+                                        csc,
+                                        D.data(),
+                                        rsd,
+                                        csd);
+        gemm(0, N / 3);
+        gemm(N / 3, N);
+
+        EXPECT_EQ(memcmp(D.data(), D_ref.data(), D.size() * sizeof(To)), 0)
+            << "M=" << M << " N=" << N << " K=" << K << " row_major=" << row_major
+            << " pad=" << pad;
+    }
+
+    // Compare the on-host gemm_ext2 of device arrays against the naive reference. With N above
+    // the minimum block of columns, the fetching thread and the stores of the finished parts of
+    // D overlap the computation. The elements between those of D must be left unchanged.
+    template <typename Ti, typename To, typename Tc>
+    void check_gemm_ext2_host_device(rocblas_int    M,
+                                     rocblas_int    N,
+                                     rocblas_int    K,
+                                     rocblas_stride row_stride_d,
+                                     rocblas_stride col_stride_d,
+                                     rocblas_int    pad,
+                                     Tc             alpha,
+                                     Tc             beta)
+    {
+        std::mt19937 gen(M * 1009 + N * 101 + K);
+        auto         random = [&] { return int(gen() % 9) - 4; };
+
+        // A and B are column-major and C is row-major, with gaps between their columns or rows
+        rocblas_stride rsa = 1, csa = M + pad, rsb = 1, csb = K + pad, rsc = N + pad, csc = 1;
+
+        // Size of an r x c matrix with the given strides
+        auto end = [](rocblas_int r, rocblas_int c, rocblas_stride rs, rocblas_stride cs) {
+            return size_t((r - 1) * rs + (c - 1) * cs + 1);
+        };
+
+        host_vector<Ti> hA(end(M, K, rsa, csa));
+        host_vector<Ti> hB(end(K, N, rsb, csb));
+        host_vector<To> hC(end(M, N, rsc, csc));
+        host_vector<To> hD(end(M, N, row_stride_d, col_stride_d));
+        for(auto& a : hA)
+            a = Ti(random());
+        for(auto& b : hB)
+            b = Ti(random());
+        for(auto& c : hC)
+            c = To(random());
+        for(auto& d : hD)
+            d = To(random());
+        host_vector<To> hD_ref = hD;
+
+        device_vector<Ti> dA(hA.size());
+        device_vector<Ti> dB(hB.size());
+        device_vector<To> dC(hC.size());
+        device_vector<To> dD(hD.size());
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+        CHECK_DEVICE_ALLOCATION(dD.memcheck());
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+
+        reference_gemm_ext2<Ti, To, Tc>(M,
+                                        N,
+                                        K,
+                                        &alpha,
+                                        hA.data(),
+                                        rsa,
+                                        csa,
+                                        hB.data(),
+                                        rsb,
+                                        csb,
+                                        &beta,
+                                        hC.data(),
+                                        rsc,
+                                        csc,
+                                        hD_ref.data(),
+                                        row_stride_d,
+                                        col_stride_d);
+
+        int device;
+        CHECK_HIP_ERROR(hipGetDevice(&device));
+        CHECK_HIP_ERROR((gemm_ext2_host_device<Ti, To, Tc>(device,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           alpha,
+                                                           dA,
+                                                           rsa,
+                                                           csa,
+                                                           dB,
+                                                           rsb,
+                                                           csb,
+                                                           beta,
+                                                           dC,
+                                                           rsc,
+                                                           csc,
+                                                           dD,
+                                                           row_stride_d,
+                                                           col_stride_d)));
+        CHECK_HIP_ERROR(hD.transfer_from(dD));
+
+        EXPECT_EQ(memcmp(hD.data(), hD_ref.data(), hD.size() * sizeof(To)), 0)
+            << "M=" << M << " N=" << N << " K=" << K << " row_stride_d=" << row_stride_d
+            << " col_stride_d=" << col_stride_d;
+    }
+
+    template <typename...>
+    struct testing_gemm_ext2_host : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            for(rocblas_int M : {1, 7, 65, 130})
+                for(rocblas_int N : {1, 5, 70})
+                    for(rocblas_int K : {0, 1, 300})
+                        for(bool row_major : {false, true})
+                            for(rocblas_int pad : {0, 3})
+                            {
+                                check_gemm_ext2_host<float, float, float>(
+                                    M, N, K, row_major, pad, 1.5f, 0.5f);
+                                check_gemm_ext2_host<float, float, float>(
+                                    M, N, K, row_major, pad, 0.0f, 2.0f);
+                                check_gemm_ext2_host<double, double, double>(
+                                    M, N, K, row_major, pad, -2.0, 0.0);
+                                check_gemm_ext2_host<int8_t, int32_t, int32_t>(
+                                    M, N, K, row_major, pad, 3, -2);
+                            }
+
+            // Device arrays, with column-major and row-major D, with and without gaps, and with
+            // overlapping elements of D, which use the naive path
+            for(rocblas_int N : {1, 200})
+                for(rocblas_int pad : {0, 3})
+                {
+                    const rocblas_int M = 65, K = 33;
+                    check_gemm_ext2_host_device<float, float, float>(
+                        M, N, K, 1, M + pad, pad, 1.5f, 0.5f);
+                    check_gemm_ext2_host_device<float, float, float>(
+                        M, N, K, N + pad, 1, pad, 1.5f, 0.5f);
+                    check_gemm_ext2_host_device<double, double, double>(
+                        M, N, K, N + pad, 1, pad, -2.0, 0.0);
+                    check_gemm_ext2_host_device<int8_t, int32_t, int32_t>(
+                        M, N, K, 1, M + pad, pad, 3, -2);
+                }
+            check_gemm_ext2_host_device<float, float, float>(65, 200, 33, 1, 0, 0, 1.5f, 0.0f);
+
+            // Distinctness of the elements of D decides between the blocked and naive paths
+            EXPECT_TRUE(gemm_ext2_host_distinct(4, 3, 1, 4));
+            EXPECT_TRUE(gemm_ext2_host_distinct(4, 3, 3, 1));
+            EXPECT_TRUE(gemm_ext2_host_distinct(1, 3, 0, 1));
+            EXPECT_FALSE(gemm_ext2_host_distinct(4, 3, 1, 3));
+            EXPECT_FALSE(gemm_ext2_host_distinct(4, 3, 0, 4));
+            EXPECT_FALSE(gemm_ext2_host_distinct(4, 3, -1, 4));
+        }
+    };
+
+    struct gemm_ext2_host_test : RocBLAS_Test<gemm_ext2_host_test, testing_gemm_ext2_host>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemm_ext2_host");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<gemm_ext2_host_test>(arg.name);
+        }
+    };
+
+    TEST_P(gemm_ext2_host_test, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_gemm_ext2_host<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_ext2_host_test)
+
+} // namespace
@@ -5,6 +5,7 @@
 #include "rocblas_datatype2string.hpp"
 #include "rocblas_test.hpp"
 #include "testing_gemm.hpp"
+#include "testing_gemm_64.hpp"
 #include "testing_gemm_batched.hpp"
 #include "testing_gemm_batched_ex.hpp"
 #include "testing_gemm_ex.hpp"
@@ -22,6 +23,7 @@ namespace
     enum gemm_test_type
     {
         GEMM,
+        GEMM_64,
         GEMM_EX,
         GEMM_BATCHED,
         GEMM_BATCHED_EX,
@@ -63,6 +65,9 @@ namespace
             case GEMM:
                 return !strcmp(arg.function, "gemm") || !strcmp(arg.function, "gemm_bad_arg");
 
+            case GEMM_64:
+                return !strcmp(arg.function, "gemm_64") || !strcmp(arg.function, "gemm_64_bad_arg");
+
             case GEMM_BATCHED:
                 return !strcmp(arg.function, "gemm_batched")
                        || !strcmp(arg.function, "gemm_batched_bad_arg");
@@ -171,6 +176,10 @@ namespace
                 testing_gemm<T>(arg);
             else if(!strcmp(arg.function, "gemm_bad_arg"))
                 testing_gemm_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gemm_64"))
+                testing_gemm_64<T>(arg);
+            else if(!strcmp(arg.function, "gemm_64_bad_arg"))
+                testing_gemm_64_bad_arg<T>(arg);
             else if(!strcmp(arg.function, "gemm_batched"))
                 testing_gemm_batched<T>(arg);
             else if(!strcmp(arg.function, "gemm_batched_bad_arg"))
@@ -191,6 +200,13 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(gemm);
 
+    using gemm_64 = gemm_test_template<gemm_testing, GEMM_64>;
+    TEST_P(gemm_64, blas3_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(rocblas_gemm_dispatch<gemm_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_64);
+
     using gemm_batched = gemm_test_template<gemm_testing, GEMM_BATCHED>;
     TEST_P(gemm_batched, blas3_tensile)
     {
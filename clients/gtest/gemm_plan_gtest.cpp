@@ -0,0 +1,187 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <string>
+
+namespace
+{
+    // Check that executing a gemm plan gives the same results as
+    // rocblas_gemm_strided_batched_ex with the same arguments
+    template <typename...>
+    struct testing_gemm_plan : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            rocblas_local_handle handle;
+            rocblas_gemm_plan    plan = nullptr;
+
+            const rocblas_operation transA = rocblas_operation_none;
+            const rocblas_operation transB = rocblas_operation_transpose;
+            const rocblas_int       M = 64, N = 48, K = 32, batch_count = 3;
+            const rocblas_int       lda = M, ldb = N, ldc = M, ldd = M;
+            const rocblas_stride    stride_a = lda * K, stride_b = ldb * K;
+            const rocblas_stride    stride_c = ldc * N, stride_d = ldd * N;
+            const rocblas_datatype  type     = rocblas_datatype_f32_r;
+
+            auto create = [&](rocblas_gemm_plan* plan, rocblas_int m, rocblas_int lda) {
+                return rocblas_gemm_plan_create(handle,
+                                                plan,
+                                                transA,
+                                                transB,
+                                                m,
+                                                N,
+                                                K,
+                                                type,
+                                                lda,
+                                                stride_a,
+                                                type,
+                                                ldb,
+                                                stride_b,
+                                                type,
+                                                ldc,
+                                                stride_c,
+                                                type,
+                                                ldd,
+                                                stride_d,
+                                                batch_count,
+                                                type,
+                                                rocblas_gemm_flags_none);
+            };
+
+            EXPECT_ROCBLAS_STATUS(create(nullptr, M, lda), rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(create(&plan, -1, lda), rocblas_status_invalid_size);
+            EXPECT_ROCBLAS_STATUS(create(&plan, M, M - 1), rocblas_status_invalid_size);
+            EXPECT_EQ(plan, nullptr);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_gemm_plan_execute(handle, nullptr, &M, &M, &M, &M, &M, nullptr),
+                rocblas_status_invalid_pointer);
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_plan_destroy(nullptr));
+
+            CHECK_ROCBLAS_ERROR(create(&plan, M, lda));
+            ASSERT_NE(plan, nullptr);
+
+            host_vector<float> hA(size_t(stride_a) * batch_count);
+            host_vector<float> hB(size_t(stride_b) * batch_count);
+            host_vector<float> hC(size_t(stride_c) * batch_count);
+            host_vector<float> hD_gold(size_t(stride_d) * batch_count);
+            host_vector<float> hD_plan(size_t(stride_d) * batch_count);
+
+            rocblas_seedrand();
+            rocblas_init<float>(hA, M, K, lda, stride_a, batch_count);
+            rocblas_init<float>(hB, N, K, ldb, stride_b, batch_count);
+            rocblas_init<float>(hC, M, N, ldc, stride_c, batch_count);
+
+            device_vector<float> dA(hA.size());
+            device_vector<float> dB(hB.size());
+            device_vector<float> dC(hC.size());
+            device_vector<float> dD(hD_gold.size());
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+            CHECK_DEVICE_ALLOCATION(dD.memcheck());
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            // beta == 0 and beta == 1 use the solutions selected at creation, both out of place
+            // and in place, and beta == 0.5 selects a solution on its first execution; all of the
+            // executions must match gemm_strided_batched_ex
+            const float alpha = 2.0f;
+            for(bool in_place : {false, true})
+            {
+                for(float beta : {1.0f, 0.0f, 0.5f, 0.5f})
+                {
+                    // In place, C is D and it is reset before each call
+                    float* c = in_place ? (float*)dD : (float*)dC;
+                    auto   reset_d = [&] {
+                        if(in_place)
+                            CHECK_HIP_ERROR(dD.transfer_from(hC));
+                        else
+                            CHECK_HIP_ERROR(hipMemset(dD, 0, sizeof(float) * hD_plan.size()));
+                    };
+
+                    reset_d();
+                    CHECK_ROCBLAS_ERROR(
+                        rocblas_gemm_strided_batched_ex(handle,
+                                                        transA,
+                                                        transB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        &alpha,
+                                                        dA,
+                                                        type,
+                                                        lda,
+                                                        stride_a,
+                                                        dB,
+                                                        type,
+                                                        ldb,
+                                                        stride_b,
+                                                        &beta,
+                                                        c,
+                                                        type,
+                                                        ldc,
+                                                        stride_c,
+                                                        dD,
+                                                        type,
+                                                        ldd,
+                                                        stride_d,
+                                                        batch_count,
+                                                        type,
+                                                        rocblas_gemm_algo_standard,
+                                                        0,
+                                                        rocblas_gemm_flags_none));
+                    CHECK_HIP_ERROR(hD_gold.transfer_from(dD));
+
+                    reset_d();
+                    CHECK_ROCBLAS_ERROR(
+                        rocblas_gemm_plan_execute(handle, plan, &alpha, dA, dB, &beta, c, dD));
+                    CHECK_HIP_ERROR(hD_plan.transfer_from(dD));
+
+                    unit_check_general<float>(M, N, ldd, stride_d, hD_gold, hD_plan, batch_count);
+                }
+            }
+
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_plan_destroy(plan));
+        }
+    };
+
+    struct gemm_plan : RocBLAS_Test<gemm_plan, testing_gemm_plan>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemm_plan");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<gemm_plan>(arg.name);
+        }
+    };
+
+    TEST_P(gemm_plan, blas3_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_gemm_plan<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_plan)
+
+} // namespace
@@ -6,6 +6,7 @@
 #include "rocblas_datatype2string.hpp"
 #include "rocblas_test.hpp"
 #include "testing_gemv.hpp"
+#include "testing_gemv_64.hpp"
 #include "testing_gemv_batched.hpp"
 #include "testing_gemv_strided_batched.hpp"
 #include "type_dispatch.hpp"
@@ -19,6 +20,7 @@ namespace
     enum gemv_test_type
     {
         GEMV,
+        GEMV_64,
         GEMV_BATCHED,
         GEMV_STRIDED_BATCHED,
     };
@@ -40,6 +42,8 @@ namespace
             {
             case GEMV:
                 return !strcmp(arg.function, "gemv") || !strcmp(arg.function, "gemv_bad_arg");
+            case GEMV_64:
+                return !strcmp(arg.function, "gemv_64") || !strcmp(arg.function, "gemv_64_bad_arg");
             case GEMV_BATCHED:
                 return !strcmp(arg.function, "gemv_batched")
                        || !strcmp(arg.function, "gemv_batched_bad_arg");
@@ -105,6 +109,10 @@ namespace
                 testing_gemv<T>(arg);
             else if(!strcmp(arg.function, "gemv_bad_arg"))
                 testing_gemv_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gemv_64"))
+                testing_gemv_64<T>(arg);
+            else if(!strcmp(arg.function, "gemv_64_bad_arg"))
+                testing_gemv_64_bad_arg<T>(arg);
             else if(!strcmp(arg.function, "gemv_batched"))
                 testing_gemv_batched<T>(arg);
             else if(!strcmp(arg.function, "gemv_batched_bad_arg"))
@@ -125,6 +133,13 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(gemv);
 
+    using gemv_64 = gemv_template<gemv_testing, GEMV_64>;
+    TEST_P(gemv_64, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(rocblas_simple_dispatch<gemv_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemv_64);
+
     using gemv_batched = gemv_template<gemv_testing, GEMV_BATCHED>;
     TEST_P(gemv_batched, blas2)
     {
@@ -6,10 +6,19 @@
 
 #include "../../library/src/include/check_numerics_matrix.hpp"
 #include "../../library/src/include/check_numerics_vector.hpp"
+#include "norm.hpp"
 #include "rocblas_data.hpp"
 #include "rocblas_vector.hpp"
 #include "type_dispatch.hpp"
 
+// The LAPACK norms which the fused norm check is compared with
+extern "C" {
+float  slange_(char* norm_type, int* m, int* n, float* A, int* lda, float* work);
+double dlange_(char* norm_type, int* m, int* n, double* A, int* lda, double* work);
+float  clange_(char* norm_type, int* m, int* n, rocblas_float_complex* A, int* lda, float* work);
+double zlange_(char* norm_type, int* m, int* n, rocblas_double_complex* A, int* lda, double* work);
+}
+
 namespace
 {
     template <typename T>
@@ -185,6 +194,210 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(complex_operators);
 
+    //
+    // random initialization
+
+    // The random values of a matrix must not depend on its leading dimension or stride
+    template <typename T>
+    void testing_init_layout(const Arguments& arg)
+    {
+        size_t M = arg.M, N = arg.N, batch_count = arg.batch_count;
+
+        size_t lda_1 = M, stride_1 = M * N;
+        size_t lda_2 = M + 3, stride_2 = lda_2 * N + 7;
+
+        host_vector<T> hA_1(stride_1 * batch_count), hA_2(stride_2 * batch_count);
+
+        rocblas_seedrand();
+        rocblas_init<T>(hA_1, M, N, lda_1, stride_1, batch_count);
+        rocblas_seedrand();
+        rocblas_init<T>(hA_2, M, N, lda_2, stride_2, batch_count);
+
+        for(size_t b = 0; b < batch_count; b++)
+            for(size_t j = 0; j < N; j++)
+                for(size_t i = 0; i < M; i++)
+                    ASSERT_EQ(hA_1[b * stride_1 + j * lda_1 + i],
+                              hA_2[b * stride_2 + j * lda_2 + i])
+                        << "at element (" << i << ", " << j << ") of batch " << b;
+    }
+
+    template <typename T, typename = void>
+    struct init_layout_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct init_layout_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "init_layout"))
+                testing_init_layout<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    struct init_layout : RocBLAS_Test<init_layout, init_layout_testing>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "init_layout");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<init_layout> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type) << '_' << arg.M << '_' << arg.N << '_'
+                 << arg.batch_count;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(init_layout, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<init_layout_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(init_layout);
+
+    //
+    // norm check
+
+    inline double xlange(char norm_type, int m, int n, float* A, int lda, float* work)
+    {
+        return slange_(&norm_type, &m, &n, A, &lda, work);
+    }
+
+    inline double xlange(char norm_type, int m, int n, double* A, int lda, double* work)
+    {
+        return dlange_(&norm_type, &m, &n, A, &lda, work);
+    }
+
+    inline double
+        xlange(char norm_type, int m, int n, rocblas_float_complex* A, int lda, float* work)
+    {
+        return clange_(&norm_type, &m, &n, A, &lda, work);
+    }
+
+    inline double
+        xlange(char norm_type, int m, int n, rocblas_double_complex* A, int lda, double* work)
+    {
+        return zlange_(&norm_type, &m, &n, A, &lda, work);
+    }
+
+    // The fused norm check must agree with xLANGE of the difference divided by xLANGE of the
+    // reference, which is how the check was computed before it was fused
+    template <typename T>
+    void testing_norm_check(const Arguments& arg)
+    {
+        using R = real_t<T>;
+
+        rocblas_int M = arg.M, N = arg.N;
+        size_t      lda = std::max(size_t(M), size_t(arg.lda));
+
+        host_vector<T> hA(lda * N), hB(lda * N), hD(lda * N);
+        std::vector<R> work(std::max(M, 1));
+
+        rocblas_seedrand();
+        rocblas_init<T>(hA, M, N, lda);
+
+        for(rocblas_int j = 0; j < N; j++)
+        {
+            for(size_t i = 0; i < lda; i++)
+            {
+                size_t k = j * lda + i;
+                if(i < size_t(M))
+                {
+                    // Small perturbations, as between the CPU and GPU results
+                    hB[k] = hA[k] + T(R(1e-3) * R((i + 3 * j) % 5 + 1));
+                    hD[k] = hB[k] - hA[k];
+                }
+                else
+                {
+                    // The padding must not be read
+                    hA[k] = T(R(1e6));
+                    hB[k] = T(R(-1e6));
+                }
+            }
+        }
+
+        for(char norm_type : {'O', 'I', 'F', 'M'})
+        {
+            double lapack = xlange(norm_type, M, N, hD.data(), lda, work.data())
+                            / xlange(norm_type, M, N, hA.data(), lda, work.data());
+            double fused  = norm_check_general<T>(norm_type, M, N, lda, hA, hB.data());
+
+            // xLANGE accumulates in the precision of T, while the fused check uses double
+            double tol = 4 * std::max(M, N) * std::numeric_limits<R>::epsilon() * lapack;
+            EXPECT_NEAR(fused, lapack, tol) << "for norm " << norm_type;
+        }
+    }
+
+    template <typename T, typename = void>
+    struct norm_check_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct norm_check_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "norm_check"))
+                testing_norm_check<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    struct norm_check : RocBLAS_Test<norm_check, norm_check_testing>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "norm_check");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<norm_check> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type) << '_' << arg.M << '_' << arg.N << '_'
+                 << arg.lda;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(norm_check, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<norm_check_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(norm_check);
+
     //Testing a vector for NaN/zero/Inf/denormal values
     template <typename T>
     void testing_check_numerics_vector(const Arguments& arg)
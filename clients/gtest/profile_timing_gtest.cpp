@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <map>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    // Test the timing statistics and derived rates of the profile log
+    template <typename...>
+    struct testing_profile_timing : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            argument_profile_timing timing;
+            EXPECT_EQ(timing.get().count, 0u);
+
+            for(double us : {0.5, 1.0, 3.0, 3.5, 100.0})
+                timing.record(us);
+
+            auto stats = timing.get();
+            EXPECT_EQ(stats.count, 5u);
+            EXPECT_DOUBLE_EQ(stats.total, 108.0);
+            EXPECT_DOUBLE_EQ(stats.min, 0.5);
+            EXPECT_DOUBLE_EQ(stats.max, 100.0);
+
+            // Bucket b > 0 holds times in [2^(b-1), 2^b) us
+            EXPECT_EQ(stats.histogram[0], 1u);
+            EXPECT_EQ(stats.histogram[1], 1u);
+            EXPECT_EQ(stats.histogram[2], 2u);
+            EXPECT_EQ(stats.histogram[7], 1u);
+
+            std::ostringstream os;
+            os << argument_profile_histogram{stats};
+            EXPECT_EQ(os.str(), "{ 1: 1, 2: 1, 4: 2, 128: 1 }");
+
+            auto count = [](const char*                               function,
+                            const std::map<std::string, double>&      values,
+                            const std::map<std::string, std::string>& strings,
+                            double&                                   gflop,
+                            double&                                   gbyte) {
+                bool has_gflop, has_gbyte;
+                argument_profile_gflop_gbyte_count(
+                    function, values, strings, has_gflop, gflop, has_gbyte, gbyte);
+                return std::make_pair(has_gflop, has_gbyte);
+            };
+
+            double gflop, gbyte;
+            EXPECT_EQ(count("rocblas_sgemm_strided_batched",
+                            {{"M", 100}, {"N", 200}, {"K", 300}, {"batch_count", 2}},
+                            {{"transA", "N"}, {"transB", "T"}},
+                            gflop,
+                            gbyte),
+                      std::make_pair(true, false));
+            EXPECT_DOUBLE_EQ(gflop, 2 * gemm_gflop_count<float>(100, 200, 300));
+
+            EXPECT_EQ(count("rocblas_gemm_ex",
+                            {{"M", 64}, {"N", 64}, {"K", 64}},
+                            {{"a_type", "f16_r"}},
+                            gflop,
+                            gbyte),
+                      std::make_pair(true, false));
+            EXPECT_DOUBLE_EQ(gflop, gemm_gflop_count<rocblas_half>(64, 64, 64));
+
+            EXPECT_EQ(count("rocblas_zgemv",
+                            {{"M", 30}, {"N", 40}},
+                            {{"transA", "C"}},
+                            gflop,
+                            gbyte),
+                      std::make_pair(true, true));
+            EXPECT_DOUBLE_EQ(
+                gflop,
+                gemv_gflop_count<rocblas_double_complex>(rocblas_operation_conjugate_transpose,
+                                                         30,
+                                                         40));
+            EXPECT_DOUBLE_EQ(
+                gbyte,
+                gemv_gbyte_count<rocblas_double_complex>(rocblas_operation_conjugate_transpose,
+                                                         30,
+                                                         40));
+
+            EXPECT_EQ(count("rocblas_csscal", {{"N", 1000}}, {}, gflop, gbyte),
+                      std::make_pair(true, true));
+            EXPECT_DOUBLE_EQ(gflop, (scal_gflop_count<rocblas_float_complex, float>(1000)));
+
+            EXPECT_EQ(count("rocblas_scopy", {{"N", 1000}}, {}, gflop, gbyte),
+                      std::make_pair(false, true));
+            EXPECT_DOUBLE_EQ(gbyte, copy_gbyte_count<float>(1000));
+
+            // Functions without known counts, and invalid sizes, have no rates
+            EXPECT_EQ(count("rocblas_isamax", {{"N", 1000}}, {}, gflop, gbyte),
+                      std::make_pair(false, false));
+            EXPECT_EQ(count("rocblas_sgemm", {{"M", -1}, {"N", 10}, {"K", 10}}, {}, gflop, gbyte),
+                      std::make_pair(false, false));
+        }
+    };
+
+    struct profile_timing : RocBLAS_Test<profile_timing, testing_profile_timing>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "profile_timing");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<profile_timing>(arg.name);
+        }
+    };
+
+    TEST_P(profile_timing, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_profile_timing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(profile_timing)
+
+} // namespace
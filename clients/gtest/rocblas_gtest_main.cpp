@@ -6,6 +6,7 @@
 
 #include "rocblas_data.hpp"
 #include "rocblas_parse_data.hpp"
+#include "rocblas_random.hpp"
 #include "rocblas_test.hpp"
 #include "test_cleanup.hpp"
 #include "utility.hpp"
@@ -242,6 +243,9 @@ int main(int argc, char** argv)
     // Set data file path
     rocblas_parse_data(argc, argv, rocblas_exepath() + "rocblas_gtest.data");
 
+    // Print the seed, so that failures can be reproduced with --seed
+    rocblas_cout << "rocblas-test INFO: random seed " << g_rocblas_seed << std::endl;
+
     // Initialize Google Tests
     testing::InitGoogleTest(&argc, argv);
 
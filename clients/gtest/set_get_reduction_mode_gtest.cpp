@@ -0,0 +1,77 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <string>
+
+namespace
+{
+    template <typename...>
+    struct testing_set_get_reduction_mode : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            rocblas_reduction_mode mode = rocblas_reduction_mode(-1);
+            rocblas_handle         handle;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+            // Make sure the default reduction_mode is rocblas_reduction_mode_default
+            CHECK_ROCBLAS_ERROR(rocblas_get_reduction_mode(handle, &mode));
+            EXPECT_EQ(rocblas_reduction_mode_default, mode);
+
+            // Make sure set()/get() functions work
+            CHECK_ROCBLAS_ERROR(
+                rocblas_set_reduction_mode(handle, rocblas_reduction_mode_reproducible));
+            CHECK_ROCBLAS_ERROR(rocblas_get_reduction_mode(handle, &mode));
+            EXPECT_EQ(rocblas_reduction_mode_reproducible, mode);
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_reduction_mode(handle, rocblas_reduction_mode_default));
+            CHECK_ROCBLAS_ERROR(rocblas_get_reduction_mode(handle, &mode));
+            EXPECT_EQ(rocblas_reduction_mode_default, mode);
+
+            // Make sure invalid arguments are rejected, and leave the mode unchanged
+            EXPECT_ROCBLAS_STATUS(rocblas_get_reduction_mode(handle, nullptr),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_set_reduction_mode(handle, rocblas_reduction_mode(2)),
+                                  rocblas_status_invalid_value);
+            CHECK_ROCBLAS_ERROR(rocblas_get_reduction_mode(handle, &mode));
+            EXPECT_EQ(rocblas_reduction_mode_default, mode);
+
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+        }
+    };
+
+    struct set_get_reduction_mode
+        : RocBLAS_Test<set_get_reduction_mode, testing_set_get_reduction_mode>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "set_get_reduction_mode");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<set_get_reduction_mode>(arg.name);
+        }
+    };
+
+    TEST_P(set_get_reduction_mode, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_set_get_reduction_mode<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_reduction_mode)
+
+} // namespace
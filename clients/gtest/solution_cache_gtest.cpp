@@ -0,0 +1,113 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+    // Check that repeated gemm calls with the same problem are served by the
+    // Tensile solution cache, and that the statistics are reported per handle
+    template <typename...>
+    struct testing_solution_cache : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            rocblas_local_handle handle;
+            size_t               hits = ~size_t{0}, misses = ~size_t{0};
+
+            EXPECT_ROCBLAS_STATUS(rocblas_get_solution_cache_stats(nullptr, &hits, &misses),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_solution_cache_stats(handle, nullptr, &misses),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_solution_cache_stats(handle, &hits, nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            // A new handle has not made any calls
+            CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_stats(handle, &hits, &misses));
+            EXPECT_EQ(hits, 0u);
+            EXPECT_EQ(misses, 0u);
+
+            // The cache is disabled with ROCBLAS_TENSILE_SOLUTION_CACHE_SIZE=0
+            const char* env = getenv("ROCBLAS_TENSILE_SOLUTION_CACHE_SIZE");
+            if(env && !strtoul(env, nullptr, 0))
+                return;
+
+            const rocblas_int M = 64, N = 64, K = 64;
+            const float       alpha = 1.0f, beta = 0.0f;
+
+            device_vector<float> dA(size_t(M) * K);
+            device_vector<float> dB(size_t(K) * N);
+            device_vector<float> dC(size_t(M) * N);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            constexpr size_t calls = 3;
+            for(size_t i = 0; i < calls; ++i)
+                CHECK_ROCBLAS_ERROR(rocblas_sgemm(handle,
+                                                  rocblas_operation_none,
+                                                  rocblas_operation_none,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &alpha,
+                                                  dA,
+                                                  M,
+                                                  dB,
+                                                  K,
+                                                  &beta,
+                                                  dC,
+                                                  M));
+
+            // The first call may be a miss, unless another handle already
+            // solved the same problem on this device. The others must be hits.
+            CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_stats(handle, &hits, &misses));
+            EXPECT_EQ(hits + misses, calls);
+            EXPECT_GE(hits, calls - 1);
+
+            CHECK_ROCBLAS_ERROR(rocblas_reset_solution_cache_stats(handle));
+            CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_stats(handle, &hits, &misses));
+            EXPECT_EQ(hits, 0u);
+            EXPECT_EQ(misses, 0u);
+        }
+    };
+
+    struct solution_cache : RocBLAS_Test<solution_cache, testing_solution_cache>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "solution_cache");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<solution_cache>(arg.name);
+        }
+    };
+
+    TEST_P(solution_cache, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_solution_cache<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(solution_cache)
+
+} // namespace
@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+    // Check that Tensile initialization and code object loading statistics are
+    // reported, and that launching a gemm loads the code objects it needs
+    template <typename...>
+    struct testing_tensile_load_stats : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_get_tensile_load_stats(nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            rocblas_local_handle handle;
+            const rocblas_int    M = 64, N = 64, K = 64;
+            const float          alpha = 1.0f, beta = 0.0f;
+
+            device_vector<float> dA(size_t(M) * K);
+            device_vector<float> dB(size_t(K) * N);
+            device_vector<float> dC(size_t(M) * N);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            CHECK_ROCBLAS_ERROR(rocblas_sgemm(handle,
+                                              rocblas_operation_none,
+                                              rocblas_operation_none,
+                                              M,
+                                              N,
+                                              K,
+                                              &alpha,
+                                              dA,
+                                              M,
+                                              dB,
+                                              K,
+                                              &beta,
+                                              dC,
+                                              M));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+            rocblas_tensile_load_stats stats;
+            CHECK_ROCBLAS_ERROR(rocblas_get_tensile_load_stats(&stats));
+
+            int device_count;
+            CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+
+            EXPECT_GT(stats.init_seconds, 0.0);
+            EXPECT_GT(stats.code_objects_total, 0u);
+            EXPECT_GT(stats.code_objects_loaded, 0u);
+            EXPECT_LE(stats.code_objects_loaded, stats.code_objects_total * device_count);
+            EXPECT_GT(stats.code_object_bytes_loaded, 0u);
+
+            // With ROCBLAS_TENSILE_LAZY_LOADING=0, every code object is loaded at initialization
+            const char* env = getenv("ROCBLAS_TENSILE_LAZY_LOADING");
+            if(env && !strtol(env, nullptr, 0))
+                EXPECT_GE(stats.code_objects_loaded, stats.code_objects_total);
+        }
+    };
+
+    struct tensile_load_stats : RocBLAS_Test<tensile_load_stats, testing_tensile_load_stats>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "tensile_load_stats");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<tensile_load_stats>(arg.name);
+        }
+    };
+
+    TEST_P(tensile_load_stats, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_tensile_load_stats<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(tensile_load_stats)
+
+} // namespace
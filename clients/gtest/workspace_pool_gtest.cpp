@@ -0,0 +1,239 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "../../library/src/include/rocblas_workspace_pool.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Test the workspace pool logic with a host memory backend
+    template <typename...>
+    struct testing_workspace_pool : rocblas_test_valid
+    {
+        using pool_t = rocblas_workspace_pool;
+
+        // Create a pool, returning its backend through a pointer
+        static std::unique_ptr<pool_t> make_pool(rocblas_workspace_policy         policy,
+                                                 rocblas_host_workspace_backend*& backend,
+                                                 size_t                           limit = ~size_t{0})
+        {
+            auto b  = std::make_unique<rocblas_host_workspace_backend>(limit);
+            backend = b.get();
+            return std::make_unique<pool_t>(std::move(b), policy);
+        }
+
+        void operator()(const Arguments&)
+        {
+            const size_t MIN = pool_t::MIN_SIZE_CLASS;
+            EXPECT_EQ(pool_t::size_class(1), MIN);
+            EXPECT_EQ(pool_t::size_class(MIN + 1), 2 * MIN);
+            EXPECT_EQ(pool_t::size_class(8 * MIN), 8 * MIN);
+
+            rocblas_host_workspace_backend* backend;
+
+            // The host backend does not use streams, which only identify the users of blocks
+            hipStream_t s1 = reinterpret_cast<hipStream_t>(1);
+            hipStream_t s2 = reinterpret_cast<hipStream_t>(2);
+
+            // The grow policy reuses returned blocks, including larger ones
+            {
+                auto pool = make_pool(rocblas_workspace_policy::grow, backend);
+                EXPECT_EQ(pool->acquire(0, s1).ptr, nullptr);
+
+                auto a = pool->acquire(100, s1);
+                ASSERT_NE(a.ptr, nullptr);
+                EXPECT_EQ(a.size, MIN);
+                pool->release(a, s1);
+
+                auto b = pool->acquire(MIN, s1);
+                EXPECT_EQ(b.ptr, a.ptr);
+                auto c = pool->acquire(3 * MIN, s1);
+                EXPECT_EQ(c.size, 4 * MIN);
+                EXPECT_EQ(backend->allocations(), 2u);
+
+                pool->release(b, s1);
+                pool->release(c, s1);
+                EXPECT_EQ(pool->cached_size(), 5 * MIN);
+
+                auto d = pool->acquire(2 * MIN, s1);
+                EXPECT_EQ(d.ptr, c.ptr);
+                EXPECT_EQ(backend->allocations(), 2u);
+                EXPECT_EQ(backend->deallocations(), 0u);
+                pool->release(d, s1);
+
+                // Allocating a new largest size class deallocates the smaller cached blocks
+                auto e = pool->acquire(8 * MIN, s1);
+                EXPECT_EQ(e.size, 8 * MIN);
+                EXPECT_EQ(pool->cached_size(), 0u);
+                EXPECT_EQ(backend->deallocations(), 2u);
+                pool->release(e, s1);
+
+                pool->trim();
+                EXPECT_EQ(pool->allocated_size(), 0u);
+                EXPECT_EQ(backend->allocated_size(), 0u);
+                EXPECT_EQ(backend->fences_destroyed(), backend->fences_recorded());
+            }
+
+            // A block released by a stream is only reused by another stream after a wait for the
+            // work queued on the releasing stream, and blocks released by the acquiring stream
+            // are preferred
+            {
+                auto pool = make_pool(rocblas_workspace_policy::grow, backend);
+                auto a    = pool->acquire(MIN, s1);
+                auto b    = pool->acquire(MIN, s2);
+                pool->release(a, s1);
+                EXPECT_EQ(backend->fences_recorded(), 1u);
+
+                auto c = pool->acquire(MIN, s2);
+                EXPECT_EQ(c.ptr, a.ptr);
+                EXPECT_EQ(backend->fence_waits(), 1u);
+                EXPECT_EQ(backend->fences_destroyed(), 1u);
+
+                pool->release(b, s2);
+                pool->release(c, s1);
+                auto d = pool->acquire(MIN, s2);
+                EXPECT_EQ(d.ptr, b.ptr);
+                EXPECT_EQ(backend->fence_waits(), 1u);
+                pool->release(d, s2);
+
+                pool->trim();
+                EXPECT_EQ(backend->fences_destroyed(), backend->fences_recorded());
+            }
+
+            // The free policy deallocates returned blocks
+            {
+                auto pool = make_pool(rocblas_workspace_policy::free, backend);
+                pool->release(pool->acquire(MIN, s1), s1);
+                EXPECT_EQ(backend->deallocations(), 1u);
+                EXPECT_EQ(pool->cached_size(), 0u);
+            }
+
+            // The high_water policy rounds acquisitions up to the high water mark,
+            // and only keeps blocks of its size class
+            {
+                auto pool = make_pool(rocblas_workspace_policy::high_water, backend);
+                auto a    = pool->acquire(MIN, s1);
+                auto b    = pool->acquire(4 * MIN, s1);
+                EXPECT_EQ(pool->high_water(), 4 * MIN);
+
+                pool->release(a, s1);
+                EXPECT_EQ(backend->deallocations(), 1u);
+                pool->release(b, s1);
+
+                auto c = pool->acquire(1, s1);
+                EXPECT_EQ(c.ptr, b.ptr);
+                EXPECT_EQ(c.size, 4 * MIN);
+                pool->release(c, s1);
+            }
+
+            // Cached blocks are deallocated to make room when the backend runs out of memory,
+            // and failed acquisitions do not raise the high water mark
+            {
+                auto pool = make_pool(rocblas_workspace_policy::grow, backend, 3 * MIN);
+                auto a    = pool->acquire(MIN, s1);
+                auto b    = pool->acquire(MIN, s1);
+                pool->release(a, s1);
+                pool->release(b, s1);
+
+                auto c = pool->acquire(2 * MIN, s1);
+                EXPECT_NE(c.ptr, nullptr);
+                EXPECT_EQ(pool->cached_size(), 0u);
+                pool->release(c, s1);
+
+                EXPECT_EQ(pool->acquire(4 * MIN, s1).ptr, nullptr);
+                EXPECT_EQ(pool->high_water(), 2 * MIN);
+            }
+
+            // A workspace which grows while it is in use keeps its current block until it is no
+            // longer in use, and keeps it if the new block cannot be acquired
+            {
+                std::shared_ptr<pool_t> pool
+                    = make_pool(rocblas_workspace_policy::grow, backend, 6 * MIN);
+                rocblas_workspace workspace(pool);
+
+                ASSERT_TRUE(workspace.acquire(MIN, false, s1));
+                auto a = workspace.current();
+
+                ASSERT_TRUE(workspace.acquire(2 * MIN, true, s1));
+                auto b = workspace.current();
+                EXPECT_NE(b.ptr, a.ptr);
+                EXPECT_EQ(b.size, 2 * MIN);
+                EXPECT_EQ(workspace.retired(), 1u);
+                EXPECT_EQ(backend->allocated_size(), 3 * MIN);
+
+                EXPECT_FALSE(workspace.acquire(4 * MIN, true, s1));
+                EXPECT_EQ(workspace.current().ptr, b.ptr);
+                EXPECT_EQ(workspace.retired(), 1u);
+
+                // Once the workspace is no longer in use, the retired block goes back to the pool
+                workspace.release_retired(s1);
+                EXPECT_EQ(workspace.retired(), 0u);
+                EXPECT_EQ(pool->cached_size(), MIN);
+
+                // Growing while not in use returns the current block to the pool first
+                ASSERT_TRUE(workspace.acquire(4 * MIN, false, s1));
+                EXPECT_EQ(workspace.current().size, 4 * MIN);
+                EXPECT_EQ(workspace.retired(), 0u);
+                EXPECT_EQ(backend->allocated_size(), 4 * MIN);
+
+                workspace.release(s1);
+                EXPECT_EQ(workspace.current().ptr, nullptr);
+                EXPECT_EQ(pool->allocated_size(), pool->cached_size());
+            }
+
+            // A pool can be shared by threads
+            {
+                auto pool = make_pool(rocblas_workspace_policy::grow, backend);
+
+                std::vector<std::thread> threads;
+                for(int t = 0; t < 8; ++t)
+                    threads.emplace_back([&] {
+                        for(size_t i = 0; i < 1000; ++i)
+                        {
+                            auto block = pool->acquire((i % 7 + 1) * MIN / 2, s1);
+                            EXPECT_NE(block.ptr, nullptr);
+                            pool->release(block, s1);
+                        }
+                    });
+                for(auto& thread : threads)
+                    thread.join();
+
+                EXPECT_EQ(pool->allocated_size(), pool->cached_size());
+                EXPECT_EQ(pool->allocated_size(), backend->allocated_size());
+            }
+        }
+    };
+
+    struct workspace_pool : RocBLAS_Test<workspace_pool, testing_workspace_pool>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "workspace_pool");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<workspace_pool>(arg.name);
+        }
+    };
+
+    TEST_P(workspace_pool, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_workspace_pool<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(workspace_pool)
+
+} // namespace
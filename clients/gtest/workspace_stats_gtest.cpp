@@ -0,0 +1,105 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Check the workspace statistics of requests made through rocblas_device_malloc_alloc
+    template <typename...>
+    struct testing_workspace_stats : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            rocblas_local_handle handle;
+
+            // Let rocBLAS manage the device memory, starting without any
+            CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, 0));
+            CHECK_ROCBLAS_ERROR(rocblas_reset_workspace_stats(handle));
+
+            size_t count = 0;
+            EXPECT_ROCBLAS_STATUS(rocblas_get_workspace_stats(nullptr, nullptr, &count),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_workspace_stats(handle, nullptr, nullptr),
+                                  rocblas_status_invalid_pointer);
+            CHECK_ROCBLAS_ERROR(rocblas_get_workspace_stats(handle, nullptr, &count));
+            EXPECT_EQ(count, 0u);
+
+            auto request = [&](size_t size) {
+                rocblas_device_malloc_base* mem = nullptr;
+                rocblas_status status = rocblas_device_malloc_alloc(handle, &mem, 1, size);
+                if(mem)
+                    CHECK_ROCBLAS_ERROR(rocblas_device_malloc_free(mem));
+                return status;
+            };
+
+            // The first request reallocates the device memory, and the second one reuses it
+            const size_t size = 100000;
+            CHECK_ROCBLAS_ERROR(request(size));
+            CHECK_ROCBLAS_ERROR(request(size / 2 + size / 4));
+
+            // Requests larger than user-managed device memory fail
+            CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, 1000));
+            EXPECT_ROCBLAS_STATUS(request(4 * size), rocblas_status_memory_error);
+
+            std::vector<rocblas_workspace_stats> stats(2);
+            count = stats.size();
+            CHECK_ROCBLAS_ERROR(rocblas_get_workspace_stats(handle, stats.data(), &count));
+            ASSERT_EQ(count, 2u);
+
+            // Entries are sorted by size class
+            for(auto& s : stats)
+                EXPECT_EQ(std::string(s.function), "rocblas_device_malloc_alloc");
+            EXPECT_LT(stats[0].size_class, stats[1].size_class);
+            EXPECT_GE(stats[0].size_class, size);
+
+            EXPECT_EQ(stats[0].requests, 2u);
+            EXPECT_GE(stats[0].peak_bytes, size);
+            EXPECT_EQ(stats[0].reallocations, 1u);
+            EXPECT_EQ(stats[0].failures, 0u);
+
+            EXPECT_EQ(stats[1].requests, 1u);
+            EXPECT_GE(stats[1].peak_bytes, 4 * size);
+            EXPECT_EQ(stats[1].reallocations, 0u);
+            EXPECT_EQ(stats[1].failures, 1u);
+
+            count = 0;
+            CHECK_ROCBLAS_ERROR(rocblas_reset_workspace_stats(handle));
+            CHECK_ROCBLAS_ERROR(rocblas_get_workspace_stats(handle, nullptr, &count));
+            EXPECT_EQ(count, 0u);
+        }
+    };
+
+    struct workspace_stats : RocBLAS_Test<workspace_stats, testing_workspace_stats>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "workspace_stats");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<workspace_stats>(arg.name);
+        }
+    };
+
+    TEST_P(workspace_stats, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_workspace_stats<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(workspace_stats)
+
+} // namespace
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "rocblas_arguments.hpp"
 
 namespace ArgumentLogging
@@ -83,6 +84,14 @@ public:
 
                 name_line << ",CPU-us";
                 val_line << "," << cpu_us;
+
+                // Speedup of the batched reference computation from computing problems in parallel
+                double cpu_speedup = batched_reference_speedup();
+                if(has_batch_count && cpu_speedup > 0)
+                {
+                    name_line << ",CPU-speedup";
+                    val_line << "," << cpu_speedup;
+                }
             }
             if(arg.norm_check)
             {
@@ -0,0 +1,91 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <chrono>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#ifndef WIN32
+#include <time.h>
+#endif
+
+/* ============================================================================================ */
+/*! \brief  Speedup of the last batched reference computation over computing its problems one
+ *          after another, or -1 if there is none to report */
+inline double& batched_reference_speedup_value()
+{
+    static double speedup = -1;
+    return speedup;
+}
+
+/*! \brief  Return the speedup of the last batched reference computation, or -1 if there is
+ *          none, and clear it so that it is only reported once */
+inline double batched_reference_speedup()
+{
+    double speedup                    = batched_reference_speedup_value();
+    batched_reference_speedup_value() = -1;
+    return speedup;
+}
+
+/*! \brief  CPU time of the calling thread in microseconds, or its wall time where thread CPU
+ *          time is not available */
+inline double batched_reference_thread_time_us()
+{
+#ifndef WIN32
+    timespec t;
+    if(!clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t))
+        return t.tv_sec * 1e6 + t.tv_nsec * 1e-3;
+#endif
+    return std::chrono::duration<double, std::micro>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/* ============================================================================================ */
+/*! \brief  Compute the CPU reference results of a batch by calling func(b) for each problem b.
+ *
+ *          When the batch has at least as many problems as there are OpenMP threads, the
+ *          problems are spread across the threads, and the reference BLAS calls made by func
+ *          are nested in a parallel region, so each one runs on a single thread. Smaller
+ *          batches are computed one problem after another, so that each reference call can
+ *          use the whole machine.
+ *
+ *          The speedup reported by batched_reference_speedup() is the total CPU time of the
+ *          parallel calls, which approximates the time of computing them one after another,
+ *          divided by the wall time of the batch.
+ *
+ *          func must only write to the results of its own problem. */
+template <typename F>
+void batched_reference(rocblas_int batch_count, F&& func)
+{
+#ifdef _OPENMP
+    if(batch_count > 1 && batch_count >= omp_get_max_threads())
+    {
+        auto   start   = std::chrono::steady_clock::now();
+        double call_us = 0;
+
+#pragma omp parallel for schedule(dynamic) reduction(+ : call_us)
+        for(rocblas_int b = 0; b < batch_count; ++b)
+        {
+            double call_start = batched_reference_thread_time_us();
+            func(b);
+            call_us += batched_reference_thread_time_us() - call_start;
+        }
+
+        double wall_us = std::chrono::duration<double, std::micro>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+        if(wall_us > 0)
+            batched_reference_speedup_value() = call_us / wall_us;
+        return;
+    }
+#endif
+
+    for(rocblas_int b = 0; b < batch_count; ++b)
+        func(b);
+    batched_reference_speedup_value() = 1;
+}
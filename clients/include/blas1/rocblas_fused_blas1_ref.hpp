@@ -0,0 +1,70 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "rocblas.h"
+#include "rocblas_math.hpp"
+
+// Host references of the fused BLAS1 functions axpby, waxpby, axpy_dot and dot2. Vectors follow
+// the BLAS convention for negative increments: x points to the first element in memory, and
+// element i of the vector is x[(n - 1 - i) * |incx|].
+namespace rocblas_fused_blas1_ref
+{
+    inline int64_t index(rocblas_int n, rocblas_int i, rocblas_int inc)
+    {
+        return inc < 0 ? int64_t(n - 1 - i) * -inc : int64_t(i) * inc;
+    }
+
+    // w := alpha * x + beta * y, without reading x if alpha is zero, or y if beta is zero
+    template <typename T>
+    void waxpby(rocblas_int n,
+                T           alpha,
+                const T*    x,
+                rocblas_int incx,
+                T           beta,
+                const T*    y,
+                rocblas_int incy,
+                T*          w,
+                rocblas_int incw)
+    {
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            T wi = T(0);
+            if(alpha != T(0))
+                wi = alpha * x[index(n, i, incx)];
+            if(beta != T(0))
+                wi = wi + beta * y[index(n, i, incy)];
+            w[index(n, i, incw)] = wi;
+        }
+    }
+
+    // The dot product, conjugated for the complex types: x^H * y
+    template <typename T>
+    T dotc(rocblas_int n, const T* x, rocblas_int incx, const T* y, rocblas_int incy)
+    {
+        T result;
+        if constexpr(is_complex<T>)
+            cblas_dotc<T>(n, x, incx, y, incy, &result);
+        else
+            cblas_dot<T>(n, x, incx, y, incy, &result);
+        return result;
+    }
+
+    // y := alpha * x + y, then returns y^H * z
+    template <typename T>
+    T axpy_dot(rocblas_int n,
+               T           alpha,
+               T*          x,
+               rocblas_int incx,
+               T*          y,
+               rocblas_int incy,
+               const T*    z,
+               rocblas_int incz)
+    {
+        cblas_axpy<T>(n, alpha, x, incx, y, incy);
+        return dotc<T>(n, y, incy, z, incz);
+    }
+}
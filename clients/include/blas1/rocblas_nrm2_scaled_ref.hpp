@@ -0,0 +1,67 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include "rocblas_math.hpp"
+#include <cmath>
+#include <limits>
+
+// Host reference of nrm2 for vectors whose elements are too large or too small for their squares
+// to be representable. The norm is computed in double precision as a scaled sum of squares which
+// is rescaled by every new largest element, as in the nrm2 of LAPACK 3.9, so that it is
+// independent of Blue's accumulators of rocblas_nrm2_mode_scaled.
+namespace rocblas_nrm2_scaled_ref
+{
+    struct ssq
+    {
+        double scale   = 0;
+        double sumsq   = 1;
+        bool   has_nan = false;
+        bool   has_inf = false;
+
+        void update(double t)
+        {
+            double at = std::abs(t);
+            if(at != at)
+                has_nan = true;
+            else if(at > std::numeric_limits<double>::max())
+                has_inf = true;
+            else if(at > scale)
+            {
+                sumsq = 1 + sumsq * (scale / at) * (scale / at);
+                scale = at;
+            }
+            else if(at > 0)
+                sumsq += (at / scale) * (at / scale);
+        }
+
+        double norm() const
+        {
+            return has_nan   ? std::numeric_limits<double>::quiet_NaN()
+                   : has_inf ? std::numeric_limits<double>::infinity()
+                             : scale * std::sqrt(sumsq);
+        }
+    };
+
+    template <typename T>
+    real_t<T> nrm2(int64_t n, const T* x, int64_t incx)
+    {
+        ssq s;
+        for(int64_t i = 0; i < n; i++)
+        {
+            if constexpr(is_complex<T>)
+            {
+                s.update(double(std::real(x[i * incx])));
+                s.update(double(std::imag(x[i * incx])));
+            }
+            else
+            {
+                s.update(double(x[i * incx]));
+            }
+        }
+        return real_t<T>(s.norm());
+    }
+}
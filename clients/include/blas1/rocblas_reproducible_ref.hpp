@@ -0,0 +1,180 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include "rocblas_math.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// Host reference of the sums of rocblas_reduction_mode_reproducible: the terms are computed in
+// double precision and pre-rounded into 3 bins, whose sums do not depend on the order of the
+// terms. The results are the same bits as those of rocBLAS, for any n and increments.
+namespace rocblas_reproducible_ref
+{
+    constexpr int bins = 3;
+
+    inline double abs(double t)
+    {
+        return t < 0 ? -t : t == t ? t : std::numeric_limits<double>::infinity();
+    }
+
+    template <typename T>
+    double real(T x)
+    {
+        return double(float(x));
+    }
+
+    inline double real(double x)
+    {
+        return x;
+    }
+
+    // Sum of the terms t[0], ..., t[n - 1] of each of the components of a sum
+    inline std::vector<double> sum(const std::vector<std::vector<double>>& t, int64_t n)
+    {
+        int log2n = 0;
+        while((int64_t(1) << log2n) < n)
+            log2n++;
+
+        double amax = 0;
+        for(auto& tc : t)
+            for(double ti : tc)
+                amax = abs(ti) > amax ? abs(ti) : amax;
+
+        constexpr int kmax = std::numeric_limits<double>::max_exponent - 2;
+        constexpr int kmin = std::numeric_limits<double>::min_exponent - 1;
+
+        int  e      = 0;
+        bool finite = amax <= std::numeric_limits<double>::max();
+        if(finite)
+            std::frexp(amax, &e);
+
+        int k     = e + log2n + 1;
+        int scale = k > kmax ? k - kmax : 0;
+        k -= scale;
+
+        double sigma[bins];
+        for(int j = 0; j < bins; j++)
+        {
+            sigma[j] = std::ldexp(1.5, k > kmin ? k : kmin);
+            k -= std::numeric_limits<double>::digits - 1 - log2n;
+        }
+
+        std::vector<double> result;
+        for(auto& tc : t)
+        {
+            double bin[bins] = {0};
+            for(double ti : tc)
+            {
+                if(!finite)
+                {
+                    if(!(abs(ti) <= std::numeric_limits<double>::max()))
+                        bin[0] += ti;
+                    continue;
+                }
+
+                if(scale)
+                    ti = std::ldexp(ti, -scale);
+
+                for(int j = 0; j < bins; j++)
+                {
+                    double q = (sigma[j] + ti) - sigma[j];
+                    bin[j] += q;
+                    ti -= q;
+                }
+            }
+
+            double s = bin[bins - 1];
+            for(int j = bins - 2; j >= 0; j--)
+                s += bin[j];
+            result.push_back(scale ? std::ldexp(s, scale) : s);
+        }
+        return result;
+    }
+
+    template <typename Tr>
+    Tr convert(double val)
+    {
+        if(std::is_same<Tr, rocblas_half>{} || std::is_same<Tr, rocblas_bfloat16>{})
+            return Tr(float(val));
+        else
+            return Tr(val);
+    }
+
+    template <typename T>
+    real_t<T> asum(int64_t n, const T* x, int64_t incx)
+    {
+        std::vector<std::vector<double>> t(1, std::vector<double>(n));
+        for(int64_t i = 0; i < n; i++)
+        {
+            if constexpr(is_complex<T>)
+                t[0][i] = std::abs(real(std::real(x[i * incx])))
+                          + std::abs(real(std::imag(x[i * incx])));
+            else
+                t[0][i] = std::abs(real(x[i * incx]));
+        }
+        return convert<real_t<T>>(sum(t, n)[0]);
+    }
+
+    template <typename T>
+    real_t<T> nrm2(int64_t n, const T* x, int64_t incx)
+    {
+#pragma clang fp contract(off)
+        std::vector<std::vector<double>> t(1, std::vector<double>(n));
+        for(int64_t i = 0; i < n; i++)
+        {
+            if constexpr(is_complex<T>)
+            {
+                double re = real(std::real(x[i * incx]));
+                double im = real(std::imag(x[i * incx]));
+                t[0][i]   = re * re + im * im;
+            }
+            else
+            {
+                double re = real(x[i * incx]);
+                t[0][i]   = re * re;
+            }
+        }
+        return convert<real_t<T>>(std::sqrt(sum(t, n)[0]));
+    }
+
+    template <typename T, bool CONJ = false>
+    T dot(int64_t n, const T* x, int64_t incx, const T* y, int64_t incy)
+    {
+#pragma clang fp contract(off)
+        if constexpr(is_complex<T>)
+        {
+            std::vector<std::vector<double>> t(2, std::vector<double>(n));
+            for(int64_t i = 0; i < n; i++)
+            {
+                double xr = real(std::real(x[i * incx]));
+                double xi = real(std::imag(x[i * incx]));
+                double yr = real(std::real(y[i * incy]));
+                double yi = real(std::imag(y[i * incy]));
+                if(CONJ)
+                    xi = -xi;
+                t[0][i] = xr * yr - xi * yi;
+                t[1][i] = xr * yi + xi * yr;
+            }
+            auto s = sum(t, n);
+            return T(convert<real_t<T>>(s[0]), convert<real_t<T>>(s[1]));
+        }
+        else
+        {
+            std::vector<std::vector<double>> t(1, std::vector<double>(n));
+            for(int64_t i = 0; i < n; i++)
+                t[0][i] = real(x[i * incx]) * real(y[i * incy]);
+            return convert<T>(sum(t, n)[0]);
+        }
+    }
+
+    template <typename T>
+    T dotc(int64_t n, const T* x, int64_t incx, const T* y, int64_t incy)
+    {
+        return dot<T, true>(n, x, incx, y, incy);
+    }
+}
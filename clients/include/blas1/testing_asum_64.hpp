@@ -0,0 +1,119 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_asum_64_bad_arg(const Arguments& arg)
+{
+    auto rocblas_asum_64_fn = rocblas_asum_64<T>;
+
+    int64_t             N                = 100;
+    int64_t             incx             = 1;
+    static const size_t safe_size        = 100;
+    real_t<T>           rocblas_result   = 10;
+    real_t<T>*          h_rocblas_result = &rocblas_result;
+
+    rocblas_local_handle handle{arg};
+    device_vector<T>     dx(safe_size);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_asum_64_fn(handle, N, nullptr, incx, h_rocblas_result),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_asum_64_fn(handle, N, dx, incx, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_asum_64_fn(nullptr, N, dx, incx, h_rocblas_result),
+                          rocblas_status_invalid_handle);
+
+    // A negative size or increment which does not fit in rocblas_int sets the result to 0
+    int64_t   N_64 = int64_t(1) << 33;
+    real_t<T> zero = real_t<T>(0);
+    EXPECT_ROCBLAS_STATUS(rocblas_asum_64_fn(handle, -N_64, nullptr, incx, h_rocblas_result),
+                          rocblas_status_success);
+    unit_check_general<real_t<T>, real_t<T>>(1, 1, 1, &zero, h_rocblas_result);
+    rocblas_result = 10;
+    EXPECT_ROCBLAS_STATUS(rocblas_asum_64_fn(handle, N, nullptr, -N_64, h_rocblas_result),
+                          rocblas_status_success);
+    unit_check_general<real_t<T>, real_t<T>>(1, 1, 1, &zero, h_rocblas_result);
+}
+
+template <typename T>
+void testing_asum_64(const Arguments& arg)
+{
+    auto rocblas_asum_64_fn = rocblas_asum_64<T>;
+
+    int64_t N    = arg.N;
+    int64_t incx = arg.incx;
+
+    real_t<T>            rocblas_result_1;
+    real_t<T>            rocblas_result_2;
+    real_t<T>            cpu_result;
+    rocblas_local_handle handle{arg};
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0 || incx <= 0)
+    {
+        real_t<T> result_0 = real_t<T>(0);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_asum_64_fn(handle, N, nullptr, incx, &rocblas_result_1));
+
+        // check that result is set to 0
+        unit_check_general<real_t<T>, real_t<T>>(1, 1, 1, &result_0, &rocblas_result_1);
+        return;
+    }
+
+    size_t size_x = N * size_t(incx);
+
+    // allocate memory on device
+    device_vector<T> dx(size_x);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+
+    device_vector<real_t<T>> dr(1);
+    CHECK_DEVICE_ALLOCATION(dr.memcheck());
+
+    host_vector<T> hx(size_x);
+    CHECK_HIP_ERROR(hx.memcheck());
+
+    // Initial Data on CPU
+    rocblas_init_vector(hx, arg, N, incx, 0, 1, rocblas_client_alpha_sets_nan, true);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    // GPU BLAS rocblas_pointer_mode_host
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_asum_64_fn(handle, N, dx, incx, &rocblas_result_1));
+
+    // GPU BLAS rocblas_pointer_mode_device
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(rocblas_asum_64_fn(handle, N, dx, incx, dr));
+    CHECK_HIP_ERROR(hipMemcpy(&rocblas_result_2, dr, sizeof(real_t<T>), hipMemcpyDeviceToHost));
+
+    // CPU BLAS, whose rocblas_int sizes hold the sizes of the tests
+    cblas_asum<T>(N, hx, incx, &cpu_result);
+
+    if(arg.unit_check)
+    {
+        unit_check_general<real_t<T>, real_t<T>>(1, 1, 1, &cpu_result, &rocblas_result_1);
+        unit_check_general<real_t<T>, real_t<T>>(1, 1, 1, &cpu_result, &rocblas_result_2);
+    }
+
+    if(arg.norm_check)
+    {
+        rocblas_cout << "cpu=" << std::scientific << cpu_result
+                     << ", gpu_host_ptr=" << rocblas_result_1
+                     << ", gpu_dev_ptr=" << rocblas_result_2 << std::endl;
+    }
+}
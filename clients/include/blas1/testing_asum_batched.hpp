@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -143,10 +144,9 @@ void testing_asum_batched(const Arguments& arg)
         real_t<T> cpu_result[batch_count];
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             cblas_asum<T>(N, hx[i], incx, cpu_result + i);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         if(arg.unit_check)
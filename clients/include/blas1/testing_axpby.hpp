@@ -0,0 +1,194 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_fused_blas1_ref.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+/* ============================================================================================ */
+template <typename T>
+void testing_axpby_bad_arg(const Arguments& arg)
+{
+    auto rocblas_axpby_fn = rocblas_axpby<T>;
+
+    rocblas_int N         = 100;
+    rocblas_int incx      = 1;
+    rocblas_int incy      = 1;
+    size_t      safe_size = 100;
+    T           alpha     = 0.6;
+    T           beta      = 0.5;
+    T           zero      = 0.0;
+    T           one       = 1.0;
+
+    rocblas_local_handle handle{arg};
+    device_vector<T>     dx(safe_size);
+    device_vector<T>     dy(safe_size);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_axpby_fn(handle, N, &alpha, nullptr, incx, &beta, dy, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpby_fn(handle, N, &alpha, dx, incx, &beta, nullptr, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpby_fn(handle, N, nullptr, dx, incx, &beta, dy, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpby_fn(handle, N, &alpha, dx, incx, nullptr, dy, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpby_fn(nullptr, N, &alpha, dx, incx, &beta, dy, incy),
+                          rocblas_status_invalid_handle);
+    // If N == 0, then alpha, beta, X and Y can be nullptr without error
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_axpby_fn(handle, 0, nullptr, nullptr, incx, nullptr, nullptr, incy),
+        rocblas_status_success);
+    // If alpha == 0 and beta == 1, then X and Y can be nullptr without error
+    EXPECT_ROCBLAS_STATUS(rocblas_axpby_fn(handle, N, &zero, nullptr, incx, &one, nullptr, incy),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_axpby(const Arguments& arg)
+{
+    auto rocblas_axpby_fn = rocblas_axpby<T>;
+
+    rocblas_int          N       = arg.N;
+    rocblas_int          incx    = arg.incx;
+    rocblas_int          incy    = arg.incy;
+    T                    h_alpha = arg.get_alpha<T>();
+    T                    h_beta  = arg.get_beta<T>();
+    bool                 HMM     = arg.HMM;
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_axpby_fn(handle, N, nullptr, nullptr, incx, nullptr, nullptr, incy));
+        return;
+    }
+
+    rocblas_int abs_incx = incx > 0 ? incx : -incx;
+    rocblas_int abs_incy = incy > 0 ? incy : -incy;
+    size_t      size_x   = N * size_t(abs_incx);
+    size_t      size_y   = N * size_t(abs_incy);
+    if(!size_x)
+        size_x = 1;
+    if(!size_y)
+        size_y = 1;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(size_x);
+    host_vector<T> hy_1(size_y);
+    host_vector<T> hy_2(size_y);
+    host_vector<T> hy_gold(size_y);
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, N, abs_incx, 0, 1, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy_1, arg, N, abs_incy, 0, 1, rocblas_client_beta_sets_nan, false, true);
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // allocate memory on device
+    device_vector<T> dx(size_x, 1, HMM);
+    device_vector<T> dy_1(size_y, 1, HMM);
+    device_vector<T> dy_2(size_y, 1, HMM);
+    device_vector<T> d_alpha(1, 1, HMM);
+    device_vector<T> d_beta(1, 1, HMM);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy_1.transfer_from(hy_1));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dy_2.transfer_from(hy_2));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        // ROCBLAS pointer mode host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_axpby_fn(handle, N, &h_alpha, dx, incx, &h_beta, dy_1, incy));
+
+        // ROCBLAS pointer mode device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_axpby_fn(handle, N, d_alpha, dx, incx, d_beta, dy_2, incy));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy_1));
+        CHECK_HIP_ERROR(hy_2.transfer_from(dy_2));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        rocblas_fused_blas1_ref::waxpby<T>(
+            N, h_alpha, hx, incx, h_beta, hy_gold, incy, hy_gold, incy);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, hy_gold, hy_1);
+            unit_check_general<T>(1, N, abs_incy, hy_gold, hy_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', 1, N, abs_incy, hy_gold, hy_1);
+            rocblas_error_2 = norm_check_general<T>('F', 1, N, abs_incy, hy_gold, hy_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_axpby_fn(handle, N, &h_alpha, dx, incx, &h_beta, dy_1, incy);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_axpby_fn(handle, N, &h_alpha, dx, incx, &h_beta, dy_1, incy);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_beta, e_incy>{}.log_args<T>(rocblas_cout,
+                                                                          arg,
+                                                                          gpu_time_used,
+                                                                          axpby_gflop_count<T>(N),
+                                                                          axpby_gbyte_count<T>(N),
+                                                                          cpu_time_used,
+                                                                          rocblas_error_1,
+                                                                          rocblas_error_2);
+    }
+}
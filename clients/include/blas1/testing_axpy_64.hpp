@@ -0,0 +1,120 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+/* ============================================================================================ */
+template <typename T>
+void testing_axpy_64_bad_arg(const Arguments& arg)
+{
+    auto rocblas_axpy_64_fn = rocblas_axpy_64<T>;
+
+    int64_t N         = 100;
+    int64_t incx      = 1;
+    int64_t incy      = 1;
+    size_t  safe_size = 100;
+    T       alpha     = 0.6;
+    T       zero      = 0.0;
+
+    rocblas_local_handle handle{arg};
+    device_vector<T>     dx(safe_size);
+    device_vector<T>     dy(safe_size);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_64_fn(handle, N, &alpha, nullptr, incx, dy, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_64_fn(handle, N, &alpha, dx, incx, nullptr, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_64_fn(handle, N, nullptr, dx, incx, dy, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_64_fn(nullptr, N, &alpha, dx, incx, dy, incy),
+                          rocblas_status_invalid_handle);
+    // If N == 0, then alpha, X and Y can be nullptr without error
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_64_fn(handle, 0, nullptr, nullptr, incx, nullptr, incy),
+                          rocblas_status_success);
+    // If alpha == 0, then X and Y can be nullptr without error, also for sizes and increments
+    // which do not fit in rocblas_int
+    int64_t N_64 = int64_t(1) << 33;
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_64_fn(handle, N_64, &zero, nullptr, N_64, nullptr, -N_64),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_axpy_64(const Arguments& arg)
+{
+    auto rocblas_axpy_64_fn = rocblas_axpy_64<T>;
+
+    int64_t              N       = arg.N;
+    int64_t              incx    = arg.incx;
+    int64_t              incy    = arg.incy;
+    T                    h_alpha = arg.get_alpha<T>();
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_64_fn(handle, N, nullptr, nullptr, incx, nullptr, incy));
+        return;
+    }
+
+    int64_t abs_incx = incx > 0 ? incx : -incx;
+    int64_t abs_incy = incy > 0 ? incy : -incy;
+    size_t  size_x   = std::max(size_t(N * abs_incx), size_t(1));
+    size_t  size_y   = std::max(size_t(N * abs_incy), size_t(1));
+
+    host_vector<T> hx(size_x);
+    host_vector<T> hy(size_y);
+    host_vector<T> hy_gold(size_y);
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, N, abs_incx, 0, 1, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, N, abs_incy, 0, 1, rocblas_client_alpha_sets_nan, false, true);
+    hy_gold = hy;
+
+    device_vector<T> dx(size_x);
+    device_vector<T> dy(size_y);
+    device_vector<T> d_alpha(1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    // y is updated twice, in host and then in device pointer mode, and compared once
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_axpy_64_fn(handle, N, &h_alpha, dx, incx, dy, incy));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(rocblas_axpy_64_fn(handle, N, d_alpha, dx, incx, dy, incy));
+
+    CHECK_HIP_ERROR(hy.transfer_from(dy));
+
+    // CPU BLAS, whose rocblas_int sizes hold the sizes of the tests
+    cblas_axpy<T>(N, h_alpha, hx, incx, hy_gold, incy);
+    cblas_axpy<T>(N, h_alpha, hx, incx, hy_gold, incy);
+
+    if(arg.unit_check)
+        unit_check_general<T>(1, N, abs_incy, hy_gold, hy);
+
+    if(arg.norm_check)
+    {
+        double rocblas_error = norm_check_general<T>('F', 1, N, abs_incy, hy_gold, hy);
+        rocblas_cout << "rocblas_error=" << rocblas_error << std::endl;
+    }
+}
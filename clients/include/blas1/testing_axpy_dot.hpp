@@ -0,0 +1,243 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_fused_blas1_ref.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+/* ============================================================================================ */
+template <typename T>
+void testing_axpy_dot_bad_arg(const Arguments& arg)
+{
+    auto rocblas_axpy_dot_fn = rocblas_axpy_dot<T>;
+
+    rocblas_int N         = 100;
+    rocblas_int incx      = 1;
+    rocblas_int incy      = 1;
+    rocblas_int incz      = 1;
+    size_t      safe_size = 100;
+    T           alpha     = 0.6;
+
+    rocblas_local_handle handle{arg};
+    device_vector<T>     dx(safe_size);
+    device_vector<T>     dy(safe_size);
+    device_vector<T>     dz(safe_size);
+    device_vector<T>     d_rocblas_result(1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_rocblas_result.memcheck());
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_axpy_dot_fn(handle, N, &alpha, nullptr, incx, dy, incy, dz, incz, d_rocblas_result),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_axpy_dot_fn(handle, N, &alpha, dx, incx, nullptr, incy, dz, incz, d_rocblas_result),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_axpy_dot_fn(handle, N, &alpha, dx, incx, dy, incy, nullptr, incz, d_rocblas_result),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_axpy_dot_fn(handle, N, nullptr, dx, incx, dy, incy, dz, incz, d_rocblas_result),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_axpy_dot_fn(handle, N, &alpha, dx, incx, dy, incy, dz, incz, nullptr),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_axpy_dot_fn(nullptr, N, &alpha, dx, incx, dy, incy, dz, incz, d_rocblas_result),
+        rocblas_status_invalid_handle);
+}
+
+template <typename T>
+void testing_axpy_dot(const Arguments& arg)
+{
+    auto rocblas_axpy_dot_fn = rocblas_axpy_dot<T>;
+
+    rocblas_int          N       = arg.N;
+    rocblas_int          incx    = arg.incx;
+    rocblas_int          incy    = arg.incy;
+    rocblas_int          incz    = arg.incz;
+    T                    h_alpha = arg.get_alpha<T>();
+    bool                 HMM     = arg.HMM;
+    rocblas_local_handle handle{arg};
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0)
+    {
+        device_vector<T> d_rocblas_result(1);
+        CHECK_DEVICE_ALLOCATION(d_rocblas_result.memcheck());
+
+        host_vector<T> cpu_0(1);
+        host_vector<T> gpu_0(1);
+        host_vector<T> h_rocblas_result(1);
+        CHECK_HIP_ERROR(cpu_0.memcheck());
+        CHECK_HIP_ERROR(gpu_0.memcheck());
+        CHECK_HIP_ERROR(h_rocblas_result.memcheck());
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot_fn(
+            handle, N, nullptr, nullptr, incx, nullptr, incy, nullptr, incz, d_rocblas_result));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot_fn(
+            handle, N, nullptr, nullptr, incx, nullptr, incy, nullptr, incz, h_rocblas_result));
+
+        CHECK_HIP_ERROR(gpu_0.transfer_from(d_rocblas_result));
+        unit_check_general<T>(1, 1, 1, cpu_0, gpu_0);
+        unit_check_general<T>(1, 1, 1, cpu_0, h_rocblas_result);
+
+        return;
+    }
+
+    rocblas_int abs_incx = incx > 0 ? incx : -incx;
+    rocblas_int abs_incy = incy > 0 ? incy : -incy;
+    rocblas_int abs_incz = incz > 0 ? incz : -incz;
+    size_t      size_x   = N * size_t(abs_incx);
+    size_t      size_y   = N * size_t(abs_incy);
+    size_t      size_z   = N * size_t(abs_incz);
+    if(!size_x)
+        size_x = 1;
+    if(!size_y)
+        size_y = 1;
+    if(!size_z)
+        size_z = 1;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(size_x);
+    host_vector<T> hy(size_y);
+    host_vector<T> hz(size_z);
+    host_vector<T> hy_1(size_y);
+    host_vector<T> hy_2(size_y);
+    host_vector<T> cpu_result_1(1);
+    host_vector<T> cpu_result_2(1);
+    host_vector<T> rocblas_result_1(1);
+    host_vector<T> rocblas_result_2(1);
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, N, abs_incx, 0, 1, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, N, abs_incy, 0, 1, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hz, arg, N, abs_incz, 0, 1, rocblas_client_alpha_sets_nan, false);
+
+    // allocate memory on device
+    device_vector<T> dx(size_x, 1, HMM);
+    device_vector<T> dy(size_y, 1, HMM);
+    device_vector<T> dz(size_z, 1, HMM);
+    device_vector<T> d_alpha(1, 1, HMM);
+    device_vector<T> d_rocblas_result_2(1, 1, HMM);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_rocblas_result_2.memcheck());
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dz.transfer_from(hz));
+
+    // When incz is incy, the call in device pointer mode passes y as z, which forms the squared
+    // norm of the updated y
+    bool z_is_y = incz == incy;
+    T*   dz_ptr = z_is_y ? (T*)dy : (T*)dz;
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+        // ROCBLAS pointer mode host
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot_fn(
+            handle, N, &h_alpha, dx, incx, dy, incy, dz, incz, rocblas_result_1));
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+
+        // ROCBLAS pointer mode device
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot_fn(
+            handle, N, d_alpha, dx, incx, dy, incy, dz_ptr, incz, d_rocblas_result_2));
+        CHECK_HIP_ERROR(hy_2.transfer_from(dy));
+        CHECK_HIP_ERROR(rocblas_result_2.transfer_from(d_rocblas_result_2));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        cpu_result_1[0]
+            = rocblas_fused_blas1_ref::axpy_dot<T>(N, h_alpha, hx, incx, hy, incy, hz, incz);
+        cpu_result_2[0] = z_is_y ? rocblas_fused_blas1_ref::dotc<T>(N, hy, incy, hy, incy)
+                                 : cpu_result_1[0];
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, hy, hy_1);
+            unit_check_general<T>(1, N, abs_incy, hy, hy_2);
+            unit_check_general<T>(1, 1, 1, cpu_result_1, rocblas_result_1);
+            unit_check_general<T>(1, 1, 1, cpu_result_2, rocblas_result_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1
+                = norm_check_general<T>('F', 1, N, abs_incy, hy, hy_1)
+                  + rocblas_abs((cpu_result_1[0] - rocblas_result_1[0]) / cpu_result_1[0]);
+            rocblas_error_2
+                = norm_check_general<T>('F', 1, N, abs_incy, hy, hy_2)
+                  + rocblas_abs((cpu_result_2[0] - rocblas_result_2[0]) / cpu_result_2[0]);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_axpy_dot_fn(
+                handle, N, d_alpha, dx, incx, dy, incy, dz, incz, d_rocblas_result_2);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_axpy_dot_fn(
+                handle, N, d_alpha, dx, incx, dy, incy, dz, incz, d_rocblas_result_2);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_incy, e_incz>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            axpy_dot_gflop_count<T>(N),
+            axpy_dot_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
@@ -0,0 +1,392 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "batched_reference.hpp"
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_fused_blas1_ref.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+/* ============================================================================================ */
+template <typename T>
+void testing_axpy_dot_strided_batched_bad_arg(const Arguments& arg)
+{
+    auto rocblas_axpy_dot_strided_batched_fn = rocblas_axpy_dot_strided_batched<T>;
+
+    rocblas_int    N = 100, incx = 1, incy = 1, incz = 1, batch_count = 2;
+    rocblas_stride stride = N;
+    T              alpha  = 0.6;
+
+    rocblas_local_handle           handle{arg};
+    device_strided_batch_vector<T> dx(N, incx, stride, batch_count);
+    device_strided_batch_vector<T> dy(N, incy, stride, batch_count);
+    device_strided_batch_vector<T> dz(N, incz, stride, batch_count);
+    device_vector<T>               d_result(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_dot_strided_batched_fn(handle,
+                                                              N,
+                                                              &alpha,
+                                                              nullptr,
+                                                              incx,
+                                                              stride,
+                                                              dy,
+                                                              incy,
+                                                              stride,
+                                                              dz,
+                                                              incz,
+                                                              stride,
+                                                              batch_count,
+                                                              d_result),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_dot_strided_batched_fn(handle,
+                                                              N,
+                                                              &alpha,
+                                                              dx,
+                                                              incx,
+                                                              stride,
+                                                              nullptr,
+                                                              incy,
+                                                              stride,
+                                                              dz,
+                                                              incz,
+                                                              stride,
+                                                              batch_count,
+                                                              d_result),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_dot_strided_batched_fn(handle,
+                                                              N,
+                                                              &alpha,
+                                                              dx,
+                                                              incx,
+                                                              stride,
+                                                              dy,
+                                                              incy,
+                                                              stride,
+                                                              nullptr,
+                                                              incz,
+                                                              stride,
+                                                              batch_count,
+                                                              d_result),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_dot_strided_batched_fn(handle,
+                                                              N,
+                                                              nullptr,
+                                                              dx,
+                                                              incx,
+                                                              stride,
+                                                              dy,
+                                                              incy,
+                                                              stride,
+                                                              dz,
+                                                              incz,
+                                                              stride,
+                                                              batch_count,
+                                                              d_result),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_dot_strided_batched_fn(handle,
+                                                              N,
+                                                              &alpha,
+                                                              dx,
+                                                              incx,
+                                                              stride,
+                                                              dy,
+                                                              incy,
+                                                              stride,
+                                                              dz,
+                                                              incz,
+                                                              stride,
+                                                              batch_count,
+                                                              nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_dot_strided_batched_fn(nullptr,
+                                                              N,
+                                                              &alpha,
+                                                              dx,
+                                                              incx,
+                                                              stride,
+                                                              dy,
+                                                              incy,
+                                                              stride,
+                                                              dz,
+                                                              incz,
+                                                              stride,
+                                                              batch_count,
+                                                              d_result),
+                          rocblas_status_invalid_handle);
+}
+
+template <typename T>
+void testing_axpy_dot_strided_batched(const Arguments& arg)
+{
+    auto rocblas_axpy_dot_strided_batched_fn = rocblas_axpy_dot_strided_batched<T>;
+
+    rocblas_int    N           = arg.N;
+    rocblas_int    incx        = arg.incx;
+    rocblas_int    incy        = arg.incy;
+    rocblas_int    incz        = arg.incz;
+    rocblas_stride stride_x    = arg.stride_x;
+    rocblas_stride stride_y    = arg.stride_y;
+    rocblas_int    batch_count = arg.batch_count;
+    T              h_alpha     = arg.get_alpha<T>();
+
+    // z has the stride of x, or the size of z if that is larger
+    rocblas_stride stride_z = std::max(stride_x, rocblas_stride(N) * std::abs(incz));
+
+    double               rocblas_error_1 = 0;
+    double               rocblas_error_2 = 0;
+    rocblas_local_handle handle{arg};
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0 || batch_count <= 0)
+    {
+        device_vector<T> d_rocblas_result(std::max(batch_count, 1));
+        CHECK_DEVICE_ALLOCATION(d_rocblas_result.memcheck());
+
+        host_vector<T> h_rocblas_result(std::max(batch_count, 1));
+        CHECK_HIP_ERROR(h_rocblas_result.memcheck());
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot_strided_batched_fn(handle,
+                                                                N,
+                                                                nullptr,
+                                                                nullptr,
+                                                                incx,
+                                                                stride_x,
+                                                                nullptr,
+                                                                incy,
+                                                                stride_y,
+                                                                nullptr,
+                                                                incz,
+                                                                stride_z,
+                                                                batch_count,
+                                                                d_rocblas_result));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot_strided_batched_fn(handle,
+                                                                N,
+                                                                nullptr,
+                                                                nullptr,
+                                                                incx,
+                                                                stride_x,
+                                                                nullptr,
+                                                                incy,
+                                                                stride_y,
+                                                                nullptr,
+                                                                incz,
+                                                                stride_z,
+                                                                batch_count,
+                                                                h_rocblas_result));
+
+        if(batch_count > 0)
+        {
+            host_vector<T> cpu_0(batch_count);
+            host_vector<T> gpu_0(batch_count);
+            CHECK_HIP_ERROR(gpu_0.transfer_from(d_rocblas_result));
+            unit_check_general<T>(1, 1, 1, 1, cpu_0, gpu_0, batch_count);
+            unit_check_general<T>(1, 1, 1, 1, cpu_0, h_rocblas_result, batch_count);
+        }
+
+        return;
+    }
+
+    rocblas_int abs_incy = std::abs(incy);
+
+    host_vector<T> cpu_result_1(batch_count);
+    host_vector<T> cpu_result_2(batch_count);
+    host_vector<T> rocblas_result_1(batch_count);
+    host_vector<T> rocblas_result_2(batch_count);
+    host_vector<T> halpha(1);
+    CHECK_HIP_ERROR(halpha.memcheck());
+    halpha[0] = h_alpha;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_strided_batch_vector<T> hx(N, incx ? incx : 1, stride_x, batch_count);
+    host_strided_batch_vector<T> hy(N, incy ? incy : 1, stride_y, batch_count);
+    host_strided_batch_vector<T> hz(N, incz ? incz : 1, stride_z, batch_count);
+    host_strided_batch_vector<T> hy1(N, incy ? incy : 1, stride_y, batch_count);
+    host_strided_batch_vector<T> hy2(N, incy ? incy : 1, stride_y, batch_count);
+    CHECK_HIP_ERROR(hx.memcheck());
+    CHECK_HIP_ERROR(hy.memcheck());
+    CHECK_HIP_ERROR(hz.memcheck());
+    CHECK_HIP_ERROR(hy1.memcheck());
+    CHECK_HIP_ERROR(hy2.memcheck());
+
+    device_strided_batch_vector<T> dx(N, incx ? incx : 1, stride_x, batch_count);
+    device_strided_batch_vector<T> dy(N, incy ? incy : 1, stride_y, batch_count);
+    device_strided_batch_vector<T> dz(N, incz ? incz : 1, stride_z, batch_count);
+    device_vector<T>               dalpha(1);
+    device_vector<T>               d_rocblas_result_2(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(dalpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_rocblas_result_2.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hz, arg, rocblas_client_alpha_sets_nan, false);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dz.transfer_from(hz));
+    CHECK_HIP_ERROR(dalpha.transfer_from(halpha));
+
+    double gpu_time_used, cpu_time_used;
+
+    // When incz is incy, the call in device pointer mode passes y as z, which forms the squared
+    // norms of the updated y
+    bool           z_is_y    = incz == incy;
+    T*             dz_ptr    = z_is_y ? (T*)dy : (T*)dz;
+    rocblas_stride dz_stride = z_is_y ? stride_y : stride_z;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot_strided_batched_fn(handle,
+                                                                N,
+                                                                halpha,
+                                                                dx,
+                                                                incx,
+                                                                stride_x,
+                                                                dy,
+                                                                incy,
+                                                                stride_y,
+                                                                dz,
+                                                                incz,
+                                                                stride_z,
+                                                                batch_count,
+                                                                rocblas_result_1));
+        CHECK_HIP_ERROR(hy1.transfer_from(dy));
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot_strided_batched_fn(handle,
+                                                                N,
+                                                                dalpha,
+                                                                dx,
+                                                                incx,
+                                                                stride_x,
+                                                                dy,
+                                                                incy,
+                                                                stride_y,
+                                                                dz_ptr,
+                                                                incz,
+                                                                dz_stride,
+                                                                batch_count,
+                                                                d_rocblas_result_2));
+        CHECK_HIP_ERROR(hy2.transfer_from(dy));
+        CHECK_HIP_ERROR(rocblas_result_2.transfer_from(d_rocblas_result_2));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        batched_reference(batch_count, [&](rocblas_int b) {
+            cpu_result_1[b] = rocblas_fused_blas1_ref::axpy_dot<T>(
+                N, h_alpha, hx[b], incx, hy[b], incy, hz[b], incz);
+            cpu_result_2[b] = z_is_y ? rocblas_fused_blas1_ref::dotc<T>(N, hy[b], incy, hy[b], incy)
+                                     : cpu_result_1[b];
+        });
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, stride_y, hy, hy1, batch_count);
+            unit_check_general<T>(1, N, abs_incy, stride_y, hy, hy2, batch_count);
+            unit_check_general<T>(1, 1, 1, 1, cpu_result_1, rocblas_result_1, batch_count);
+            unit_check_general<T>(1, 1, 1, 1, cpu_result_2, rocblas_result_2, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1
+                = norm_check_general<T>('I', 1, N, abs_incy, stride_y, hy, hy1, batch_count);
+            rocblas_error_2
+                = norm_check_general<T>('I', 1, N, abs_incy, stride_y, hy, hy2, batch_count);
+            for(int b = 0; b < batch_count; ++b)
+            {
+                rocblas_error_1
+                    += rocblas_abs((cpu_result_1[b] - rocblas_result_1[b]) / cpu_result_1[b]);
+                rocblas_error_2
+                    += rocblas_abs((cpu_result_2[b] - rocblas_result_2[b]) / cpu_result_2[b]);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_axpy_dot_strided_batched_fn(handle,
+                                                N,
+                                                dalpha,
+                                                dx,
+                                                incx,
+                                                stride_x,
+                                                dy,
+                                                incy,
+                                                stride_y,
+                                                dz,
+                                                incz,
+                                                stride_z,
+                                                batch_count,
+                                                d_rocblas_result_2);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_axpy_dot_strided_batched_fn(handle,
+                                                N,
+                                                dalpha,
+                                                dx,
+                                                incx,
+                                                stride_x,
+                                                dy,
+                                                incy,
+                                                stride_y,
+                                                dz,
+                                                incz,
+                                                stride_z,
+                                                batch_count,
+                                                d_rocblas_result_2);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_incy, e_incz, e_stride_x, e_stride_y, e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         axpy_dot_gflop_count<T>(N),
+                         axpy_dot_gbyte_count<T>(N),
+                         cpu_time_used,
+                         rocblas_error_1,
+                         rocblas_error_2);
+    }
+}
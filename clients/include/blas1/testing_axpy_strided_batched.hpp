@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -198,10 +199,9 @@ void testing_axpy_strided_batched(const Arguments& arg)
                 //
                 // Compute the host solution.
                 //
-                for(rocblas_int batch_index = 0; batch_index < batch_count; ++batch_index)
-                {
+                batched_reference(batch_count, [&](rocblas_int batch_index) {
                     cblas_axpy<T>(N, h_alpha, hx[batch_index], incx, hy[batch_index], incy);
-                }
+                });
                 cpu_time_used = get_time_us_no_sync() - cpu_time_used;
             }
 
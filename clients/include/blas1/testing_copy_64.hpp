@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_copy_64_bad_arg(const Arguments& arg)
+{
+    auto rocblas_copy_64_fn = rocblas_copy_64<T>;
+
+    int64_t             N         = 100;
+    int64_t             incx      = 1;
+    int64_t             incy      = 1;
+    static const size_t safe_size = 100; //  arbitrarily set to 100
+
+    rocblas_local_handle handle{arg};
+
+    // allocate memory on device
+    device_vector<T> dx(safe_size);
+    device_vector<T> dy(safe_size);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_copy_64_fn(handle, N, nullptr, incx, dy, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_copy_64_fn(handle, N, dx, incx, nullptr, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_copy_64_fn(nullptr, N, dx, incx, dy, incy),
+                          rocblas_status_invalid_handle);
+    // Quick return for a negative size which does not fit in rocblas_int
+    int64_t N_64 = int64_t(1) << 33;
+    EXPECT_ROCBLAS_STATUS(rocblas_copy_64_fn(handle, -N_64, nullptr, incx, nullptr, incy),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_copy_64(const Arguments& arg)
+{
+    auto rocblas_copy_64_fn = rocblas_copy_64<T>;
+
+    int64_t              N    = arg.N;
+    int64_t              incx = arg.incx;
+    int64_t              incy = arg.incy;
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_copy_64_fn(handle, N, nullptr, incx, nullptr, incy));
+        return;
+    }
+
+    int64_t abs_incx = incx >= 0 ? incx : -incx;
+    int64_t abs_incy = incy >= 0 ? incy : -incy;
+    size_t  size_x   = std::max(size_t(N * abs_incx), size_t(1));
+    size_t  size_y   = std::max(size_t(N * abs_incy), size_t(1));
+
+    host_vector<T> hx(size_x);
+    host_vector<T> hy(size_y);
+    host_vector<T> hx_gold(size_x);
+    host_vector<T> hy_gold(size_y);
+
+    // Initial Data on CPU
+    rocblas_init_vector(hx, arg, N, abs_incx, 0, 1, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, N, abs_incy, 0, 1, rocblas_client_alpha_sets_nan, false);
+    hx_gold = hx;
+    hy_gold = hy;
+
+    device_vector<T> dx(size_x);
+    device_vector<T> dy(size_y);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    CHECK_ROCBLAS_ERROR(rocblas_copy_64_fn(handle, N, dx, incx, dy, incy));
+
+    CHECK_HIP_ERROR(hx.transfer_from(dx));
+    CHECK_HIP_ERROR(hy.transfer_from(dy));
+
+    // CPU BLAS, whose rocblas_int sizes hold the sizes of the tests
+    cblas_copy<T>(N, hx_gold, incx, hy_gold, incy);
+
+    if(arg.unit_check)
+    {
+        unit_check_general<T>(1, N, abs_incx, hx_gold, hx);
+        unit_check_general<T>(1, N, abs_incy, hy_gold, hy);
+    }
+}
@@ -0,0 +1,248 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "batched_reference.hpp"
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_fused_blas1_ref.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+/* ============================================================================================ */
+template <typename T>
+void testing_dot2_batched_bad_arg(const Arguments& arg)
+{
+    auto rocblas_dot2_batched_fn = rocblas_dot2_batched<T>;
+
+    rocblas_int N = 100, incx = 1, incy = 1, incz = 1, batch_count = 2;
+
+    rocblas_local_handle   handle{arg};
+    device_batch_vector<T> dx(N, incx, batch_count);
+    device_batch_vector<T> dy(N, incy, batch_count);
+    device_batch_vector<T> dz(N, incz, batch_count);
+    device_vector<T>       d_result(2 * batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    auto dx_ptr = dx.ptr_on_device();
+    auto dy_ptr = dy.ptr_on_device();
+    auto dz_ptr = dz.ptr_on_device();
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_dot2_batched_fn(
+            handle, N, nullptr, incx, dy_ptr, incy, dz_ptr, incz, batch_count, d_result),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_dot2_batched_fn(
+            handle, N, dx_ptr, incx, nullptr, incy, dz_ptr, incz, batch_count, d_result),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_dot2_batched_fn(
+            handle, N, dx_ptr, incx, dy_ptr, incy, nullptr, incz, batch_count, d_result),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_dot2_batched_fn(
+            handle, N, dx_ptr, incx, dy_ptr, incy, dz_ptr, incz, batch_count, nullptr),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_dot2_batched_fn(
+            nullptr, N, dx_ptr, incx, dy_ptr, incy, dz_ptr, incz, batch_count, d_result),
+        rocblas_status_invalid_handle);
+}
+
+template <typename T>
+void testing_dot2_batched(const Arguments& arg)
+{
+    auto rocblas_dot2_batched_fn = rocblas_dot2_batched<T>;
+
+    rocblas_int N           = arg.N;
+    rocblas_int incx        = arg.incx;
+    rocblas_int incy        = arg.incy;
+    rocblas_int incz        = arg.incz;
+    rocblas_int batch_count = arg.batch_count;
+
+    double               rocblas_error_1 = 0;
+    double               rocblas_error_2 = 0;
+    rocblas_local_handle handle{arg};
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0 || batch_count <= 0)
+    {
+        device_vector<T> d_rocblas_result(std::max(2 * batch_count, 1));
+        CHECK_DEVICE_ALLOCATION(d_rocblas_result.memcheck());
+
+        host_vector<T> h_rocblas_result(std::max(2 * batch_count, 1));
+        CHECK_HIP_ERROR(h_rocblas_result.memcheck());
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_dot2_batched_fn(
+            handle, N, nullptr, incx, nullptr, incy, nullptr, incz, batch_count, d_rocblas_result));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_dot2_batched_fn(
+            handle, N, nullptr, incx, nullptr, incy, nullptr, incz, batch_count, h_rocblas_result));
+
+        if(batch_count > 0)
+        {
+            host_vector<T> cpu_0(2 * batch_count);
+            host_vector<T> gpu_0(2 * batch_count);
+            CHECK_HIP_ERROR(gpu_0.transfer_from(d_rocblas_result));
+            unit_check_general<T>(1, 1, 1, 1, cpu_0, gpu_0, 2 * batch_count);
+            unit_check_general<T>(1, 1, 1, 1, cpu_0, h_rocblas_result, 2 * batch_count);
+        }
+
+        return;
+    }
+
+    // The products with y for all the batches, followed by the products with z
+    host_vector<T> cpu_result(2 * batch_count);
+    host_vector<T> rocblas_result_1(2 * batch_count);
+    host_vector<T> rocblas_result_2(2 * batch_count);
+
+    //Device-arrays of pointers to device memory
+    device_batch_vector<T> dx(N, incx ? incx : 1, batch_count);
+    device_batch_vector<T> dy(N, incy ? incy : 1, batch_count);
+    device_batch_vector<T> dz(N, incz ? incz : 1, batch_count);
+    device_vector<T>       d_rocblas_result_2(2 * batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_rocblas_result_2.memcheck());
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_batch_vector<T> hx(N, incx ? incx : 1, batch_count);
+    host_batch_vector<T> hy(N, incy ? incy : 1, batch_count);
+    host_batch_vector<T> hz(N, incz ? incz : 1, batch_count);
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hz, arg, rocblas_client_alpha_sets_nan, false);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dz.transfer_from(hz));
+
+    double gpu_time_used, cpu_time_used;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_dot2_batched_fn(handle,
+                                                    N,
+                                                    dx.ptr_on_device(),
+                                                    incx,
+                                                    dy.ptr_on_device(),
+                                                    incy,
+                                                    dz.ptr_on_device(),
+                                                    incz,
+                                                    batch_count,
+                                                    rocblas_result_1));
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_dot2_batched_fn(handle,
+                                                    N,
+                                                    dx.ptr_on_device(),
+                                                    incx,
+                                                    dy.ptr_on_device(),
+                                                    incy,
+                                                    dz.ptr_on_device(),
+                                                    incz,
+                                                    batch_count,
+                                                    d_rocblas_result_2));
+        CHECK_HIP_ERROR(rocblas_result_2.transfer_from(d_rocblas_result_2));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        batched_reference(batch_count, [&](rocblas_int b) {
+            cpu_result[b] = rocblas_fused_blas1_ref::dotc<T>(N, hx[b], incx, hy[b], incy);
+            cpu_result[batch_count + b]
+                = rocblas_fused_blas1_ref::dotc<T>(N, hx[b], incx, hz[b], incz);
+        });
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, 1, 1, 1, cpu_result, rocblas_result_1, 2 * batch_count);
+            unit_check_general<T>(1, 1, 1, 1, cpu_result, rocblas_result_2, 2 * batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            for(int i = 0; i < 2 * batch_count; ++i)
+            {
+                rocblas_error_1
+                    += rocblas_abs((cpu_result[i] - rocblas_result_1[i]) / cpu_result[i]);
+                rocblas_error_2
+                    += rocblas_abs((cpu_result[i] - rocblas_result_2[i]) / cpu_result[i]);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_dot2_batched_fn(handle,
+                                    N,
+                                    dx.ptr_on_device(),
+                                    incx,
+                                    dy.ptr_on_device(),
+                                    incy,
+                                    dz.ptr_on_device(),
+                                    incz,
+                                    batch_count,
+                                    d_rocblas_result_2);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_dot2_batched_fn(handle,
+                                    N,
+                                    dx.ptr_on_device(),
+                                    incx,
+                                    dy.ptr_on_device(),
+                                    incy,
+                                    dz.ptr_on_device(),
+                                    incz,
+                                    batch_count,
+                                    d_rocblas_result_2);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_incx, e_incy, e_incz, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            dot2_gflop_count<T>(N),
+            dot2_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
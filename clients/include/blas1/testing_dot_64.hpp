@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "near.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T, bool CONJ = false>
+void testing_dot_64_bad_arg(const Arguments& arg)
+{
+    auto rocblas_dot_64_fn = CONJ ? rocblas_dotc_64<T> : rocblas_dot_64<T>;
+
+    int64_t             N         = 100;
+    int64_t             incx      = 1;
+    int64_t             incy      = 1;
+    static const size_t safe_size = 100; //  arbitrarily set to 100
+
+    rocblas_local_handle handle{arg};
+    device_vector<T>     dx(safe_size);
+    device_vector<T>     dy(safe_size);
+    device_vector<T>     d_rocblas_result(1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_rocblas_result.memcheck());
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_64_fn(handle, N, nullptr, incx, dy, incy, d_rocblas_result),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_64_fn(handle, N, dx, incx, nullptr, incy, d_rocblas_result),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_64_fn(handle, N, dx, incx, dy, incy, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_64_fn(nullptr, N, dx, incx, dy, incy, d_rocblas_result),
+                          rocblas_status_invalid_handle);
+
+    // A negative size which does not fit in rocblas_int sets the result to 0
+    int64_t N_64 = int64_t(1) << 33;
+    T       h_rocblas_result(1);
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_dot_64_fn(handle, -N_64, nullptr, incx, nullptr, incy, &h_rocblas_result),
+        rocblas_status_success);
+    T cpu_0 = T(0);
+    unit_check_general<T>(1, 1, 1, &cpu_0, &h_rocblas_result);
+}
+
+template <typename T>
+void testing_dotc_64_bad_arg(const Arguments& arg)
+{
+    testing_dot_64_bad_arg<T, true>(arg);
+}
+
+template <typename T, bool CONJ = false>
+void testing_dot_64(const Arguments& arg)
+{
+    auto rocblas_dot_64_fn = CONJ ? rocblas_dotc_64<T> : rocblas_dot_64<T>;
+
+    int64_t N    = arg.N;
+    int64_t incx = arg.incx;
+    int64_t incy = arg.incy;
+
+    T cpu_result;
+    T rocblas_result_1;
+    T rocblas_result_2;
+
+    rocblas_local_handle handle{arg};
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_dot_64_fn(handle, N, nullptr, incx, nullptr, incy, &rocblas_result_1));
+
+        T cpu_0 = T(0);
+        unit_check_general<T>(1, 1, 1, &cpu_0, &rocblas_result_1);
+        return;
+    }
+
+    int64_t abs_incx = incx >= 0 ? incx : -incx;
+    int64_t abs_incy = incy >= 0 ? incy : -incy;
+    size_t  size_x   = std::max(size_t(N * abs_incx), size_t(1));
+    size_t  size_y   = std::max(size_t(N * abs_incy), size_t(1));
+
+    // allocate memory on device
+    device_vector<T> dx(size_x);
+    device_vector<T> dy(size_y);
+    device_vector<T> d_rocblas_result_2(1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_rocblas_result_2.memcheck());
+
+    host_vector<T> hx(size_x);
+    host_vector<T> hy(size_y);
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, N, abs_incx, 0, 1, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, N, abs_incy, 0, 1, rocblas_client_alpha_sets_nan, false, true);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    // GPU BLAS, rocblas_pointer_mode_host
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_dot_64_fn(handle, N, dx, incx, dy, incy, &rocblas_result_1));
+
+    // GPU BLAS, rocblas_pointer_mode_device
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(rocblas_dot_64_fn(handle, N, dx, incx, dy, incy, d_rocblas_result_2));
+    CHECK_HIP_ERROR(
+        hipMemcpy(&rocblas_result_2, d_rocblas_result_2, sizeof(T), hipMemcpyDeviceToHost));
+
+    // CPU BLAS, whose rocblas_int sizes hold the sizes of the tests
+    (CONJ ? cblas_dotc<T> : cblas_dot<T>)(N, hx, incx, hy, incy, &cpu_result);
+
+    if(arg.unit_check)
+    {
+        if(std::is_same<T, rocblas_half>{} || std::is_same<T, rocblas_bfloat16>{})
+        {
+            // Half precision sums diverge proportionally to N, and more so across chunks
+            const double tol = N * sum_error_tolerance<T>;
+
+            near_check_general<T>(1, 1, 1, &cpu_result, &rocblas_result_1, tol);
+            near_check_general<T>(1, 1, 1, &cpu_result, &rocblas_result_2, tol);
+        }
+        else
+        {
+            unit_check_general<T>(1, 1, 1, &cpu_result, &rocblas_result_1);
+            unit_check_general<T>(1, 1, 1, &cpu_result, &rocblas_result_2);
+        }
+    }
+
+    if(arg.norm_check)
+    {
+        rocblas_cout << "cpu=" << cpu_result << ", gpu_host_ptr=" << rocblas_result_1
+                     << ", gpu_device_ptr=" << rocblas_result_2 << std::endl;
+    }
+}
+
+template <typename T>
+void testing_dotc_64(const Arguments& arg)
+{
+    testing_dot_64<T, true>(arg);
+}
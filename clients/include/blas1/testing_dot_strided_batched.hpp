@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -245,15 +246,14 @@ void testing_dot_strided_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < batch_count; ++b)
-        {
+        batched_reference(batch_count, [&](rocblas_int b) {
             (CONJ ? cblas_dotc<T> : cblas_dot<T>)(N,
                                                   hx + b * stride_x,
                                                   incx,
                                                   hy_ptr + b * stride_y,
                                                   incy,
                                                   &cpu_result[b]);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         if(arg.unit_check)
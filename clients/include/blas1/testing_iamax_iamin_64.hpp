@@ -0,0 +1,134 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "rocblas.hpp"
+#include "rocblas_iamax_iamin_ref.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_iamax_iamin_64_bad_arg(const Arguments& arg, rocblas_iamax_iamin_64_t<T> func)
+{
+    int64_t             N         = 100;
+    int64_t             incx      = 1;
+    static const size_t safe_size = 100;
+
+    rocblas_local_handle handle{arg};
+    device_vector<T>     dx(safe_size);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+
+    int64_t h_rocblas_result;
+
+    EXPECT_ROCBLAS_STATUS(func(handle, N, nullptr, incx, &h_rocblas_result),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(func(handle, N, dx, incx, nullptr), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(func(nullptr, N, dx, incx, &h_rocblas_result),
+                          rocblas_status_invalid_handle);
+
+    // A negative size which does not fit in rocblas_int sets the index to 0
+    int64_t N_64     = int64_t(1) << 33;
+    int64_t zero     = 0;
+    h_rocblas_result = 1;
+    EXPECT_ROCBLAS_STATUS(func(handle, -N_64, nullptr, incx, &h_rocblas_result),
+                          rocblas_status_success);
+    unit_check_general<int64_t>(1, 1, 1, &zero, &h_rocblas_result);
+}
+
+template <typename T>
+void testing_iamax_64_bad_arg(const Arguments& arg)
+{
+    testing_iamax_iamin_64_bad_arg<T>(arg, rocblas_iamax_64<T>);
+}
+
+template <typename T>
+void testing_iamin_64_bad_arg(const Arguments& arg)
+{
+    testing_iamax_iamin_64_bad_arg<T>(arg, rocblas_iamin_64<T>);
+}
+
+template <typename T, void REFBLAS_FUNC(rocblas_int, const T*, rocblas_int, rocblas_int*)>
+void testing_iamax_iamin_64(const Arguments& arg, rocblas_iamax_iamin_64_t<T> func)
+{
+    int64_t N    = arg.N;
+    int64_t incx = arg.incx;
+
+    int64_t h_rocblas_result_1;
+    int64_t h_rocblas_result_2;
+
+    rocblas_local_handle handle{arg};
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0 || incx <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(func(handle, N, nullptr, incx, &h_rocblas_result_1));
+
+        int64_t cpu_0 = 0;
+        unit_check_general<int64_t>(1, 1, 1, &cpu_0, &h_rocblas_result_1);
+        return;
+    }
+
+    size_t size_x = size_t(N) * incx;
+
+    // allocate memory on device
+    device_vector<T>       dx(size_x);
+    device_vector<int64_t> d_rocblas_result(1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_rocblas_result.memcheck());
+
+    host_vector<T> hx(size_x);
+
+    // Initial Data on CPU
+    rocblas_init_vector(hx, arg, N, incx, 0, 1, rocblas_client_alpha_sets_nan, true);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    // GPU BLAS rocblas_pointer_mode_host
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(func(handle, N, dx, incx, &h_rocblas_result_1));
+
+    // GPU BLAS, rocblas_pointer_mode_device
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(func(handle, N, dx, incx, d_rocblas_result));
+    CHECK_HIP_ERROR(hipMemcpy(
+        &h_rocblas_result_2, d_rocblas_result, sizeof(int64_t), hipMemcpyDeviceToHost));
+
+    // CPU BLAS, whose rocblas_int sizes hold the sizes of the tests
+    rocblas_int cpu_index;
+    REFBLAS_FUNC(N, hx, incx, &cpu_index);
+    int64_t cpu_result = cpu_index;
+
+    if(arg.unit_check)
+    {
+        unit_check_general<int64_t>(1, 1, 1, &cpu_result, &h_rocblas_result_1);
+        unit_check_general<int64_t>(1, 1, 1, &cpu_result, &h_rocblas_result_2);
+    }
+
+    if(arg.norm_check)
+    {
+        rocblas_cout << "cpu=" << cpu_result << ", gpu_host_ptr=" << h_rocblas_result_1
+                     << ", gpu_dev_ptr=" << h_rocblas_result_2 << std::endl;
+    }
+}
+
+template <typename T>
+void testing_iamax_64(const Arguments& arg)
+{
+    testing_iamax_iamin_64<T, rocblas_iamax_iamin_ref::iamax<T>>(arg, rocblas_iamax_64<T>);
+}
+
+template <typename T>
+void testing_iamin_64(const Arguments& arg)
+{
+    testing_iamax_iamin_64<T, rocblas_iamax_iamin_ref::iamin<T>>(arg, rocblas_iamin_64<T>);
+}
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "near.hpp"
@@ -139,10 +140,9 @@ void testing_nrm2_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             cblas_nrm2<T>(N, hx[i], incx, cpu_result + i);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         real_t<T> abs_result = cpu_result[0] > 0 ? cpu_result[0] : -cpu_result[0];
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "cblas_interface.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
@@ -130,10 +131,9 @@ void testing_rotg_batched(const Arguments& arg)
         cs.copy_from(hs);
 
         cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < batch_count; b++)
-        {
+        batched_reference(batch_count, [&](rocblas_int b) {
             cblas_rotg<T, U>(ca[b], cb[b], cc[b], cs[b]);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         // Test rocblas_pointer_mode_host
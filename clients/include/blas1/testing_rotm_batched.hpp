@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "cblas_interface.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
@@ -144,10 +145,9 @@ void testing_rotm_batched(const Arguments& arg)
         cy.copy_from(hy);
 
         cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < batch_count; b++)
-        {
+        batched_reference(batch_count, [&](rocblas_int b) {
             cblas_rotm<T>(N, cx[b], incx, cy[b], incy, hparam[b]);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         if(arg.unit_check || arg.norm_check)
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "cblas_interface.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
@@ -141,10 +142,9 @@ void testing_rotmg_batched(const Arguments& arg)
         cparams.copy_from(hparams);
 
         cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < batch_count; b++)
-        {
+        batched_reference(batch_count, [&](rocblas_int b) {
             cblas_rotmg<T>(cd1[b], cd2[b], cx1[b], cy1[b], cparams[b]);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         // Test rocblas_pointer_mode_host
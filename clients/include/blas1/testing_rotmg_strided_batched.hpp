@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "cblas_interface.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
@@ -135,14 +136,13 @@ void testing_rotmg_strided_batched(const Arguments& arg)
         host_vector<T> cy1     = hy1;
 
         cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < batch_count; b++)
-        {
+        batched_reference(batch_count, [&](rocblas_int b) {
             cblas_rotmg<T>(cd1 + b * stride_d1,
                            cd2 + b * stride_d2,
                            cx1 + b * stride_x1,
                            cy1 + b * stride_y1,
                            cparams + b * stride_param);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         // Test rocblas_pointer_mode_host
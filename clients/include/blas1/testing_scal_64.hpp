@@ -0,0 +1,104 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T, typename U = T>
+void testing_scal_64_bad_arg(const Arguments& arg)
+{
+    auto rocblas_scal_64_fn = rocblas_scal_64<T, U>;
+
+    int64_t N     = 100;
+    int64_t incx  = 1;
+    U       alpha = (U)0.6;
+
+    rocblas_local_handle handle{arg};
+
+    // allocate memory on device
+    device_vector<T> dx(N * incx);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+
+    EXPECT_ROCBLAS_STATUS((rocblas_scal_64_fn(handle, N, &alpha, nullptr, incx)),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS((rocblas_scal_64_fn(handle, N, nullptr, dx, incx)),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS((rocblas_scal_64_fn(nullptr, N, &alpha, dx, incx)),
+                          rocblas_status_invalid_handle);
+    // Quick return for negative sizes and increments which do not fit in rocblas_int
+    int64_t N_64 = int64_t(1) << 33;
+    EXPECT_ROCBLAS_STATUS((rocblas_scal_64_fn(handle, -N_64, nullptr, nullptr, incx)),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS((rocblas_scal_64_fn(handle, N, nullptr, nullptr, -N_64)),
+                          rocblas_status_success);
+}
+
+template <typename T, typename U = T>
+void testing_scal_64(const Arguments& arg)
+{
+    auto rocblas_scal_64_fn = rocblas_scal_64<T, U>;
+
+    int64_t N       = arg.N;
+    int64_t incx    = arg.incx;
+    U       h_alpha = arg.get_alpha<U>();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || incx <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR((rocblas_scal_64_fn(handle, N, nullptr, nullptr, incx)));
+        return;
+    }
+
+    size_t size_x = N * size_t(incx);
+
+    host_vector<T> hx(size_x);
+    host_vector<T> hx_gold(size_x);
+
+    // Initial Data on CPU
+    rocblas_init_vector(hx, arg, N, incx, 0, 1, rocblas_client_alpha_sets_nan, true);
+    hx_gold = hx;
+
+    device_vector<T> dx(size_x);
+    device_vector<U> d_alpha(1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(U), hipMemcpyHostToDevice));
+
+    // x is scaled twice, in host and then in device pointer mode, and compared once
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR((rocblas_scal_64_fn(handle, N, &h_alpha, dx, incx)));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR((rocblas_scal_64_fn(handle, N, d_alpha, dx, incx)));
+
+    CHECK_HIP_ERROR(hx.transfer_from(dx));
+
+    // CPU BLAS, whose rocblas_int sizes hold the sizes of the tests
+    cblas_scal(N, h_alpha, (T*)hx_gold, incx);
+    cblas_scal(N, h_alpha, (T*)hx_gold, incx);
+
+    if(arg.unit_check)
+        unit_check_general<T>(1, N, incx, hx_gold, hx);
+
+    if(arg.norm_check)
+    {
+        double rocblas_error = norm_check_general<T>('F', 1, N, incx, hx_gold, hx);
+        rocblas_cout << "rocblas_error=" << rocblas_error << std::endl;
+    }
+}
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -101,10 +102,9 @@ void testing_scal_strided_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             cblas_scal(N, h_alpha, (T*)hx_gold + i * stridex, incx);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -0,0 +1,212 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_fused_blas1_ref.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+/* ============================================================================================ */
+template <typename T>
+void testing_waxpby_bad_arg(const Arguments& arg)
+{
+    auto rocblas_waxpby_fn = rocblas_waxpby<T>;
+
+    rocblas_int N         = 100;
+    rocblas_int incx      = 1;
+    rocblas_int incy      = 1;
+    rocblas_int incw      = 1;
+    size_t      safe_size = 100;
+    T           alpha     = 0.6;
+    T           beta      = 0.5;
+
+    rocblas_local_handle handle{arg};
+    device_vector<T>     dx(safe_size);
+    device_vector<T>     dy(safe_size);
+    device_vector<T>     dw(safe_size);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dw.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_waxpby_fn(handle, N, &alpha, nullptr, incx, &beta, dy, incy, dw, incw),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_waxpby_fn(handle, N, &alpha, dx, incx, &beta, nullptr, incy, dw, incw),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_waxpby_fn(handle, N, &alpha, dx, incx, &beta, dy, incy, nullptr, incw),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_waxpby_fn(handle, N, nullptr, dx, incx, &beta, dy, incy, dw, incw),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_waxpby_fn(handle, N, &alpha, dx, incx, nullptr, dy, incy, dw, incw),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_waxpby_fn(nullptr, N, &alpha, dx, incx, &beta, dy, incy, dw, incw),
+        rocblas_status_invalid_handle);
+    // If N == 0, then alpha, beta, X, Y and W can be nullptr without error
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_waxpby_fn(handle, 0, nullptr, nullptr, incx, nullptr, nullptr, incy, nullptr, incw),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_waxpby(const Arguments& arg)
+{
+    auto rocblas_waxpby_fn = rocblas_waxpby<T>;
+
+    rocblas_int          N       = arg.N;
+    rocblas_int          incx    = arg.incx;
+    rocblas_int          incy    = arg.incy;
+    rocblas_int          incw    = arg.incy;
+    T                    h_alpha = arg.get_alpha<T>();
+    T                    h_beta  = arg.get_beta<T>();
+    bool                 HMM     = arg.HMM;
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_waxpby_fn(
+            handle, N, nullptr, nullptr, incx, nullptr, nullptr, incy, nullptr, incw));
+        return;
+    }
+
+    rocblas_int abs_incx = incx > 0 ? incx : -incx;
+    rocblas_int abs_incy = incy > 0 ? incy : -incy;
+    rocblas_int abs_incw = incw > 0 ? incw : -incw;
+    size_t      size_x   = N * size_t(abs_incx);
+    size_t      size_y   = N * size_t(abs_incy);
+    size_t      size_w   = N * size_t(abs_incw);
+    if(!size_x)
+        size_x = 1;
+    if(!size_y)
+        size_y = 1;
+    if(!size_w)
+        size_w = 1;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(size_x);
+    host_vector<T> hy(size_y);
+    host_vector<T> hw_1(size_w);
+    host_vector<T> hw_2(size_w);
+    host_vector<T> hw_gold(size_w);
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, N, abs_incx, 0, 1, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, N, abs_incy, 0, 1, rocblas_client_beta_sets_nan, false, true);
+    rocblas_init_vector(hw_1, arg, N, abs_incw, 0, 1, rocblas_client_never_set_nan, false);
+
+    // w is only written, so it starts out with values which must all be overwritten
+    hw_2    = hw_1;
+    hw_gold = hw_1;
+
+    // allocate memory on device
+    device_vector<T> dx(size_x, 1, HMM);
+    device_vector<T> dy(size_y, 1, HMM);
+    device_vector<T> dw_1(size_w, 1, HMM);
+    device_vector<T> dw_2(size_w, 1, HMM);
+    device_vector<T> d_alpha(1, 1, HMM);
+    device_vector<T> d_beta(1, 1, HMM);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dw_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dw_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dw_1.transfer_from(hw_1));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dw_2.transfer_from(hw_2));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        // ROCBLAS pointer mode host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_waxpby_fn(handle, N, &h_alpha, dx, incx, &h_beta, dy, incy, dw_1, incw));
+
+        // ROCBLAS pointer mode device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_waxpby_fn(handle, N, d_alpha, dx, incx, d_beta, dy, incy, dw_2, incw));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hw_1.transfer_from(dw_1));
+        CHECK_HIP_ERROR(hw_2.transfer_from(dw_2));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        rocblas_fused_blas1_ref::waxpby<T>(N, h_alpha, hx, incx, h_beta, hy, incy, hw_gold, incw);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incw, hw_gold, hw_1);
+            unit_check_general<T>(1, N, abs_incw, hw_gold, hw_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', 1, N, abs_incw, hw_gold, hw_1);
+            rocblas_error_2 = norm_check_general<T>('F', 1, N, abs_incw, hw_gold, hw_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_waxpby_fn(handle, N, &h_alpha, dx, incx, &h_beta, dy, incy, dw_1, incw);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_waxpby_fn(handle, N, &h_alpha, dx, incx, &h_beta, dy, incy, dw_1, incw);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_beta, e_incy>{}.log_args<T>(rocblas_cout,
+                                                                          arg,
+                                                                          gpu_time_used,
+                                                                          axpby_gflop_count<T>(N),
+                                                                          axpby_gbyte_count<T>(N),
+                                                                          cpu_time_used,
+                                                                          rocblas_error_1,
+                                                                          rocblas_error_2);
+    }
+}
@@ -0,0 +1,270 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "batched_reference.hpp"
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_fused_blas1_ref.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+/* ============================================================================================ */
+template <typename T>
+void testing_waxpby_batched_bad_arg(const Arguments& arg)
+{
+    auto rocblas_waxpby_batched_fn = rocblas_waxpby_batched<T>;
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int N = 100, incx = 1, incy = 1, incw = 1, batch_count = 2;
+
+    T                      alpha = 0.6, beta = 0.5;
+    device_batch_vector<T> dx(10, 1, 2);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    device_batch_vector<T> dy(10, 1, 2);
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    device_batch_vector<T> dw(10, 1, 2);
+    CHECK_DEVICE_ALLOCATION(dw.memcheck());
+
+    auto dx_ptr = dx.ptr_on_device();
+    auto dy_ptr = dy.ptr_on_device();
+    auto dw_ptr = dw.ptr_on_device();
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_waxpby_batched_fn(
+            handle, N, &alpha, nullptr, incx, &beta, dy_ptr, incy, dw_ptr, incw, batch_count),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_waxpby_batched_fn(
+            handle, N, &alpha, dx_ptr, incx, &beta, nullptr, incy, dw_ptr, incw, batch_count),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_waxpby_batched_fn(
+            handle, N, &alpha, dx_ptr, incx, &beta, dy_ptr, incy, nullptr, incw, batch_count),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_waxpby_batched_fn(
+            handle, N, nullptr, dx_ptr, incx, &beta, dy_ptr, incy, dw_ptr, incw, batch_count),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_waxpby_batched_fn(
+            handle, N, &alpha, dx_ptr, incx, nullptr, dy_ptr, incy, dw_ptr, incw, batch_count),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_waxpby_batched_fn(
+            nullptr, N, &alpha, dx_ptr, incx, &beta, dy_ptr, incy, dw_ptr, incw, batch_count),
+        rocblas_status_invalid_handle);
+
+    // When N==0, all pointers can be nullptr without error
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_waxpby_batched_fn(
+            handle, 0, nullptr, nullptr, incx, nullptr, nullptr, incy, nullptr, incw, batch_count),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_waxpby_batched(const Arguments& arg)
+{
+    auto rocblas_waxpby_batched_fn = rocblas_waxpby_batched<T>;
+
+    rocblas_local_handle handle{arg};
+    rocblas_int          N = arg.N, incx = arg.incx, incy = arg.incy, incw = arg.incy,
+                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || batch_count <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(rocblas_waxpby_batched_fn(handle,
+                                                        N,
+                                                        nullptr,
+                                                        nullptr,
+                                                        incx,
+                                                        nullptr,
+                                                        nullptr,
+                                                        incy,
+                                                        nullptr,
+                                                        incw,
+                                                        batch_count),
+                              rocblas_status_success);
+        return;
+    }
+
+    rocblas_int abs_incw = std::abs(incw);
+
+    //
+    // Host memory.
+    //
+    host_batch_vector<T> hx(N, incx ? incx : 1, batch_count), hy(N, incy ? incy : 1, batch_count),
+        hw(N, incw ? incw : 1, batch_count), hw1(N, incw ? incw : 1, batch_count),
+        hw2(N, incw ? incw : 1, batch_count);
+    host_vector<T> halpha(1), hbeta(1);
+
+    CHECK_HIP_ERROR(hx.memcheck());
+    CHECK_HIP_ERROR(hy.memcheck());
+    CHECK_HIP_ERROR(hw.memcheck());
+    CHECK_HIP_ERROR(hw1.memcheck());
+    CHECK_HIP_ERROR(hw2.memcheck());
+    CHECK_HIP_ERROR(halpha.memcheck());
+    CHECK_HIP_ERROR(hbeta.memcheck());
+
+    //
+    // Device memory.
+    //
+    device_batch_vector<T> dx(N, incx ? incx : 1, batch_count), dy(N, incy ? incy : 1, batch_count),
+        dw(N, incw ? incw : 1, batch_count);
+    device_vector<T> dalpha(1), dbeta(1);
+
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dw.memcheck());
+    CHECK_DEVICE_ALLOCATION(dalpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(dbeta.memcheck());
+
+    halpha[0] = h_alpha;
+    hbeta[0]  = h_beta;
+
+    //
+    // Initialize data on host memory
+    //
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_beta_sets_nan, false, true);
+    rocblas_init_vector(hw, arg, rocblas_client_never_set_nan, false);
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        //
+        // Call routine with pointer mode on host.
+        //
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dw.transfer_from(hw));
+        CHECK_ROCBLAS_ERROR(rocblas_waxpby_batched_fn(handle,
+                                                      N,
+                                                      halpha,
+                                                      dx.ptr_on_device(),
+                                                      incx,
+                                                      hbeta,
+                                                      dy.ptr_on_device(),
+                                                      incy,
+                                                      dw.ptr_on_device(),
+                                                      incw,
+                                                      batch_count));
+        CHECK_HIP_ERROR(hw1.transfer_from(dw));
+
+        //
+        // Call routine with pointer mode on device.
+        //
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(dw.transfer_from(hw));
+        CHECK_HIP_ERROR(dalpha.transfer_from(halpha));
+        CHECK_HIP_ERROR(dbeta.transfer_from(hbeta));
+        CHECK_ROCBLAS_ERROR(rocblas_waxpby_batched_fn(handle,
+                                                      N,
+                                                      dalpha,
+                                                      dx.ptr_on_device(),
+                                                      incx,
+                                                      dbeta,
+                                                      dy.ptr_on_device(),
+                                                      incy,
+                                                      dw.ptr_on_device(),
+                                                      incw,
+                                                      batch_count));
+        CHECK_HIP_ERROR(hw2.transfer_from(dw));
+
+        //
+        // CPU BLAS
+        //
+        cpu_time_used = get_time_us_no_sync();
+        batched_reference(batch_count, [&](rocblas_int b) {
+            rocblas_fused_blas1_ref::waxpby<T>(
+                N, h_alpha, hx[b], incx, h_beta, hy[b], incy, hw[b], incw);
+        });
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        //
+        // Compare with with the solution.
+        //
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incw, hw, hw1, batch_count);
+            unit_check_general<T>(1, N, abs_incw, hw, hw2, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('I', 1, N, abs_incw, hw, hw1, batch_count);
+            rocblas_error_2 = norm_check_general<T>('I', 1, N, abs_incw, hw, hw2, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_waxpby_batched_fn(handle,
+                                      N,
+                                      &h_alpha,
+                                      dx.ptr_on_device(),
+                                      incx,
+                                      &h_beta,
+                                      dy.ptr_on_device(),
+                                      incy,
+                                      dw.ptr_on_device(),
+                                      incw,
+                                      batch_count);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_waxpby_batched_fn(handle,
+                                      N,
+                                      &h_alpha,
+                                      dx.ptr_on_device(),
+                                      incx,
+                                      &h_beta,
+                                      dy.ptr_on_device(),
+                                      incy,
+                                      dw.ptr_on_device(),
+                                      incw,
+                                      batch_count);
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_beta, e_incy, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            axpby_gflop_count<T>(N),
+            axpby_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
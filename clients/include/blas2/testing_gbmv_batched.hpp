@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -316,11 +317,10 @@ void testing_gbmv_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < batch_count; ++b)
-        {
+        batched_reference(batch_count, [&](rocblas_int b) {
             cblas_gbmv<T>(
                 transA, M, N, KL, KU, h_alpha, hA[b], lda, hxA[b], incx, h_beta, hy_goldA[b], incy);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         // copy output from device to CPU
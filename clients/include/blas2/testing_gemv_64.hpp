@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_gemv_64_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemv_64_fn = rocblas_gemv_64<T>;
+
+    const int64_t M    = 100;
+    const int64_t N    = 100;
+    const int64_t lda  = 100;
+    const int64_t incx = 1;
+    const int64_t incy = 1;
+
+    const T alpha(1), beta(1), zero(0), one(1);
+
+    const rocblas_operation transA = rocblas_operation_none;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T> dA(lda * N);
+    device_vector<T> dx(N * incx);
+    device_vector<T> dy(M * incy);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_64_fn(handle, transA, M, N, &alpha, nullptr, lda, dx, incx, &beta, dy, incy),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_64_fn(handle, transA, M, N, &alpha, dA, lda, nullptr, incx, &beta, dy, incy),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_64_fn(handle, transA, M, N, &alpha, dA, lda, dx, incx, &beta, nullptr, incy),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_64_fn(handle, transA, M, N, nullptr, dA, lda, dx, incx, &beta, dy, incy),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_64_fn(handle, transA, M, N, &alpha, dA, lda, dx, incx, nullptr, dy, incy),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_64_fn(nullptr, transA, M, N, &alpha, dA, lda, dx, incx, &beta, dy, incy),
+        rocblas_status_invalid_handle);
+
+    // If alpha == 0 and beta == 1, then A, x and y can be nullptr without error, also for sizes,
+    // leading dimension and increments which do not fit in rocblas_int
+    const int64_t N_64 = int64_t(1) << 33;
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_64_fn(
+            handle, transA, N_64, N_64, &zero, nullptr, N_64, nullptr, N_64, &one, nullptr, -N_64),
+        rocblas_status_success);
+
+    // The sizes are checked as in gemv
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_64_fn(
+            handle, transA, N_64, N, &alpha, dA, N_64 - 1, dx, incx, &beta, dy, incy),
+        rocblas_status_invalid_size);
+}
+
+template <typename T>
+void testing_gemv_64(const Arguments& arg)
+{
+    auto rocblas_gemv_64_fn = rocblas_gemv_64<T>;
+
+    int64_t           M       = arg.M;
+    int64_t           N       = arg.N;
+    int64_t           lda     = arg.lda;
+    int64_t           incx    = arg.incx;
+    int64_t           incy    = arg.incy;
+    T                 h_alpha = arg.get_alpha<T>();
+    T                 h_beta  = arg.get_beta<T>();
+    rocblas_operation transA  = char2rocblas_operation(arg.transA);
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < M || lda < 1 || !incx || !incy;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemv_64_fn(
+                handle, transA, M, N, nullptr, nullptr, lda, nullptr, incx, nullptr, nullptr, incy),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+
+        return;
+    }
+
+    size_t  size_A   = lda * size_t(N);
+    int64_t dim_x    = transA == rocblas_operation_none ? N : M;
+    int64_t dim_y    = transA == rocblas_operation_none ? M : N;
+    int64_t abs_incx = incx >= 0 ? incx : -incx;
+    int64_t abs_incy = incy >= 0 ? incy : -incy;
+    size_t  size_x   = dim_x * size_t(abs_incx);
+    size_t  size_y   = dim_y * size_t(abs_incy);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hx(size_x);
+    host_vector<T> hy(size_y);
+    host_vector<T> hy_gold(size_y);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dx(size_x);
+    device_vector<T> dy(size_y);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(hA,
+                        arg,
+                        M,
+                        N,
+                        lda,
+                        0,
+                        1,
+                        rocblas_client_alpha_sets_nan,
+                        rocblas_client_general_matrix,
+                        true);
+    rocblas_init_vector(hx, arg, dim_x, abs_incx, 0, 1, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hy, arg, dim_y, abs_incy, 0, 1, rocblas_client_beta_sets_nan);
+    hy_gold = hy;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // y is updated twice, in host and then in device pointer mode, and compared once
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_gemv_64_fn(
+        handle, transA, M, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(
+        rocblas_gemv_64_fn(handle, transA, M, N, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
+
+    CHECK_HIP_ERROR(hy.transfer_from(dy));
+
+    // CPU BLAS, whose rocblas_int sizes hold the sizes of the tests
+    cblas_gemv<T>(transA, M, N, h_alpha, hA, lda, hx, incx, h_beta, hy_gold, incy);
+    cblas_gemv<T>(transA, M, N, h_alpha, hA, lda, hx, incx, h_beta, hy_gold, incy);
+
+    if(arg.unit_check)
+        unit_check_general<T>(1, dim_y, abs_incy, hy_gold, hy);
+
+    if(arg.norm_check)
+    {
+        double rocblas_error = norm_check_general<T>('F', 1, dim_y, abs_incy, hy_gold, hy);
+        rocblas_cout << "rocblas_error=" << rocblas_error << std::endl;
+    }
+}
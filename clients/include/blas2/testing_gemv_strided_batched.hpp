@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -430,8 +431,7 @@ void testing_gemv_strided_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < batch_count; ++b)
-        {
+        batched_reference(batch_count, [&](rocblas_int b) {
             cblas_gemv<T>(transA,
                           M,
                           N,
@@ -443,7 +443,7 @@ void testing_gemv_strided_batched(const Arguments& arg)
                           h_beta,
                           hy_gold + b * stride_y,
                           incy);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         // copy output from device to CPU
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -258,8 +259,7 @@ void testing_ger_strided_batched(const Arguments& arg)
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
 
-        for(int b = 0; b < batch_count; ++b)
-        {
+        batched_reference(batch_count, [&](rocblas_int b) {
             cblas_ger<T, CONJ>(M,
                                N,
                                h_alpha,
@@ -269,7 +269,7 @@ void testing_ger_strided_batched(const Arguments& arg)
                                incy,
                                hA_gold + b * stride_a,
                                lda);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
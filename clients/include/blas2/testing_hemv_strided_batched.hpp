@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -378,7 +379,7 @@ void testing_hemv_strided_batched(const Arguments& arg)
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
 
-        for(int b = 0; b < batch_count; b++)
+        batched_reference(batch_count, [&](rocblas_int b) {
             cblas_hemv<T>(uplo,
                           N,
                           h_alpha,
@@ -389,6 +390,7 @@ void testing_hemv_strided_batched(const Arguments& arg)
                           h_beta,
                           hy_gold + b * stride_y,
                           incy);
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
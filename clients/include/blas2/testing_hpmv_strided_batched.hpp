@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -357,7 +358,7 @@ void testing_hpmv_strided_batched(const Arguments& arg)
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
 
-        for(int b = 0; b < batch_count; b++)
+        batched_reference(batch_count, [&](rocblas_int b) {
             cblas_hpmv<T>(uplo,
                           N,
                           h_alpha,
@@ -367,6 +368,7 @@ void testing_hpmv_strided_batched(const Arguments& arg)
                           h_beta,
                           hy_gold + b * stride_y,
                           incy);
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -317,8 +318,7 @@ void testing_spmv_strided_batched(const Arguments& arg)
         // cpu reference
         cpu_time_used = get_time_us_no_sync();
 
-        for(int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             cblas_spmv<T>(uplo,
                           N,
                           alpha[0],
@@ -328,7 +328,7 @@ void testing_spmv_strided_batched(const Arguments& arg)
                           beta[0],
                           hg + i * stridey,
                           incy);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -328,8 +329,7 @@ void testing_symv_strided_batched(const Arguments& arg)
         // cpu reference
         cpu_time_used = get_time_us_no_sync();
 
-        for(int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             cblas_symv<T>(uplo,
                           N,
                           alpha[0],
@@ -340,7 +340,7 @@ void testing_symv_strided_batched(const Arguments& arg)
                           beta[0],
                           hg + i * stridey,
                           incy);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
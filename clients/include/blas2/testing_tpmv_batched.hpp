@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -147,10 +148,9 @@ void testing_tpmv_batched(const Arguments& arg)
         //
         {
             cpu_time_used = get_time_us_no_sync();
-            for(rocblas_int batch_index = 0; batch_index < batch_count; ++batch_index)
-            {
+            batched_reference(batch_count, [&](rocblas_int batch_index) {
                 cblas_tpmv<T>(uplo, transA, diag, M, hA[batch_index], hx[batch_index], incx);
-            }
+            });
             cpu_time_used = get_time_us_no_sync() - cpu_time_used;
         }
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
 #include "norm.hpp"
@@ -317,8 +318,7 @@ void testing_geam_batched(const Arguments& arg)
         // reference calculation for golden result
         cpu_time_used = get_time_us_no_sync();
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        batched_reference(batch_count, [&](rocblas_int b) {
             auto hA_copy_p = hA_copy[b];
             auto hB_copy_p = hB_copy[b];
             auto hC_gold_p = hC_gold[b];
@@ -335,7 +335,7 @@ void testing_geam_batched(const Arguments& arg)
                        ldb,
                        (T*)hC_gold_p,
                        ldc);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -0,0 +1,241 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_gemm_64_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_64_fn = rocblas_gemm_64<T>;
+
+    const int64_t M = 100;
+    const int64_t N = 100;
+    const int64_t K = 100;
+
+    const int64_t lda = 100;
+    const int64_t ldb = 100;
+    const int64_t ldc = 100;
+
+    const T alpha(1), beta(1), zero(0), one(1);
+
+    const size_t safe_size = 100;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    // allocate memory on device
+    device_vector<T> dA(safe_size);
+    device_vector<T> dB(safe_size);
+    device_vector<T> dC(safe_size);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_64_fn(
+            handle, transA, transB, M, N, K, &alpha, nullptr, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_64_fn(
+            handle, transA, transB, M, N, K, &alpha, dA, lda, nullptr, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_64_fn(
+            handle, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, nullptr, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_64_fn(
+            handle, transA, transB, M, N, K, nullptr, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_64_fn(
+            handle, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, nullptr, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_64_fn(
+            nullptr, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_handle);
+
+    // If alpha == 0 and beta == 1, then A, B and C can be nullptr without error, also for sizes
+    // and leading dimensions which do not fit in rocblas_int
+    const int64_t N_64 = int64_t(1) << 33;
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_64_fn(handle,
+                                             transA,
+                                             transB,
+                                             N_64,
+                                             N_64,
+                                             N_64,
+                                             &zero,
+                                             nullptr,
+                                             N_64,
+                                             nullptr,
+                                             N_64,
+                                             &one,
+                                             nullptr,
+                                             N_64),
+                          rocblas_status_success);
+
+    // The sizes are checked as in gemm
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_64_fn(
+            handle, transA, transB, N_64, N, K, &alpha, dA, N_64 - 1, dB, ldb, &beta, dC, N_64),
+        rocblas_status_invalid_size);
+}
+
+template <typename T>
+void testing_gemm_64(const Arguments& arg)
+{
+    auto rocblas_gemm_64_fn = rocblas_gemm_64<T>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    int64_t M = arg.M;
+    int64_t N = arg.N;
+    int64_t K = arg.K;
+
+    int64_t lda = arg.lda;
+    int64_t ldb = arg.ldb;
+    int64_t ldc = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+
+    int64_t A_row = transA == rocblas_operation_none ? M : K;
+    int64_t A_col = transA == rocblas_operation_none ? K : M;
+    int64_t B_row = transB == rocblas_operation_none ? K : N;
+    int64_t B_col = transB == rocblas_operation_none ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    // Note: K==0 is not an early exit, since C still needs to be multiplied by beta
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_64_fn(handle,
+                                                 transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 nullptr,
+                                                 nullptr,
+                                                 lda,
+                                                 nullptr,
+                                                 ldb,
+                                                 nullptr,
+                                                 nullptr,
+                                                 ldc),
+                              rocblas_status_invalid_size);
+
+        return;
+    }
+
+    const size_t size_A = size_t(lda) * A_col;
+    const size_t size_B = size_t(ldb) * B_col;
+    const size_t size_C = size_t(ldc) * N;
+
+    // allocate memory on device
+    device_vector<T> dA(size_A);
+    device_vector<T> dB(size_B);
+    device_vector<T> dC(size_C);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> hC(size_C);
+    host_vector<T> hC_gold(size_C);
+
+    // Initialize data on host memory
+    rocblas_init_matrix(hA,
+                        arg,
+                        A_row,
+                        A_col,
+                        lda,
+                        0,
+                        1,
+                        rocblas_client_alpha_sets_nan,
+                        rocblas_client_general_matrix,
+                        true);
+    rocblas_init_matrix(hB,
+                        arg,
+                        B_row,
+                        B_col,
+                        ldb,
+                        0,
+                        1,
+                        rocblas_client_alpha_sets_nan,
+                        rocblas_client_general_matrix,
+                        false,
+                        true);
+    rocblas_init_matrix(
+        hC, arg, M, N, ldc, 0, 1, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+    hC_gold = hC;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // C is updated twice, in host and then in device pointer mode, and compared once
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_64_fn(
+        handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_64_fn(
+        handle, transA, transB, M, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+
+    CHECK_HIP_ERROR(hC.transfer_from(dC));
+
+    // CPU BLAS, whose rocblas_int sizes hold the sizes of the tests
+    cblas_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+    cblas_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+
+    if(arg.unit_check)
+    {
+        if(std::is_same<T, rocblas_half>{} && K > 10000)
+        {
+            // For large K, rocblas_half tends to diverge proportional to K
+            // Tolerance is slightly greater than 1 / 1024.0
+            const double tol = K * sum_error_tolerance<T>;
+            near_check_general<T>(M, N, ldc, hC_gold, hC, tol);
+        }
+        else
+        {
+            unit_check_general<T>(M, N, ldc, hC_gold, hC);
+        }
+    }
+
+    if(arg.norm_check)
+    {
+        double rocblas_error = std::abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC));
+        rocblas_cout << "rocblas_error=" << rocblas_error << std::endl;
+    }
+}
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
 #include "near.hpp"
@@ -522,8 +523,7 @@ void testing_gemm_strided_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(rocblas_int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             cblas_gemm<T>(transA,
                           transB,
                           M,
@@ -537,7 +537,7 @@ void testing_gemm_strided_batched(const Arguments& arg)
                           h_beta,
                           hC_gold + stride_c * i,
                           ldc);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         // fetch GPU
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -438,8 +439,7 @@ void testing_her2k_strided_batched(const Arguments& arg)
         }
 
         // cpu reference
-        for(int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             // herkx: B equals A to ensure a symmetric result
             herXX_ref_fn(uplo,
                          transA,
@@ -453,7 +453,7 @@ void testing_her2k_strided_batched(const Arguments& arg)
                          &h_beta[0],
                          hC_gold + i * strideC,
                          ldc);
-        }
+        });
 
         if(arg.timing)
         {
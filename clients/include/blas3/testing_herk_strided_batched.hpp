@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -343,8 +344,7 @@ void testing_herk_strided_batched(const Arguments& arg)
         }
 
         // cpu reference
-        for(int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             cblas_herk<T>(uplo,
                           transA,
                           N,
@@ -355,7 +355,7 @@ void testing_herk_strided_batched(const Arguments& arg)
                           h_beta[0],
                           hC_gold + i * strideC,
                           ldc);
-        }
+        });
 
         if(arg.timing)
         {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -278,8 +279,7 @@ void testing_symm_hemm_batched(const Arguments& arg)
         }
 
         // cpu reference
-        for(int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             if(HERM)
             {
                 cblas_hemm<T>(
@@ -300,7 +300,7 @@ void testing_symm_hemm_batched(const Arguments& arg)
                               hC_gold[i],
                               ldc);
             }
-        }
+        });
 
         if(arg.timing)
         {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -389,8 +390,7 @@ void testing_symm_hemm_strided_batched(const Arguments& arg)
         }
 
         // cpu reference
-        for(int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             if(HERM)
             {
                 cblas_hemm<T>(
@@ -411,7 +411,7 @@ void testing_symm_hemm_strided_batched(const Arguments& arg)
                               hC_gold[i],
                               ldc);
             }
-        }
+        });
 
         if(arg.timing)
         {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -290,8 +291,7 @@ void testing_syr2k_batched(const Arguments& arg)
         }
 
         // cpu reference
-        for(int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             if(TWOK)
             {
                 cblas_syr2k<T>(uplo,
@@ -312,7 +312,7 @@ void testing_syr2k_batched(const Arguments& arg)
                 cblas_syrk<T>(
                     uplo, transA, N, K, h_alpha[0], hA[i], lda, h_beta[0], hC_gold[i], ldc);
             }
-        }
+        });
 
         if(arg.timing)
         {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -433,8 +434,7 @@ void testing_syr2k_strided_batched(const Arguments& arg)
         }
 
         // cpu reference
-        for(int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             if(TWOK)
             {
                 cblas_syr2k<T>(uplo,
@@ -463,7 +463,7 @@ void testing_syr2k_strided_batched(const Arguments& arg)
                               hC_gold + i * strideC,
                               ldc); // B must == A to use syrk as reference
             }
-        }
+        });
 
         if(arg.timing)
         {
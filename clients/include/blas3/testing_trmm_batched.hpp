@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
 #include "near.hpp"
@@ -246,10 +247,9 @@ void testing_trmm_batched(const Arguments& arg)
             cpu_time_used = get_time_us_no_sync();
         }
 
-        for(rocblas_int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             cblas_trmm<T>(side, uplo, transA, diag, M, N, alpha, hA[i], lda, hB_gold[i], ldb);
-        }
+        });
 
         if(arg.timing)
         {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
 #include "near.hpp"
@@ -371,8 +372,7 @@ void testing_trmm_strided_batched(const Arguments& arg)
             cpu_time_used = get_time_us_no_sync();
         }
 
-        for(int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             cblas_trmm<T>(side,
                           uplo,
                           transA,
@@ -384,7 +384,7 @@ void testing_trmm_strided_batched(const Arguments& arg)
                           lda,
                           cpuB + i * stride_b,
                           ldb);
-        }
+        });
 
         if(arg.timing)
         {
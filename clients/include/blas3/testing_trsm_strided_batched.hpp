@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
 #include "norm.hpp"
@@ -590,7 +591,7 @@ void testing_trsm_strided_batched(const Arguments& arg)
         // CPU cblas
         cpu_time_used = get_time_us_no_sync();
 
-        for(int b = 0; b < batch_count; b++)
+        batched_reference(batch_count, [&](rocblas_int b) {
             cblas_trsm<T>(side,
                           uplo,
                           transA,
@@ -602,6 +603,7 @@ void testing_trsm_strided_batched(const Arguments& arg)
                           lda,
                           cpuXorB + stride_b * b,
                           ldb);
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -170,7 +170,7 @@ void testing_trtri(const Arguments& arg)
 
         if(arg.norm_check)
         {
-            rocblas_error = norm_check_symmetric<T>('F', char_uplo, N, lda, hB, hA);
+            rocblas_error = norm_check_triangular<T>('F', char_uplo, char_diag, N, N, lda, hB, hA);
         }
     }
 
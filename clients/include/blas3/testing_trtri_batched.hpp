@@ -191,14 +191,16 @@ void testing_trtri_batched(const Arguments& arg)
         {
             for(size_t i = 0; i < batch_count; i++)
             {
-                rocblas_error = fmax(rocblas_error,
-                                     norm_check_symmetric<T>('F', char_uplo, N, lda, hB[i], hA[i]));
+                rocblas_error = fmax(
+                    rocblas_error,
+                    norm_check_triangular<T>('F', char_uplo, char_diag, N, N, lda, hB[i], hA[i]));
             }
             rocblas_error = 0.0;
             for(size_t i = 0; i < batch_count; i++)
             {
                 rocblas_error = fmax(
-                    rocblas_error, norm_check_symmetric<T>('F', char_uplo, N, lda, hB[i], hA_2[i]));
+                    rocblas_error,
+                    norm_check_triangular<T>('F', char_uplo, char_diag, N, N, lda, hB[i], hA_2[i]));
             }
         }
     } // end of norm_check
@@ -202,16 +202,28 @@ void testing_trtri_strided_batched(const Arguments& arg)
             {
                 rocblas_error
                     = fmax(rocblas_error,
-                           norm_check_symmetric<T>(
-                               'F', char_uplo, N, lda, hB + i * stride_a, hA + i * stride_a));
+                           norm_check_triangular<T>('F',
+                                                    char_uplo,
+                                                    char_diag,
+                                                    N,
+                                                    N,
+                                                    lda,
+                                                    hB + i * stride_a,
+                                                    hA + i * stride_a));
             }
             rocblas_error = 0.0;
             for(size_t i = 0; i < batch_count; i++)
             {
                 rocblas_error
                     = fmax(rocblas_error,
-                           norm_check_symmetric<T>(
-                               'F', char_uplo, N, lda, hB + i * stride_a, hA_2 + i * stride_a));
+                           norm_check_triangular<T>('F',
+                                                    char_uplo,
+                                                    char_diag,
+                                                    N,
+                                                    N,
+                                                    lda,
+                                                    hB + i * stride_a,
+                                                    hA_2 + i * stride_a));
             }
         }
     } // end of norm_check
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
@@ -294,11 +295,10 @@ void testing_axpy_strided_batched_ex(const Arguments& arg)
                 //
                 // Compute the host solution.
                 //
-                for(rocblas_int batch_index = 0; batch_index < batch_count; ++batch_index)
-                {
+                batched_reference(batch_count, [&](rocblas_int batch_index) {
                     cblas_axpy<Tex>(
                         N, h_alpha_ex, hx_ex[batch_index], incx, hy_ex[batch_index], incy);
-                }
+                });
                 cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
                 for(rocblas_int b = 0; b < batch_count; b++)
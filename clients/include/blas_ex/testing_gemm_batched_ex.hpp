@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
 #include "near.hpp"
@@ -809,8 +810,7 @@ void testing_gemm_batched_ex(const Arguments& arg)
                     }
         cpu_time_used = get_time_us_no_sync();
 
-        for(rocblas_int b = 0; b < batch_count; b++)
-        {
+        batched_reference(batch_count, [&](rocblas_int b) {
             cblas_gemm<Ti, To_hpa>(transA,
                                    transB,
                                    M,
@@ -824,7 +824,7 @@ void testing_gemm_batched_ex(const Arguments& arg)
                                    h_beta_Tc,
                                    hD_gold[b],
                                    ldd);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
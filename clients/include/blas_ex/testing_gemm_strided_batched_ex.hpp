@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
 #include "near.hpp"
@@ -969,8 +970,7 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
                     }
         cpu_time_used = get_time_us_no_sync();
 
-        for(rocblas_int i = 0; i < batch_count; i++)
-        {
+        batched_reference(batch_count, [&](rocblas_int i) {
             cblas_gemm<Ti, To_hpa>(transA,
                                    transB,
                                    M,
@@ -985,7 +985,7 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
                                    hD_gold + stride_d * i,
                                    ldd,
                                    alt);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "near.hpp"
@@ -207,8 +208,9 @@ void testing_nrm2_strided_batched_ex(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(int i = 0; i < batch_count; i++)
+        batched_reference(batch_count, [&](rocblas_int i) {
             cblas_nrm2<Tx>(N, hx + i * stridex, incx, cpu_result + i);
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         Tr abs_result = cpu_result[0] > 0 ? cpu_result[0] : -cpu_result[0];
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
 #include "near.hpp"
@@ -459,8 +460,7 @@ void testing_trmm_outofplace_strided_batched(const Arguments& arg)
             cpu_time_used = get_time_us_no_sync();
         }
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        batched_reference(batch_count, [&](rocblas_int b) {
             cblas_trmm<T>(side,
                           uplo,
                           transA,
@@ -472,7 +472,7 @@ void testing_trmm_outofplace_strided_batched(const Arguments& arg)
                           lda,
                           cpuB + b * stride_b,
                           ldb);
-        }
+        });
 
         if(arg.timing)
         {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "batched_reference.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
 #include "norm.hpp"
@@ -717,7 +718,7 @@ void testing_trsm_strided_batched_ex(const Arguments& arg)
         // CPU cblas
         cpu_time_used = get_time_us_no_sync();
 
-        for(int b = 0; b < batch_count; b++)
+        batched_reference(batch_count, [&](rocblas_int b) {
             cblas_trsm<T>(side,
                           uplo,
                           transA,
@@ -729,6 +730,7 @@ void testing_trsm_strided_batched_ex(const Arguments& arg)
                           lda,
                           cpuXorB + b * stride_B,
                           ldb);
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -0,0 +1,51 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <cstddef>
+
+/* ============================================================================================ */
+/*! \brief  Conversions between rocblas_half or rocblas_bfloat16 and float, used by the CPU
+ *          reference functions which compute in float.
+ *
+ *          cblas_convert(m, n, A, lda, B, ldb) converts the m x n column-major matrix A with
+ *          leading dimension lda into B with leading dimension ldb. Elements in the padding
+ *          between the columns of B are not written.
+ *
+ *          The results are rounded exactly as the conversion operators of rocblas_half and
+ *          rocblas_bfloat16 round them. F16C, AVX2 or AVX-512 instructions are used when the
+ *          CPU supports them, and large matrices are converted by several OpenMP threads.
+ *
+ *          When alt is true, half values are truncated to bfloat16 precision after being
+ *          widened, as the alternate implementation of HPA gemm does. */
+void cblas_convert(rocblas_int         m,
+                   rocblas_int         n,
+                   const rocblas_half* A,
+                   size_t              lda,
+                   float*              B,
+                   size_t              ldb,
+                   bool                alt = false);
+
+void cblas_convert(rocblas_int             m,
+                   rocblas_int             n,
+                   const rocblas_bfloat16* A,
+                   size_t                  lda,
+                   float*                  B,
+                   size_t                  ldb);
+
+void cblas_convert(
+    rocblas_int m, rocblas_int n, const float* A, size_t lda, rocblas_half* B, size_t ldb);
+
+void cblas_convert(
+    rocblas_int m, rocblas_int n, const float* A, size_t lda, rocblas_bfloat16* B, size_t ldb);
+
+/*! \brief  Convert the n elements of the vector x with increment incx into the vector y with
+ *          increment incy. The increments must not be negative. */
+template <typename Ti, typename To>
+inline void cblas_convert(rocblas_int n, const Ti* x, size_t incx, To* y, size_t incy)
+{
+    cblas_convert(1, n, x, incx, y, incy);
+}
@@ -0,0 +1,413 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+/*!\file
+ * \brief compares two results (usually, CPU and GPU results) element by element, and summarizes
+ *        the mismatches; used by unit_check_general() and near_check_general().
+ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+/*! \brief  Real and imaginary parts of an element of any rocBLAS type, in double */
+template <typename T>
+inline double check_real(const T& x)
+{
+    return static_cast<double>(x);
+}
+
+template <typename T>
+inline double check_real(const rocblas_complex_num<T>& x)
+{
+    return x.real();
+}
+
+template <typename T>
+inline double check_imag(const T&)
+{
+    return 0;
+}
+
+template <typename T>
+inline double check_imag(const rocblas_complex_num<T>& x)
+{
+    return x.imag();
+}
+
+/*! \brief  Type of the real and imaginary parts of an element */
+template <typename T>
+struct check_part_type
+{
+    using type = T;
+};
+
+template <typename T>
+struct check_part_type<rocblas_complex_num<T>>
+{
+    using type = T;
+};
+
+/*! \brief  Number of significant digits which print every value of F distinctly */
+template <typename F>
+constexpr int check_digits()
+{
+    // rocblas_half and rocblas_bfloat16 have no std::numeric_limits, and need 5 digits
+    return std::numeric_limits<F>::is_integer       ? std::numeric_limits<F>::digits10 + 1
+           : std::numeric_limits<F>::is_specialized ? std::numeric_limits<F>::max_digits10
+                                                    : 5;
+}
+
+/*! \brief  Distance in ulps between two values of the floating point type F, which are not NaN.
+ *          For integers, it is the absolute difference. */
+template <typename F, std::enable_if_t<!std::is_integral<F>{}, int> = 0>
+inline uint64_t check_ulp_distance(F a, F b)
+{
+    using U = std::conditional_t<sizeof(F) == 2,
+                                 uint16_t,
+                                 std::conditional_t<sizeof(F) == 4, uint32_t, uint64_t>>;
+    constexpr U sign = U(1) << (sizeof(F) * 8 - 1);
+
+    U ua, ub;
+    std::memcpy(&ua, &a, sizeof(F));
+    std::memcpy(&ub, &b, sizeof(F));
+
+    // Map sign and magnitude to an unsigned order, so that the distance counts ulps
+    ua = ua & sign ? U(~ua + 1) : U(ua | sign);
+    ub = ub & sign ? U(~ub + 1) : U(ub | sign);
+    return ua >= ub ? ua - ub : ub - ua;
+}
+
+template <typename F, std::enable_if_t<std::is_integral<F>{}, int> = 0>
+inline uint64_t check_ulp_distance(F a, F b)
+{
+    return a >= b ? uint64_t(a) - uint64_t(b) : uint64_t(b) - uint64_t(a);
+}
+
+/*! \brief  Larger distance between the real and imaginary parts of a reference element and a
+ *          result element, in ulps of the result type */
+template <typename Tc, typename Tg>
+inline uint64_t check_ulp_distance_of(const Tc& c, const Tg& g)
+{
+    using F = typename check_part_type<Tg>::type;
+    return std::max(check_ulp_distance(F(check_real(c)), F(check_real(g))),
+                    check_ulp_distance(F(check_imag(c)), F(check_imag(g))));
+}
+
+/*! \brief  Whether two floating point values are within 4 ulps of each other, as for
+ *          ASSERT_FLOAT_EQ and ASSERT_DOUBLE_EQ. NaN is not equal to anything. */
+template <typename F>
+inline bool check_almost_equal(F a, F b)
+{
+    return a == a && b == b && check_ulp_distance(a, b) <= 4;
+}
+
+/*! \brief  Element comparisons of unit_check_general() and near_check_general() */
+struct check_exact
+{
+    template <typename Tc, typename Tg>
+    bool operator()(const Tc& c, const Tg& g) const
+    {
+        return c == g;
+    }
+};
+
+template <typename F>
+struct check_ulps
+{
+    template <typename Tc, typename Tg>
+    bool operator()(const Tc& c, const Tg& g) const
+    {
+        return check_almost_equal(F(check_real(c)), F(check_real(g)))
+               && check_almost_equal(F(check_imag(c)), F(check_imag(g)));
+    }
+};
+
+// A bfloat16 result matches a float reference rounded or truncated to bfloat16
+struct check_bf16_rounding
+{
+    bool operator()(float c, const rocblas_bfloat16& g) const
+    {
+        rocblas_bfloat16 truncated(c, rocblas_bfloat16::truncate);
+        return check_almost_equal(float(g), float(truncated))
+               || check_almost_equal(float(g), float(rocblas_bfloat16(c)));
+    }
+};
+
+// The real and imaginary parts each differ by at most abs_error, as for ASSERT_NEAR
+struct check_near
+{
+    double abs_error;
+
+    template <typename Tc, typename Tg>
+    bool operator()(const Tc& c, const Tg& g) const
+    {
+        double cr = check_real(c), ci = check_imag(c), gr = check_real(g), gi = check_imag(g);
+        return (cr == gr || std::abs(cr - gr) <= abs_error)
+               && (ci == gi || std::abs(ci - gi) <= abs_error);
+    }
+};
+
+/* ============================================================================================ */
+/*! \brief  Summary of the differences between two batches of matrices */
+struct check_report
+{
+    //! Number of mismatches which are listed
+    static constexpr size_t listed = 10;
+
+    struct location
+    {
+        size_t row = 0, col = 0, batch = 0;
+
+        bool operator<(const location& rhs) const
+        {
+            return batch != rhs.batch ? batch < rhs.batch
+                                      : col != rhs.col ? col < rhs.col : row < rhs.row;
+        }
+    };
+
+    struct mismatch
+    {
+        location where;
+        double   expected_re, expected_im, actual_re, actual_im;
+        uint64_t ulps; //!< distance in ulps of the result type, unless either value is NaN
+    };
+
+    //! Significant digits with which the expected and actual values are printed
+    int digits = 6;
+
+    size_t                elements   = 0;
+    size_t                mismatches = 0;
+    std::vector<mismatch> first; //!< the first mismatches, in column-major order
+
+    double   max_abs_error = 0, max_rel_error = 0;
+    location max_abs_where, max_rel_where;
+
+    //! Numbers of NaN and infinite elements of the result, and of the reference
+    size_t nan_actual = 0, inf_actual = 0, nan_expected = 0, inf_expected = 0;
+
+    //! Merge the report of another part of the same matrices
+    void merge(const check_report& rhs)
+    {
+        elements += rhs.elements;
+        mismatches += rhs.mismatches;
+        first.insert(first.end(), rhs.first.begin(), rhs.first.end());
+        std::sort(first.begin(), first.end(), [](const mismatch& a, const mismatch& b) {
+            return a.where < b.where;
+        });
+        if(first.size() > listed)
+            first.resize(listed);
+
+        if(rhs.max_abs_error > max_abs_error
+           || (rhs.max_abs_error == max_abs_error && rhs.max_abs_where < max_abs_where))
+        {
+            max_abs_error = rhs.max_abs_error;
+            max_abs_where = rhs.max_abs_where;
+        }
+        if(rhs.max_rel_error > max_rel_error
+           || (rhs.max_rel_error == max_rel_error && rhs.max_rel_where < max_rel_where))
+        {
+            max_rel_error = rhs.max_rel_error;
+            max_rel_where = rhs.max_rel_where;
+        }
+
+        nan_actual += rhs.nan_actual;
+        inf_actual += rhs.inf_actual;
+        nan_expected += rhs.nan_expected;
+        inf_expected += rhs.inf_expected;
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const check_report::location& where)
+{
+    return os << "(row " << where.row << ", col " << where.col << ", batch " << where.batch << ")";
+}
+
+inline std::ostream& operator<<(std::ostream& os, const check_report& report)
+{
+    auto value = [&](double re, double im) -> std::ostream& {
+        if(im)
+            return os << "(" << re << ", " << im << ")";
+        return os << re;
+    };
+
+    os << report.mismatches << " of " << report.elements << " elements differ";
+    auto precision = os.precision();
+    os << std::setprecision(report.digits);
+    for(auto& m : report.first)
+    {
+        os << "\n  " << m.where << ": expected ";
+        value(m.expected_re, m.expected_im) << ", actual ";
+        value(m.actual_re, m.actual_im);
+        if(!std::isnan(m.expected_re) && !std::isnan(m.expected_im) && !std::isnan(m.actual_re)
+           && !std::isnan(m.actual_im))
+            os << ", " << m.ulps << " ulps apart";
+    }
+    os.precision(precision);
+    if(report.mismatches > report.first.size())
+        os << "\n  ...";
+    os << "\nmax absolute error " << report.max_abs_error << " at " << report.max_abs_where
+       << "\nmax relative error " << report.max_rel_error << " at " << report.max_rel_where
+       << "\nNaN/Inf elements: " << report.nan_actual << "/" << report.inf_actual
+       << " in the result, " << report.nan_expected << "/" << report.inf_expected
+       << " in the reference";
+    return os;
+}
+
+/* ============================================================================================ */
+/*! \brief  Compare the M x N matrices cpu(b) and gpu(b), with leading dimension lda, for each b
+ *          in the batch, and summarize the differences.
+ *
+ *          An element matches when both are NaN, or when the reference is not NaN and
+ *          eq(reference, result) is true. The errors are the absolute values of the differences
+ *          in double, and the relative errors divide them by the absolute values of the
+ *          reference. Differences involving NaN are counted as mismatches, but not as errors.
+ *
+ *          The columns are spread across OpenMP threads for large batches, and each column is
+ *          first compared with a vectorized loop which only counts and reduces. Its elements are
+ *          only visited again to record a mismatch which is listed, or a new maximum error. */
+template <typename CPU, typename GPU, typename EQ>
+check_report check_compare(rocblas_int M,
+                           rocblas_int N,
+                           rocblas_int lda,
+                           rocblas_int batch_count,
+                           CPU&&       cpu,
+                           GPU&&       gpu,
+                           EQ          eq)
+{
+    check_report report;
+    size_t       columns = M > 0 && N > 0 && batch_count > 0 ? size_t(N) * batch_count : 0;
+
+#pragma omp parallel if(columns * M >= 65536)
+    {
+        check_report part;
+
+#pragma omp for schedule(static)
+        for(size_t c = 0; c < columns; ++c)
+        {
+            size_t b = c / N, j = c % N;
+            auto   hc = cpu(b) + j * size_t(lda);
+            auto   hg = gpu(b) + j * size_t(lda);
+
+            size_t bad = 0, nan_g = 0, inf_g = 0, nan_c = 0, inf_c = 0;
+            double max_abs = 0, max_rel = 0;
+
+#pragma omp simd reduction(+ : bad, nan_g, inf_g, nan_c, inf_c) reduction(max : max_abs, max_rel)
+            for(rocblas_int i = 0; i < M; ++i)
+            {
+                double cr = check_real(hc[i]), ci = check_imag(hc[i]);
+                double gr = check_real(hg[i]), gi = check_imag(hg[i]);
+                bool   cnan = cr != cr || ci != ci, gnan = gr != gr || gi != gi;
+                bool   ok   = cnan ? gnan : eq(hc[i], hg[i]);
+                double err  = std::sqrt((gr - cr) * (gr - cr) + (gi - ci) * (gi - ci));
+                double rel  = err / std::sqrt(cr * cr + ci * ci);
+
+                bad += !ok;
+                nan_g += gnan;
+                nan_c += cnan;
+                inf_g += !gnan && (std::isinf(gr) || std::isinf(gi));
+                inf_c += !cnan && (std::isinf(cr) || std::isinf(ci));
+                max_abs = err > max_abs ? err : max_abs;
+                max_rel = rel > max_rel ? rel : max_rel;
+            }
+
+            part.elements += M;
+            part.mismatches += bad;
+            part.nan_actual += nan_g;
+            part.inf_actual += inf_g;
+            part.nan_expected += nan_c;
+            part.inf_expected += inf_c;
+
+            bool list    = bad && part.first.size() < check_report::listed;
+            bool new_abs = max_abs > part.max_abs_error;
+            bool new_rel = max_rel > part.max_rel_error;
+            if(!list && !new_abs && !new_rel)
+                continue;
+
+            for(rocblas_int i = 0; i < M; ++i)
+            {
+                double cr = check_real(hc[i]), ci = check_imag(hc[i]);
+                double gr = check_real(hg[i]), gi = check_imag(hg[i]);
+                bool   cnan = cr != cr || ci != ci, gnan = gr != gr || gi != gi;
+                double err  = std::sqrt((gr - cr) * (gr - cr) + (gi - ci) * (gi - ci));
+                double rel  = err / std::sqrt(cr * cr + ci * ci);
+
+                check_report::location where{size_t(i), j, b};
+                if(list && part.first.size() < check_report::listed
+                   && !(cnan ? gnan : eq(hc[i], hg[i])))
+                {
+                    uint64_t ulps = cnan || gnan ? 0 : check_ulp_distance_of(hc[i], hg[i]);
+                    part.first.push_back({where, cr, ci, gr, gi, ulps});
+                }
+                if(new_abs && err > part.max_abs_error)
+                {
+                    part.max_abs_error = err;
+                    part.max_abs_where = where;
+                }
+                if(new_rel && rel > part.max_rel_error)
+                {
+                    part.max_rel_error = rel;
+                    part.max_rel_where = where;
+                }
+            }
+        }
+
+#pragma omp critical
+        report.merge(part);
+    }
+
+    using Tc = std::decay_t<decltype(cpu(size_t(0))[0])>;
+    using Tg = std::decay_t<decltype(gpu(size_t(0))[0])>;
+
+    report.digits = std::max(check_digits<typename check_part_type<Tc>::type>(),
+                             check_digits<typename check_part_type<Tg>::type>());
+    return report;
+}
+
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+
+/*! \brief  Compare strided batches of matrices, with one gtest failure summarizing mismatches */
+#define CHECK_COMPARE(M, N, lda, strideA, hCPU, hGPU, batch_count, EQ)  \
+    do                                                                  \
+    {                                                                   \
+        auto check_compare_report_ = check_compare(                     \
+            M,                                                          \
+            N,                                                          \
+            lda,                                                        \
+            batch_count,                                                \
+            [&](size_t b) { return (hCPU) + b * (strideA); },           \
+            [&](size_t b) { return (hGPU) + b * (strideA); },           \
+            EQ);                                                        \
+        if(check_compare_report_.mismatches)                            \
+            FAIL() << check_compare_report_;                            \
+    } while(0)
+
+/*! \brief  Compare arrays of matrices, with one gtest failure summarizing any mismatches */
+#define CHECK_COMPARE_B(M, N, lda, hCPU, hGPU, batch_count, EQ) \
+    do                                                          \
+    {                                                           \
+        auto check_compare_report_ = check_compare(             \
+            M,                                                  \
+            N,                                                  \
+            lda,                                                \
+            batch_count,                                        \
+            [&](size_t b) { return &(hCPU)[b][0]; },            \
+            [&](size_t b) { return &(hGPU)[b][0]; },            \
+            EQ);                                                \
+        if(check_compare_report_.mismatches)                    \
+            FAIL() << check_compare_report_;                    \
+    } while(0)
+
+#endif // GOOGLE_TEST
@@ -4,18 +4,25 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
 //!
-//! @brief Host free memory w/o swap.  Returns kB or -1 if unknown.
+//! @brief Host free memory w/o swap.  Returns bytes or -1 if unknown.
+//!        The value read from the OS is reused for a short time.
 //!
 ptrdiff_t host_bytes_available();
 
 //!
-//! @brief Allocates memory which can be freed with free.  Returns nullptr if swap required.
+//! @brief Allocates memory which must be freed with host_free.  Returns nullptr if swap required.
+//!        If other threads' large allocations leave too little free memory, waits until they
+//!        are freed, unless the calling thread holds large allocations itself.
 //!
 void* host_malloc(size_t size);
 
 //!
-//! @brief Allocates memory which can be freed with free.  Throws exception if swap required.
+//! @brief Allocates memory which must be freed with host_free.  Throws exception if swap required.
 //!
 inline void* host_malloc_throw(size_t nmemb, size_t size)
 {
@@ -28,12 +35,14 @@ inline void* host_malloc_throw(size_t nmemb, size_t size)
 }
 
 //!
-//! @brief Allocates cleared memory which can be freed with free.  Returns nullptr if swap required.
+//! @brief Allocates cleared memory which must be freed with host_free.  Returns nullptr if swap
+//!        required.
 //!
 void* host_calloc(size_t nmemb, size_t size);
 
 //!
-//! @brief Allocates cleared memory which can be freed with free.  Throws exception if swap required.
+//! @brief Allocates cleared memory which must be freed with host_free.  Throws exception if swap
+//!        required.
 //!
 inline void* host_calloc_throw(size_t nmemb, size_t size)
 {
@@ -45,6 +54,11 @@ inline void* host_calloc_throw(size_t nmemb, size_t size)
     return ptr;
 }
 
+//!
+//! @brief Frees memory of size bytes allocated with host_malloc or host_calloc.
+//!
+void host_free(void* ptr, size_t size);
+
 //!
 //! @brief  Allocator which allocates with host_calloc
 //!
@@ -67,7 +81,7 @@ struct host_memory_allocator
 
     void deallocate(T* ptr, std::size_t n)
     {
-        free(ptr);
+        host_free(ptr, n * sizeof(T));
     }
 };
 
@@ -232,16 +232,17 @@ private:
     {
         if(nullptr != this->m_data)
         {
+            size_t nmemb = size_t(this->m_n) * std::abs(this->m_inc);
             for(rocblas_int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
             {
                 if(nullptr != this->m_data[batch_index])
                 {
-                    free(this->m_data[batch_index]);
+                    host_free(this->m_data[batch_index], nmemb * sizeof(T));
                     this->m_data[batch_index] = nullptr;
                 }
             }
 
-            free(this->m_data);
+            host_free(this->m_data, this->m_batch_count * sizeof(T*));
             this->m_data = nullptr;
         }
     }
@@ -96,7 +96,7 @@ public:
     {
         if(nullptr != this->m_data)
         {
-            free(this->m_data);
+            host_free(this->m_data, this->m_nmemb * sizeof(T));
             this->m_data = nullptr;
         }
     }
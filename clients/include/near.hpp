@@ -4,7 +4,7 @@
  * ************************************************************************ */
 
 /* =====================================================================
-    Google Near check: ASSERT_NEAR( elementof(A), elementof(B))
+    Google Near check: |elementof(A) - elementof(B)| <= abs_error
    =================================================================== */
 
 /*!\file
@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include "check_compare.hpp"
 #include "rocblas.h"
 #include "rocblas_math.hpp"
 #include "rocblas_test.hpp"
@@ -40,59 +41,15 @@ template <>
 ROCBLAS_CLANG_STATIC constexpr double sum_error_tolerance<rocblas_double_complex> = 1 / 1000000.0;
 
 #ifndef GOOGLE_TEST
-#define NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, err, NEAR_ASSERT)
-#define NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, err, NEAR_ASSERT)
+#define NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, err)
+#define NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, err)
 #else
-
-#define NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, err, NEAR_ASSERT)            \
-    do                                                                                       \
-    {                                                                                        \
-        for(size_t k = 0; k < batch_count; k++)                                              \
-            for(size_t j = 0; j < N; j++)                                                    \
-                for(size_t i = 0; i < M; i++)                                                \
-                    if(rocblas_isnan(hCPU[i + j * size_t(lda) + k * strideA]))               \
-                    {                                                                        \
-                        ASSERT_TRUE(rocblas_isnan(hGPU[i + j * size_t(lda) + k * strideA])); \
-                    }                                                                        \
-                    else                                                                     \
-                    {                                                                        \
-                        NEAR_ASSERT(hCPU[i + j * size_t(lda) + k * strideA],                 \
-                                    hGPU[i + j * size_t(lda) + k * strideA],                 \
-                                    err);                                                    \
-                    }                                                                        \
-    } while(0)
-
-#define NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, err, NEAR_ASSERT)                    \
-    do                                                                                        \
-    {                                                                                         \
-        for(size_t k = 0; k < batch_count; k++)                                               \
-            for(size_t j = 0; j < N; j++)                                                     \
-                for(size_t i = 0; i < M; i++)                                                 \
-                    if(rocblas_isnan(hCPU[k][i + j * size_t(lda)]))                           \
-                    {                                                                         \
-                        ASSERT_TRUE(rocblas_isnan(hGPU[k][i + j * size_t(lda)]));             \
-                    }                                                                         \
-                    else                                                                      \
-                    {                                                                         \
-                        NEAR_ASSERT(                                                          \
-                            hCPU[k][i + j * size_t(lda)], hGPU[k][i + j * size_t(lda)], err); \
-                    }                                                                         \
-    } while(0)
-
+#define NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, err) \
+    CHECK_COMPARE(M, N, lda, strideA, hCPU, hGPU, batch_count, check_near{err})
+#define NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, err) \
+    CHECK_COMPARE_B(M, N, lda, hCPU, hGPU, batch_count, check_near{err})
 #endif
 
-#define NEAR_ASSERT_HALF(a, b, err) ASSERT_NEAR(double(a), double(b), err)
-
-#define NEAR_ASSERT_BF16(a, b, err) ASSERT_NEAR(double(a), double(b), err)
-
-#define NEAR_ASSERT_COMPLEX(a, b, err)                  \
-    do                                                  \
-    {                                                   \
-        auto ta = (a), tb = (b);                        \
-        ASSERT_NEAR(std::real(ta), std::real(tb), err); \
-        ASSERT_NEAR(std::imag(ta), std::imag(tb), err); \
-    } while(0)
-
 // TODO: Replace std::remove_cv_t with std::type_identity_t in C++20
 // It is only used to make T_hpa non-deduced
 template <typename T, typename T_hpa = T>
@@ -103,7 +60,7 @@ inline void near_check_general(rocblas_int                    M,
                                const T*                       hGPU,
                                double                         abs_error)
 {
-    NEAR_CHECK(M, N, lda, 0, hCPU, hGPU, 1, abs_error, ASSERT_NEAR);
+    NEAR_CHECK(M, N, lda, 0, hCPU, hGPU, 1, abs_error);
 }
 
 template <>
@@ -114,7 +71,7 @@ inline void near_check_general(rocblas_int         M,
                                const rocblas_half* hGPU,
                                double              abs_error)
 {
-    NEAR_CHECK(M, N, lda, 0, hCPU, hGPU, 1, abs_error, NEAR_ASSERT_HALF);
+    NEAR_CHECK(M, N, lda, 0, hCPU, hGPU, 1, abs_error);
 }
 
 template <>
@@ -125,7 +82,7 @@ inline void near_check_general<rocblas_bfloat16, float>(rocblas_int
                                                         const rocblas_bfloat16* hGPU,
                                                         double                  abs_error)
 {
-    NEAR_CHECK(M, N, lda, 0, hCPU, hGPU, 1, abs_error, NEAR_ASSERT_BF16);
+    NEAR_CHECK(M, N, lda, 0, hCPU, hGPU, 1, abs_error);
 }
 
 template <>
@@ -137,7 +94,7 @@ inline void near_check_general(rocblas_int                  M,
                                double                       abs_error)
 {
     abs_error *= sqrthalf;
-    NEAR_CHECK(M, N, lda, 0, hCPU, hGPU, 1, abs_error, NEAR_ASSERT_COMPLEX);
+    NEAR_CHECK(M, N, lda, 0, hCPU, hGPU, 1, abs_error);
 }
 
 template <>
@@ -149,7 +106,7 @@ inline void near_check_general(rocblas_int                   M,
                                double                        abs_error)
 {
     abs_error *= sqrthalf;
-    NEAR_CHECK(M, N, lda, 0, hCPU, hGPU, 1, abs_error, NEAR_ASSERT_COMPLEX);
+    NEAR_CHECK(M, N, lda, 0, hCPU, hGPU, 1, abs_error);
 }
 
 template <typename T, typename T_hpa = T>
@@ -162,7 +119,7 @@ inline void near_check_general(rocblas_int                    M,
                                rocblas_int                    batch_count,
                                double                         abs_error)
 {
-    NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, abs_error, ASSERT_NEAR);
+    NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, abs_error);
 }
 
 template <>
@@ -175,7 +132,7 @@ inline void near_check_general(rocblas_int         M,
                                rocblas_int         batch_count,
                                double              abs_error)
 {
-    NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, abs_error, NEAR_ASSERT_HALF);
+    NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, abs_error);
 }
 
 template <>
@@ -188,7 +145,7 @@ inline void near_check_general<rocblas_bfloat16, float>(rocblas_int
                                                         rocblas_int             batch_count,
                                                         double                  abs_error)
 {
-    NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, abs_error, NEAR_ASSERT_BF16);
+    NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, abs_error);
 }
 
 template <>
@@ -202,7 +159,7 @@ inline void near_check_general(rocblas_int                  M,
                                double                       abs_error)
 {
     abs_error *= sqrthalf;
-    NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, abs_error, NEAR_ASSERT_COMPLEX);
+    NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, abs_error);
 }
 
 template <>
@@ -216,7 +173,7 @@ inline void near_check_general(rocblas_int                   M,
                                double                        abs_error)
 {
     abs_error *= sqrthalf;
-    NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, abs_error, NEAR_ASSERT_COMPLEX);
+    NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, abs_error);
 }
 
 template <typename T, typename T_hpa = T>
@@ -228,7 +185,7 @@ void near_check_general(rocblas_int                                M,
                         rocblas_int                                batch_count,
                         double                                     abs_error)
 {
-    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error, ASSERT_NEAR);
+    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error);
 }
 
 template <>
@@ -240,7 +197,7 @@ inline void near_check_general(rocblas_int                     M,
                                rocblas_int                     batch_count,
                                double                          abs_error)
 {
-    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error, NEAR_ASSERT_HALF);
+    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error);
 }
 template <>
 inline void near_check_general<rocblas_bfloat16, float>(rocblas_int                         M,
@@ -251,7 +208,7 @@ inline void near_check_general<rocblas_bfloat16, float>(rocblas_int
                                                         rocblas_int batch_count,
                                                         double      abs_error)
 {
-    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error, NEAR_ASSERT_BF16);
+    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error);
 }
 
 template <>
@@ -264,7 +221,7 @@ inline void near_check_general(rocblas_int                              M,
                                double                                   abs_error)
 {
     abs_error *= sqrthalf;
-    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error, NEAR_ASSERT_COMPLEX);
+    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error);
 }
 
 template <>
@@ -277,7 +234,7 @@ inline void near_check_general(rocblas_int                               M,
                                double                                    abs_error)
 {
     abs_error *= sqrthalf;
-    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error, NEAR_ASSERT_COMPLEX);
+    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error);
 }
 
 template <typename T, typename T_hpa = T>
@@ -289,7 +246,7 @@ inline void near_check_general(rocblas_int                          M,
                                rocblas_int                          batch_count,
                                double                               abs_error)
 {
-    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error, ASSERT_NEAR);
+    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error);
 }
 
 template <>
@@ -301,7 +258,7 @@ inline void near_check_general(rocblas_int               M,
                                rocblas_int               batch_count,
                                double                    abs_error)
 {
-    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error, NEAR_ASSERT_HALF);
+    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error);
 }
 
 template <>
@@ -313,7 +270,7 @@ inline void near_check_general<rocblas_bfloat16, float>(rocblas_int
                                                         rocblas_int                   batch_count,
                                                         double                        abs_error)
 {
-    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error, NEAR_ASSERT_BF16);
+    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error);
 }
 
 template <>
@@ -325,7 +282,7 @@ inline void near_check_general(rocblas_int                        M,
                                rocblas_int                        batch_count,
                                double                             abs_error)
 {
-    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error, NEAR_ASSERT_COMPLEX);
+    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error);
 }
 
 template <>
@@ -337,5 +294,5 @@ inline void near_check_general(rocblas_int                         M,
                                rocblas_int                         batch_count,
                                double                              abs_error)
 {
-    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error, NEAR_ASSERT_COMPLEX);
+    NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, abs_error);
 }
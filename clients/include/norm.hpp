@@ -6,13 +6,18 @@
 #pragma once
 
 #include "cblas.h"
+#include "check_compare.hpp"
 #include "norm.hpp"
 #include "rocblas.h"
 #include "rocblas_vector.hpp"
 #include "utility.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
 #include <cstdio>
 #include <limits>
 #include <memory>
+#include <vector>
 
 /* =====================================================================
         Norm check: norm(A-B)/norm(A), evaluate relative error
@@ -25,202 +30,217 @@
 /* ========================================Norm Check
  * ==================================================== */
 
-/* LAPACK fortran library functionality */
-extern "C" {
-float  slange_(char* norm_type, int* m, int* n, float* A, int* lda, float* work);
-double dlange_(char* norm_type, int* m, int* n, double* A, int* lda, double* work);
-float  clange_(char* norm_type, int* m, int* n, rocblas_float_complex* A, int* lda, float* work);
-double zlange_(char* norm_type, int* m, int* n, rocblas_double_complex* A, int* lda, double* work);
-
-float  slansy_(char* norm_type, char* uplo, int* n, float* A, int* lda, float* work);
-double dlansy_(char* norm_type, char* uplo, int* n, double* A, int* lda, double* work);
-float clanhe_(char* norm_type, char* uplo, int* n, rocblas_float_complex* A, int* lda, float* work);
-double
-    zlanhe_(char* norm_type, char* uplo, int* n, rocblas_double_complex* A, int* lda, double* work);
-
-void saxpy_(int* n, float* alpha, float* x, int* incx, float* y, int* incy);
-void daxpy_(int* n, double* alpha, double* x, int* incx, double* y, int* incy);
-void caxpy_(int*                   n,
-            rocblas_float_complex* alpha,
-            rocblas_float_complex* x,
-            int*                   incx,
-            rocblas_float_complex* y,
-            int*                   incy);
-void zaxpy_(int*                    n,
-            rocblas_double_complex* alpha,
-            rocblas_double_complex* x,
-            int*                    incx,
-            rocblas_double_complex* y,
-            int*                    incy);
-}
-
-/*! \brief  Overloading: norm check for general Matrix: half/float/doubel/complex */
-inline float xlange(char* norm_type, int* m, int* n, float* A, int* lda, float* work)
-{
-    return slange_(norm_type, m, n, A, lda, work);
-}
-
-inline double xlange(char* norm_type, int* m, int* n, double* A, int* lda, double* work)
-{
-    return dlange_(norm_type, m, n, A, lda, work);
-}
-
-inline float
-    xlange(char* norm_type, int* m, int* n, rocblas_float_complex* A, int* lda, float* work)
-{
-    return clange_(norm_type, m, n, A, lda, work);
-}
+/* ============== Streaming Norm of Difference ============= */
 
-inline double
-    xlange(char* norm_type, int* m, int* n, rocblas_double_complex* A, int* lda, double* work)
+/*! \brief  Parts of the matrices which norm_check_difference() reads */
+enum class norm_check_shape
 {
-    return zlange_(norm_type, m, n, A, lda, work);
-}
+    general, //!< all M x N elements
+    symmetric, //!< the uplo triangle of an N x N symmetric or Hermitian matrix
+    triangular, //!< the uplo trapezoid of an M x N triangular matrix
+};
 
-inline float xlanhe(char* norm_type, char* uplo, int* n, float* A, int* lda, float* work)
+/*! \brief  Neumaier compensated sum, which keeps the rounding errors of the additions */
+struct norm_check_sum
 {
-    return slansy_(norm_type, uplo, n, A, lda, work);
-}
+    double sum = 0, comp = 0;
 
-inline double xlanhe(char* norm_type, char* uplo, int* n, double* A, int* lda, double* work)
-{
-    return dlansy_(norm_type, uplo, n, A, lda, work);
-}
-
-inline float
-    xlanhe(char* norm_type, char* uplo, int* n, rocblas_float_complex* A, int* lda, float* work)
-{
-    return clanhe_(norm_type, uplo, n, A, lda, work);
-}
+    void operator+=(double x)
+    {
+        double t = sum + x;
+        comp += std::abs(sum) >= std::abs(x) ? (sum - t) + x : (x - t) + sum;
+        sum = t;
+    }
 
-inline double
-    xlanhe(char* norm_type, char* uplo, int* n, rocblas_double_complex* A, int* lda, double* work)
-{
-    return zlanhe_(norm_type, uplo, n, A, lda, work);
-}
+    double value() const
+    {
+        return sum + comp;
+    }
+};
 
-inline void xaxpy(int* n, float* alpha, float* x, int* incx, float* y, int* incy)
+/*! \brief  Compute norm(B - A) / norm(A) in one traversal of A and B, without copies.
+ *
+ *          norm_type is 'O' or '1' for the one norm (maximum column sum), 'I' for the infinity
+ *          norm (maximum row sum), 'F' or 'E' for the Frobenius norm, or 'M' for the largest
+ *          absolute value, as for LAPACK xLANGE, xLANHE and xLANTR. The elements are converted to
+ *          double, and the differences are computed in double.
+ *
+ *          The columns are spread across OpenMP threads for large matrices, and the loops over
+ *          the rows of a column are vectorized. The sums of the columns are added with
+ *          compensation, so that the result agrees with LAPACK to within a few ulps.
+ *
+ *          For symmetric matrices, only the diagonal and the uplo triangle are read, and only
+ *          the real part of the diagonal of complex (Hermitian) matrices is used. For
+ *          triangular matrices, only the uplo trapezoid is read, and the diagonal is taken to be
+ *          ones when diag is 'U'. */
+template <typename TA, typename TB>
+double norm_check_difference(char             norm_type,
+                             norm_check_shape shape,
+                             char             uplo,
+                             char             diag,
+                             rocblas_int      M,
+                             rocblas_int      N,
+                             size_t           lda,
+                             const TA&        A,
+                             const TB&        B)
 {
-    return saxpy_(n, alpha, x, incx, y, incy);
-}
+    using T = std::decay_t<decltype(A[0])>;
 
-inline void xaxpy(int* n, double* alpha, double* x, int* incx, double* y, int* incy)
-{
-    return daxpy_(n, alpha, x, incx, y, incy);
-}
+    norm_type          = std::toupper(norm_type);
+    const bool one     = norm_type == 'O' || norm_type == '1';
+    const bool inf     = norm_type == 'I';
+    const bool frob    = norm_type == 'F' || norm_type == 'E';
+    const bool upper   = uplo == 'U' || uplo == 'u';
+    const bool unit    = shape == norm_check_shape::triangular && (diag == 'U' || diag == 'u');
+    const bool sym     = shape == norm_check_shape::symmetric;
+    const bool by_line = (one || inf) && (inf || sym); // sums over rows are kept in lines
 
-inline void xaxpy(int*                   n,
-                  rocblas_float_complex* alpha,
-                  rocblas_float_complex* x,
-                  int*                   incx,
-                  rocblas_float_complex* y,
-                  int*                   incy)
-{
-    return caxpy_(n, alpha, x, incx, y, incy);
-}
+    // Whether the diagonal is computed apart from the other elements of its column
+    const bool apart = sym || unit;
 
-inline void xaxpy(int*                    n,
-                  rocblas_double_complex* alpha,
-                  rocblas_double_complex* x,
-                  int*                    incx,
-                  rocblas_double_complex* y,
-                  int*                    incy)
-{
-    return zaxpy_(n, alpha, x, incx, y, incy);
-}
+    std::vector<double> lines_a(by_line ? M : 0), lines_d(by_line ? M : 0);
+    norm_check_sum      frob_a, frob_d;
+    double              max_a = 0, max_d = 0;
 
-template <typename T>
-void m_axpy(size_t* N, T* alpha, T* x, int* incx, T* y, int* incy)
-{
-    for(size_t i = 0; i < *N; i++)
+#pragma omp parallel if(size_t(M) * N >= 65536)
     {
-        y[i * (*incy)] = (*alpha) * x[i * (*incx)] + y[i * (*incy)];
-    }
-}
-
-/* ============== Norm Check for General Matrix ============= */
-/*! \brief compare the norm error of two matrices hCPU & hGPU */
+        std::vector<double> thread_lines_a(lines_a.size()), thread_lines_d(lines_d.size());
+        double*             line_a = by_line ? thread_lines_a.data() : nullptr;
+        double*             line_d = by_line ? thread_lines_d.data() : nullptr;
+        norm_check_sum      thread_frob_a, thread_frob_d;
+        double              thread_max_a = 0, thread_max_d = 0;
+
+#pragma omp for schedule(static)
+        for(rocblas_int j = 0; j < N; ++j)
+        {
+            // Rows [lo, hi) of column j, without the diagonal if it is computed apart
+            rocblas_int lo = 0, hi = M;
+            if(shape != norm_check_shape::general)
+            {
+                if(upper)
+                    hi = std::min(M, apart ? j : j + 1);
+                else
+                    lo = std::min(M, apart ? j + 1 : j);
+            }
+
+            double col_a = 0, col_d = 0, sq_a = 0, sq_d = 0, big_a = 0, big_d = 0;
+            size_t col = j * lda;
+
+#pragma omp simd reduction(+ : col_a, col_d, sq_a, sq_d) reduction(max : big_a, big_d)
+            for(rocblas_int i = lo; i < hi; ++i)
+            {
+                double ar = check_real(A[col + i]), ai = check_imag(A[col + i]);
+                double dr = check_real(B[col + i]) - ar;
+                double di = check_imag(B[col + i]) - ai;
+                double a2 = ar * ar + ai * ai, d2 = dr * dr + di * di;
+                double aa = is_complex<T> ? std::sqrt(a2) : std::abs(ar);
+                double ad = is_complex<T> ? std::sqrt(d2) : std::abs(dr);
+
+                col_a += aa;
+                col_d += ad;
+                sq_a += a2;
+                sq_d += d2;
+                big_a = std::max(big_a, aa);
+                big_d = std::max(big_d, ad);
+                if(line_a)
+                {
+                    line_a[i] += aa;
+                    line_d[i] += ad;
+                }
+            }
+
+            // The off-diagonal elements of a symmetric matrix count twice
+            if(sym)
+            {
+                sq_a *= 2;
+                sq_d *= 2;
+            }
+
+            if(apart && j < M)
+            {
+                double aa = 1, ad = 0;
+                if(sym)
+                {
+                    double ar = check_real(A[col + j]);
+                    aa        = std::abs(ar);
+                    ad        = std::abs(check_real(B[col + j]) - ar);
+                }
+                col_a += aa;
+                col_d += ad;
+                sq_a += aa * aa;
+                sq_d += ad * ad;
+                big_a = std::max(big_a, aa);
+                big_d = std::max(big_d, ad);
+                if(line_a && !sym)
+                {
+                    line_a[j] += aa;
+                    line_d[j] += ad;
+                }
+            }
+
+            // The stored part of column j of a symmetric matrix is also part of row j
+            if(sym && line_a)
+            {
+                line_a[j] += col_a;
+                line_d[j] += col_d;
+            }
+
+            thread_frob_a += sq_a;
+            thread_frob_d += sq_d;
+            if(one && !sym)
+            {
+                big_a = col_a;
+                big_d = col_d;
+            }
+            if(!frob)
+            {
+                thread_max_a = std::max(thread_max_a, big_a);
+                thread_max_d = std::max(thread_max_d, big_d);
+            }
+        }
 
-// Real
-template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
-double norm_check_general(
-    char norm_type, rocblas_int M, rocblas_int N, rocblas_int lda, T* hCPU, T* hGPU)
-{
-    // norm type can be 'O', 'I', 'F', 'o', 'i', 'f' for one, infinity or Frobenius norm
-    // one norm is max column sum
-    // infinity norm is max row sum
-    // Frobenius is l2 norm of matrix entries
-    size_t size = N * (size_t)lda;
+#pragma omp critical
+        {
+            frob_a += thread_frob_a.value();
+            frob_d += thread_frob_d.value();
+            max_a = std::max(max_a, thread_max_a);
+            max_d = std::max(max_d, thread_max_d);
+            for(size_t i = 0; i < lines_a.size(); ++i)
+            {
+                lines_a[i] += thread_lines_a[i];
+                lines_d[i] += thread_lines_d[i];
+            }
+        }
+    }
 
-    host_vector<double> hCPU_double(size);
-    host_vector<double> hGPU_double(size);
+    if(frob)
+        return std::sqrt(frob_d.value()) / std::sqrt(frob_a.value());
 
-    for(rocblas_int i = 0; i < N; i++)
+    if(by_line)
     {
-        for(rocblas_int j = 0; j < M; j++)
+        max_a = max_d = 0;
+        for(size_t i = 0; i < lines_a.size(); ++i)
         {
-            size_t idx       = j + i * (size_t)lda;
-            hCPU_double[idx] = double(hCPU[idx]);
-            hGPU_double[idx] = double(hGPU[idx]);
+            max_a = std::max(max_a, lines_a[i]);
+            max_d = std::max(max_d, lines_d[i]);
         }
     }
-
-    double      work[1];
-    rocblas_int incx  = 1;
-    double      alpha = -1.0;
-
-    double cpu_norm = xlange(&norm_type, &M, &N, hCPU_double.data(), &lda, work);
-    m_axpy(&size, &alpha, hCPU_double.data(), &incx, hGPU_double.data(), &incx);
-    double error = xlange(&norm_type, &M, &N, hGPU_double.data(), &lda, work) / cpu_norm;
-
-    return error;
+    return max_d / max_a;
 }
 
-// Complex
-template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+/* ============== Norm Check for General Matrix ============= */
+/*! \brief compare the norm error of two matrices hCPU & hGPU, where hCPU may hold a different
+ *         (higher precision) type than hGPU */
+template <typename T, typename VEC>
 double norm_check_general(
-    char norm_type, rocblas_int M, rocblas_int N, rocblas_int lda, T* hCPU, T* hGPU)
+    char norm_type, rocblas_int M, rocblas_int N, rocblas_int lda, VEC&& hCPU, const T* hGPU)
 {
-    // norm type can be O', 'I', 'F', 'o', 'i', 'f' for one, infinity or Frobenius norm
+    // norm type can be 'O', 'I', 'F', 'o', 'i', 'f' for one, infinity or Frobenius norm
     // one norm is max column sum
     // infinity norm is max row sum
     // Frobenius is l2 norm of matrix entries
-
-    decltype(std::real(*hCPU)) work[1];
-    rocblas_int                incx  = 1;
-    T                          alpha = -1.0;
-    size_t                     size  = N * (size_t)lda;
-
-    double cpu_norm = xlange(&norm_type, &M, &N, hCPU, &lda, work);
-    m_axpy(&size, &alpha, hCPU, &incx, hGPU, &incx);
-    double error = xlange(&norm_type, &M, &N, hGPU, &lda, work) / cpu_norm;
-
-    return error;
-}
-
-// For BF16 and half, we convert the results to double first
-template <typename T,
-          typename VEC,
-          std::enable_if_t<std::is_same<T, rocblas_half>{} || std::is_same<T, rocblas_bfloat16>{},
-                           int> = 0>
-double norm_check_general(
-    char norm_type, rocblas_int M, rocblas_int N, rocblas_int lda, VEC&& hCPU, T* hGPU)
-{
-    size_t              size = N * (size_t)lda;
-    host_vector<double> hCPU_double(size);
-    host_vector<double> hGPU_double(size);
-
-    for(rocblas_int i = 0; i < N; i++)
-    {
-        for(rocblas_int j = 0; j < M; j++)
-        {
-            size_t idx       = j + i * (size_t)lda;
-            hCPU_double[idx] = hCPU[idx];
-            hGPU_double[idx] = hGPU[idx];
-        }
-    }
-
-    return norm_check_general<double>(norm_type, M, N, lda, hCPU_double, hGPU_double);
+    return norm_check_difference(
+        norm_type, norm_check_shape::general, 'N', 'N', M, N, lda, hCPU, hGPU);
 }
 
 /* ============== Norm Check for strided_batched case ============= */
@@ -343,78 +363,29 @@ double norm_check_general(char        norm_type,
 
 /* ============== Norm Check for Symmetric Matrix ============= */
 /*! \brief compare the norm error of two Hermitian/symmetric matrices hCPU & hGPU */
-template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+template <typename T, typename VEC>
 double norm_check_symmetric(
-    char norm_type, char uplo, rocblas_int N, rocblas_int lda, T* hCPU, T* hGPU)
+    char norm_type, char uplo, rocblas_int N, rocblas_int lda, VEC&& hCPU, const T* hGPU)
 {
     // norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-
-    double      work[1];
-    rocblas_int incx  = 1;
-    double      alpha = -1.0;
-    size_t      size  = N * (size_t)lda;
-
-    host_vector<double> hCPU_double(size);
-    host_vector<double> hGPU_double(size);
-
-    for(rocblas_int i = 0; i < N; i++)
-    {
-        for(rocblas_int j = 0; j < N; j++)
-        {
-            size_t idx       = j + i * (size_t)lda;
-            hCPU_double[idx] = double(hCPU[idx]);
-            hGPU_double[idx] = double(hGPU[idx]);
-        }
-    }
-
-    double cpu_norm = xlanhe(&norm_type, &uplo, &N, hCPU_double, &lda, work);
-    m_axpy(&size, &alpha, hCPU_double.data(), &incx, hGPU_double.data(), &incx);
-    double error = xlanhe(&norm_type, &uplo, &N, hGPU_double, &lda, work) / cpu_norm;
-
-    return error;
+    return norm_check_difference(
+        norm_type, norm_check_shape::symmetric, uplo, 'N', N, N, lda, hCPU, hGPU);
 }
 
-template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
-double norm_check_symmetric(
-    char norm_type, char uplo, rocblas_int N, rocblas_int lda, T* hCPU, T* hGPU)
+/* ============== Norm Check for Triangular Matrix ============= */
+/*! \brief compare the norm error of the uplo trapezoids of two matrices hCPU & hGPU */
+template <typename T, typename VEC>
+double norm_check_triangular(char        norm_type,
+                             char        uplo,
+                             char        diag,
+                             rocblas_int M,
+                             rocblas_int N,
+                             rocblas_int lda,
+                             VEC&&       hCPU,
+                             const T*    hGPU)
 {
-    // norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-
-    decltype(std::real(*hCPU)) work[1];
-    rocblas_int                incx  = 1;
-    T                          alpha = -1.0;
-    size_t                     size  = (size_t)lda * N;
-
-    double cpu_norm = xlanhe(&norm_type, &uplo, &N, hCPU, &lda, work);
-    m_axpy(&size, &alpha, hCPU, &incx, hGPU, &incx);
-    double error = xlanhe(&norm_type, &uplo, &N, hGPU, &lda, work) / cpu_norm;
-
-    return error;
-}
-
-template <>
-inline double norm_check_symmetric(char          norm_type,
-                                   char          uplo,
-                                   rocblas_int   N,
-                                   rocblas_int   lda,
-                                   rocblas_half* hCPU,
-                                   rocblas_half* hGPU)
-{
-    size_t              size = N * (size_t)lda;
-    host_vector<double> hCPU_double(size);
-    host_vector<double> hGPU_double(size);
-
-    for(rocblas_int i = 0; i < N; i++)
-    {
-        for(rocblas_int j = 0; j < N; j++)
-        {
-            size_t idx       = j + i * (size_t)lda;
-            hCPU_double[idx] = hCPU[idx];
-            hGPU_double[idx] = hGPU[idx];
-        }
-    }
-
-    return norm_check_symmetric(norm_type, uplo, N, lda, hCPU_double.data(), hGPU_double.data());
+    return norm_check_difference(
+        norm_type, norm_check_shape::triangular, uplo, diag, M, N, lda, hCPU, hGPU);
 }
 
 template <typename T>
@@ -60,6 +60,16 @@
     static auto FN<A, B, C, true> = PFN
 #endif
 
+// The _64 functions and the fused BLAS1 functions have no Fortran interface, so they are
+// mapped to the C API only
+#define MAP2C(...) GET_MACRO(__VA_ARGS__, dum5, MAP2C4, MAP2C3, dum2, dum1)(__VA_ARGS__)
+#define MAP2C3(FN, A, PFN) \
+    template <>            \
+    static auto FN<A> = PFN
+#define MAP2C4(FN, A, B, PFN) \
+    template <>               \
+    static auto FN<A, B> = PFN
+
 /*!\file
  *  This file exposes C++ templated BLAS interface with only the precision templated.
  */
@@ -90,6 +100,18 @@ MAP2CF(rocblas_scal, rocblas_double_complex, rocblas_double_complex, rocblas_zsc
 MAP2CF(rocblas_scal, rocblas_float_complex, float, rocblas_csscal);
 MAP2CF(rocblas_scal, rocblas_double_complex, double, rocblas_zdscal);
 
+// scal_64
+template <typename T, typename U = T>
+static rocblas_status (*rocblas_scal_64)(
+    rocblas_handle handle, int64_t n, const U* alpha, T* x, int64_t incx);
+
+MAP2C(rocblas_scal_64, float, float, rocblas_sscal_64);
+MAP2C(rocblas_scal_64, double, double, rocblas_dscal_64);
+MAP2C(rocblas_scal_64, rocblas_float_complex, rocblas_float_complex, rocblas_cscal_64);
+MAP2C(rocblas_scal_64, rocblas_double_complex, rocblas_double_complex, rocblas_zscal_64);
+MAP2C(rocblas_scal_64, rocblas_float_complex, float, rocblas_csscal_64);
+MAP2C(rocblas_scal_64, rocblas_double_complex, double, rocblas_zdscal_64);
+
 // scal_batched
 template <typename T, typename U = T, bool FORTRAN = false>
 static rocblas_status (*rocblas_scal_batched)(rocblas_handle handle,
@@ -142,6 +164,16 @@ MAP2CF(rocblas_copy, double, rocblas_dcopy);
 MAP2CF(rocblas_copy, rocblas_float_complex, rocblas_ccopy);
 MAP2CF(rocblas_copy, rocblas_double_complex, rocblas_zcopy);
 
+// copy_64
+template <typename T>
+static rocblas_status (*rocblas_copy_64)(
+    rocblas_handle handle, int64_t n, const T* x, int64_t incx, T* y, int64_t incy);
+
+MAP2C(rocblas_copy_64, float, rocblas_scopy_64);
+MAP2C(rocblas_copy_64, double, rocblas_dcopy_64);
+MAP2C(rocblas_copy_64, rocblas_float_complex, rocblas_ccopy_64);
+MAP2C(rocblas_copy_64, rocblas_double_complex, rocblas_zcopy_64);
+
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_copy_batched)(rocblas_handle handle,
                                               rocblas_int    n,
@@ -182,6 +214,16 @@ MAP2CF(rocblas_swap, double, rocblas_dswap);
 MAP2CF(rocblas_swap, rocblas_float_complex, rocblas_cswap);
 MAP2CF(rocblas_swap, rocblas_double_complex, rocblas_zswap);
 
+// swap_64
+template <typename T>
+static rocblas_status (*rocblas_swap_64)(
+    rocblas_handle handle, int64_t n, T* x, int64_t incx, T* y, int64_t incy);
+
+MAP2C(rocblas_swap_64, float, rocblas_sswap_64);
+MAP2C(rocblas_swap_64, double, rocblas_dswap_64);
+MAP2C(rocblas_swap_64, rocblas_float_complex, rocblas_cswap_64);
+MAP2C(rocblas_swap_64, rocblas_double_complex, rocblas_zswap_64);
+
 // swap_batched
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_swap_batched)(rocblas_handle handle,
@@ -231,6 +273,23 @@ MAP2CF(rocblas_dot, rocblas_bfloat16, rocblas_bfdot);
 MAP2CF(rocblas_dot, rocblas_float_complex, rocblas_cdotu);
 MAP2CF(rocblas_dot, rocblas_double_complex, rocblas_zdotu);
 
+// dot_64
+template <typename T>
+static rocblas_status (*rocblas_dot_64)(rocblas_handle handle,
+                                        int64_t        n,
+                                        const T*       x,
+                                        int64_t        incx,
+                                        const T*       y,
+                                        int64_t        incy,
+                                        T*             result);
+
+MAP2C(rocblas_dot_64, float, rocblas_sdot_64);
+MAP2C(rocblas_dot_64, double, rocblas_ddot_64);
+MAP2C(rocblas_dot_64, rocblas_half, rocblas_hdot_64);
+MAP2C(rocblas_dot_64, rocblas_bfloat16, rocblas_bfdot_64);
+MAP2C(rocblas_dot_64, rocblas_float_complex, rocblas_cdotu_64);
+MAP2C(rocblas_dot_64, rocblas_double_complex, rocblas_zdotu_64);
+
 // dotc
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_dotc)(rocblas_handle handle,
@@ -244,6 +303,19 @@ static rocblas_status (*rocblas_dotc)(rocblas_handle handle,
 MAP2CF(rocblas_dotc, rocblas_float_complex, rocblas_cdotc);
 MAP2CF(rocblas_dotc, rocblas_double_complex, rocblas_zdotc);
 
+// dotc_64
+template <typename T>
+static rocblas_status (*rocblas_dotc_64)(rocblas_handle handle,
+                                         int64_t        n,
+                                         const T*       x,
+                                         int64_t        incx,
+                                         const T*       y,
+                                         int64_t        incy,
+                                         T*             result);
+
+MAP2C(rocblas_dotc_64, rocblas_float_complex, rocblas_cdotc_64);
+MAP2C(rocblas_dotc_64, rocblas_double_complex, rocblas_zdotc_64);
+
 // dot_batched
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_dot_batched)(rocblas_handle handle,
@@ -322,6 +394,16 @@ MAP2CF(rocblas_asum, double, rocblas_dasum);
 MAP2CF(rocblas_asum, rocblas_float_complex, rocblas_scasum);
 MAP2CF(rocblas_asum, rocblas_double_complex, rocblas_dzasum);
 
+// asum_64
+template <typename T>
+static rocblas_status (*rocblas_asum_64)(
+    rocblas_handle handle, int64_t n, const T* x, int64_t incx, real_t<T>* result);
+
+MAP2C(rocblas_asum_64, float, rocblas_sasum_64);
+MAP2C(rocblas_asum_64, double, rocblas_dasum_64);
+MAP2C(rocblas_asum_64, rocblas_float_complex, rocblas_scasum_64);
+MAP2C(rocblas_asum_64, rocblas_double_complex, rocblas_dzasum_64);
+
 // asum_batched
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_asum_batched)(rocblas_handle handle,
@@ -361,6 +443,16 @@ MAP2CF(rocblas_nrm2, double, rocblas_dnrm2);
 MAP2CF(rocblas_nrm2, rocblas_float_complex, rocblas_scnrm2);
 MAP2CF(rocblas_nrm2, rocblas_double_complex, rocblas_dznrm2);
 
+// nrm2_64
+template <typename T>
+static rocblas_status (*rocblas_nrm2_64)(
+    rocblas_handle handle, int64_t n, const T* x, int64_t incx, real_t<T>* result);
+
+MAP2C(rocblas_nrm2_64, float, rocblas_snrm2_64);
+MAP2C(rocblas_nrm2_64, double, rocblas_dnrm2_64);
+MAP2C(rocblas_nrm2_64, rocblas_float_complex, rocblas_scnrm2_64);
+MAP2C(rocblas_nrm2_64, rocblas_double_complex, rocblas_dznrm2_64);
+
 // nrm2_batched
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_nrm2_batched)(rocblas_handle handle,
@@ -425,6 +517,29 @@ MAP2CF(rocblas_iamin, double, rocblas_idamin);
 MAP2CF(rocblas_iamin, rocblas_float_complex, rocblas_icamin);
 MAP2CF(rocblas_iamin, rocblas_double_complex, rocblas_izamin);
 
+//
+// iamax_64 and iamin_64, whose index result is int64_t
+//
+template <typename T>
+using rocblas_iamax_iamin_64_t = rocblas_status (*)(
+    rocblas_handle handle, int64_t n, const T* x, int64_t incx, int64_t* result);
+
+template <typename T>
+rocblas_iamax_iamin_64_t<T> rocblas_iamax_64;
+
+MAP2C(rocblas_iamax_64, float, rocblas_isamax_64);
+MAP2C(rocblas_iamax_64, double, rocblas_idamax_64);
+MAP2C(rocblas_iamax_64, rocblas_float_complex, rocblas_icamax_64);
+MAP2C(rocblas_iamax_64, rocblas_double_complex, rocblas_izamax_64);
+
+template <typename T>
+rocblas_iamax_iamin_64_t<T> rocblas_iamin_64;
+
+MAP2C(rocblas_iamin_64, float, rocblas_isamin_64);
+MAP2C(rocblas_iamin_64, double, rocblas_idamin_64);
+MAP2C(rocblas_iamin_64, rocblas_float_complex, rocblas_icamin_64);
+MAP2C(rocblas_iamin_64, rocblas_double_complex, rocblas_izamin_64);
+
 //
 // Define the signature type for the iamax_iamin batched.
 //
@@ -508,6 +623,17 @@ MAP2CF(rocblas_axpy, rocblas_half, rocblas_haxpy);
 MAP2CF(rocblas_axpy, rocblas_float_complex, rocblas_caxpy);
 MAP2CF(rocblas_axpy, rocblas_double_complex, rocblas_zaxpy);
 
+// axpy_64
+template <typename T>
+static rocblas_status (*rocblas_axpy_64)(
+    rocblas_handle handle, int64_t n, const T* alpha, const T* x, int64_t incx, T* y, int64_t incy);
+
+MAP2C(rocblas_axpy_64, float, rocblas_saxpy_64);
+MAP2C(rocblas_axpy_64, double, rocblas_daxpy_64);
+MAP2C(rocblas_axpy_64, rocblas_half, rocblas_haxpy_64);
+MAP2C(rocblas_axpy_64, rocblas_float_complex, rocblas_caxpy_64);
+MAP2C(rocblas_axpy_64, rocblas_double_complex, rocblas_zaxpy_64);
+
 // axpy batched
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_axpy_batched)(rocblas_handle handle,
@@ -544,6 +670,232 @@ MAP2CF(rocblas_axpy_strided_batched, rocblas_half, rocblas_haxpy_strided_batched
 MAP2CF(rocblas_axpy_strided_batched, rocblas_float_complex, rocblas_caxpy_strided_batched);
 MAP2CF(rocblas_axpy_strided_batched, rocblas_double_complex, rocblas_zaxpy_strided_batched);
 
+// axpby
+template <typename T>
+static rocblas_status (*rocblas_axpby)(rocblas_handle handle,
+                                       rocblas_int    n,
+                                       const T*       alpha,
+                                       const T*       x,
+                                       rocblas_int    incx,
+                                       const T*       beta,
+                                       T*             y,
+                                       rocblas_int    incy);
+
+MAP2C(rocblas_axpby, float, rocblas_saxpby);
+MAP2C(rocblas_axpby, double, rocblas_daxpby);
+MAP2C(rocblas_axpby, rocblas_float_complex, rocblas_caxpby);
+MAP2C(rocblas_axpby, rocblas_double_complex, rocblas_zaxpby);
+
+// axpby batched
+template <typename T>
+static rocblas_status (*rocblas_axpby_batched)(rocblas_handle handle,
+                                               rocblas_int    n,
+                                               const T*       alpha,
+                                               const T* const x[],
+                                               rocblas_int    incx,
+                                               const T*       beta,
+                                               T* const       y[],
+                                               rocblas_int    incy,
+                                               rocblas_int    batch_count);
+
+MAP2C(rocblas_axpby_batched, float, rocblas_saxpby_batched);
+MAP2C(rocblas_axpby_batched, double, rocblas_daxpby_batched);
+MAP2C(rocblas_axpby_batched, rocblas_float_complex, rocblas_caxpby_batched);
+MAP2C(rocblas_axpby_batched, rocblas_double_complex, rocblas_zaxpby_batched);
+
+// axpby strided batched
+template <typename T>
+static rocblas_status (*rocblas_axpby_strided_batched)(rocblas_handle handle,
+                                                       rocblas_int    n,
+                                                       const T*       alpha,
+                                                       const T*       x,
+                                                       rocblas_int    incx,
+                                                       rocblas_stride stridex,
+                                                       const T*       beta,
+                                                       T*             y,
+                                                       rocblas_int    incy,
+                                                       rocblas_stride stridey,
+                                                       rocblas_int    batch_count);
+
+MAP2C(rocblas_axpby_strided_batched, float, rocblas_saxpby_strided_batched);
+MAP2C(rocblas_axpby_strided_batched, double, rocblas_daxpby_strided_batched);
+MAP2C(rocblas_axpby_strided_batched, rocblas_float_complex, rocblas_caxpby_strided_batched);
+MAP2C(rocblas_axpby_strided_batched, rocblas_double_complex, rocblas_zaxpby_strided_batched);
+
+// waxpby
+template <typename T>
+static rocblas_status (*rocblas_waxpby)(rocblas_handle handle,
+                                        rocblas_int    n,
+                                        const T*       alpha,
+                                        const T*       x,
+                                        rocblas_int    incx,
+                                        const T*       beta,
+                                        const T*       y,
+                                        rocblas_int    incy,
+                                        T*             w,
+                                        rocblas_int    incw);
+
+MAP2C(rocblas_waxpby, float, rocblas_swaxpby);
+MAP2C(rocblas_waxpby, double, rocblas_dwaxpby);
+MAP2C(rocblas_waxpby, rocblas_float_complex, rocblas_cwaxpby);
+MAP2C(rocblas_waxpby, rocblas_double_complex, rocblas_zwaxpby);
+
+// waxpby batched
+template <typename T>
+static rocblas_status (*rocblas_waxpby_batched)(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const T*       alpha,
+                                                const T* const x[],
+                                                rocblas_int    incx,
+                                                const T*       beta,
+                                                const T* const y[],
+                                                rocblas_int    incy,
+                                                T* const       w[],
+                                                rocblas_int    incw,
+                                                rocblas_int    batch_count);
+
+MAP2C(rocblas_waxpby_batched, float, rocblas_swaxpby_batched);
+MAP2C(rocblas_waxpby_batched, double, rocblas_dwaxpby_batched);
+MAP2C(rocblas_waxpby_batched, rocblas_float_complex, rocblas_cwaxpby_batched);
+MAP2C(rocblas_waxpby_batched, rocblas_double_complex, rocblas_zwaxpby_batched);
+
+// waxpby strided batched
+template <typename T>
+static rocblas_status (*rocblas_waxpby_strided_batched)(rocblas_handle handle,
+                                                        rocblas_int    n,
+                                                        const T*       alpha,
+                                                        const T*       x,
+                                                        rocblas_int    incx,
+                                                        rocblas_stride stridex,
+                                                        const T*       beta,
+                                                        const T*       y,
+                                                        rocblas_int    incy,
+                                                        rocblas_stride stridey,
+                                                        T*             w,
+                                                        rocblas_int    incw,
+                                                        rocblas_stride stridew,
+                                                        rocblas_int    batch_count);
+
+MAP2C(rocblas_waxpby_strided_batched, float, rocblas_swaxpby_strided_batched);
+MAP2C(rocblas_waxpby_strided_batched, double, rocblas_dwaxpby_strided_batched);
+MAP2C(rocblas_waxpby_strided_batched, rocblas_float_complex, rocblas_cwaxpby_strided_batched);
+MAP2C(rocblas_waxpby_strided_batched, rocblas_double_complex, rocblas_zwaxpby_strided_batched);
+
+// axpy_dot
+template <typename T>
+static rocblas_status (*rocblas_axpy_dot)(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          const T*       alpha,
+                                          const T*       x,
+                                          rocblas_int    incx,
+                                          T*             y,
+                                          rocblas_int    incy,
+                                          const T*       z,
+                                          rocblas_int    incz,
+                                          T*             result);
+
+MAP2C(rocblas_axpy_dot, float, rocblas_saxpy_dot);
+MAP2C(rocblas_axpy_dot, double, rocblas_daxpy_dot);
+MAP2C(rocblas_axpy_dot, rocblas_float_complex, rocblas_caxpy_dotc);
+MAP2C(rocblas_axpy_dot, rocblas_double_complex, rocblas_zaxpy_dotc);
+
+// axpy_dot batched
+template <typename T>
+static rocblas_status (*rocblas_axpy_dot_batched)(rocblas_handle handle,
+                                                  rocblas_int    n,
+                                                  const T*       alpha,
+                                                  const T* const x[],
+                                                  rocblas_int    incx,
+                                                  T* const       y[],
+                                                  rocblas_int    incy,
+                                                  const T* const z[],
+                                                  rocblas_int    incz,
+                                                  rocblas_int    batch_count,
+                                                  T*             results);
+
+MAP2C(rocblas_axpy_dot_batched, float, rocblas_saxpy_dot_batched);
+MAP2C(rocblas_axpy_dot_batched, double, rocblas_daxpy_dot_batched);
+MAP2C(rocblas_axpy_dot_batched, rocblas_float_complex, rocblas_caxpy_dotc_batched);
+MAP2C(rocblas_axpy_dot_batched, rocblas_double_complex, rocblas_zaxpy_dotc_batched);
+
+// axpy_dot strided batched
+template <typename T>
+static rocblas_status (*rocblas_axpy_dot_strided_batched)(rocblas_handle handle,
+                                                          rocblas_int    n,
+                                                          const T*       alpha,
+                                                          const T*       x,
+                                                          rocblas_int    incx,
+                                                          rocblas_stride stridex,
+                                                          T*             y,
+                                                          rocblas_int    incy,
+                                                          rocblas_stride stridey,
+                                                          const T*       z,
+                                                          rocblas_int    incz,
+                                                          rocblas_stride stridez,
+                                                          rocblas_int    batch_count,
+                                                          T*             results);
+
+MAP2C(rocblas_axpy_dot_strided_batched, float, rocblas_saxpy_dot_strided_batched);
+MAP2C(rocblas_axpy_dot_strided_batched, double, rocblas_daxpy_dot_strided_batched);
+MAP2C(rocblas_axpy_dot_strided_batched, rocblas_float_complex, rocblas_caxpy_dotc_strided_batched);
+MAP2C(rocblas_axpy_dot_strided_batched, rocblas_double_complex, rocblas_zaxpy_dotc_strided_batched);
+
+// dot2
+template <typename T>
+static rocblas_status (*rocblas_dot2)(rocblas_handle handle,
+                                      rocblas_int    n,
+                                      const T*       x,
+                                      rocblas_int    incx,
+                                      const T*       y,
+                                      rocblas_int    incy,
+                                      const T*       z,
+                                      rocblas_int    incz,
+                                      T*             results);
+
+MAP2C(rocblas_dot2, float, rocblas_sdot2);
+MAP2C(rocblas_dot2, double, rocblas_ddot2);
+MAP2C(rocblas_dot2, rocblas_float_complex, rocblas_cdotc2);
+MAP2C(rocblas_dot2, rocblas_double_complex, rocblas_zdotc2);
+
+// dot2 batched
+template <typename T>
+static rocblas_status (*rocblas_dot2_batched)(rocblas_handle handle,
+                                              rocblas_int    n,
+                                              const T* const x[],
+                                              rocblas_int    incx,
+                                              const T* const y[],
+                                              rocblas_int    incy,
+                                              const T* const z[],
+                                              rocblas_int    incz,
+                                              rocblas_int    batch_count,
+                                              T*             results);
+
+MAP2C(rocblas_dot2_batched, float, rocblas_sdot2_batched);
+MAP2C(rocblas_dot2_batched, double, rocblas_ddot2_batched);
+MAP2C(rocblas_dot2_batched, rocblas_float_complex, rocblas_cdotc2_batched);
+MAP2C(rocblas_dot2_batched, rocblas_double_complex, rocblas_zdotc2_batched);
+
+// dot2 strided batched
+template <typename T>
+static rocblas_status (*rocblas_dot2_strided_batched)(rocblas_handle handle,
+                                                      rocblas_int    n,
+                                                      const T*       x,
+                                                      rocblas_int    incx,
+                                                      rocblas_stride stridex,
+                                                      const T*       y,
+                                                      rocblas_int    incy,
+                                                      rocblas_stride stridey,
+                                                      const T*       z,
+                                                      rocblas_int    incz,
+                                                      rocblas_stride stridez,
+                                                      rocblas_int    batch_count,
+                                                      T*             results);
+
+MAP2C(rocblas_dot2_strided_batched, float, rocblas_sdot2_strided_batched);
+MAP2C(rocblas_dot2_strided_batched, double, rocblas_ddot2_strided_batched);
+MAP2C(rocblas_dot2_strided_batched, rocblas_float_complex, rocblas_cdotc2_strided_batched);
+MAP2C(rocblas_dot2_strided_batched, rocblas_double_complex, rocblas_zdotc2_strided_batched);
+
 // rot
 template <typename T, typename U = T, typename V = T, bool FORTRAN = false>
 static rocblas_status (*rocblas_rot)(rocblas_handle handle,
@@ -1117,6 +1469,26 @@ MAP2CF(rocblas_gemv, double, rocblas_dgemv);
 MAP2CF(rocblas_gemv, rocblas_float_complex, rocblas_cgemv);
 MAP2CF(rocblas_gemv, rocblas_double_complex, rocblas_zgemv);
 
+// gemv_64
+template <typename T>
+static rocblas_status (*rocblas_gemv_64)(rocblas_handle    handle,
+                                         rocblas_operation transA,
+                                         int64_t           m,
+                                         int64_t           n,
+                                         const T*          alpha,
+                                         const T*          A,
+                                         int64_t           lda,
+                                         const T*          x,
+                                         int64_t           incx,
+                                         const T*          beta,
+                                         T*                y,
+                                         int64_t           incy);
+
+MAP2C(rocblas_gemv_64, float, rocblas_sgemv_64);
+MAP2C(rocblas_gemv_64, double, rocblas_dgemv_64);
+MAP2C(rocblas_gemv_64, rocblas_float_complex, rocblas_cgemv_64);
+MAP2C(rocblas_gemv_64, rocblas_double_complex, rocblas_zgemv_64);
+
 // gemv_batched
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_gemv_batched)(rocblas_handle    handle,
@@ -2179,6 +2551,29 @@ MAP2CF(rocblas_gemm, rocblas_half, rocblas_hgemm);
 MAP2CF(rocblas_gemm, rocblas_float_complex, rocblas_cgemm);
 MAP2CF(rocblas_gemm, rocblas_double_complex, rocblas_zgemm);
 
+// gemm_64
+template <typename T>
+static rocblas_status (*rocblas_gemm_64)(rocblas_handle    handle,
+                                         rocblas_operation transA,
+                                         rocblas_operation transB,
+                                         int64_t           m,
+                                         int64_t           n,
+                                         int64_t           k,
+                                         const T*          alpha,
+                                         const T*          A,
+                                         int64_t           lda,
+                                         const T*          B,
+                                         int64_t           ldb,
+                                         const T*          beta,
+                                         T*                C,
+                                         int64_t           ldc);
+
+MAP2C(rocblas_gemm_64, float, rocblas_sgemm_64);
+MAP2C(rocblas_gemm_64, double, rocblas_dgemm_64);
+MAP2C(rocblas_gemm_64, rocblas_half, rocblas_hgemm_64);
+MAP2C(rocblas_gemm_64, rocblas_float_complex, rocblas_cgemm_64);
+MAP2C(rocblas_gemm_64, rocblas_double_complex, rocblas_zgemm_64);
+
 // gemm_batched
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_gemm_batched)(rocblas_handle    handle,
@@ -65,6 +65,7 @@ struct Arguments
 
     rocblas_int incx;
     rocblas_int incy;
+    rocblas_int incz;
     rocblas_int incd;
     rocblas_int incb;
 
@@ -88,6 +89,10 @@ struct Arguments
 
     rocblas_atomics_mode atomics_mode;
 
+    rocblas_reduction_mode reduction_mode;
+
+    rocblas_nrm2_mode nrm2_mode;
+
     // memory padding for testing write out of bounds
     uint32_t pad;
 
@@ -150,6 +155,7 @@ struct Arguments
     OPER(ldd) SEP                    \
     OPER(incx) SEP                   \
     OPER(incy) SEP                   \
+    OPER(incz) SEP                   \
     OPER(incd) SEP                   \
     OPER(incb) SEP                   \
     OPER(batch_count) SEP            \
@@ -165,6 +171,8 @@ struct Arguments
     OPER(compute_type) SEP           \
     OPER(initialization) SEP         \
     OPER(atomics_mode) SEP           \
+    OPER(reduction_mode) SEP         \
+    OPER(nrm2_mode) SEP              \
     OPER(pad) SEP                    \
     OPER(threads) SEP                \
     OPER(streams) SEP                \
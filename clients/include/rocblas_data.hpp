@@ -6,7 +6,9 @@
 
 #include "rocblas_arguments.hpp"
 #include "test_cleanup.hpp"
+#include <algorithm>
 #include <cerrno>
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -14,8 +16,11 @@
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <map>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #ifdef __cpp_lib_filesystem
 #include <filesystem>
@@ -36,25 +41,86 @@ class RocBLAS_TestData
         return filename;
     }
 
+    // in-memory data, which is read instead of the file when it is not empty
+    static auto& data()
+    {
+        static std::string data;
+        return data;
+    }
+
+    // ranges [first, second) of record numbers
+    using record_ranges = std::vector<std::pair<size_t, size_t>>;
+
+    // Records of the data file, which is memory-mapped, or of the in-memory data. They are
+    // validated and indexed by function name in one pass when the data is first used.
+    struct records
+    {
+        const char* base  = nullptr; // first record, after the signature
+        size_t      count = 0;
+
+        // ranges of consecutive records of each function, in file order
+        std::map<std::string, record_ranges> functions;
+
+        void*       mapping      = nullptr;
+        size_t      mapping_size = 0;
+        std::string buffer; // contents of files which cannot be mapped
+
+        records() = default;
+        ~records();
+        records(const records&) = delete;
+        records& operator=(const records&) = delete;
+    };
+
+    // records of the data, loaded if this is the first time, or after test_cleanup::cleanup()
+    static const records& get_records();
+
     // filter iterator
-    class iterator : public std::istream_iterator<Arguments>
+    class iterator
     {
-        bool (*const filter)(const Arguments&) = nullptr;
+        bool (*filter)(const Arguments&) = nullptr;
+
+        const char*                          base = nullptr;
+        std::shared_ptr<const record_ranges> ranges;
+        size_t                               range = 0, index = 0;
+        Arguments                            arg;
 
-        // Skip entries for which filter is false
+        bool at_end() const
+        {
+            return !ranges || range == ranges->size();
+        }
+
+        // Skip entries for which filter is false, copying each entry out of the data
         void skip_filter()
         {
-            static auto endIter = std::istream_iterator<Arguments>{};
-            if(filter)
-                while(*this != endIter && !filter(**this))
-                    ++*static_cast<std::istream_iterator<Arguments>*>(this);
+            while(!at_end())
+            {
+                if(index < (*ranges)[range].second)
+                {
+                    memcpy(&arg, base + index * sizeof(Arguments), sizeof(Arguments));
+                    if(!filter || filter(arg))
+                        return;
+                    ++index;
+                }
+                else if(++range < ranges->size())
+                    index = (*ranges)[range].first;
+            }
         }
 
     public:
-        // Constructor takes a filter and iterator
-        iterator(bool filter(const Arguments&), std::istream_iterator<Arguments> iter)
-            : std::istream_iterator<Arguments>(iter)
-            , filter(filter)
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = Arguments;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const Arguments*;
+        using reference         = const Arguments&;
+
+        // Constructor takes a filter and the ranges of records to visit
+        iterator(bool filter(const Arguments&),
+                 const char*                          base,
+                 std::shared_ptr<const record_ranges> ranges)
+            : filter(filter)
+            , base(base)
+            , ranges(std::move(ranges))
+            , index(this->ranges->empty() ? 0 : this->ranges->front().first)
         {
             skip_filter();
         }
@@ -62,18 +128,40 @@ class RocBLAS_TestData
         // Default end iterator and nullptr filter
         iterator() = default;
 
+        const Arguments& operator*() const
+        {
+            return arg;
+        }
+
+        const Arguments* operator->() const
+        {
+            return &arg;
+        }
+
         // Preincrement iterator operator with filtering
         iterator& operator++()
         {
-            ++*static_cast<std::istream_iterator<Arguments>*>(this);
+            ++index;
             skip_filter();
             return *this;
         }
 
         // We do not need a postincrement iterator operator
-        // We delete it here so that the base class's isn't silently called
+        // We delete it here so that it isn't silently used
         // To implement it, use "auto old = *this; ++*this; return old;"
         iterator operator++(int) = delete;
+
+        bool operator==(const iterator& rhs) const
+        {
+            return at_end() || rhs.at_end()
+                       ? at_end() == rhs.at_end()
+                       : ranges == rhs.ranges && range == rhs.range && index == rhs.index;
+        }
+
+        bool operator!=(const iterator& rhs) const
+        {
+            return !(*this == rhs);
+        }
     };
 
 public:
@@ -89,36 +177,41 @@ public:
         }
     }
 
-    // begin() iterator which accepts an optional filter.
-    static iterator begin(bool filter(const Arguments&) = nullptr)
+    // Initialize in-memory data, such as the records expanded from a YAML file
+    static void set_data(std::string buf)
+    {
+        data() = std::move(buf);
+    }
+
+    // begin() iterator which accepts an optional filter, and an optional filter of function
+    // names. function_filter is only passed the function name, and is called once per distinct
+    // function name, so that only the records of the accepted functions are read.
+    static iterator begin(bool filter(const Arguments&)          = nullptr,
+                          bool function_filter(const Arguments&) = nullptr)
     {
-        static std::ifstream* ifs = nullptr;
+        const records& recs   = get_records();
+        auto           ranges = std::make_shared<record_ranges>();
 
-        // If this is the first time, or after test_cleanup::cleanup() has been called
-        if(!ifs)
+        if(!function_filter)
+            ranges->emplace_back(0, recs.count);
+        else
         {
-            std::string fileToOpen = filename();
-            // Allocate a std::ifstream and register it to be deleted during cleanup
-            ifs = test_cleanup::allocate(
-                &ifs, fileToOpen, std::ifstream::in | std::ifstream::binary);
-            if(!ifs || ifs->fail())
+            Arguments arg;
+            for(auto& function : recs.functions)
             {
-                rocblas_cerr << "Cannot open " << fileToOpen << ": " << strerror(errno)
-                             << std::endl;
-                exit(EXIT_FAILURE);
+                memset(&arg, 0, sizeof(arg));
+                memcpy(arg.function, function.first.data(), function.first.size());
+                if(function_filter(arg))
+                    ranges->insert(ranges->end(), function.second.begin(), function.second.end());
             }
-        }
 
-        // We re-seek the file back to position 0
-        ifs->clear();
-        ifs->seekg(0);
-
-        // Validate the data file format
-        Arguments::validate(*ifs);
+            // Visit the records in file order, as the tests were generated
+            std::sort(ranges->begin(), ranges->end());
+        }
 
         // We create a filter iterator which will choose only the test cases we want right now.
         // This is to preserve Gtest structure while not creating no-op tests which "always pass".
-        return iterator(filter, std::istream_iterator<Arguments>(*ifs));
+        return iterator(filter, recs.base, std::move(ranges));
     }
 
     // end() iterator
@@ -0,0 +1,22 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+/*! \brief  Expand a rocBLAS YAML test file into binary Arguments records, as rocblas_gentest.py
+ *          does, without running Python or writing a file.
+ *
+ *          The template file, if not empty, is read before the YAML file. include: lines are
+ *          searched for in the directory of the file which includes them, and then in the
+ *          include directories. The documents are expanded in parallel, and the records are
+ *          returned in the format of the binary test data files, starting with the signature
+ *          checked by Arguments::validate(). Duplicate records are removed, keeping the first.
+ *
+ *          Errors in the YAML are reported with their file, line and column, and exit. */
+std::string rocblas_gentest(const std::string&              yaml_file,
+                            const std::string&              template_file = "",
+                            const std::vector<std::string>& include_dirs  = {});
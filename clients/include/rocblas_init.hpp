@@ -52,6 +52,7 @@ void rocblas_init_matrix_alternating_sign(rocblas_check_matrix_type matrix_type,
                                           rocblas_stride            stride      = 0,
                                           rocblas_int               batch_count = 1)
 {
+    uint32_t matrix = rocblas_next_matrix_id();
     if(matrix_type == rocblas_client_general_matrix)
     {
         for(size_t b = 0; b < batch_count; b++)
@@ -59,8 +60,10 @@ void rocblas_init_matrix_alternating_sign(rocblas_check_matrix_type matrix_type,
             for(size_t i = 0; i < M; ++i)
                 for(size_t j = 0; j < N; ++j)
                 {
-                    auto value                  = rand_gen();
-                    A[i + j * lda + b * stride] = (i ^ j) & 1 ? value : negate(value);
+                    size_t idx = i + j * lda + b * stride;
+                    rocblas_seek_rand seek(matrix, rocblas_element_index(i, j, b, M, N));
+                    auto value = rand_gen();
+                    A[idx]     = (i ^ j) & 1 ? value : negate(value);
                 }
     }
     else if(matrix_type == rocblas_client_triangular_matrix)
@@ -70,9 +73,11 @@ void rocblas_init_matrix_alternating_sign(rocblas_check_matrix_type matrix_type,
             for(size_t i = 0; i < M; ++i)
                 for(size_t j = 0; j < N; ++j)
                 {
+                    size_t idx = i + j * lda + b * stride;
+                    rocblas_seek_rand seek(matrix, rocblas_element_index(i, j, b, M, N));
                     auto value
                         = uplo == 'U' ? (j >= i ? rand_gen() : 0) : (j <= i ? rand_gen() : 0);
-                    A[i + j * lda + b * stride] = (i ^ j) & 1 ? T(value) : T(negate(value));
+                    A[idx] = (i ^ j) & 1 ? T(value) : T(negate(value));
                 }
     }
 }
@@ -86,12 +91,15 @@ void rocblas_init_vector_alternating_sign(T               rand_gen(),
                                           rocblas_stride  stride      = 0,
                                           rocblas_int     batch_count = 1)
 {
+    uint32_t matrix = rocblas_next_matrix_id();
     for(size_t b = 0; b < batch_count; b++)
 #pragma omp parallel for
         for(size_t j = 0; j < N; ++j)
         {
-            auto value               = rand_gen();
-            x[j * incx + b * stride] = j & 1 ? value : negate(value);
+            size_t idx = j * incx + b * stride;
+            rocblas_seek_rand seek(matrix, rocblas_element_index(j, 0, b, N, 1));
+            auto value = rand_gen();
+            x[idx]     = j & 1 ? value : negate(value);
         }
 }
 
@@ -110,13 +118,18 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
                          rocblas_stride            stride      = 0,
                          rocblas_int               batch_count = 1)
 {
+    uint32_t matrix = rocblas_next_matrix_id();
     if(matrix_type == rocblas_client_general_matrix)
     {
         for(size_t b = 0; b < batch_count; b++)
 #pragma omp parallel for
             for(size_t i = 0; i < M; ++i)
                 for(size_t j = 0; j < N; ++j)
-                    A[i + j * lda + b * stride] = rand_gen();
+                {
+                    size_t idx = i + j * lda + b * stride;
+                    rocblas_seek_rand seek(matrix, rocblas_element_index(i, j, b, M, N));
+                    A[idx] = rand_gen();
+                }
     }
     else if(matrix_type == rocblas_client_hermitian_matrix)
     {
@@ -125,6 +138,7 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
             for(size_t i = 0; i < N; ++i)
                 for(size_t j = 0; j <= i; ++j)
                 {
+                    rocblas_seek_rand seek(matrix, rocblas_element_index(j, i, b, N, N));
                     auto value = rand_gen();
                     if(i == j)
                         A[b * stride + j + i * lda] = std::real(value);
@@ -152,6 +166,7 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
             for(size_t i = 0; i < N; ++i)
                 for(size_t j = 0; j <= i; ++j)
                 {
+                    rocblas_seek_rand seek(matrix, rocblas_element_index(j, i, b, N, N));
                     auto value = rand_gen();
                     if(i == j)
                         A[b * stride + j + i * lda] = value;
@@ -179,9 +194,11 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
             for(size_t i = 0; i < M; ++i)
                 for(size_t j = 0; j < N; ++j)
                 {
+                    size_t idx = i + j * lda + b * stride;
+                    rocblas_seek_rand seek(matrix, rocblas_element_index(i, j, b, M, N));
                     auto value
                         = uplo == 'U' ? (j >= i ? rand_gen() : T(0)) : (j <= i ? rand_gen() : T(0));
-                    A[i + j * lda + b * stride] = value;
+                    A[idx] = value;
                 }
     }
 }
@@ -197,10 +214,15 @@ void rocblas_init_vector(T               rand_gen(),
                          rocblas_stride  stride      = 0,
                          rocblas_int     batch_count = 1)
 {
+    uint32_t matrix = rocblas_next_matrix_id();
     for(size_t b = 0; b < batch_count; b++)
 #pragma omp parallel for
         for(size_t j = 0; j < N; ++j)
-            x[j * incx + b * stride] = rand_gen();
+        {
+            size_t idx = j * incx + b * stride;
+            rocblas_seek_rand seek(matrix, rocblas_element_index(j, 0, b, N, 1));
+            x[idx] = rand_gen();
+        }
 }
 
 /* ============================================================================================ */
@@ -330,19 +352,17 @@ void rocblas_init_vector_trig(host_vector<T>& x,
 template <typename T>
 void rocblas_init(T* A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+    uint32_t matrix = rocblas_next_matrix_id();
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
     {
         size_t b_idx = i_batch * stride;
+#pragma omp parallel for
         for(size_t j = 0; j < N; ++j)
         {
+            // The column is written at its offset, and seeded with the index of its first element
             size_t col_idx = b_idx + j * lda;
-            if(M > 4)
-                random_run_generator<T>(A + col_idx, M);
-            else
-            {
-                for(size_t i = 0; i < M; ++i)
-                    A[col_idx + i] = random_generator<T>();
-            }
+            random_run_generator<T>(
+                A + col_idx, M, matrix, rocblas_element_index(0, j, i_batch, M, N));
         }
     }
 }
@@ -387,6 +407,7 @@ template <typename T>
 void rocblas_init_alternating_sign(
     T* A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+    uint32_t matrix = rocblas_next_matrix_id();
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
 #pragma omp parallel for
         for(size_t j = 0; j < N; ++j)
@@ -394,6 +415,7 @@ void rocblas_init_alternating_sign(
             size_t offset = j * lda + i_batch * stride;
             for(size_t i = 0; i < M; ++i)
             {
+                rocblas_seek_rand seek(matrix, rocblas_element_index(i, j, i_batch, M, N));
                 auto value    = random_generator<T>();
                 A[i + offset] = (i ^ j) & 1 ? value : negate(value);
             }
@@ -412,6 +434,7 @@ template <typename T>
 void rocblas_init_hpl_alternating_sign(
     T* A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+    uint32_t matrix = rocblas_next_matrix_id();
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
 #pragma omp parallel for
         for(size_t j = 0; j < N; ++j)
@@ -419,6 +442,7 @@ void rocblas_init_hpl_alternating_sign(
             size_t offset = j * lda + i_batch * stride;
             for(size_t i = 0; i < M; ++i)
             {
+                rocblas_seek_rand seek(matrix, rocblas_element_index(i, j, i_batch, M, N));
                 auto value    = random_hpl_generator<T>();
                 A[i + offset] = (i ^ j) & 1 ? value : negate(value);
             }
@@ -458,9 +482,12 @@ inline void rocblas_init_cos(
 template <typename T>
 void rocblas_init_symmetric(host_vector<T>& A, size_t N, size_t lda)
 {
+    uint32_t matrix = rocblas_next_matrix_id();
+#pragma omp parallel for
     for(size_t i = 0; i < N; ++i)
         for(size_t j = 0; j <= i; ++j)
         {
+            rocblas_seek_rand seek(matrix, rocblas_element_index(j, i, 0, N, N));
             auto value = random_generator<T>();
             // Warning: It's undefined behavior to assign to the
             // same array element twice in same sequence point (i==j)
@@ -473,11 +500,14 @@ void rocblas_init_symmetric(host_vector<T>& A, size_t N, size_t lda)
 template <typename T>
 void rocblas_init_symmetric(T* A, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+    uint32_t matrix = rocblas_next_matrix_id();
     for(size_t b = 0; b < batch_count; ++b)
     {
+#pragma omp parallel for
         for(size_t i = 0; i < N; ++i)
             for(size_t j = 0; j <= i; ++j)
             {
+                rocblas_seek_rand seek(matrix, rocblas_element_index(j, i, b, N, N));
                 auto value = random_generator<T>();
                 // Warning: It's undefined behavior to assign to the
                 // same array element twice in same sequence point (i==j)
@@ -511,9 +541,12 @@ void rocblas_clear_symmetric(
 template <typename T>
 void rocblas_init_hermitian(host_vector<T>& A, size_t N, size_t lda)
 {
+    uint32_t matrix = rocblas_next_matrix_id();
+#pragma omp parallel for
     for(size_t i = 0; i < N; ++i)
         for(size_t j = 0; j <= i; ++j)
         {
+            rocblas_seek_rand seek(matrix, rocblas_element_index(j, i, 0, N, N));
             auto value     = random_generator<T>();
             A[j + i * lda] = value;
             value.y        = (i == j) ? 0 : negate(value.y);
@@ -526,20 +559,32 @@ template <typename T>
 void rocblas_init_hpl(
     host_vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+    uint32_t matrix = rocblas_next_matrix_id();
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
+#pragma omp parallel for
         for(size_t i = 0; i < M; ++i)
             for(size_t j = 0; j < N; ++j)
-                A[i + j * lda + i_batch * stride] = random_hpl_generator<T>();
+            {
+                size_t idx = i + j * lda + i_batch * stride;
+                rocblas_seek_rand seek(matrix, rocblas_element_index(i, j, i_batch, M, N));
+                A[idx] = random_hpl_generator<T>();
+            }
 }
 
 template <typename T>
 void rocblas_init_hpl(
     T* A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+    uint32_t matrix = rocblas_next_matrix_id();
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
+#pragma omp parallel for
         for(size_t i = 0; i < M; ++i)
             for(size_t j = 0; j < N; ++j)
-                A[i + j * lda + i_batch * stride] = random_hpl_generator<T>();
+            {
+                size_t idx = i + j * lda + i_batch * stride;
+                rocblas_seek_rand seek(matrix, rocblas_element_index(i, j, i_batch, M, N));
+                A[idx] = random_hpl_generator<T>();
+            }
 }
 
 /* ============================================================================================ */
@@ -7,44 +7,188 @@
 #include "rocblas.h"
 #include "rocblas_math.hpp"
 #include <cinttypes>
+#include <cstdint>
 #include <random>
 #include <thread>
 #include <type_traits>
 
 /* ============================================================================================ */
+/*! \brief  Philox4x32-10 counter-based random number generator.
+ *
+ *          Each 128-bit counter is encrypted with the 64-bit seed as the key, giving 4 random
+ *          32-bit words which depend on nothing else. The counter holds the number of the block of
+ *          4 words, a 64-bit index and a 32-bit stream, so that the random values of an element of
+ *          a matrix are a function of the seed, the matrix (stream) and the element (index), and
+ *          do not depend on which thread generates them, or in what order.
+ *
+ *          It satisfies UniformRandomBitGenerator, so the standard distributions can use it. */
+class rocblas_philox
+{
+    uint32_t m_key[2];
+    uint32_t m_ctr[4]; // block, index low, index high, stream
+    uint32_t m_out[4];
+    int      m_pos;
+
+public:
+    using result_type = uint32_t;
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    static constexpr result_type max()
+    {
+        return UINT32_MAX;
+    }
+
+    //! Encrypt the counter (c0, c1, c2, c3) with the key (k0, k1)
+    static void block(uint32_t c0,
+                      uint32_t c1,
+                      uint32_t c2,
+                      uint32_t c3,
+                      uint32_t k0,
+                      uint32_t k1,
+                      uint32_t out[4])
+    {
+        for(int round = 0; round < 10; ++round)
+        {
+            uint64_t p0 = uint64_t(0xD2511F53) * c0;
+            uint64_t p1 = uint64_t(0xCD9E8D57) * c2;
+
+            c0 = uint32_t(p1 >> 32) ^ c1 ^ k0;
+            c2 = uint32_t(p0 >> 32) ^ c3 ^ k1;
+            c1 = uint32_t(p1);
+            c3 = uint32_t(p0);
+            k0 += 0x9E3779B9;
+            k1 += 0xBB67AE85;
+        }
+        out[0] = c0;
+        out[1] = c1;
+        out[2] = c2;
+        out[3] = c3;
+    }
+
+    explicit rocblas_philox(uint64_t seed = 0, uint32_t stream = 0, uint64_t index = 0)
+    {
+        seek(seed, stream, index);
+    }
+
+    //! Start the words of the given element of the given stream
+    void seek(uint64_t seed, uint32_t stream, uint64_t index)
+    {
+        m_key[0] = uint32_t(seed);
+        m_key[1] = uint32_t(seed >> 32);
+        m_ctr[0] = 0;
+        m_ctr[1] = uint32_t(index);
+        m_ctr[2] = uint32_t(index >> 32);
+        m_ctr[3] = stream;
+        m_pos    = 4;
+    }
+
+    result_type operator()()
+    {
+        if(m_pos == 4)
+        {
+            block(m_ctr[0]++, m_ctr[1], m_ctr[2], m_ctr[3], m_key[0], m_key[1], m_out);
+            m_pos = 0;
+        }
+        return m_out[m_pos++];
+    }
+};
+
 // Random number generator
-using rocblas_rng_t = std::mt19937;
+using rocblas_rng_t = rocblas_philox;
 
-extern rocblas_rng_t   g_rocblas_seed;
+extern uint64_t        g_rocblas_seed;
 extern std::thread::id g_main_thread_id;
 
 extern thread_local rocblas_rng_t t_rocblas_rng;
-extern thread_local int           t_rocblas_rand_idx;
+extern thread_local uint32_t      t_rocblas_matrix_id;
+
+// Streams of the values which are not drawn for an element of a matrix
+constexpr uint32_t rocblas_main_stream   = UINT32_MAX;
+constexpr uint32_t rocblas_thread_stream = UINT32_MAX - 1;
 
 // optimized helper
 float rocblas_uniform_int_1_10();
 
-void rocblas_uniform_int_1_10_run_float(float* ptr, size_t num);
-void rocblas_uniform_int_1_10_run_double(double* ptr, size_t num);
-void rocblas_uniform_int_1_10_run_float_complex(rocblas_float_complex* ptr, size_t num);
-void rocblas_uniform_int_1_10_run_double_complex(rocblas_double_complex* ptr, size_t num);
-
-// For the main thread, we use g_rocblas_seed; for other threads, we start with a different seed but
-// deterministically based on the thread id's hash function.
+// Set ptr[i] to the value of random_generator() for element index + i of the given matrix
+void rocblas_uniform_int_1_10_run_float(float* ptr, size_t num, uint32_t matrix, uint64_t index);
+void rocblas_uniform_int_1_10_run_double(double* ptr, size_t num, uint32_t matrix, uint64_t index);
+void rocblas_uniform_int_1_10_run_float_complex(rocblas_float_complex* ptr,
+                                                size_t                 num,
+                                                uint32_t               matrix,
+                                                uint64_t               index);
+void rocblas_uniform_int_1_10_run_double_complex(rocblas_double_complex* ptr,
+                                                 size_t                  num,
+                                                 uint32_t                matrix,
+                                                 uint64_t                index);
+
+// For the main thread, we use the main stream of g_rocblas_seed; for other threads, we use a
+// different stream, starting at an index based on the thread id's hash function.
 inline rocblas_rng_t get_seed()
 {
     auto tid = std::this_thread::get_id();
-    return tid == g_main_thread_id ? g_rocblas_seed
-                                   : rocblas_rng_t(std::hash<std::thread::id>{}(tid));
+    return tid == g_main_thread_id
+               ? rocblas_rng_t(g_rocblas_seed, rocblas_main_stream)
+               : rocblas_rng_t(
+                   g_rocblas_seed, rocblas_thread_stream, std::hash<std::thread::id>{}(tid));
 }
 
 // Reset the seed (mainly to ensure repeatability of failures in a given suite)
 inline void rocblas_seedrand()
 {
-    t_rocblas_rng      = get_seed();
-    t_rocblas_rand_idx = 0;
+    t_rocblas_rng       = get_seed();
+    t_rocblas_matrix_id = 0;
+}
+
+// Set the seed used by rocblas_seedrand(), from the --seed option
+inline void rocblas_set_seed(uint64_t seed)
+{
+    g_rocblas_seed = seed;
+    rocblas_seedrand();
+}
+
+// Number the matrices initialized by the calling thread since rocblas_seedrand(), so that each
+// one has its own stream of random values. The numbering is per thread, so that the values do not
+// depend on how tests are scheduled: threads which initialize their matrices in the same order
+// after rocblas_seedrand() get identical matrices.
+inline uint32_t rocblas_next_matrix_id()
+{
+    return t_rocblas_matrix_id++;
+}
+
+// Logical index of element (i, j) of matrix b of a batch of M x N matrices, which does not depend
+// on the leading dimension, the stride or the padding between the matrices
+inline uint64_t rocblas_element_index(size_t i, size_t j, size_t b, size_t M, size_t N)
+{
+    return (uint64_t(b) * N + j) * M + i;
 }
 
+/*! \brief  While in scope, the random values drawn by the calling thread are those of the given
+ *          element of a matrix. The thread's previous stream is restored on destruction, so that
+ *          the values it draws afterwards do not depend on which elements were initialized. */
+class rocblas_seek_rand
+{
+    rocblas_rng_t m_saved;
+
+public:
+    rocblas_seek_rand(uint32_t matrix, uint64_t index)
+        : m_saved(t_rocblas_rng)
+    {
+        t_rocblas_rng.seek(g_rocblas_seed, matrix, index);
+    }
+
+    ~rocblas_seek_rand()
+    {
+        t_rocblas_rng = m_saved;
+    }
+
+    rocblas_seek_rand(const rocblas_seek_rand&) = delete;
+    rocblas_seek_rand& operator=(const rocblas_seek_rand&) = delete;
+};
+
 /* ============================================================================================ */
 /*! \brief  Random number generator which generates NaN values */
 class rocblas_nan_rng
@@ -309,38 +453,45 @@ inline int8_t random_generator<int8_t>()
     return static_cast<int8_t>(std::uniform_int_distribution<unsigned short>(1, 3)(t_rocblas_rng));
 };
 
-/*! \brief  generate a sequence of random number in range [1,2,3,4,5,6,7,8,9,10] */
+/*! \brief  generate the random_generator() values of elements [index, index + num) of a matrix */
 template <typename T>
-inline void random_run_generator(T* ptr, size_t num)
+inline void random_run_generator(T* ptr, size_t num, uint32_t matrix, uint64_t index)
 {
     for(size_t i = 0; i < num; i++)
     {
+        rocblas_seek_rand seek(matrix, index + i);
         ptr[i] = random_generator<T>();
     }
 }
 
 template <>
-inline void random_run_generator<float>(float* ptr, size_t num)
+inline void random_run_generator<float>(float* ptr, size_t num, uint32_t matrix, uint64_t index)
 {
-    rocblas_uniform_int_1_10_run_float(ptr, num);
+    rocblas_uniform_int_1_10_run_float(ptr, num, matrix, index);
 };
 
 template <>
-inline void random_run_generator<double>(double* ptr, size_t num)
+inline void random_run_generator<double>(double* ptr, size_t num, uint32_t matrix, uint64_t index)
 {
-    rocblas_uniform_int_1_10_run_double(ptr, num);
+    rocblas_uniform_int_1_10_run_double(ptr, num, matrix, index);
 };
 
 template <>
-inline void random_run_generator<rocblas_float_complex>(rocblas_float_complex* ptr, size_t num)
+inline void random_run_generator<rocblas_float_complex>(rocblas_float_complex* ptr,
+                                                        size_t                 num,
+                                                        uint32_t               matrix,
+                                                        uint64_t               index)
 {
-    rocblas_uniform_int_1_10_run_float_complex(ptr, num);
+    rocblas_uniform_int_1_10_run_float_complex(ptr, num, matrix, index);
 };
 
 template <>
-inline void random_run_generator<rocblas_double_complex>(rocblas_double_complex* ptr, size_t num)
+inline void random_run_generator<rocblas_double_complex>(rocblas_double_complex* ptr,
+                                                         size_t                  num,
+                                                         uint32_t                matrix,
+                                                         uint64_t                index)
 {
-    rocblas_uniform_int_1_10_run_double_complex(ptr, num);
+    rocblas_uniform_int_1_10_run_double_complex(ptr, num, matrix, index);
 };
 
 // HPL
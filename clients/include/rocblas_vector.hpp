@@ -45,11 +45,14 @@ void rocblas_init_template(U& that, T rand_gen(), bool seedReset, bool alternati
     if(seedReset)
         rocblas_seedrand();
 
+    // Element i of batch batch_index is numbered batch_index * n + i
+    uint32_t matrix = rocblas_next_matrix_id();
     for(rocblas_int batch_index = 0; batch_index < that.batch_count(); ++batch_index)
     {
         auto*     batched_data = that[batch_index];
         ptrdiff_t inc          = that.inc();
         auto      n            = that.n();
+        size_t    first        = size_t(batch_index) * n;
 
         if(inc < 0)
             batched_data -= (n - 1) * inc;
@@ -58,6 +61,7 @@ void rocblas_init_template(U& that, T rand_gen(), bool seedReset, bool alternati
         {
             for(rocblas_int i = 0; i < n; ++i)
             {
+                rocblas_seek_rand seek(matrix, first + i);
                 auto value            = rand_gen();
                 batched_data[i * inc] = (i ^ 0) & 1 ? value : negate(value);
             }
@@ -65,7 +69,10 @@ void rocblas_init_template(U& that, T rand_gen(), bool seedReset, bool alternati
         else
         {
             for(rocblas_int i = 0; i < n; ++i)
+            {
+                rocblas_seek_rand seek(matrix, first + i);
                 batched_data[i * inc] = rand_gen();
+            }
         }
     }
 }
@@ -0,0 +1,168 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "blas1/rocblas_nrm2_scaled_ref.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// Check to see if rocblas_nrm2_mode_scaled is working. This is done by:
+// - Scaling the elements of the vectors to the extreme exponents of the type: huge elements whose
+//   squares overflow, tiny elements whose squares underflow, a mix of huge, medium and tiny
+//   elements, and a mix of elements just above and below the threshold of the small accumulator
+// - Calling nrm2 in its strided batched, batched and non-batched forms in host pointer mode, and
+//   nrm2_strided_batched and nrm2_strided_batched_ex in device pointer mode
+// - Checking that all of the results are near the host reference, which computes a scaled sum of
+//   squares in double precision with another algorithm
+
+// Exponents of the elements of each profile, which are cycled through along the vectors
+template <typename R>
+std::vector<int> testing_nrm2_mode_exponents(rocblas_int profile, rocblas_int N)
+{
+    constexpr int t    = std::numeric_limits<R>::digits;
+    constexpr int emin = std::numeric_limits<R>::min_exponent;
+    constexpr int emax = std::numeric_limits<R>::max_exponent;
+
+    // The elements are at most 10 times their scale, and the norm must not overflow
+    int log2n = 0;
+    while((int64_t(1) << log2n) < N)
+        log2n++;
+    int huge = emax - 5 - (log2n + 1) / 2;
+    int tiny = emin + 2;
+
+    // Elements above and below the square root of the smallest normal number, whose squares
+    // are both significant in the norm
+    int tsml = (emin - 1) / 2;
+
+    switch(profile)
+    {
+    case 0:
+        return {huge};
+    case 1:
+        return {tiny};
+    case 2:
+        return {huge, 0, tiny};
+    default:
+        return {tsml + 1, tsml - 5 - t / 8};
+    }
+}
+
+template <typename R>
+void testing_nrm2_mode_check(rocblas_int N, rocblas_int batch_count, const R* ref, const R* result)
+{
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        // accounts for rounding in the reduction sum, as in testing_nrm2
+        double tol = 2.0 * N * std::numeric_limits<R>::epsilon() * ref[b];
+        EXPECT_TRUE(std::isfinite(result[b])) << "in batch " << b;
+        EXPECT_NEAR(double(ref[b]), double(result[b]), tol) << "in batch " << b;
+    }
+}
+
+template <typename T>
+void testing_nrm2_mode(const Arguments& arg)
+{
+    using R = real_t<T>;
+
+    rocblas_local_handle handle{arg};
+    rocblas_nrm2_mode    mode;
+
+    // The handle is created in the nrm2 mode of the arguments
+    CHECK_ROCBLAS_ERROR(rocblas_get_nrm2_mode(handle, &mode));
+    EXPECT_EQ(mode, arg.nrm2_mode);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_nrm2_mode(nullptr, rocblas_nrm2_mode_scaled),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_nrm2_mode(nullptr, &mode), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_nrm2_mode(handle, nullptr), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_nrm2_mode(handle, rocblas_nrm2_mode(2)),
+                          rocblas_status_invalid_value);
+    CHECK_ROCBLAS_ERROR(rocblas_get_nrm2_mode(handle, &mode));
+    EXPECT_EQ(mode, arg.nrm2_mode);
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_nrm2_mode(handle, rocblas_nrm2_mode_scaled));
+    CHECK_ROCBLAS_ERROR(rocblas_get_nrm2_mode(handle, &mode));
+    EXPECT_EQ(mode, rocblas_nrm2_mode_scaled);
+
+    rocblas_int N = arg.N, incx = arg.incx, batch_count = arg.batch_count;
+    if(N <= 0 || incx <= 0 || batch_count <= 0)
+        return;
+
+    host_strided_batch_vector<T>   hx(N, incx, size_t(N) * incx, batch_count);
+    device_strided_batch_vector<T> dx(N, incx, size_t(N) * incx, batch_count);
+    device_batch_vector<T>         dbx(N, incx, batch_count);
+    host_batch_vector<T>           hbx(N, incx, batch_count);
+    CHECK_HIP_ERROR(hx.memcheck());
+    CHECK_HIP_ERROR(hbx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dbx.memcheck());
+
+    host_vector<R>   h_ref(batch_count), h_strided(batch_count), h_batched(batch_count);
+    host_vector<R>   h_single(batch_count), h_device(batch_count), h_ex(batch_count);
+    device_vector<R> d_result(batch_count);
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    for(rocblas_int profile = 0; profile < 4; profile++)
+    {
+        SCOPED_TRACE(testing::Message() << "in profile " << profile);
+
+        rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+
+        auto exponents = testing_nrm2_mode_exponents<R>(profile, N);
+        for(rocblas_int b = 0; b < batch_count; b++)
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                R scale = std::ldexp(R(1), exponents[i % exponents.size()]);
+                hx[b][i * incx] *= scale;
+                hbx[b][i * incx] = hx[b][i * incx];
+            }
+
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+        CHECK_HIP_ERROR(dbx.transfer_from(hbx));
+
+        for(rocblas_int b = 0; b < batch_count; b++)
+            h_ref[b] = rocblas_nrm2_scaled_ref::nrm2<T>(N, hx[b], incx);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_nrm2_strided_batched<T>(
+            handle, N, dx, incx, dx.stride(), batch_count, h_strided));
+        CHECK_ROCBLAS_ERROR(rocblas_nrm2_batched<T>(
+            handle, N, dbx.ptr_on_device(), incx, batch_count, h_batched));
+        for(rocblas_int b = 0; b < batch_count; b++)
+            CHECK_ROCBLAS_ERROR(rocblas_nrm2<T>(handle, N, dx[b], incx, &h_single[b]));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_nrm2_strided_batched<T>(
+            handle, N, dx, incx, dx.stride(), batch_count, d_result));
+        CHECK_HIP_ERROR(h_device.transfer_from(d_result));
+        CHECK_ROCBLAS_ERROR(rocblas_nrm2_strided_batched_ex(handle,
+                                                            N,
+                                                            dx,
+                                                            rocblas_type2datatype<T>(),
+                                                            incx,
+                                                            dx.stride(),
+                                                            batch_count,
+                                                            d_result,
+                                                            rocblas_type2datatype<R>(),
+                                                            rocblas_type2datatype<R>()));
+        CHECK_HIP_ERROR(h_ex.transfer_from(d_result));
+
+        testing_nrm2_mode_check<R>(N, batch_count, h_ref, h_strided);
+        testing_nrm2_mode_check<R>(N, batch_count, h_ref, h_batched);
+        testing_nrm2_mode_check<R>(N, batch_count, h_ref, h_single);
+        testing_nrm2_mode_check<R>(N, batch_count, h_ref, h_device);
+        testing_nrm2_mode_check<R>(N, batch_count, h_ref, h_ex);
+    }
+}
@@ -72,8 +72,16 @@ inline void testing_ostream_threadsafety(const Arguments& arg)
 
     rocblas_seedrand();
 
+    // Alternate between synchronous writes and asynchronous writes with a small queue
+    rocblas_log_async_options sync_options, async_options;
+    async_options.enabled    = true;
+    async_options.queue_size = 64;
+    auto old_options         = rocblas_internal_ostream::set_async_options(sync_options);
+
     for(size_t n = 0; n < NTIMES; ++n)
     {
+        rocblas_internal_ostream::set_async_options(n % 2 ? async_options : sync_options);
+
         // Open a file in /tmp
         //char path[] = "/tmp/rocblas-XXXXXX";
         fs::path          path;
@@ -100,6 +108,9 @@ inline void testing_ostream_threadsafety(const Arguments& arg)
         for(auto& t : threads)
             t.join();
 
+        // Wait for asynchronous writes to complete
+        rocblas_internal_ostream::flush_workers();
+
         // Close the original file descriptor
         if(CLOSE(fd))
             FAIL() << "Could not close filehandle for " << path;
@@ -114,7 +125,8 @@ inline void testing_ostream_threadsafety(const Arguments& arg)
 
         // For each line in the file, make sure its signature matches.
         // This detects interleaved IO which causes garbled output.
-        for(std::string line; std::getline(is, line);)
+        size_t nlines = 0;
+        for(std::string line; std::getline(is, line); ++nlines)
         {
             if(!check_sig(line))
             {
@@ -125,11 +137,15 @@ inline void testing_ostream_threadsafety(const Arguments& arg)
 
         is.close();
 
-#ifdef WIN32
-        // need all file descriptors closed to allow file removal on windows before process exits
+        // The block policy does not drop any lines
+        EXPECT_EQ(nlines, NTHREAD * NLINES);
+
+        // Close the workers' file descriptors, so that a later file reusing the inode gets a new
+        // worker, and to allow file removal on windows before process exits
         rocblas_internal_ostream::clear_workers();
-#endif
         // If there were no failures, erase the temporary file
         fs::remove(path);
     }
+
+    rocblas_internal_ostream::set_async_options(old_options);
 }
@@ -0,0 +1,236 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "blas1/rocblas_reproducible_ref.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <cstring>
+
+// Check to see if rocblas_reduction_mode_reproducible is working. This is done by:
+// - Initializing vectors whose values span many binades, so that the order of the additions
+//   changes the sums of the default mode
+// - Calling asum, nrm2, dot and dotc in their strided batched, batched and non-batched forms,
+//   with the vectors and with contiguous copies of them, in host and device pointer mode
+// - Checking that all of the results have the same bits as the host reference, which implements
+//   the same pre-rounded sums on the host
+
+template <typename R>
+void testing_reduction_mode_check(rocblas_int batch_count, const R* expected, const R* result)
+{
+    for(rocblas_int b = 0; b < batch_count; b++)
+        EXPECT_EQ(0, memcmp(expected + b, result + b, sizeof(R))) << "in batch " << b;
+}
+
+template <typename T>
+struct testing_reduction_mode_vectors
+{
+    rocblas_int N, incx, incy, batch_count;
+
+    host_strided_batch_vector<T>   hx, hy;
+    device_strided_batch_vector<T> dx, dy, dx1, dy1;
+    device_batch_vector<T>         dbx, dby;
+
+    testing_reduction_mode_vectors(const Arguments& arg)
+        : N(arg.N)
+        , incx(arg.incx)
+        , incy(arg.incy)
+        , batch_count(arg.batch_count)
+        , hx(N, incx, size_t(N) * incx, batch_count)
+        , hy(N, incy, size_t(N) * incy, batch_count)
+        , dx(N, incx, size_t(N) * incx, batch_count)
+        , dy(N, incy, size_t(N) * incy, batch_count)
+        , dx1(N, 1, N, batch_count)
+        , dy1(N, 1, N, batch_count)
+        , dbx(N, incx, batch_count)
+        , dby(N, incy, batch_count)
+    {
+        CHECK_HIP_ERROR(hx.memcheck());
+        CHECK_HIP_ERROR(hy.memcheck());
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+        CHECK_DEVICE_ALLOCATION(dx1.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy1.memcheck());
+        CHECK_DEVICE_ALLOCATION(dbx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dby.memcheck());
+
+        rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+        rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false, true);
+
+        // Spread the values over 2^-30 to 2^30
+        for(rocblas_int b = 0; b < batch_count; b++)
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                real_t<T> scale = std::ldexp(1.0, int((int64_t(b) * N + i) * 7 % 61) - 30);
+                hx[b][i * incx] *= scale;
+                hy[b][i * incy] /= scale;
+            }
+
+        host_strided_batch_vector<T> hx1(N, 1, N, batch_count);
+        host_strided_batch_vector<T> hy1(N, 1, N, batch_count);
+        host_batch_vector<T>         hbx(N, incx, batch_count);
+        host_batch_vector<T>         hby(N, incy, batch_count);
+        CHECK_HIP_ERROR(hx1.memcheck());
+        CHECK_HIP_ERROR(hy1.memcheck());
+        CHECK_HIP_ERROR(hbx.memcheck());
+        CHECK_HIP_ERROR(hby.memcheck());
+        for(rocblas_int b = 0; b < batch_count; b++)
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                hx1[b][i] = hbx[b][i * incx] = hx[b][i * incx];
+                hy1[b][i] = hby[b][i * incy] = hy[b][i * incy];
+            }
+
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_HIP_ERROR(dx1.transfer_from(hx1));
+        CHECK_HIP_ERROR(dy1.transfer_from(hy1));
+        CHECK_HIP_ERROR(dbx.transfer_from(hbx));
+        CHECK_HIP_ERROR(dby.transfer_from(hby));
+    }
+};
+
+// Results of the strided batched, batched and non-batched forms of a sum in host pointer mode,
+// and of the strided batched form in device pointer mode, compared with the host reference
+template <typename R, typename STRIDED, typename BATCHED, typename SINGLE, typename REF>
+void testing_reduction_mode_sums(rocblas_handle handle,
+                                 rocblas_int    batch_count,
+                                 STRIDED        strided,
+                                 BATCHED        batched,
+                                 SINGLE         single,
+                                 REF            ref)
+{
+    host_vector<R>   h_strided(batch_count), h_batched(batch_count), h_single(batch_count);
+    host_vector<R>   h_inc1(batch_count), h_device(batch_count), h_ref(batch_count);
+    device_vector<R> d_strided(batch_count);
+    CHECK_DEVICE_ALLOCATION(d_strided.memcheck());
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(strided(h_strided));
+    CHECK_ROCBLAS_ERROR(batched(h_batched));
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        CHECK_ROCBLAS_ERROR(single(b, false, &h_single[b]));
+        CHECK_ROCBLAS_ERROR(single(b, true, &h_inc1[b]));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(strided(d_strided));
+    CHECK_HIP_ERROR(h_device.transfer_from(d_strided));
+
+    for(rocblas_int b = 0; b < batch_count; b++)
+        h_ref[b] = ref(b);
+
+    testing_reduction_mode_check<R>(batch_count, h_ref, h_strided);
+    testing_reduction_mode_check<R>(batch_count, h_ref, h_batched);
+    testing_reduction_mode_check<R>(batch_count, h_ref, h_single);
+    testing_reduction_mode_check<R>(batch_count, h_ref, h_inc1);
+    testing_reduction_mode_check<R>(batch_count, h_ref, h_device);
+}
+
+template <typename T, typename STRIDED, typename BATCHED, typename SINGLE, typename REF>
+void testing_reduction_mode_norm(rocblas_handle                     handle,
+                                 testing_reduction_mode_vectors<T>& v,
+                                 STRIDED                            strided_fn,
+                                 BATCHED                            batched_fn,
+                                 SINGLE                             single_fn,
+                                 REF                                ref_fn)
+{
+    rocblas_int N = v.N, incx = v.incx, batch_count = v.batch_count;
+    testing_reduction_mode_sums<real_t<T>>(
+        handle,
+        batch_count,
+        [&](real_t<T>* r) {
+            return strided_fn(handle, N, v.dx, incx, v.dx.stride(), batch_count, r);
+        },
+        [&](real_t<T>* r) {
+            return batched_fn(handle, N, v.dbx.ptr_on_device(), incx, batch_count, r);
+        },
+        [&](rocblas_int b, bool inc1, real_t<T>* r) {
+            return inc1 ? single_fn(handle, N, v.dx1[b], 1, r)
+                        : single_fn(handle, N, v.dx[b], incx, r);
+        },
+        [&](rocblas_int b) { return ref_fn(N, v.hx[b], incx); });
+}
+
+template <typename T, typename STRIDED, typename BATCHED, typename SINGLE, typename REF>
+void testing_reduction_mode_dot(rocblas_handle                     handle,
+                                testing_reduction_mode_vectors<T>& v,
+                                STRIDED                            strided_fn,
+                                BATCHED                            batched_fn,
+                                SINGLE                             single_fn,
+                                REF                                ref_fn)
+{
+    rocblas_int N = v.N, incx = v.incx, incy = v.incy, batch_count = v.batch_count;
+    testing_reduction_mode_sums<T>(
+        handle,
+        batch_count,
+        [&](T* r) {
+            return strided_fn(
+                handle, N, v.dx, incx, v.dx.stride(), v.dy, incy, v.dy.stride(), batch_count, r);
+        },
+        [&](T* r) {
+            return batched_fn(handle,
+                              N,
+                              v.dbx.ptr_on_device(),
+                              incx,
+                              v.dby.ptr_on_device(),
+                              incy,
+                              batch_count,
+                              r);
+        },
+        [&](rocblas_int b, bool inc1, T* r) {
+            return inc1 ? single_fn(handle, N, v.dx1[b], 1, v.dy1[b], 1, r)
+                        : single_fn(handle, N, v.dx[b], incx, v.dy[b], incy, r);
+        },
+        [&](rocblas_int b) { return ref_fn(N, v.hx[b], incx, v.hy[b], incy); });
+}
+
+template <typename T>
+void testing_reduction_mode(const Arguments& arg)
+{
+    if(arg.N <= 0 || arg.incx <= 0 || arg.incy <= 0 || arg.batch_count <= 0)
+        return;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_reduction_mode(handle, rocblas_reduction_mode_reproducible));
+
+    testing_reduction_mode_vectors<T> v(arg);
+
+    testing_reduction_mode_norm(handle,
+                                v,
+                                rocblas_asum_strided_batched<T>,
+                                rocblas_asum_batched<T>,
+                                rocblas_asum<T>,
+                                rocblas_reproducible_ref::asum<T>);
+
+    testing_reduction_mode_norm(handle,
+                                v,
+                                rocblas_nrm2_strided_batched<T>,
+                                rocblas_nrm2_batched<T>,
+                                rocblas_nrm2<T>,
+                                rocblas_reproducible_ref::nrm2<T>);
+
+    testing_reduction_mode_dot(handle,
+                               v,
+                               rocblas_dot_strided_batched<T>,
+                               rocblas_dot_batched<T>,
+                               rocblas_dot<T>,
+                               rocblas_reproducible_ref::dot<T>);
+
+    if constexpr(is_complex<T>)
+        testing_reduction_mode_dot(handle,
+                                   v,
+                                   rocblas_dotc_strided_batched<T>,
+                                   rocblas_dotc_batched<T>,
+                                   rocblas_dotc<T>,
+                                   rocblas_reproducible_ref::dotc<T>);
+}
@@ -0,0 +1,244 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// Check to see if rocblas_result_mode_deferred is working. This is done by:
+// - Checking the arguments of the result mode functions, and that quick returns are not deferred
+// - Calling asum, nrm2, iamax and iamin in their strided batched, batched and non-batched forms,
+//   in host pointer mode, first in blocking mode and then in deferred mode
+// - Checking that the result pointers of the deferred calls are not written, and collecting all
+//   of the deferred results after the last call, where they must match the blocking results
+// - Deferring more results than the handle keeps, and checking that the oldest one is lost
+
+// The number of deferred results kept by a handle
+constexpr rocblas_result_token testing_result_mode_kept = 64;
+
+// Results of a reduction in blocking mode, and the token of the same reduction in deferred mode
+template <typename R>
+struct testing_result_mode_pending
+{
+    std::vector<R>       expected;
+    rocblas_result_token token;
+};
+
+template <typename R, typename FN>
+testing_result_mode_pending<R>
+    testing_result_mode_defer(rocblas_handle handle, rocblas_int batch_count, FN fn)
+{
+    testing_result_mode_pending<R> pending{std::vector<R>(batch_count), 0};
+    rocblas_result_token           token;
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_result_mode(handle, rocblas_result_mode_blocking));
+    CHECK_ROCBLAS_ERROR(fn(pending.expected.data()));
+    CHECK_ROCBLAS_ERROR(rocblas_get_result_token(handle, &token));
+    EXPECT_EQ(token, rocblas_result_token(0));
+
+    // The result pointer of a deferred call is not written
+    std::vector<R> untouched(batch_count, R(-1));
+    CHECK_ROCBLAS_ERROR(rocblas_set_result_mode(handle, rocblas_result_mode_deferred));
+    CHECK_ROCBLAS_ERROR(fn(untouched.data()));
+    CHECK_ROCBLAS_ERROR(rocblas_get_result_token(handle, &pending.token));
+    EXPECT_NE(pending.token, rocblas_result_token(0));
+    for(rocblas_int b = 0; b < batch_count; b++)
+        EXPECT_EQ(untouched[b], R(-1)) << "in batch " << b;
+
+    return pending;
+}
+
+// The deferred results must match the blocking results, within a relative tolerance of tol,
+// which is 0 for the results which are computed in the same way in both modes
+template <typename R>
+void testing_result_mode_collect(rocblas_handle                                     handle,
+                                 const std::vector<testing_result_mode_pending<R>>& pending,
+                                 double                                             tol)
+{
+    for(const auto& p : pending)
+    {
+        std::vector<R> result(p.expected.size());
+        CHECK_ROCBLAS_ERROR(rocblas_get_result(handle, p.token, result.data()));
+        for(size_t b = 0; b < result.size(); b++)
+        {
+            if(tol)
+                EXPECT_NEAR(double(p.expected[b]),
+                            double(result[b]),
+                            tol * std::abs(double(p.expected[b])))
+                    << "in batch " << b;
+            else
+                EXPECT_EQ(p.expected[b], result[b]) << "in batch " << b;
+        }
+    }
+}
+
+template <typename T>
+struct testing_result_mode_vectors
+{
+    rocblas_int N, incx, batch_count;
+
+    host_strided_batch_vector<T>   hx;
+    device_strided_batch_vector<T> dx;
+    device_batch_vector<T>         dbx;
+
+    testing_result_mode_vectors(const Arguments& arg)
+        : N(arg.N)
+        , incx(arg.incx)
+        , batch_count(arg.batch_count)
+        , hx(N, incx, size_t(N) * incx, batch_count)
+        , dx(N, incx, size_t(N) * incx, batch_count)
+        , dbx(N, incx, batch_count)
+    {
+        CHECK_HIP_ERROR(hx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dbx.memcheck());
+
+        rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+
+        host_batch_vector<T> hbx(N, incx, batch_count);
+        CHECK_HIP_ERROR(hbx.memcheck());
+        for(rocblas_int b = 0; b < batch_count; b++)
+            for(rocblas_int i = 0; i < N; i++)
+                hbx[b][i * incx] = hx[b][i * incx];
+
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+        CHECK_HIP_ERROR(dbx.transfer_from(hbx));
+    }
+};
+
+// Defer the results of the strided batched, batched and non-batched forms of a reduction
+template <typename R, typename T, typename STRIDED, typename BATCHED, typename SINGLE>
+void testing_result_mode_reduction(rocblas_handle                               handle,
+                                   testing_result_mode_vectors<T>&              v,
+                                   STRIDED                                      strided_fn,
+                                   BATCHED                                      batched_fn,
+                                   SINGLE                                       single_fn,
+                                   std::vector<testing_result_mode_pending<R>>& pending)
+{
+    rocblas_int N = v.N, incx = v.incx, batch_count = v.batch_count;
+
+    pending.push_back(testing_result_mode_defer<R>(handle, batch_count, [&](R* r) {
+        return strided_fn(handle, N, v.dx, incx, v.dx.stride(), batch_count, r);
+    }));
+    pending.push_back(testing_result_mode_defer<R>(handle, batch_count, [&](R* r) {
+        return batched_fn(handle, N, v.dbx.ptr_on_device(), incx, batch_count, r);
+    }));
+    for(rocblas_int b = 0; b < batch_count; b++)
+        pending.push_back(testing_result_mode_defer<R>(
+            handle, 1, [&](R* r) { return single_fn(handle, N, v.dx[b], incx, r); }));
+}
+
+template <typename T>
+void testing_result_mode(const Arguments& arg)
+{
+    using R = real_t<T>;
+
+    rocblas_local_handle handle{arg};
+    rocblas_result_mode  mode;
+    rocblas_result_token token;
+    R                    h_result = 1;
+
+    // The default mode is blocking, and no result has been deferred
+    CHECK_ROCBLAS_ERROR(rocblas_get_result_mode(handle, &mode));
+    EXPECT_EQ(mode, rocblas_result_mode_blocking);
+    CHECK_ROCBLAS_ERROR(rocblas_get_result_token(handle, &token));
+    EXPECT_EQ(token, rocblas_result_token(0));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_result_mode(nullptr, rocblas_result_mode_deferred),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_result_mode(nullptr, &mode), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_result_mode(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_result_token(nullptr, &token),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_result_token(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_result(nullptr, 1, &h_result),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_result(handle, 1, nullptr), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_result(handle, 0, &h_result), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_result(handle, 1, &h_result), rocblas_status_invalid_value);
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_result_mode(handle, rocblas_result_mode_deferred));
+    CHECK_ROCBLAS_ERROR(rocblas_get_result_mode(handle, &mode));
+    EXPECT_EQ(mode, rocblas_result_mode_deferred);
+
+    // Quick returns write the result pointer and are not deferred
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_asum<T>(handle, 0, nullptr, 1, &h_result));
+    EXPECT_EQ(h_result, R(0));
+    CHECK_ROCBLAS_ERROR(rocblas_get_result_token(handle, &token));
+    EXPECT_EQ(token, rocblas_result_token(0));
+
+    if(arg.N <= 0 || arg.incx <= 0 || arg.batch_count <= 0)
+        return;
+
+    testing_result_mode_vectors<T> v(arg);
+
+    // All of the results are collected after the last reduction
+    std::vector<testing_result_mode_pending<R>>           pending_sums, pending_norms;
+    std::vector<testing_result_mode_pending<rocblas_int>> pending_index;
+
+    testing_result_mode_reduction(handle,
+                                  v,
+                                  rocblas_asum_strided_batched<T>,
+                                  rocblas_asum_batched<T>,
+                                  rocblas_asum<T>,
+                                  pending_sums);
+
+    testing_result_mode_reduction(handle,
+                                  v,
+                                  rocblas_nrm2_strided_batched<T>,
+                                  rocblas_nrm2_batched<T>,
+                                  rocblas_nrm2<T>,
+                                  pending_norms);
+
+    testing_result_mode_reduction(handle,
+                                  v,
+                                  rocblas_iamax_strided_batched<T>,
+                                  rocblas_iamax_batched<T>,
+                                  rocblas_iamax<T>,
+                                  pending_index);
+
+    testing_result_mode_reduction(handle,
+                                  v,
+                                  rocblas_iamin_strided_batched<T>,
+                                  rocblas_iamin_batched<T>,
+                                  rocblas_iamin<T>,
+                                  pending_index);
+
+    // The square root of nrm2 may be computed on the host in blocking mode, and is always
+    // computed on the device in deferred mode
+    testing_result_mode_collect(handle, pending_sums, 0);
+    testing_result_mode_collect(handle, pending_norms, 2 * std::numeric_limits<R>::epsilon());
+    testing_result_mode_collect(handle, pending_index, 0);
+
+    // Once more results are deferred than the handle keeps, the oldest one is lost
+    rocblas_result_token first = 0;
+    for(rocblas_result_token i = 0; i <= testing_result_mode_kept; i++)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_asum<T>(handle, v.N, v.dx, v.incx, &h_result));
+        CHECK_ROCBLAS_ERROR(rocblas_get_result_token(handle, &token));
+        if(!i)
+            first = token;
+    }
+    EXPECT_EQ(token, first + testing_result_mode_kept);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_result(handle, first, &h_result),
+                          rocblas_status_invalid_value);
+    CHECK_ROCBLAS_ERROR(rocblas_get_result(handle, token, &h_result));
+
+    // The asum of the first batch in the non-batched form follows the strided batched and
+    // batched forms
+    EXPECT_EQ(h_result, pending_sums[2].expected[0]);
+}
@@ -6,85 +6,25 @@
 /* ========================================Gtest Unit Check
  * ==================================================== */
 
-/*! \brief gtest unit compare two matrices float/double/complex */
+/*! \brief gtest unit compare two matrices float/double/complex; any mismatches are reported in
+ *         one failure */
 
 #pragma once
 
+#include "check_compare.hpp"
 #include "rocblas.h"
 #include "rocblas_math.hpp"
 #include "rocblas_test.hpp"
 #include "rocblas_vector.hpp"
 
 #ifndef GOOGLE_TEST
-#define UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, UNIT_ASSERT_EQ)
-#define UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, UNIT_ASSERT_EQ)
+#define UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, EQ)
+#define UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, EQ)
 #else
-#define UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, UNIT_ASSERT_EQ)              \
-    do                                                                                       \
-    {                                                                                        \
-        for(size_t k = 0; k < batch_count; k++)                                              \
-            for(size_t j = 0; j < N; j++)                                                    \
-                for(size_t i = 0; i < M; i++)                                                \
-                    if(rocblas_isnan(hCPU[i + j * size_t(lda) + k * strideA]))               \
-                    {                                                                        \
-                        ASSERT_TRUE(rocblas_isnan(hGPU[i + j * size_t(lda) + k * strideA])); \
-                    }                                                                        \
-                    else                                                                     \
-                    {                                                                        \
-                        UNIT_ASSERT_EQ(hCPU[i + j * size_t(lda) + k * strideA],              \
-                                       hGPU[i + j * size_t(lda) + k * strideA]);             \
-                    }                                                                        \
-    } while(0)
-
-#define UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, UNIT_ASSERT_EQ)          \
-    do                                                                            \
-    {                                                                             \
-        for(size_t k = 0; k < batch_count; k++)                                   \
-            for(size_t j = 0; j < N; j++)                                         \
-                for(size_t i = 0; i < M; i++)                                     \
-                    if(rocblas_isnan(hCPU[k][i + j * size_t(lda)]))               \
-                    {                                                             \
-                        ASSERT_TRUE(rocblas_isnan(hGPU[k][i + j * size_t(lda)])); \
-                    }                                                             \
-                    else                                                          \
-                    {                                                             \
-                        UNIT_ASSERT_EQ(hCPU[k][i + j * size_t(lda)],              \
-                                       hGPU[k][i + j * size_t(lda)]);             \
-                    }                                                             \
-    } while(0)
-
-#define ASSERT_HALF_EQ(a, b) ASSERT_FLOAT_EQ(float(a), float(b))
-#define ASSERT_BF16_EQ(a, b) ASSERT_FLOAT_EQ(float(a), float(b))
-
-// Compare float to rocblas_bfloat16
-// Allow the rocblas_bfloat16 to match the rounded or truncated value of float
-// Only call ASSERT_FLOAT_EQ with the rounded value if the truncated value does not match
-#include <gtest/internal/gtest-internal.h>
-#define ASSERT_FLOAT_BF16_EQ(a, b)                                                     \
-    do                                                                                 \
-    {                                                                                  \
-        using testing::internal::FloatingPoint;                                        \
-        if(!FloatingPoint<float>(b).AlmostEquals(                                      \
-               FloatingPoint<float>(rocblas_bfloat16(a, rocblas_bfloat16::truncate)))) \
-            ASSERT_FLOAT_EQ(b, rocblas_bfloat16(a));                                   \
-    } while(0)
-
-#define ASSERT_FLOAT_COMPLEX_EQ(a, b)                  \
-    do                                                 \
-    {                                                  \
-        auto ta = (a), tb = (b);                       \
-        ASSERT_FLOAT_EQ(std::real(ta), std::real(tb)); \
-        ASSERT_FLOAT_EQ(std::imag(ta), std::imag(tb)); \
-    } while(0)
-
-#define ASSERT_DOUBLE_COMPLEX_EQ(a, b)                  \
-    do                                                  \
-    {                                                   \
-        auto ta = (a), tb = (b);                        \
-        ASSERT_DOUBLE_EQ(std::real(ta), std::real(tb)); \
-        ASSERT_DOUBLE_EQ(std::imag(ta), std::imag(tb)); \
-    } while(0)
-
+#define UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, EQ) \
+    CHECK_COMPARE(M, N, lda, strideA, hCPU, hGPU, batch_count, EQ)
+#define UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, EQ) \
+    CHECK_COMPARE_B(M, N, lda, hCPU, hGPU, batch_count, EQ)
 #endif // GOOGLE_TEST
 
 // TODO: Replace std::remove_cv_t with std::type_identity_t in C++20
@@ -103,14 +43,14 @@ inline void unit_check_general(rocblas_int             M,
                                const rocblas_bfloat16* hCPU,
                                const rocblas_bfloat16* hGPU)
 {
-    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, ASSERT_BF16_EQ);
+    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, check_ulps<float>{});
 }
 
 template <>
 inline void unit_check_general<rocblas_bfloat16, float>(
     rocblas_int M, rocblas_int N, rocblas_int lda, const float* hCPU, const rocblas_bfloat16* hGPU)
 {
-    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, ASSERT_FLOAT_BF16_EQ);
+    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, check_bf16_rounding{});
 }
 
 template <>
@@ -120,21 +60,21 @@ inline void unit_check_general(rocblas_int         M,
                                const rocblas_half* hCPU,
                                const rocblas_half* hGPU)
 {
-    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, ASSERT_HALF_EQ);
+    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, check_ulps<float>{});
 }
 
 template <>
 inline void unit_check_general(
     rocblas_int M, rocblas_int N, rocblas_int lda, const float* hCPU, const float* hGPU)
 {
-    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, ASSERT_FLOAT_EQ);
+    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, check_ulps<float>{});
 }
 
 template <>
 inline void unit_check_general(
     rocblas_int M, rocblas_int N, rocblas_int lda, const double* hCPU, const double* hGPU)
 {
-    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, ASSERT_DOUBLE_EQ);
+    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, check_ulps<double>{});
 }
 
 template <>
@@ -144,7 +84,7 @@ inline void unit_check_general(rocblas_int                  M,
                                const rocblas_float_complex* hCPU,
                                const rocblas_float_complex* hGPU)
 {
-    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, ASSERT_FLOAT_COMPLEX_EQ);
+    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, check_ulps<float>{});
 }
 
 template <>
@@ -154,14 +94,21 @@ inline void unit_check_general(rocblas_int                   M,
                                const rocblas_double_complex* hCPU,
                                const rocblas_double_complex* hGPU)
 {
-    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, ASSERT_DOUBLE_COMPLEX_EQ);
+    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, check_ulps<double>{});
 }
 
 template <>
 inline void unit_check_general(
     rocblas_int M, rocblas_int N, rocblas_int lda, const rocblas_int* hCPU, const rocblas_int* hGPU)
 {
-    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, ASSERT_EQ);
+    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, check_exact{});
+}
+
+template <>
+inline void unit_check_general(
+    rocblas_int M, rocblas_int N, rocblas_int lda, const int64_t* hCPU, const int64_t* hGPU)
+{
+    UNIT_CHECK(M, N, lda, 0, hCPU, hGPU, 1, check_exact{});
 }
 
 template <typename T, typename T_hpa = T>
@@ -182,7 +129,7 @@ inline void unit_check_general(rocblas_int             M,
                                const rocblas_bfloat16* hGPU,
                                rocblas_int             batch_count)
 {
-    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, ASSERT_BF16_EQ);
+    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, check_ulps<float>{});
 }
 
 template <>
@@ -194,7 +141,7 @@ inline void unit_check_general<rocblas_bfloat16, float>(rocblas_int
                                                         const rocblas_bfloat16* hGPU,
                                                         rocblas_int             batch_count)
 {
-    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, ASSERT_FLOAT_BF16_EQ);
+    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, check_bf16_rounding{});
 }
 
 template <>
@@ -206,7 +153,7 @@ inline void unit_check_general(rocblas_int         M,
                                const rocblas_half* hGPU,
                                rocblas_int         batch_count)
 {
-    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, ASSERT_HALF_EQ);
+    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, check_ulps<float>{});
 }
 
 template <>
@@ -218,7 +165,7 @@ inline void unit_check_general(rocblas_int    M,
                                const float*   hGPU,
                                rocblas_int    batch_count)
 {
-    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, ASSERT_FLOAT_EQ);
+    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, check_ulps<float>{});
 }
 
 template <>
@@ -230,7 +177,7 @@ inline void unit_check_general(rocblas_int    M,
                                const double*  hGPU,
                                rocblas_int    batch_count)
 {
-    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, ASSERT_DOUBLE_EQ);
+    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, check_ulps<double>{});
 }
 
 template <>
@@ -242,7 +189,7 @@ inline void unit_check_general(rocblas_int                  M,
                                const rocblas_float_complex* hGPU,
                                rocblas_int                  batch_count)
 {
-    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, ASSERT_FLOAT_COMPLEX_EQ);
+    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, check_ulps<float>{});
 }
 
 template <>
@@ -254,7 +201,7 @@ inline void unit_check_general(rocblas_int                   M,
                                const rocblas_double_complex* hGPU,
                                rocblas_int                   batch_count)
 {
-    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, ASSERT_DOUBLE_COMPLEX_EQ);
+    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, check_ulps<double>{});
 }
 
 template <>
@@ -266,7 +213,7 @@ inline void unit_check_general(rocblas_int        M,
                                const rocblas_int* hGPU,
                                rocblas_int        batch_count)
 {
-    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, ASSERT_EQ);
+    UNIT_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, check_exact{});
 }
 
 template <typename T, typename T_hpa = T>
@@ -285,7 +232,7 @@ inline void unit_check_general(rocblas_int                         M,
                                const host_vector<rocblas_bfloat16> hGPU[],
                                rocblas_int                         batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_BF16_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_ulps<float>{});
 }
 
 template <>
@@ -296,7 +243,7 @@ inline void unit_check_general<rocblas_bfloat16, float>(rocblas_int
                                                         const host_vector<rocblas_bfloat16> hGPU[],
                                                         rocblas_int batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_FLOAT_BF16_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_bf16_rounding{});
 }
 
 template <>
@@ -307,7 +254,7 @@ inline void unit_check_general(rocblas_int                     M,
                                const host_vector<rocblas_half> hGPU[],
                                rocblas_int                     batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_HALF_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_ulps<float>{});
 }
 
 template <>
@@ -318,7 +265,7 @@ inline void unit_check_general(rocblas_int            M,
                                const host_vector<int> hGPU[],
                                rocblas_int            batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_exact{});
 }
 
 template <>
@@ -329,7 +276,7 @@ inline void unit_check_general(rocblas_int              M,
                                const host_vector<float> hGPU[],
                                rocblas_int              batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_FLOAT_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_ulps<float>{});
 }
 
 template <>
@@ -340,7 +287,7 @@ inline void unit_check_general(rocblas_int               M,
                                const host_vector<double> hGPU[],
                                rocblas_int               batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_DOUBLE_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_ulps<double>{});
 }
 
 template <>
@@ -351,7 +298,7 @@ inline void unit_check_general(rocblas_int                              M,
                                const host_vector<rocblas_float_complex> hGPU[],
                                rocblas_int                              batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_FLOAT_COMPLEX_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_ulps<float>{});
 }
 
 template <>
@@ -362,7 +309,7 @@ inline void unit_check_general(rocblas_int                               M,
                                const host_vector<rocblas_double_complex> hGPU[],
                                rocblas_int                               batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_DOUBLE_COMPLEX_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_ulps<double>{});
 }
 
 template <typename T, typename T_hpa = T>
@@ -381,7 +328,7 @@ inline void unit_check_general(rocblas_int                   M,
                                const rocblas_bfloat16* const hGPU[],
                                rocblas_int                   batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_BF16_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_ulps<float>{});
 }
 
 template <>
@@ -392,7 +339,7 @@ inline void unit_check_general<rocblas_bfloat16, float>(rocblas_int
                                                         const rocblas_bfloat16* const hGPU[],
                                                         rocblas_int                   batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_FLOAT_BF16_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_bf16_rounding{});
 }
 
 template <>
@@ -403,7 +350,7 @@ inline void unit_check_general(rocblas_int               M,
                                const rocblas_half* const hGPU[],
                                rocblas_int               batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_HALF_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_ulps<float>{});
 }
 
 template <>
@@ -414,7 +361,7 @@ inline void unit_check_general(rocblas_int      M,
                                const int* const hGPU[],
                                rocblas_int      batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_exact{});
 }
 
 template <>
@@ -425,7 +372,7 @@ inline void unit_check_general(rocblas_int        M,
                                const float* const hGPU[],
                                rocblas_int        batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_FLOAT_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_ulps<float>{});
 }
 
 template <>
@@ -436,7 +383,7 @@ inline void unit_check_general(rocblas_int         M,
                                const double* const hGPU[],
                                rocblas_int         batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_DOUBLE_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_ulps<double>{});
 }
 
 template <>
@@ -447,7 +394,7 @@ inline void unit_check_general(rocblas_int                        M,
                                const rocblas_float_complex* const hGPU[],
                                rocblas_int                        batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_FLOAT_COMPLEX_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_ulps<float>{});
 }
 
 template <>
@@ -458,7 +405,7 @@ inline void unit_check_general(rocblas_int                         M,
                                const rocblas_double_complex* const hGPU[],
                                rocblas_int                         batch_count)
 {
-    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, ASSERT_DOUBLE_COMPLEX_EQ);
+    UNIT_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, check_ulps<double>{});
 }
 
 template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
@@ -51,6 +51,106 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_atomics_mode(rocblas_handle       hand
 ROCBLAS_EXPORT rocblas_status rocblas_get_atomics_mode(rocblas_handle        handle,
                                                        rocblas_atomics_mode* atomics_mode);
 
+/*! \brief set rocblas_reduction_mode
+    \details
+    Selects how the sums of the asum, nrm2 and dot families of functions, including their
+    _batched, _strided_batched, _ex and _64 variants, are accumulated. In
+    rocblas_reduction_mode_reproducible, the results are bitwise reproducible from run to run,
+    between batched and non-batched calls and across devices. Reproducible sums read the
+    vectors twice and use more workspace, so they are slower than the default sums. The _64
+    variants sum the results of their chunks of 2^30 elements on the host, so their results are
+    reproducible from run to run, but may differ from the results of the other variants.
+    The mode is used by the API functions only; the rocblas_internal_* templates always use
+    the default sums.
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_reduction_mode(rocblas_handle         handle,
+                                                         rocblas_reduction_mode reduction_mode);
+
+/*! \brief get rocblas_reduction_mode
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_reduction_mode(rocblas_handle          handle,
+                                                         rocblas_reduction_mode* reduction_mode);
+
+/*! \brief set rocblas_nrm2_mode
+    \details
+    Selects how the nrm2 family of functions, including their _batched, _strided_batched, _ex
+    and _64 variants, accumulate the squares of the elements with float and double execution
+    types. In rocblas_nrm2_mode_scaled, the squares of the small, medium and big elements are
+    accumulated separately after scaling them by powers of 2, with the algorithm of Blue which is
+    used by LAPACK 3.10, so that the norm is computed in one pass without overflow or underflow
+    for any finite elements. The partial sums of the blocks use three times the workspace of the
+    default mode. rocblas_reduction_mode_reproducible takes precedence over this mode.
+    The mode is used by the API functions only; the rocblas_internal_* templates always use
+    the default mode, so that the workspace sized by their callers suffices. Returns
+    rocblas_status_invalid_value if nrm2_mode is not a rocblas_nrm2_mode.
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_nrm2_mode(rocblas_handle    handle,
+                                                    rocblas_nrm2_mode nrm2_mode);
+
+/*! \brief get rocblas_nrm2_mode
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_nrm2_mode(rocblas_handle     handle,
+                                                    rocblas_nrm2_mode* nrm2_mode);
+
+/*! \brief set rocblas_result_mode
+    \details
+    Selects how the asum, nrm2, iamax and iamin families of functions, including their
+    _batched, _strided_batched and _ex variants, return their results in host pointer mode.
+    In rocblas_result_mode_deferred, the results are copied asynchronously into a ring of
+    pinned host buffers of the handle, and the functions return without waiting for the
+    device. The result pointer is not written. Instead, the result is identified by the token
+    returned by rocblas_get_result_token, and is collected with rocblas_get_result.
+
+    Results which are computed before the function returns are still written to the result
+    pointer, and their token is 0. This is the case when n, incx or batch_count is not positive,
+    for the _64 variants, and in rocblas_reduction_mode_reproducible. The results of other
+    functions, and of calls in device pointer mode, are not affected by the result mode.
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_result_mode(rocblas_handle      handle,
+                                                      rocblas_result_mode result_mode);
+
+/*! \brief get rocblas_result_mode
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_result_mode(rocblas_handle       handle,
+                                                      rocblas_result_mode* result_mode);
+
+/*! \brief get the token of the last deferred result
+    \details
+    Returns the token of the result of the last call to asum, nrm2, iamax or iamin, or one of
+    their variants, made with the handle. The token is 0 if that result was written to the
+    result pointer before the call returned, or if no such call has been made.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of the call
+    @param[out]
+    token       pointer to the rocblas_result_token of the result
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_result_token(rocblas_handle        handle,
+                                                       rocblas_result_token* token);
+
+/*! \brief collect a deferred result
+    \details
+    Waits for the copy of a deferred result to the host to complete, and writes the result to
+    result. result must be large enough to hold the results of all of the batches of the call
+    which deferred it, in the type of the result pointer of that call. A result can be collected
+    any number of times while it is kept by the handle. The handle keeps the 64 most recent
+    deferred results, so a result must be collected before 64 more results are deferred with
+    the same handle.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of the call which deferred the result
+    @param[in]
+    token       [rocblas_result_token]
+                the token of the result, returned by rocblas_get_result_token
+    @param[out]
+    result      pointer to host memory for the result
+    @return     rocblas_status_invalid_value if the token does not identify a result kept by
+                the handle
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_result(rocblas_handle       handle,
+                                                 rocblas_result_token token,
+                                                 void*                result);
+
 /*! \brief query the preferable supported int8 input layout for gemm
      \details
     Indicates the supported int8 input layout for gemm according to the device.
@@ -356,6 +456,29 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_performance_metric(rocblas_handle
 ROCBLAS_EXPORT rocblas_status rocblas_get_performance_metric(rocblas_handle              handle,
                                                              rocblas_performance_metric* metric);
 
+/*! \brief returns the Tensile solution cache statistics of a handle
+     \details
+    Returns the number of gemm calls made with the handle whose Tensile solution was found in
+    the solution cache (hits), and the number of calls for which solution selection had to be
+    performed (misses). The solution cache is shared by all handles on a device; its maximum
+    number of entries is set with the ROCBLAS_TENSILE_SOLUTION_CACHE_SIZE environment variable,
+    and a size of 0 disables it.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[out]
+    hits        pointer to where the number of cache hits will be stored
+    @param[out]
+    misses      pointer to where the number of cache misses will be stored
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_solution_cache_stats(rocblas_handle handle,
+                                                               size_t*        hits,
+                                                               size_t*        misses);
+
+/*! \brief resets the Tensile solution cache statistics of a handle to zero
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_reset_solution_cache_stats(rocblas_handle handle);
+
 #ifdef __cplusplus
 }
 #endif
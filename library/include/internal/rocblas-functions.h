@@ -114,6 +114,58 @@ ROCBLAS_EXPORT rocblas_status rocblas_zdscal(rocblas_handle          handle,
                                              rocblas_int             incx);
 //! @}
 
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    scal_64 is the ILP64 interface of scal: n and incx are int64_t, so that vector x may
+    have 2^31 or more elements.
+
+    scal  scales each element of vector x with scalar alpha.
+
+        x := alpha * x
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [int64_t]
+              the number of elements in x.
+    @param[in]
+    alpha     device pointer or host pointer for the scalar alpha.
+    @param[inout]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int64_t]
+              specifies the increment for the elements of x.
+
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sscal_64(
+    rocblas_handle handle, int64_t n, const float* alpha, float* x, int64_t incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dscal_64(
+    rocblas_handle handle, int64_t n, const double* alpha, double* x, int64_t incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cscal_64(rocblas_handle               handle,
+                                               int64_t                      n,
+                                               const rocblas_float_complex* alpha,
+                                               rocblas_float_complex*       x,
+                                               int64_t                      incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zscal_64(rocblas_handle                handle,
+                                               int64_t                       n,
+                                               const rocblas_double_complex* alpha,
+                                               rocblas_double_complex*       x,
+                                               int64_t                       incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csscal_64(
+    rocblas_handle handle, int64_t n, const float* alpha, rocblas_float_complex* x, int64_t incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdscal_64(
+    rocblas_handle handle, int64_t n, const double* alpha, rocblas_double_complex* x, int64_t incx);
+//! @}
+
 /*! @{
     \brief <b> BLAS Level 1 API </b>
 
@@ -319,6 +371,56 @@ ROCBLAS_EXPORT rocblas_status rocblas_zcopy(rocblas_handle                handle
                                             rocblas_int                   incy);
 //! @}
 
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    copy_64 is the ILP64 interface of copy: n, incx and incy are int64_t, so that vectors
+    x and y may have 2^31 or more elements.
+
+    copy  copies each element x[i] into y[i], for  i = 1 , ... , n
+
+        y := x
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [int64_t]
+              the number of elements in x to be copied to y.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int64_t]
+              specifies the increment for the elements of x.
+    @param[out]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [int64_t]
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_scopy_64(
+    rocblas_handle handle, int64_t n, const float* x, int64_t incx, float* y, int64_t incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dcopy_64(
+    rocblas_handle handle, int64_t n, const double* x, int64_t incx, double* y, int64_t incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ccopy_64(rocblas_handle               handle,
+                                               int64_t                      n,
+                                               const rocblas_float_complex* x,
+                                               int64_t                      incx,
+                                               rocblas_float_complex*       y,
+                                               int64_t                      incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zcopy_64(rocblas_handle                handle,
+                                               int64_t                       n,
+                                               const rocblas_double_complex* x,
+                                               int64_t                       incx,
+                                               rocblas_double_complex*       y,
+                                               int64_t                       incy);
+//! @}
+
 /*! @{
     \brief <b> BLAS Level 1 API </b>
 
@@ -566,6 +668,108 @@ ROCBLAS_EXPORT rocblas_status rocblas_zdotc(rocblas_handle                handle
                                             rocblas_double_complex*       result);
 //! @}
 
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    dot_64, dotu_64 and dotc_64 are the ILP64 interfaces of dot, dotu and dotc: n, incx
+    and incy are int64_t, so that vectors x and y may have 2^31 or more elements.
+
+    dot(u)  performs the dot product of vectors x and y
+
+        result = x * y;
+
+    dotc  performs the dot product of the conjugate of complex vector x and complex vector y
+
+        result = conjugate (x) * y;
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [int64_t]
+              the number of elements in x and y.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int64_t]
+              specifies the increment for the elements of y.
+    @param[in]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [int64_t]
+              specifies the increment for the elements of y.
+    @param[inout]
+    result
+              device pointer or host pointer to store the dot product.
+              return is 0.0 if n <= 0.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sdot_64(rocblas_handle handle,
+                                              int64_t        n,
+                                              const float*   x,
+                                              int64_t        incx,
+                                              const float*   y,
+                                              int64_t        incy,
+                                              float*         result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot_64(rocblas_handle handle,
+                                              int64_t        n,
+                                              const double*  x,
+                                              int64_t        incx,
+                                              const double*  y,
+                                              int64_t        incy,
+                                              double*        result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_hdot_64(rocblas_handle      handle,
+                                              int64_t             n,
+                                              const rocblas_half* x,
+                                              int64_t             incx,
+                                              const rocblas_half* y,
+                                              int64_t             incy,
+                                              rocblas_half*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_bfdot_64(rocblas_handle          handle,
+                                               int64_t                 n,
+                                               const rocblas_bfloat16* x,
+                                               int64_t                 incx,
+                                               const rocblas_bfloat16* y,
+                                               int64_t                 incy,
+                                               rocblas_bfloat16*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdotu_64(rocblas_handle               handle,
+                                               int64_t                      n,
+                                               const rocblas_float_complex* x,
+                                               int64_t                      incx,
+                                               const rocblas_float_complex* y,
+                                               int64_t                      incy,
+                                               rocblas_float_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdotu_64(rocblas_handle                handle,
+                                               int64_t                       n,
+                                               const rocblas_double_complex* x,
+                                               int64_t                       incx,
+                                               const rocblas_double_complex* y,
+                                               int64_t                       incy,
+                                               rocblas_double_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdotc_64(rocblas_handle               handle,
+                                               int64_t                      n,
+                                               const rocblas_float_complex* x,
+                                               int64_t                      incx,
+                                               const rocblas_float_complex* y,
+                                               int64_t                      incy,
+                                               rocblas_float_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdotc_64(rocblas_handle                handle,
+                                               int64_t                       n,
+                                               const rocblas_double_complex* x,
+                                               int64_t                       incx,
+                                               const rocblas_double_complex* y,
+                                               int64_t                       incy,
+                                               rocblas_double_complex*       result);
+//! @}
+
 /*! @{
     \brief <b> BLAS Level 1 API </b>
 
@@ -860,6 +1064,57 @@ ROCBLAS_EXPORT rocblas_status rocblas_zswap(rocblas_handle          handle,
                                             rocblas_int             incy);
 //! @}
 
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    swap_64 is the ILP64 interface of swap: n, incx and incy are int64_t, so that vectors
+    x and y may have 2^31 or more elements.
+
+    swap  interchanges vectors x and y.
+
+        y := x;
+        x := y
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [int64_t]
+              the number of elements in x and y.
+    @param[inout]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int64_t]
+              specifies the increment for the elements of x.
+    @param[inout]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [int64_t]
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sswap_64(
+    rocblas_handle handle, int64_t n, float* x, int64_t incx, float* y, int64_t incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dswap_64(
+    rocblas_handle handle, int64_t n, double* x, int64_t incx, double* y, int64_t incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cswap_64(rocblas_handle         handle,
+                                               int64_t                n,
+                                               rocblas_float_complex* x,
+                                               int64_t                incx,
+                                               rocblas_float_complex* y,
+                                               int64_t                incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zswap_64(rocblas_handle          handle,
+                                               int64_t                 n,
+                                               rocblas_double_complex* x,
+                                               int64_t                 incx,
+                                               rocblas_double_complex* y,
+                                               int64_t                 incy);
+//! @}
+
 /*! @{
     \brief <b> BLAS Level 1 API </b>
 
@@ -1075,6 +1330,78 @@ ROCBLAS_EXPORT rocblas_status rocblas_zaxpy(rocblas_handle                handle
                                             rocblas_int                   incy);
 //! @}
 
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    axpy_64 is the ILP64 interface of axpy: n, incx and incy are int64_t, so that vectors
+    x and y may have 2^31 or more elements.
+
+    axpy   computes constant alpha multiplied by vector x, plus vector y
+
+        y := alpha * x + y
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [int64_t]
+              the number of elements in x and y.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int64_t]
+              specifies the increment for the elements of x.
+    @param[out]
+    y         device pointer storing vector y.
+    @param[inout]
+    incy      [int64_t]
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_64(rocblas_handle handle,
+                                               int64_t        n,
+                                               const float*   alpha,
+                                               const float*   x,
+                                               int64_t        incx,
+                                               float*         y,
+                                               int64_t        incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_64(rocblas_handle handle,
+                                               int64_t        n,
+                                               const double*  alpha,
+                                               const double*  x,
+                                               int64_t        incx,
+                                               double*        y,
+                                               int64_t        incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_haxpy_64(rocblas_handle      handle,
+                                               int64_t             n,
+                                               const rocblas_half* alpha,
+                                               const rocblas_half* x,
+                                               int64_t             incx,
+                                               rocblas_half*       y,
+                                               int64_t             incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpy_64(rocblas_handle               handle,
+                                               int64_t                      n,
+                                               const rocblas_float_complex* alpha,
+                                               const rocblas_float_complex* x,
+                                               int64_t                      incx,
+                                               rocblas_float_complex*       y,
+                                               int64_t                      incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpy_64(rocblas_handle                handle,
+                                               int64_t                       n,
+                                               const rocblas_double_complex* alpha,
+                                               const rocblas_double_complex* x,
+                                               int64_t                       incx,
+                                               rocblas_double_complex*       y,
+                                               int64_t                       incy);
+//! @}
+
 /*! @{
     \brief <b> BLAS Level 1 API </b>
 
@@ -1245,136 +1572,1243 @@ ROCBLAS_EXPORT rocblas_status rocblas_zaxpy_strided_batched(rocblas_handle
     \brief <b> BLAS Level 1 API </b>
 
     \details
-    asum computes the sum of the magnitudes of elements of a real vector x,
-    or the sum of magnitudes of the real and imaginary parts of elements if x is a complex vector.
+    axpby computes constant alpha multiplied by vector x, plus constant beta multiplied by
+    vector y, in one pass over x and y
+
+        y := alpha * x + beta * y
+
+    y is not read if beta is zero, and x is not read if alpha is zero.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
     n         [rocblas_int]
-              the number of elements in x and y.
+              the number of elements in each vector.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
     @param[in]
     x         device pointer storing vector x.
     @param[in]
     incx      [rocblas_int]
-              specifies the increment for the elements of x. incx must be > 0.
+              specifies the increment for the elements of each x.
+    @param[in]
+    beta      device pointer or host pointer to specify the scalar beta.
     @param[inout]
-    result
-              device pointer or host pointer to store the asum product.
-              return is 0.0 if n <= 0.
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_sasum(
-    rocblas_handle handle, rocblas_int n, const float* x, rocblas_int incx, float* result);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dasum(
-    rocblas_handle handle, rocblas_int n, const double* x, rocblas_int incx, double* result);
-
-ROCBLAS_EXPORT rocblas_status rocblas_scasum(rocblas_handle               handle,
+ROCBLAS_EXPORT rocblas_status rocblas_saxpby(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             const float*   alpha,
+                                             const float*   x,
+                                             rocblas_int    incx,
+                                             const float*   beta,
+                                             float*         y,
+                                             rocblas_int    incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpby(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             const double*  alpha,
+                                             const double*  x,
+                                             rocblas_int    incx,
+                                             const double*  beta,
+                                             double*        y,
+                                             rocblas_int    incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpby(rocblas_handle               handle,
                                              rocblas_int                  n,
+                                             const rocblas_float_complex* alpha,
                                              const rocblas_float_complex* x,
                                              rocblas_int                  incx,
-                                             float*                       result);
+                                             const rocblas_float_complex* beta,
+                                             rocblas_float_complex*       y,
+                                             rocblas_int                  incy);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dzasum(rocblas_handle                handle,
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpby(rocblas_handle                handle,
                                              rocblas_int                   n,
+                                             const rocblas_double_complex* alpha,
                                              const rocblas_double_complex* x,
                                              rocblas_int                   incx,
-                                             double*                       result);
+                                             const rocblas_double_complex* beta,
+                                             rocblas_double_complex*       y,
+                                             rocblas_int                   incy);
 //! @}
 
 /*! @{
     \brief <b> BLAS Level 1 API </b>
 
     \details
-    asum_batched computes the sum of the magnitudes of the elements in a batch of real vectors x_i,
-    or the sum of magnitudes of the real and imaginary parts of elements if x_i is a complex
-    vector, for i = 1, ..., batch_count
+    axpby_batched computes y_i := alpha * x_i + beta * y_i, for i = 1, ..., batch_count,
+    over a set of batched vectors. y_i is not read if beta is zero, and x_i is not read if
+    alpha is zero.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
     n         [rocblas_int]
-              number of elements in each vector x_i
+              the number of elements in each vector.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
     @param[in]
     x         device array of device pointers storing each vector x_i.
     @param[in]
     incx      [rocblas_int]
-              specifies the increment for the elements of each x_i. incx must be > 0.
-    @param[out]
-    results
-              device array or host array of batch_count size for results.
-              return is 0.0 if n, incx<=0.
+              specifies the increment for the elements of each x.
+    @param[in]
+    beta      device pointer or host pointer to specify the scalar beta.
+    @param[inout]
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y.
     @param[in]
     batch_count [rocblas_int]
               number of instances in the batch.
+
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_sasum_batched(rocblas_handle     handle,
-                                                    rocblas_int        n,
-                                                    const float* const x[],
-                                                    rocblas_int        incx,
-                                                    rocblas_int        batch_count,
-                                                    float*             results);
+ROCBLAS_EXPORT rocblas_status rocblas_saxpby_batched(rocblas_handle     handle,
+                                                     rocblas_int        n,
+                                                     const float*       alpha,
+                                                     const float* const x[],
+                                                     rocblas_int        incx,
+                                                     const float*       beta,
+                                                     float* const       y[],
+                                                     rocblas_int        incy,
+                                                     rocblas_int        batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dasum_batched(rocblas_handle      handle,
-                                                    rocblas_int         n,
-                                                    const double* const x[],
-                                                    rocblas_int         incx,
-                                                    rocblas_int         batch_count,
-                                                    double*             results);
+ROCBLAS_EXPORT rocblas_status rocblas_daxpby_batched(rocblas_handle      handle,
+                                                     rocblas_int         n,
+                                                     const double*       alpha,
+                                                     const double* const x[],
+                                                     rocblas_int         incx,
+                                                     const double*       beta,
+                                                     double* const       y[],
+                                                     rocblas_int         incy,
+                                                     rocblas_int         batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_scasum_batched(rocblas_handle                     handle,
+ROCBLAS_EXPORT rocblas_status rocblas_caxpby_batched(rocblas_handle                     handle,
                                                      rocblas_int                        n,
+                                                     const rocblas_float_complex*       alpha,
                                                      const rocblas_float_complex* const x[],
                                                      rocblas_int                        incx,
-                                                     rocblas_int                        batch_count,
-                                                     float*                             results);
+                                                     const rocblas_float_complex*       beta,
+                                                     rocblas_float_complex* const       y[],
+                                                     rocblas_int                        incy,
+                                                     rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dzasum_batched(rocblas_handle                      handle,
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpby_batched(rocblas_handle                      handle,
                                                      rocblas_int                         n,
+                                                     const rocblas_double_complex*       alpha,
                                                      const rocblas_double_complex* const x[],
                                                      rocblas_int                         incx,
-                                                     rocblas_int batch_count,
-                                                     double*     results);
+                                                     const rocblas_double_complex*       beta,
+                                                     rocblas_double_complex* const       y[],
+                                                     rocblas_int                         incy,
+                                                     rocblas_int batch_count);
 //! @}
 
 /*! @{
     \brief <b> BLAS Level 1 API </b>
 
     \details
-    asum_strided_batched computes the sum of the magnitudes of elements of a real vectors x_i,
-    or the sum of magnitudes of the real and imaginary parts of elements if x_i is a complex
-    vector, for i = 1, ..., batch_count
+    axpby_strided_batched computes y_i := alpha * x_i + beta * y_i, for i = 1, ..., batch_count,
+    over a set of strided batched vectors. y_i is not read if beta is zero, and x_i is not read
+    if alpha is zero.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
     n         [rocblas_int]
-              number of elements in each vector x_i
+              the number of elements in each vector.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
     @param[in]
     x         device pointer to the first vector x_1.
     @param[in]
     incx      [rocblas_int]
-              specifies the increment for the elements of each x_i. incx must be > 0.
+              specifies the increment for the elements of each x.
     @param[in]
     stridex   [rocblas_stride]
-              stride from the start of one vector (x_i) and the next one (x_i+1).
-              There are no restrictions placed on stride_x, however the user should
-              take care to ensure that stride_x is of appropriate size, for a typical
-              case this means stride_x >= n * incx.
-    @param[out]
-    results
-              device pointer or host pointer to array for storing contiguous batch_count results.
-              return is 0.0 if n, incx<=0.
+              specifies the increment between vectors of x.
+    @param[in]
+    beta      device pointer or host pointer to specify the scalar beta.
+    @param[inout]
+    y         device pointer to the first vector y_1.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y.
+    @param[in]
+    stridey   [rocblas_stride]
+              specifies the increment between vectors of y.
     @param[in]
     batch_count [rocblas_int]
-              number of instances in the batch
+              number of instances in the batch.
+
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_sasum_strided_batched(rocblas_handle handle,
-                                                            rocblas_int    n,
+ROCBLAS_EXPORT rocblas_status rocblas_saxpby_strided_batched(rocblas_handle handle,
+                                                             rocblas_int    n,
+                                                             const float*   alpha,
+                                                             const float*   x,
+                                                             rocblas_int    incx,
+                                                             rocblas_stride stridex,
+                                                             const float*   beta,
+                                                             float*         y,
+                                                             rocblas_int    incy,
+                                                             rocblas_stride stridey,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpby_strided_batched(rocblas_handle handle,
+                                                             rocblas_int    n,
+                                                             const double*  alpha,
+                                                             const double*  x,
+                                                             rocblas_int    incx,
+                                                             rocblas_stride stridex,
+                                                             const double*  beta,
+                                                             double*        y,
+                                                             rocblas_int    incy,
+                                                             rocblas_stride stridey,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpby_strided_batched(rocblas_handle               handle,
+                                                             rocblas_int                  n,
+                                                             const rocblas_float_complex* alpha,
+                                                             const rocblas_float_complex* x,
+                                                             rocblas_int                  incx,
+                                                             rocblas_stride               stridex,
+                                                             const rocblas_float_complex* beta,
+                                                             rocblas_float_complex*       y,
+                                                             rocblas_int                  incy,
+                                                             rocblas_stride               stridey,
+                                                             rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpby_strided_batched(rocblas_handle                handle,
+                                                             rocblas_int                   n,
+                                                             const rocblas_double_complex* alpha,
+                                                             const rocblas_double_complex* x,
+                                                             rocblas_int                   incx,
+                                                             rocblas_stride                stridex,
+                                                             const rocblas_double_complex* beta,
+                                                             rocblas_double_complex*       y,
+                                                             rocblas_int                   incy,
+                                                             rocblas_stride                stridey,
+                                                             rocblas_int batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    waxpby computes the sum of vectors x and y scaled by alpha and beta into a third vector w,
+    in one pass
+
+        w := alpha * x + beta * y
+
+    y is not read if beta is zero, and x is not read if alpha is zero. w may be the same
+    vector as x or y.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each vector.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x.
+    @param[in]
+    beta      device pointer or host pointer to specify the scalar beta.
+    @param[in]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y.
+    @param[out]
+    w         device pointer storing vector w.
+    @param[in]
+    incw      [rocblas_int]
+              specifies the increment for the elements of each w.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_swaxpby(rocblas_handle handle,
+                                              rocblas_int    n,
+                                              const float*   alpha,
+                                              const float*   x,
+                                              rocblas_int    incx,
+                                              const float*   beta,
+                                              const float*   y,
+                                              rocblas_int    incy,
+                                              float*         w,
+                                              rocblas_int    incw);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dwaxpby(rocblas_handle handle,
+                                              rocblas_int    n,
+                                              const double*  alpha,
+                                              const double*  x,
+                                              rocblas_int    incx,
+                                              const double*  beta,
+                                              const double*  y,
+                                              rocblas_int    incy,
+                                              double*        w,
+                                              rocblas_int    incw);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cwaxpby(rocblas_handle               handle,
+                                              rocblas_int                  n,
+                                              const rocblas_float_complex* alpha,
+                                              const rocblas_float_complex* x,
+                                              rocblas_int                  incx,
+                                              const rocblas_float_complex* beta,
+                                              const rocblas_float_complex* y,
+                                              rocblas_int                  incy,
+                                              rocblas_float_complex*       w,
+                                              rocblas_int                  incw);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zwaxpby(rocblas_handle                handle,
+                                              rocblas_int                   n,
+                                              const rocblas_double_complex* alpha,
+                                              const rocblas_double_complex* x,
+                                              rocblas_int                   incx,
+                                              const rocblas_double_complex* beta,
+                                              const rocblas_double_complex* y,
+                                              rocblas_int                   incy,
+                                              rocblas_double_complex*       w,
+                                              rocblas_int                   incw);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    waxpby_batched computes w_i := alpha * x_i + beta * y_i, for i = 1, ..., batch_count,
+    over a set of batched vectors. y_i is not read if beta is zero, and x_i is not read if
+    alpha is zero.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each vector.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x.
+    @param[in]
+    beta      device pointer or host pointer to specify the scalar beta.
+    @param[in]
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y.
+    @param[out]
+    w         device array of device pointers storing each vector w_i.
+    @param[in]
+    incw      [rocblas_int]
+              specifies the increment for the elements of each w.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_swaxpby_batched(rocblas_handle     handle,
+                                                      rocblas_int        n,
+                                                      const float*       alpha,
+                                                      const float* const x[],
+                                                      rocblas_int        incx,
+                                                      const float*       beta,
+                                                      const float* const y[],
+                                                      rocblas_int        incy,
+                                                      float* const       w[],
+                                                      rocblas_int        incw,
+                                                      rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dwaxpby_batched(rocblas_handle      handle,
+                                                      rocblas_int         n,
+                                                      const double*       alpha,
+                                                      const double* const x[],
+                                                      rocblas_int         incx,
+                                                      const double*       beta,
+                                                      const double* const y[],
+                                                      rocblas_int         incy,
+                                                      double* const       w[],
+                                                      rocblas_int         incw,
+                                                      rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cwaxpby_batched(rocblas_handle                     handle,
+                                                      rocblas_int                        n,
+                                                      const rocblas_float_complex*       alpha,
+                                                      const rocblas_float_complex* const x[],
+                                                      rocblas_int                        incx,
+                                                      const rocblas_float_complex*       beta,
+                                                      const rocblas_float_complex* const y[],
+                                                      rocblas_int                        incy,
+                                                      rocblas_float_complex* const       w[],
+                                                      rocblas_int                        incw,
+                                                      rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zwaxpby_batched(rocblas_handle                      handle,
+                                                      rocblas_int                         n,
+                                                      const rocblas_double_complex*       alpha,
+                                                      const rocblas_double_complex* const x[],
+                                                      rocblas_int                         incx,
+                                                      const rocblas_double_complex*       beta,
+                                                      const rocblas_double_complex* const y[],
+                                                      rocblas_int                         incy,
+                                                      rocblas_double_complex* const       w[],
+                                                      rocblas_int                         incw,
+                                                      rocblas_int batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    waxpby_strided_batched computes w_i := alpha * x_i + beta * y_i, for i = 1, ..., batch_count,
+    over a set of strided batched vectors. y_i is not read if beta is zero, and x_i is not read
+    if alpha is zero.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each vector.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x         device pointer to the first vector x_1.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x.
+    @param[in]
+    stridex   [rocblas_stride]
+              specifies the increment between vectors of x.
+    @param[in]
+    beta      device pointer or host pointer to specify the scalar beta.
+    @param[in]
+    y         device pointer to the first vector y_1.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y.
+    @param[in]
+    stridey   [rocblas_stride]
+              specifies the increment between vectors of y.
+    @param[out]
+    w         device pointer to the first vector w_1.
+    @param[in]
+    incw      [rocblas_int]
+              specifies the increment for the elements of each w.
+    @param[in]
+    stridew   [rocblas_stride]
+              specifies the increment between vectors of w.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_swaxpby_strided_batched(rocblas_handle handle,
+                                                              rocblas_int    n,
+                                                              const float*   alpha,
+                                                              const float*   x,
+                                                              rocblas_int    incx,
+                                                              rocblas_stride stridex,
+                                                              const float*   beta,
+                                                              const float*   y,
+                                                              rocblas_int    incy,
+                                                              rocblas_stride stridey,
+                                                              float*         w,
+                                                              rocblas_int    incw,
+                                                              rocblas_stride stridew,
+                                                              rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dwaxpby_strided_batched(rocblas_handle handle,
+                                                              rocblas_int    n,
+                                                              const double*  alpha,
+                                                              const double*  x,
+                                                              rocblas_int    incx,
+                                                              rocblas_stride stridex,
+                                                              const double*  beta,
+                                                              const double*  y,
+                                                              rocblas_int    incy,
+                                                              rocblas_stride stridey,
+                                                              double*        w,
+                                                              rocblas_int    incw,
+                                                              rocblas_stride stridew,
+                                                              rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cwaxpby_strided_batched(rocblas_handle               handle,
+                                                              rocblas_int                  n,
+                                                              const rocblas_float_complex* alpha,
+                                                              const rocblas_float_complex* x,
+                                                              rocblas_int                  incx,
+                                                              rocblas_stride               stridex,
+                                                              const rocblas_float_complex* beta,
+                                                              const rocblas_float_complex* y,
+                                                              rocblas_int                  incy,
+                                                              rocblas_stride               stridey,
+                                                              rocblas_float_complex*       w,
+                                                              rocblas_int                  incw,
+                                                              rocblas_stride               stridew,
+                                                              rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zwaxpby_strided_batched(rocblas_handle                handle,
+                                                              rocblas_int                   n,
+                                                              const rocblas_double_complex* alpha,
+                                                              const rocblas_double_complex* x,
+                                                              rocblas_int                   incx,
+                                                              rocblas_stride                stridex,
+                                                              const rocblas_double_complex* beta,
+                                                              const rocblas_double_complex* y,
+                                                              rocblas_int                   incy,
+                                                              rocblas_stride                stridey,
+                                                              rocblas_double_complex*       w,
+                                                              rocblas_int                   incw,
+                                                              rocblas_stride                stridew,
+                                                              rocblas_int batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    axpy_dot updates vector y with axpy, and computes the dot product of the updated y and a
+    vector z, reading y once
+
+        y := alpha * x + y
+        result := dot(y, z)
+
+    The dot product of the complex functions is conjugated: result := y^H * z. z may be the same
+    vector as y, for the squared norm of the updated y, but must not overlap y otherwise.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each vector.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x.
+    @param[inout]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y.
+    @param[in]
+    z         device pointer storing vector z.
+    @param[in]
+    incz      [rocblas_int]
+              specifies the increment for the elements of each z.
+    @param[inout]
+    result
+              device pointer or host pointer to store the dot product.
+              return is 0.0 if n <= 0.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_dot(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const float*   alpha,
+                                                const float*   x,
+                                                rocblas_int    incx,
+                                                float*         y,
+                                                rocblas_int    incy,
+                                                const float*   z,
+                                                rocblas_int    incz,
+                                                float*         result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_dot(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const double*  alpha,
+                                                const double*  x,
+                                                rocblas_int    incx,
+                                                double*        y,
+                                                rocblas_int    incy,
+                                                const double*  z,
+                                                rocblas_int    incz,
+                                                double*        result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpy_dotc(rocblas_handle               handle,
+                                                 rocblas_int                  n,
+                                                 const rocblas_float_complex* alpha,
+                                                 const rocblas_float_complex* x,
+                                                 rocblas_int                  incx,
+                                                 rocblas_float_complex*       y,
+                                                 rocblas_int                  incy,
+                                                 const rocblas_float_complex* z,
+                                                 rocblas_int                  incz,
+                                                 rocblas_float_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpy_dotc(rocblas_handle                handle,
+                                                 rocblas_int                   n,
+                                                 const rocblas_double_complex* alpha,
+                                                 const rocblas_double_complex* x,
+                                                 rocblas_int                   incx,
+                                                 rocblas_double_complex*       y,
+                                                 rocblas_int                   incy,
+                                                 const rocblas_double_complex* z,
+                                                 rocblas_int                   incz,
+                                                 rocblas_double_complex*       result);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    axpy_dot_batched computes y_i := alpha * x_i + y_i and results[i] := dot(y_i, z_i), for
+    i = 1, ..., batch_count, over a set of batched vectors. The dot product of the complex
+    functions is conjugated. z_i may be the same vector as y_i, but must not overlap y_i
+    otherwise.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each vector.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x.
+    @param[inout]
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y.
+    @param[in]
+    z         device array of device pointers storing each vector z_i.
+    @param[in]
+    incz      [rocblas_int]
+              specifies the increment for the elements of each z.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch.
+    @param[inout]
+    results
+              device array or host array of batch_count size for the results.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_dot_batched(rocblas_handle     handle,
+                                                        rocblas_int        n,
+                                                        const float*       alpha,
+                                                        const float* const x[],
+                                                        rocblas_int        incx,
+                                                        float* const       y[],
+                                                        rocblas_int        incy,
+                                                        const float* const z[],
+                                                        rocblas_int        incz,
+                                                        rocblas_int        batch_count,
+                                                        float*             results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_dot_batched(rocblas_handle      handle,
+                                                        rocblas_int         n,
+                                                        const double*       alpha,
+                                                        const double* const x[],
+                                                        rocblas_int         incx,
+                                                        double* const       y[],
+                                                        rocblas_int         incy,
+                                                        const double* const z[],
+                                                        rocblas_int         incz,
+                                                        rocblas_int         batch_count,
+                                                        double*             results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpy_dotc_batched(rocblas_handle                     handle,
+                                                         rocblas_int                        n,
+                                                         const rocblas_float_complex*       alpha,
+                                                         const rocblas_float_complex* const x[],
+                                                         rocblas_int                        incx,
+                                                         rocblas_float_complex* const       y[],
+                                                         rocblas_int                        incy,
+                                                         const rocblas_float_complex* const z[],
+                                                         rocblas_int                        incz,
+                                                         rocblas_int batch_count,
+                                                         rocblas_float_complex* results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpy_dotc_batched(rocblas_handle                      handle,
+                                                         rocblas_int                         n,
+                                                         const rocblas_double_complex*       alpha,
+                                                         const rocblas_double_complex* const x[],
+                                                         rocblas_int                         incx,
+                                                         rocblas_double_complex* const       y[],
+                                                         rocblas_int                         incy,
+                                                         const rocblas_double_complex* const z[],
+                                                         rocblas_int                         incz,
+                                                         rocblas_int batch_count,
+                                                         rocblas_double_complex* results);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    axpy_dot_strided_batched computes y_i := alpha * x_i + y_i and results[i] := dot(y_i, z_i),
+    for i = 1, ..., batch_count, over a set of strided batched vectors. The dot product of the
+    complex functions is conjugated. z may be the same as y, with the same increments and
+    strides, but must not overlap y otherwise.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each vector.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x         device pointer to the first vector x_1.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x.
+    @param[in]
+    stridex   [rocblas_stride]
+              specifies the increment between vectors of x.
+    @param[inout]
+    y         device pointer to the first vector y_1.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y.
+    @param[in]
+    stridey   [rocblas_stride]
+              specifies the increment between vectors of y.
+    @param[in]
+    z         device pointer to the first vector z_1.
+    @param[in]
+    incz      [rocblas_int]
+              specifies the increment for the elements of each z.
+    @param[in]
+    stridez   [rocblas_stride]
+              specifies the increment between vectors of z.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch.
+    @param[inout]
+    results
+              device array or host array of batch_count size for the results.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_dot_strided_batched(rocblas_handle handle,
+                                                                rocblas_int    n,
+                                                                const float*   alpha,
+                                                                const float*   x,
+                                                                rocblas_int    incx,
+                                                                rocblas_stride stridex,
+                                                                float*         y,
+                                                                rocblas_int    incy,
+                                                                rocblas_stride stridey,
+                                                                const float*   z,
+                                                                rocblas_int    incz,
+                                                                rocblas_stride stridez,
+                                                                rocblas_int    batch_count,
+                                                                float*         results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_dot_strided_batched(rocblas_handle handle,
+                                                                rocblas_int    n,
+                                                                const double*  alpha,
+                                                                const double*  x,
+                                                                rocblas_int    incx,
+                                                                rocblas_stride stridex,
+                                                                double*        y,
+                                                                rocblas_int    incy,
+                                                                rocblas_stride stridey,
+                                                                const double*  z,
+                                                                rocblas_int    incz,
+                                                                rocblas_stride stridez,
+                                                                rocblas_int    batch_count,
+                                                                double*        results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpy_dotc_strided_batched(rocblas_handle handle,
+                                                                 rocblas_int                  n,
+                                                                 const rocblas_float_complex* alpha,
+                                                                 const rocblas_float_complex* x,
+                                                                 rocblas_int                  incx,
+                                                                 rocblas_stride stridex,
+                                                                 rocblas_float_complex*       y,
+                                                                 rocblas_int                  incy,
+                                                                 rocblas_stride stridey,
+                                                                 const rocblas_float_complex* z,
+                                                                 rocblas_int                  incz,
+                                                                 rocblas_stride stridez,
+                                                                 rocblas_int batch_count,
+                                                                 rocblas_float_complex* results);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zaxpy_dotc_strided_batched(rocblas_handle                handle,
+                                       rocblas_int                   n,
+                                       const rocblas_double_complex* alpha,
+                                       const rocblas_double_complex* x,
+                                       rocblas_int                   incx,
+                                       rocblas_stride                stridex,
+                                       rocblas_double_complex*       y,
+                                       rocblas_int                   incy,
+                                       rocblas_stride                stridey,
+                                       const rocblas_double_complex* z,
+                                       rocblas_int                   incz,
+                                       rocblas_stride                stridez,
+                                       rocblas_int                   batch_count,
+                                       rocblas_double_complex*       results);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    dot2 computes the dot products of vector x with vectors y and z, reading x once
+
+        results[0] := dot(x, y)
+        results[1] := dot(x, z)
+
+    The dot products of the complex functions are conjugated: x^H * y and x^H * z.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each vector.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x.
+    @param[in]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y.
+    @param[in]
+    z         device pointer storing vector z.
+    @param[in]
+    incz      [rocblas_int]
+              specifies the increment for the elements of each z.
+    @param[inout]
+    results
+              device array or host array of size 2 for the products with y and z.
+              return is 0.0 if n <= 0.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sdot2(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            const float*   x,
+                                            rocblas_int    incx,
+                                            const float*   y,
+                                            rocblas_int    incy,
+                                            const float*   z,
+                                            rocblas_int    incz,
+                                            float*         results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot2(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            const double*  x,
+                                            rocblas_int    incx,
+                                            const double*  y,
+                                            rocblas_int    incy,
+                                            const double*  z,
+                                            rocblas_int    incz,
+                                            double*        results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdotc2(rocblas_handle               handle,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* x,
+                                             rocblas_int                  incx,
+                                             const rocblas_float_complex* y,
+                                             rocblas_int                  incy,
+                                             const rocblas_float_complex* z,
+                                             rocblas_int                  incz,
+                                             rocblas_float_complex*       results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdotc2(rocblas_handle                handle,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* x,
+                                             rocblas_int                   incx,
+                                             const rocblas_double_complex* y,
+                                             rocblas_int                   incy,
+                                             const rocblas_double_complex* z,
+                                             rocblas_int                   incz,
+                                             rocblas_double_complex*       results);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    dot2_batched computes results[i] := dot(x_i, y_i) and
+    results[batch_count + i] := dot(x_i, z_i), for i = 1, ..., batch_count, over a set of
+    batched vectors. The dot products of the complex functions are conjugated.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each vector.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x.
+    @param[in]
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y.
+    @param[in]
+    z         device array of device pointers storing each vector z_i.
+    @param[in]
+    incz      [rocblas_int]
+              specifies the increment for the elements of each z.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch.
+    @param[inout]
+    results
+              device array or host array of 2 * batch_count size for the results: the products
+              with y_i, followed by the products with z_i.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sdot2_batched(rocblas_handle     handle,
+                                                    rocblas_int        n,
+                                                    const float* const x[],
+                                                    rocblas_int        incx,
+                                                    const float* const y[],
+                                                    rocblas_int        incy,
+                                                    const float* const z[],
+                                                    rocblas_int        incz,
+                                                    rocblas_int        batch_count,
+                                                    float*             results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot2_batched(rocblas_handle      handle,
+                                                    rocblas_int         n,
+                                                    const double* const x[],
+                                                    rocblas_int         incx,
+                                                    const double* const y[],
+                                                    rocblas_int         incy,
+                                                    const double* const z[],
+                                                    rocblas_int         incz,
+                                                    rocblas_int         batch_count,
+                                                    double*             results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdotc2_batched(rocblas_handle                     handle,
+                                                     rocblas_int                        n,
+                                                     const rocblas_float_complex* const x[],
+                                                     rocblas_int                        incx,
+                                                     const rocblas_float_complex* const y[],
+                                                     rocblas_int                        incy,
+                                                     const rocblas_float_complex* const z[],
+                                                     rocblas_int                        incz,
+                                                     rocblas_int                        batch_count,
+                                                     rocblas_float_complex*             results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdotc2_batched(rocblas_handle                      handle,
+                                                     rocblas_int                         n,
+                                                     const rocblas_double_complex* const x[],
+                                                     rocblas_int                         incx,
+                                                     const rocblas_double_complex* const y[],
+                                                     rocblas_int                         incy,
+                                                     const rocblas_double_complex* const z[],
+                                                     rocblas_int                         incz,
+                                                     rocblas_int batch_count,
+                                                     rocblas_double_complex*             results);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    dot2_strided_batched computes results[i] := dot(x_i, y_i) and
+    results[batch_count + i] := dot(x_i, z_i), for i = 1, ..., batch_count, over a set of
+    strided batched vectors. The dot products of the complex functions are conjugated.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each vector.
+    @param[in]
+    x         device pointer to the first vector x_1.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x.
+    @param[in]
+    stridex   [rocblas_stride]
+              specifies the increment between vectors of x.
+    @param[in]
+    y         device pointer to the first vector y_1.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y.
+    @param[in]
+    stridey   [rocblas_stride]
+              specifies the increment between vectors of y.
+    @param[in]
+    z         device pointer to the first vector z_1.
+    @param[in]
+    incz      [rocblas_int]
+              specifies the increment for the elements of each z.
+    @param[in]
+    stridez   [rocblas_stride]
+              specifies the increment between vectors of z.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch.
+    @param[inout]
+    results
+              device array or host array of 2 * batch_count size for the results: the products
+              with y_i, followed by the products with z_i.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sdot2_strided_batched(rocblas_handle handle,
+                                                            rocblas_int    n,
+                                                            const float*   x,
+                                                            rocblas_int    incx,
+                                                            rocblas_stride stridex,
+                                                            const float*   y,
+                                                            rocblas_int    incy,
+                                                            rocblas_stride stridey,
+                                                            const float*   z,
+                                                            rocblas_int    incz,
+                                                            rocblas_stride stridez,
+                                                            rocblas_int    batch_count,
+                                                            float*         results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot2_strided_batched(rocblas_handle handle,
+                                                            rocblas_int    n,
+                                                            const double*  x,
+                                                            rocblas_int    incx,
+                                                            rocblas_stride stridex,
+                                                            const double*  y,
+                                                            rocblas_int    incy,
+                                                            rocblas_stride stridey,
+                                                            const double*  z,
+                                                            rocblas_int    incz,
+                                                            rocblas_stride stridez,
+                                                            rocblas_int    batch_count,
+                                                            double*        results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdotc2_strided_batched(rocblas_handle               handle,
+                                                             rocblas_int                  n,
+                                                             const rocblas_float_complex* x,
+                                                             rocblas_int                  incx,
+                                                             rocblas_stride               stridex,
+                                                             const rocblas_float_complex* y,
+                                                             rocblas_int                  incy,
+                                                             rocblas_stride               stridey,
+                                                             const rocblas_float_complex* z,
+                                                             rocblas_int                  incz,
+                                                             rocblas_stride               stridez,
+                                                             rocblas_int batch_count,
+                                                             rocblas_float_complex*       results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdotc2_strided_batched(rocblas_handle                handle,
+                                                             rocblas_int                   n,
+                                                             const rocblas_double_complex* x,
+                                                             rocblas_int                   incx,
+                                                             rocblas_stride                stridex,
+                                                             const rocblas_double_complex* y,
+                                                             rocblas_int                   incy,
+                                                             rocblas_stride                stridey,
+                                                             const rocblas_double_complex* z,
+                                                             rocblas_int                   incz,
+                                                             rocblas_stride                stridez,
+                                                             rocblas_int batch_count,
+                                                             rocblas_double_complex*       results);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    asum computes the sum of the magnitudes of elements of a real vector x,
+    or the sum of magnitudes of the real and imaginary parts of elements if x is a complex vector.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x and y.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x. incx must be > 0.
+    @param[inout]
+    result
+              device pointer or host pointer to store the asum product.
+              return is 0.0 if n <= 0.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sasum(
+    rocblas_handle handle, rocblas_int n, const float* x, rocblas_int incx, float* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dasum(
+    rocblas_handle handle, rocblas_int n, const double* x, rocblas_int incx, double* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_scasum(rocblas_handle               handle,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* x,
+                                             rocblas_int                  incx,
+                                             float*                       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dzasum(rocblas_handle                handle,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* x,
+                                             rocblas_int                   incx,
+                                             double*                       result);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    asum_64 is the ILP64 interface of asum: n and incx are int64_t, so that vector x may
+    have 2^31 or more elements.
+
+    asum computes the sum of the magnitudes of elements of a real vector x,
+    or the sum of magnitudes of the real and imaginary parts of elements if x is a complex vector.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [int64_t]
+              the number of elements in x and y.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int64_t]
+              specifies the increment for the elements of x. incx must be > 0.
+    @param[inout]
+    result
+              device pointer or host pointer to store the asum product.
+              return is 0.0 if n <= 0.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sasum_64(
+    rocblas_handle handle, int64_t n, const float* x, int64_t incx, float* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dasum_64(
+    rocblas_handle handle, int64_t n, const double* x, int64_t incx, double* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_scasum_64(
+    rocblas_handle handle, int64_t n, const rocblas_float_complex* x, int64_t incx, float* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dzasum_64(rocblas_handle                handle,
+                                                int64_t                       n,
+                                                const rocblas_double_complex* x,
+                                                int64_t                       incx,
+                                                double*                       result);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    asum_batched computes the sum of the magnitudes of the elements in a batch of real vectors x_i,
+    or the sum of magnitudes of the real and imaginary parts of elements if x_i is a complex
+    vector, for i = 1, ..., batch_count
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              number of elements in each vector x_i
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i. incx must be > 0.
+    @param[out]
+    results
+              device array or host array of batch_count size for results.
+              return is 0.0 if n, incx<=0.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sasum_batched(rocblas_handle     handle,
+                                                    rocblas_int        n,
+                                                    const float* const x[],
+                                                    rocblas_int        incx,
+                                                    rocblas_int        batch_count,
+                                                    float*             results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dasum_batched(rocblas_handle      handle,
+                                                    rocblas_int         n,
+                                                    const double* const x[],
+                                                    rocblas_int         incx,
+                                                    rocblas_int         batch_count,
+                                                    double*             results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_scasum_batched(rocblas_handle                     handle,
+                                                     rocblas_int                        n,
+                                                     const rocblas_float_complex* const x[],
+                                                     rocblas_int                        incx,
+                                                     rocblas_int                        batch_count,
+                                                     float*                             results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dzasum_batched(rocblas_handle                      handle,
+                                                     rocblas_int                         n,
+                                                     const rocblas_double_complex* const x[],
+                                                     rocblas_int                         incx,
+                                                     rocblas_int batch_count,
+                                                     double*     results);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    asum_strided_batched computes the sum of the magnitudes of elements of a real vectors x_i,
+    or the sum of magnitudes of the real and imaginary parts of elements if x_i is a complex
+    vector, for i = 1, ..., batch_count
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              number of elements in each vector x_i
+    @param[in]
+    x         device pointer to the first vector x_1.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i. incx must be > 0.
+    @param[in]
+    stridex   [rocblas_stride]
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+              There are no restrictions placed on stride_x, however the user should
+              take care to ensure that stride_x is of appropriate size, for a typical
+              case this means stride_x >= n * incx.
+    @param[out]
+    results
+              device pointer or host pointer to array for storing contiguous batch_count results.
+              return is 0.0 if n, incx<=0.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sasum_strided_batched(rocblas_handle handle,
+                                                            rocblas_int    n,
                                                             const float*   x,
                                                             rocblas_int    incx,
                                                             rocblas_stride stridex,
@@ -1450,6 +2884,50 @@ ROCBLAS_EXPORT rocblas_status rocblas_dznrm2(rocblas_handle                handl
                                              double*                       result);
 //! @}
 
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    nrm2_64 is the ILP64 interface of nrm2: n and incx are int64_t, so that vector x may
+    have 2^31 or more elements.
+
+    nrm2 computes the euclidean norm of a real or complex vector
+
+        result := sqrt( x'*x ) for real vectors
+        result := sqrt( x**H*x ) for complex vectors
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [int64_t]
+              the number of elements in x.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int64_t]
+              specifies the increment for the elements of y.
+    @param[inout]
+    result
+              device pointer or host pointer to store the nrm2 product.
+              return is 0.0 if n, incx<=0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_snrm2_64(
+    rocblas_handle handle, int64_t n, const float* x, int64_t incx, float* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dnrm2_64(
+    rocblas_handle handle, int64_t n, const double* x, int64_t incx, double* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_scnrm2_64(
+    rocblas_handle handle, int64_t n, const rocblas_float_complex* x, int64_t incx, float* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dznrm2_64(rocblas_handle                handle,
+                                                int64_t                       n,
+                                                const rocblas_double_complex* x,
+                                                int64_t                       incx,
+                                                double*                       result);
+//! @}
+
 /*! @{
     \brief <b> BLAS Level 1 API </b>
 
@@ -1617,6 +3095,50 @@ ROCBLAS_EXPORT rocblas_status rocblas_izamax(rocblas_handle                handl
                                              rocblas_int*                  result);
 //! @}
 
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    amax_64 is the ILP64 interface of amax: n, incx and the index stored in result are
+    int64_t, so that vector x may have 2^31 or more elements.
+
+    amax finds the first index of the element of maximum magnitude of a vector x.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [int64_t]
+              the number of elements in x.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int64_t]
+              specifies the increment for the elements of y.
+    @param[inout]
+    result
+              device pointer or host pointer to store the amax index.
+              return is 0.0 if n, incx<=0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_isamax_64(
+    rocblas_handle handle, int64_t n, const float* x, int64_t incx, int64_t* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_idamax_64(
+    rocblas_handle handle, int64_t n, const double* x, int64_t incx, int64_t* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_icamax_64(rocblas_handle               handle,
+                                                int64_t                      n,
+                                                const rocblas_float_complex* x,
+                                                int64_t                      incx,
+                                                int64_t*                     result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_izamax_64(rocblas_handle                handle,
+                                                int64_t                       n,
+                                                const rocblas_double_complex* x,
+                                                int64_t                       incx,
+                                                int64_t*                      result);
+//! @}
+
 /*! @{
     \brief <b> BLAS Level 1 API </b>
 
@@ -1740,35 +3262,79 @@ ROCBLAS_EXPORT rocblas_status rocblas_izamax_strided_batched(rocblas_handle
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
-    n         [rocblas_int]
+    n         [rocblas_int]
+              the number of elements in x.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[inout]
+    result
+              device pointer or host pointer to store the amin index.
+              return is 0.0 if n, incx<=0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_isamin(
+    rocblas_handle handle, rocblas_int n, const float* x, rocblas_int incx, rocblas_int* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_idamin(
+    rocblas_handle handle, rocblas_int n, const double* x, rocblas_int incx, rocblas_int* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_icamin(rocblas_handle               handle,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* x,
+                                             rocblas_int                  incx,
+                                             rocblas_int*                 result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_izamin(rocblas_handle                handle,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* x,
+                                             rocblas_int                   incx,
+                                             rocblas_int*                  result);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    amin_64 is the ILP64 interface of amin: n, incx and the index stored in result are
+    int64_t, so that vector x may have 2^31 or more elements.
+
+    amin finds the first index of the element of minimum magnitude of a vector x.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [int64_t]
               the number of elements in x.
     @param[in]
     x         device pointer storing vector x.
     @param[in]
-    incx      [rocblas_int]
+    incx      [int64_t]
               specifies the increment for the elements of y.
     @param[inout]
     result
               device pointer or host pointer to store the amin index.
               return is 0.0 if n, incx<=0.
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_isamin(
-    rocblas_handle handle, rocblas_int n, const float* x, rocblas_int incx, rocblas_int* result);
-
-ROCBLAS_EXPORT rocblas_status rocblas_idamin(
-    rocblas_handle handle, rocblas_int n, const double* x, rocblas_int incx, rocblas_int* result);
-
-ROCBLAS_EXPORT rocblas_status rocblas_icamin(rocblas_handle               handle,
-                                             rocblas_int                  n,
-                                             const rocblas_float_complex* x,
-                                             rocblas_int                  incx,
-                                             rocblas_int*                 result);
-
-ROCBLAS_EXPORT rocblas_status rocblas_izamin(rocblas_handle                handle,
-                                             rocblas_int                   n,
-                                             const rocblas_double_complex* x,
-                                             rocblas_int                   incx,
-                                             rocblas_int*                  result);
+ROCBLAS_EXPORT rocblas_status rocblas_isamin_64(
+    rocblas_handle handle, int64_t n, const float* x, int64_t incx, int64_t* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_idamin_64(
+    rocblas_handle handle, int64_t n, const double* x, int64_t incx, int64_t* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_icamin_64(rocblas_handle               handle,
+                                                int64_t                      n,
+                                                const rocblas_float_complex* x,
+                                                int64_t                      incx,
+                                                int64_t*                     result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_izamin_64(rocblas_handle                handle,
+                                                int64_t                       n,
+                                                const rocblas_double_complex* x,
+                                                int64_t                       incx,
+                                                int64_t*                      result);
 //! @}
 
 /*! @{
@@ -3284,6 +4850,107 @@ ROCBLAS_EXPORT rocblas_status rocblas_zgemv(rocblas_handle                handle
                                             rocblas_int                   incy);
 //! @}
 
+/*! @{
+    \brief <b> BLAS Level 2 API </b>
+
+    \details
+    gemv_64 is the ILP64 interface of gemv: m, n, lda, incx and incy are int64_t, so that
+    matrix A and vectors x and y may have 2^31 or more elements.
+
+    gemv performs one of the matrix-vector operations
+
+        y := alpha*A*x    + beta*y,   or
+        y := alpha*A**T*x + beta*y,   or
+        y := alpha*A**H*x + beta*y,
+        where alpha and beta are scalars, x and y are vectors and A is an
+        m by n matrix.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans     [rocblas_operation]
+              indicates whether matrix A is tranposed (conjugated) or not
+    @param[in]
+    m         [int64_t]
+              number of rows of matrix A
+    @param[in]
+    n         [int64_t]
+              number of columns of matrix A
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [int64_t]
+              specifies the leading dimension of A.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int64_t]
+              specifies the increment for the elements of x.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
+    @param[inout]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [int64_t]
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv_64(rocblas_handle    handle,
+                                               rocblas_operation trans,
+                                               int64_t           m,
+                                               int64_t           n,
+                                               const float*      alpha,
+                                               const float*      A,
+                                               int64_t           lda,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               const float*      beta,
+                                               float*            y,
+                                               int64_t           incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv_64(rocblas_handle    handle,
+                                               rocblas_operation trans,
+                                               int64_t           m,
+                                               int64_t           n,
+                                               const double*     alpha,
+                                               const double*     A,
+                                               int64_t           lda,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               const double*     beta,
+                                               double*           y,
+                                               int64_t           incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemv_64(rocblas_handle               handle,
+                                               rocblas_operation            trans,
+                                               int64_t                      m,
+                                               int64_t                      n,
+                                               const rocblas_float_complex* alpha,
+                                               const rocblas_float_complex* A,
+                                               int64_t                      lda,
+                                               const rocblas_float_complex* x,
+                                               int64_t                      incx,
+                                               const rocblas_float_complex* beta,
+                                               rocblas_float_complex*       y,
+                                               int64_t                      incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemv_64(rocblas_handle                handle,
+                                               rocblas_operation             trans,
+                                               int64_t                       m,
+                                               int64_t                       n,
+                                               const rocblas_double_complex* alpha,
+                                               const rocblas_double_complex* A,
+                                               int64_t                       lda,
+                                               const rocblas_double_complex* x,
+                                               int64_t                       incx,
+                                               const rocblas_double_complex* beta,
+                                               rocblas_double_complex*       y,
+                                               int64_t                       incy);
+//! @}
+
 /*! @{
     \brief <b> BLAS Level 2 API </b>
 
@@ -14554,6 +16221,141 @@ ROCBLAS_EXPORT rocblas_status rocblas_zgemm(rocblas_handle                handle
                                             rocblas_int                   ldc);
 //! @}
 
+/*! @{
+    \brief <b> BLAS Level 3 API </b>
+
+    \details
+    gemm_64 is the ILP64 interface of gemm: m, n, k, lda, ldb and ldc are int64_t, so that
+    matrices A, B and C may have 2^31 or more elements.
+
+    gemm performs one of the matrix-matrix operations
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+        where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+        alpha and beta are scalars, and A, B and C are matrices, with
+        op( A ) an m by k matrix, op( B ) a k by n matrix and C an m by n matrix.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A )
+    @param[in]
+    transB    [rocblas_operation]
+              specifies the form of op( B )
+    @param[in]
+    m         [int64_t]
+              number or rows of matrices op( A ) and C
+    @param[in]
+    n         [int64_t]
+              number of columns of matrices op( B ) and C
+    @param[in]
+    k         [int64_t]
+              number of columns of matrix op( A ) and number of rows of matrix op( B )
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [int64_t]
+              specifies the leading dimension of A.
+    @param[in]
+    B         device pointer storing matrix B.
+    @param[in]
+    ldb       [int64_t]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[in, out]
+    C         device pointer storing matrix C on the GPU.
+    @param[in]
+    ldc       [int64_t]
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_64(rocblas_handle    handle,
+                                               rocblas_operation transA,
+                                               rocblas_operation transB,
+                                               int64_t           m,
+                                               int64_t           n,
+                                               int64_t           k,
+                                               const float*      alpha,
+                                               const float*      A,
+                                               int64_t           lda,
+                                               const float*      B,
+                                               int64_t           ldb,
+                                               const float*      beta,
+                                               float*            C,
+                                               int64_t           ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_64(rocblas_handle    handle,
+                                               rocblas_operation transA,
+                                               rocblas_operation transB,
+                                               int64_t           m,
+                                               int64_t           n,
+                                               int64_t           k,
+                                               const double*     alpha,
+                                               const double*     A,
+                                               int64_t           lda,
+                                               const double*     B,
+                                               int64_t           ldb,
+                                               const double*     beta,
+                                               double*           C,
+                                               int64_t           ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_hgemm_64(rocblas_handle      handle,
+                                               rocblas_operation   transA,
+                                               rocblas_operation   transB,
+                                               int64_t             m,
+                                               int64_t             n,
+                                               int64_t             k,
+                                               const rocblas_half* alpha,
+                                               const rocblas_half* A,
+                                               int64_t             lda,
+                                               const rocblas_half* B,
+                                               int64_t             ldb,
+                                               const rocblas_half* beta,
+                                               rocblas_half*       C,
+                                               int64_t             ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm_64(rocblas_handle               handle,
+                                               rocblas_operation            transA,
+                                               rocblas_operation            transB,
+                                               int64_t                      m,
+                                               int64_t                      n,
+                                               int64_t                      k,
+                                               const rocblas_float_complex* alpha,
+                                               const rocblas_float_complex* A,
+                                               int64_t                      lda,
+                                               const rocblas_float_complex* B,
+                                               int64_t                      ldb,
+                                               const rocblas_float_complex* beta,
+                                               rocblas_float_complex*       C,
+                                               int64_t                      ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm_64(rocblas_handle                handle,
+                                               rocblas_operation             transA,
+                                               rocblas_operation             transB,
+                                               int64_t                       m,
+                                               int64_t                       n,
+                                               int64_t                       k,
+                                               const rocblas_double_complex* alpha,
+                                               const rocblas_double_complex* A,
+                                               int64_t                       lda,
+                                               const rocblas_double_complex* B,
+                                               int64_t                       ldb,
+                                               const rocblas_double_complex* beta,
+                                               rocblas_double_complex*       C,
+                                               int64_t                       ldc);
+//! @}
+
 /*! @{
     \brief <b> BLAS Level 3 API </b>
 
@@ -16363,6 +18165,182 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_strided_batched_ex(rocblas_handle
 
 // clang-format on
 
+/*! @{
+    \brief <b> BLAS EX API </b>
+
+    \details
+    gemm_plan_create creates a plan for repeatedly performing the strided batched
+    matrix-matrix operations of rocblas_gemm_strided_batched_ex
+
+        D_i = alpha*op(A_i)*op(B_i) + beta*C_i, for i = 1, ..., batch_count,
+
+    with fixed sizes, leading dimensions, strides, datatypes and flags. The argument
+    validation, Tensile problem construction and solution selection are performed
+    once, when the plan is created, and rocblas_gemm_plan_execute() only binds new
+    pointers and scalars. The solutions are selected for alpha == 1 and beta == 0 or
+    beta == 1, both with c != d and, if ldc == ldd, stride_c == stride_d and c_type ==
+    d_type, with c == d. If the plan is executed with scalars which select a different
+    solution (e.g., beta == -1), it is selected on that execution and kept for the
+    following executions with the same category of beta.
+
+    A plan may only be executed with handles on the device of the handle it was
+    created with. Executions of a plan from several threads are serialized while
+    their kernels are launched.
+
+    This is a beta feature.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    plan      [rocblas_gemm_plan*]
+              pointer to the plan which is created.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    stride_a  [rocblas_stride]
+              specifies stride from start of one A_i matrix to the next A_(i + 1).
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    stride_b  [rocblas_stride]
+              specifies stride from start of one B_i matrix to the next B_(i + 1).
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of each C_i.
+    @param[in]
+    stride_c  [rocblas_stride]
+              specifies stride from start of one C_i matrix to the next C_(i + 1).
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of each matrix D_i.
+    @param[in]
+    ldd       [rocblas_int]
+              specifies the leading dimension of each D_i.
+    @param[in]
+    stride_d  [rocblas_stride]
+              specifies stride from start of one D_i matrix to the next D_(i + 1).
+    @param[in]
+    batch_count
+              [rocblas_int]
+              number of gemm operations in the batch.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of computation.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_plan_create(rocblas_handle     handle,
+                                                       rocblas_gemm_plan* plan,
+                                                       rocblas_operation  transA,
+                                                       rocblas_operation  transB,
+                                                       rocblas_int        m,
+                                                       rocblas_int        n,
+                                                       rocblas_int        k,
+                                                       rocblas_datatype   a_type,
+                                                       rocblas_int        lda,
+                                                       rocblas_stride     stride_a,
+                                                       rocblas_datatype   b_type,
+                                                       rocblas_int        ldb,
+                                                       rocblas_stride     stride_b,
+                                                       rocblas_datatype   c_type,
+                                                       rocblas_int        ldc,
+                                                       rocblas_stride     stride_c,
+                                                       rocblas_datatype   d_type,
+                                                       rocblas_int        ldd,
+                                                       rocblas_stride     stride_d,
+                                                       rocblas_int        batch_count,
+                                                       rocblas_datatype   compute_type,
+                                                       uint32_t           flags);
+//! @}
+
+/*! @{
+    \brief <b> BLAS EX API </b>
+
+    \details
+    gemm_plan_execute performs the matrix-matrix operations described by a plan
+    created with rocblas_gemm_plan_create(), with the given pointers and scalars.
+    The results are the same as those of rocblas_gemm_strided_batched_ex with the
+    same arguments.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    plan      [rocblas_gemm_plan]
+              the plan to execute.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as compute_type.
+    @param[in]
+    a         [void *]
+              device pointer pointing to first matrix A_1.
+    @param[in]
+    b         [void *]
+              device pointer pointing to first matrix B_1.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as compute_type.
+    @param[in]
+    c         [void *]
+              device pointer pointing to first matrix C_1.
+    @param[out]
+    d         [void *]
+              device pointer storing each matrix D_i.
+              If d and c pointers are to the same matrix then d_type must equal c_type and ldd must equal ldc
+              and stride_d must equal stride_c or the respective invalid status will be returned.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_plan_execute(rocblas_handle    handle,
+                                                        rocblas_gemm_plan plan,
+                                                        const void*       alpha,
+                                                        const void*       a,
+                                                        const void*       b,
+                                                        const void*       beta,
+                                                        const void*       c,
+                                                        void*             d);
+//! @}
+
+/*! \brief <b> BLAS EX API </b>
+
+    \details
+    gemm_plan_destroy destroys a plan created with rocblas_gemm_plan_create().
+
+    @param[in]
+    plan      [rocblas_gemm_plan]
+              the plan to destroy.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_plan_destroy(rocblas_gemm_plan plan);
+
 /*! @{
     \brief <b> BLAS EX API </b>
 
@@ -18131,6 +20109,23 @@ ROCBLAS_EXPORT const char* rocblas_status_to_string(rocblas_status status);
  ******************************************************************************/
 ROCBLAS_EXPORT void rocblas_initialize(void);
 
+/*! \brief Get statistics of the initialization of Tensile and the loading of its code objects.
+    \details
+
+    By default, rocBLAS indexes the kernels in the Tensile code object files, and loads each
+    code object file the first time one of its kernels is launched on a device. Setting the
+    environment variable ROCBLAS_TENSILE_LAZY_LOADING=0 loads all of the code object files when
+    Tensile is initialized. These statistics measure the time and memory used by either method.
+
+    @param[out]
+    stats   [rocblas_tensile_load_stats*]
+            statistics of Tensile initialization and code object loading.
+    @retval rocblas_status_success on success.
+    @retval rocblas_status_invalid_pointer if stats is a null pointer.
+    @retval rocblas_status_not_implemented if rocBLAS was built without Tensile.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_tensile_load_stats(rocblas_tensile_load_stats* stats);
+
 /*
  * ===========================================================================
  *    build information
@@ -18252,6 +20247,39 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_device_memory_size(rocblas_handle hand
  ******************************************************************************/
 ROCBLAS_EXPORT rocblas_status rocblas_set_workspace(rocblas_handle handle, void* addr, size_t size);
 
+/*! \brief
+    \details
+    Gets the statistics of the workspace requested from the device memory of the handle, by
+    requesting function and by size class of the requests. The statistics can be used to choose
+    the device memory size of handles. The statistics are recorded once
+    rocblas_reset_workspace_stats() has been called on the handle. If the environment variable
+    ROCBLAS_WORKSPACE_STATS_PATH is set, they are recorded from the creation of the handle, and
+    are also written to the file it names, as YAML, when the handle is destroyed. The GSU
+    workspace of gemm is recorded with the size which the selected solution uses.
+
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_pointer if count is nullptr,
+    or if stats is nullptr and *count is nonzero; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    @param[out]
+    stats           array of *count entries where the statistics are stored, sorted by function and size class
+    @param[in, out]
+    count           on input, the number of entries in stats; on output, the number of entries available.
+                    If it is larger than on input, only the first entries were stored.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_workspace_stats(rocblas_handle           handle,
+                                                          rocblas_workspace_stats* stats,
+                                                          size_t*                  count);
+
+/*! \brief
+    \details
+    Resets the workspace statistics of the handle, and starts recording them
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_reset_workspace_stats(rocblas_handle handle);
+
 /*! \brief
     \details
     Returns true when device memory in handle is managed by rocBLAS
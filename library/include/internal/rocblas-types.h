@@ -40,6 +40,13 @@
  */
 typedef struct _rocblas_handle* rocblas_handle;
 
+/*! \brief rocblas_gemm_plan is an opaque structure holding a GEMM problem whose
+ * solution has been selected in advance.
+ * It must be created using rocblas_gemm_plan_create(), executed using
+ * rocblas_gemm_plan_execute() and destroyed using rocblas_gemm_plan_destroy().
+ */
+typedef struct _rocblas_gemm_plan* rocblas_gemm_plan;
+
 /*! \brief Forward declaration of hipStream_t */
 typedef struct ihipStream_t* hipStream_t;
 
@@ -215,6 +222,44 @@ typedef enum rocblas_atomics_mode_
     rocblas_atomics_allowed = 1,
 } rocblas_atomics_mode;
 
+/*! \brief Indicates how the sums of the reductions asum, nrm2 and dot are accumulated.
+*    Reproducible sums do not depend on the order of their terms, so that their results are
+*    bitwise identical from run to run, between batched and non-batched functions and across
+*    devices, at a cost of performance */
+typedef enum rocblas_reduction_mode_
+{
+    /*! \brief Sums are accumulated in the order of the fastest algorithm */
+    rocblas_reduction_mode_default = 0,
+    /*! \brief Sums are accumulated exactly in pre-rounded bins, independently of their order */
+    rocblas_reduction_mode_reproducible = 1,
+} rocblas_reduction_mode;
+
+/*! \brief Indicates how nrm2 accumulates the squares of the elements. Scaled sums do not
+*    overflow or underflow for vectors with very large or very small elements, at a cost of
+*    performance */
+typedef enum rocblas_nrm2_mode_
+{
+    /*! \brief The squares of the elements are summed without scaling */
+    rocblas_nrm2_mode_default = 0,
+    /*! \brief The squares of the elements are summed in Blue's scaled accumulators in one pass */
+    rocblas_nrm2_mode_scaled = 1,
+} rocblas_nrm2_mode;
+
+/*! \brief Indicates whether the results of reductions in host pointer mode are written to the
+*    host before the functions return, or are copied without blocking into a buffer of the handle
+*    and collected later with rocblas_get_result */
+typedef enum rocblas_result_mode_
+{
+    /*! \brief Results are written to the host before the function returns */
+    rocblas_result_mode_blocking = 0,
+    /*! \brief Results are copied asynchronously to pinned host memory of the handle */
+    rocblas_result_mode_deferred = 1,
+} rocblas_result_mode;
+
+/*! \brief Identifies a deferred result in rocblas_result_mode_deferred. Tokens are
+*    nonzero, and a token of 0 means that no result was deferred */
+typedef uint64_t rocblas_result_token;
+
 /*! \brief Indicates which performance metric Tensile uses when selecting the optimal
 *    solution for gemm problems.  */
 typedef enum rocblas_performance_metric_
@@ -239,6 +284,8 @@ typedef enum rocblas_layer_mode_
     rocblas_layer_mode_log_bench = 0x2,
     /*! \brief Outputs a YAML description of each rocBLAS function called, along with its arguments and number of times it was called. */
     rocblas_layer_mode_log_profile = 0x4,
+    /*! \brief Outputs a compact binary record of the profiled arguments of each rocBLAS function call, which can be decoded offline. */
+    rocblas_layer_mode_log_binary = 0x8,
 } rocblas_layer_mode;
 
 /*! \brief Indicates if layer is active with bitmask*/
@@ -279,6 +326,41 @@ typedef union rocblas_union_u
     rocblas_double_complex z;
 } rocblas_union_t;
 
+/*! \brief Statistics of the initialization of Tensile and the loading of its code objects,
+ * returned by rocblas_get_tensile_load_stats() */
+typedef struct rocblas_tensile_load_stats_
+{
+    /*! \brief time spent initializing Tensile on all devices, in seconds */
+    double init_seconds;
+    /*! \brief number of code object files found for the current processor */
+    size_t code_objects_total;
+    /*! \brief number of code object files loaded, summed over all devices */
+    size_t code_objects_loaded;
+    /*! \brief size of the code object files loaded, in bytes */
+    size_t code_object_bytes_loaded;
+    /*! \brief growth of the resident memory of the process while loading code objects, in bytes */
+    size_t resident_bytes_loaded;
+} rocblas_tensile_load_stats;
+
+/*! \brief Statistics of the workspace requested by a rocBLAS function, for requests of one
+ * size class, returned by rocblas_get_workspace_stats() */
+typedef struct rocblas_workspace_stats_
+{
+    /*! \brief name of the internal function which requested the workspace */
+    const char* function;
+    /*! \brief power of two bounding the requested sizes; requests larger than half of it, or any
+     * size up to the smallest size class of 64 KiB, are counted in this size class */
+    size_t size_class;
+    /*! \brief number of workspace requests */
+    size_t requests;
+    /*! \brief peak device memory of the handle in use during the requests, in bytes */
+    size_t peak_bytes;
+    /*! \brief number of times the device memory of the handle was reallocated for the requests */
+    size_t reallocations;
+    /*! \brief number of requests which failed because of insufficient device memory */
+    size_t failures;
+} rocblas_workspace_stats;
+
 /*! \brief Numerical checking for verifying the Input and Output vector/matrix of the rocBLAS functions for a NaN, zero, infinity and denormal value*/
 typedef enum rocblas_check_numerics_mode_
 {
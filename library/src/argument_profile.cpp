@@ -0,0 +1,346 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "logging.hpp"
+#include <cstring>
+
+/*******************************************************************************
+ * Timing statistics
+ ******************************************************************************/
+void argument_profile_timing::record(double us)
+{
+    int bucket = 0;
+    for(double bound = 1; bucket < BUCKETS - 1 && us >= bound; bound *= 2)
+        ++bucket;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(!m_stats.count || us < m_stats.min)
+        m_stats.min = us;
+    if(!m_stats.count || us > m_stats.max)
+        m_stats.max = us;
+    m_stats.count++;
+    m_stats.total += us;
+    m_stats.histogram[bucket]++;
+}
+
+auto argument_profile_timing::get() const -> stats
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+/*******************************************************************************
+ * GFLOP and GB counts of profiled calls
+ ******************************************************************************/
+namespace
+{
+    // Arguments of a profiled call, looked up by name
+    struct profile_arguments
+    {
+        const std::map<std::string, double>&      values;
+        const std::map<std::string, std::string>& strings;
+
+        // Integer argument, under either of two names, or -1 if it is missing
+        rocblas_int get(const char* name, const char* alt = nullptr) const
+        {
+            auto p = values.find(name);
+            if(p == values.end() && alt)
+                p = values.find(alt);
+            return p == values.end() ? -1 : rocblas_int(p->second);
+        }
+
+        // First letter of a character or string argument, or 0 if it is missing
+        char letter(const char* name, const char* alt = nullptr) const
+        {
+            auto p = strings.find(name);
+            if(p == strings.end() && alt)
+                p = strings.find(alt);
+            return p == strings.end() || p->second.empty() ? 0 : p->second[0];
+        }
+
+        rocblas_operation operation(const char* name, const char* alt = nullptr) const
+        {
+            char c = letter(name, alt);
+            return c == 'T'   ? rocblas_operation_transpose
+                   : c == 'C' ? rocblas_operation_conjugate_transpose
+                              : rocblas_operation_none;
+        }
+
+        rocblas_side side() const
+        {
+            return letter("side") == 'R' ? rocblas_side_right : rocblas_side_left;
+        }
+    };
+
+    template <typename T>
+    struct real_type
+    {
+        using type = T;
+    };
+
+    template <>
+    struct real_type<rocblas_float_complex>
+    {
+        using type = float;
+    };
+
+    template <>
+    struct real_type<rocblas_double_complex>
+    {
+        using type = double;
+    };
+
+    // Counts for a function with data type T, without its precision prefix or suffixes.
+    // real_alpha is true for functions which scale a complex vector by a real scalar.
+    template <typename T>
+    void count(const std::string&       name,
+               const profile_arguments& args,
+               bool                     real_alpha,
+               bool&                    has_gflop,
+               double&                  gflop,
+               bool&                    has_gbyte,
+               double&                  gbyte)
+    {
+        rocblas_int m = args.get("M", "m");
+        rocblas_int n = args.get("N", "n");
+        rocblas_int k = args.get("K", "k");
+
+        auto set = [&](bool& has, double& result, double value) {
+            has    = true;
+            result = value;
+        };
+
+        if(name == "asum")
+        {
+            set(has_gflop, gflop, asum_gflop_count<T>(n));
+            set(has_gbyte, gbyte, asum_gbyte_count<T>(n));
+        }
+        else if(name == "axpy")
+        {
+            set(has_gflop, gflop, axpy_gflop_count<T>(n));
+            set(has_gbyte, gbyte, axpy_gbyte_count<T>(n));
+        }
+        else if(name == "copy")
+            set(has_gbyte, gbyte, copy_gbyte_count<T>(n));
+        else if(name == "dot" || name == "dotu" || name == "dotc")
+        {
+            set(has_gflop,
+                gflop,
+                name == "dotc" ? dot_gflop_count<true, T>(n) : dot_gflop_count<false, T>(n));
+            set(has_gbyte, gbyte, dot_gbyte_count<T>(n));
+        }
+        else if(name == "nrm2")
+        {
+            set(has_gflop, gflop, nrm2_gflop_count<T>(n));
+            set(has_gbyte, gbyte, nrm2_gbyte_count<T>(n));
+        }
+        else if(name == "scal")
+        {
+            using R = typename real_type<T>::type;
+            set(has_gflop,
+                gflop,
+                real_alpha ? scal_gflop_count<T, R>(n) : scal_gflop_count<T, T>(n));
+            set(has_gbyte, gbyte, scal_gbyte_count<T>(n));
+        }
+        else if(name == "swap")
+            set(has_gbyte, gbyte, swap_gbyte_count<T>(n));
+        else if(name == "gemv")
+        {
+            rocblas_operation transA = args.operation("transA");
+            set(has_gflop, gflop, gemv_gflop_count<T>(transA, m, n));
+            set(has_gbyte, gbyte, gemv_gbyte_count<T>(transA, m, n));
+        }
+        else if(name == "ger" || name == "geru" || name == "gerc")
+        {
+            set(has_gflop, gflop, ger_gflop_count<T>(m, n));
+            set(has_gbyte, gbyte, ger_gbyte_count<T>(m, n));
+        }
+        else if(name == "symv")
+        {
+            set(has_gflop, gflop, symv_gflop_count<T>(n));
+            set(has_gbyte, gbyte, symv_gbyte_count<T>(n));
+        }
+        else if(name == "hemv")
+        {
+            set(has_gflop, gflop, hemv_gflop_count<T>(n));
+            set(has_gbyte, gbyte, hemv_gbyte_count<T>(n));
+        }
+        else if(name == "syr")
+        {
+            set(has_gflop, gflop, syr_gflop_count<T>(n));
+            set(has_gbyte, gbyte, syr_gbyte_count<T>(n));
+        }
+        else if(name == "her")
+        {
+            set(has_gflop, gflop, her_gflop_count<T>(n));
+            set(has_gbyte, gbyte, her_gbyte_count<T>(n));
+        }
+        else if(name == "trmv")
+        {
+            set(has_gflop, gflop, trmv_gflop_count<T>(m));
+            set(has_gbyte, gbyte, trmv_gbyte_count<T>(m));
+        }
+        else if(name == "trsv")
+            set(has_gflop, gflop, trsv_gflop_count<T>(m));
+        else if(name == "gemm")
+            set(has_gflop, gflop, gemm_gflop_count<T>(m, n, k));
+        else if(name == "geam")
+            set(has_gflop, gflop, geam_gflop_count<T>(m, n));
+        else if(name == "dgmm")
+            set(has_gflop, gflop, dgmm_gflop_count<T>(m, n));
+        else if(name == "symm")
+            set(has_gflop, gflop, symm_gflop_count<T>(args.side(), m, n));
+        else if(name == "hemm")
+            set(has_gflop, gflop, hemm_gflop_count<T>(args.side(), m, n));
+        else if(name == "syrk")
+        {
+            set(has_gflop, gflop, syrk_gflop_count<T>(n, k));
+            set(has_gbyte, gbyte, syrk_gbyte_count<T>(n, k));
+        }
+        else if(name == "herk")
+        {
+            set(has_gflop, gflop, herk_gflop_count<T>(n, k));
+            set(has_gbyte, gbyte, herk_gbyte_count<T>(n, k));
+        }
+        else if(name == "syr2k")
+            set(has_gflop, gflop, syr2k_gflop_count<T>(n, k));
+        else if(name == "her2k")
+            set(has_gflop, gflop, her2k_gflop_count<T>(n, k));
+        else if(name == "syrkx")
+            set(has_gflop, gflop, syrkx_gflop_count<T>(n, k));
+        else if(name == "herkx")
+            set(has_gflop, gflop, herkx_gflop_count<T>(n, k));
+        else if(name == "trmm")
+            set(has_gflop, gflop, trmm_gflop_count<T>(m, n, args.side()));
+        else if(name == "trsm")
+        {
+            rocblas_side side = args.side();
+            set(has_gflop, gflop, trsm_gflop_count<T>(m, n, side == rocblas_side_left ? m : n));
+        }
+        else if(name == "trtri")
+            set(has_gflop, gflop, trtri_gflop_count<T>(n));
+    }
+
+    // Remove a suffix from a string, returning whether it was present
+    bool remove_suffix(std::string& s, const char* suffix)
+    {
+        size_t len = strlen(suffix);
+        if(s.size() <= len || s.compare(s.size() - len, len, suffix))
+            return false;
+        s.erase(s.size() - len);
+        return true;
+    }
+} // namespace
+
+void argument_profile_gflop_gbyte_count(const char*                               function,
+                                        const std::map<std::string, double>&      values,
+                                        const std::map<std::string, std::string>& strings,
+                                        bool&                                     has_gflop,
+                                        double&                                   gflop,
+                                        bool&                                     has_gbyte,
+                                        double&                                   gbyte)
+{
+    has_gflop = has_gbyte = false;
+    gflop = gbyte = 0;
+
+    std::string name = function;
+    if(name.compare(0, 8, "rocblas_"))
+        return;
+    name.erase(0, 8);
+
+    // Functions with explicit types have no precision prefix, and a _ex or _ext2 suffix
+    bool ex = remove_suffix(name, "_ex") || remove_suffix(name, "_ext2");
+    remove_suffix(name, "_strided_batched") || remove_suffix(name, "_batched");
+
+    // Precision of the data, as a letter of the single-letter prefixes, or 'b' for bfloat16
+    char precision  = 0;
+    bool real_alpha = false;
+    if(ex)
+    {
+        // axpy and scal list the type of alpha first
+        const char* type_name = name == "axpy" || name == "scal" ? "b_type" : "a_type";
+        auto        p         = strings.find(type_name);
+        if(p == strings.end())
+            return;
+
+        static const std::map<std::string, char> precisions = {{"f16_r", 'h'},
+                                                               {"bf16_r", 'b'},
+                                                               {"f32_r", 's'},
+                                                               {"f64_r", 'd'},
+                                                               {"f32_c", 'c'},
+                                                               {"f64_c", 'z'},
+                                                               {"i8_r", 's'}};
+        auto                                     q = precisions.find(p->second);
+        if(q == precisions.end())
+            return;
+        precision = q->second;
+
+        if(name == "scal")
+        {
+            auto alpha = strings.find("a_type");
+            real_alpha = alpha != strings.end() && !alpha->second.empty()
+                         && alpha->second.back() == 'r';
+        }
+    }
+    else if(!name.compare(0, 2, "bf"))
+    {
+        precision = 'b';
+        name.erase(0, 2);
+    }
+    else if(name == "csscal" || name == "zdscal")
+    {
+        precision  = name[0];
+        real_alpha = true;
+        name.erase(0, 2);
+    }
+    else if(name == "scasum" || name == "scnrm2" || name == "dzasum" || name == "dznrm2")
+    {
+        precision = name[1];
+        name.erase(0, 2);
+    }
+    else if(!name.empty() && strchr("hsdcz", name[0]))
+    {
+        precision = name[0];
+        name.erase(0, 1);
+    }
+    else
+        return;
+
+    profile_arguments args{values, strings};
+    switch(precision)
+    {
+    case 'h':
+        count<rocblas_half>(name, args, false, has_gflop, gflop, has_gbyte, gbyte);
+        break;
+    case 'b':
+        count<rocblas_bfloat16>(name, args, false, has_gflop, gflop, has_gbyte, gbyte);
+        break;
+    case 's':
+        count<float>(name, args, false, has_gflop, gflop, has_gbyte, gbyte);
+        break;
+    case 'd':
+        count<double>(name, args, false, has_gflop, gflop, has_gbyte, gbyte);
+        break;
+    case 'c':
+        count<rocblas_float_complex>(name, args, real_alpha, has_gflop, gflop, has_gbyte, gbyte);
+        break;
+    case 'z':
+        count<rocblas_double_complex>(name, args, real_alpha, has_gflop, gflop, has_gbyte, gbyte);
+        break;
+    }
+
+    // Calls with invalid sizes have no meaningful counts
+    has_gflop = has_gflop && gflop > 0;
+    has_gbyte = has_gbyte && gbyte > 0;
+
+    // The counts of batched functions are for each problem in the batch
+    auto p = values.find("batch_count");
+    if(p != values.end())
+    {
+        gflop *= p->second;
+        gbyte *= p->second;
+    }
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "binary_logging.hpp"
+
+rocblas_binary_log::rocblas_binary_log(const char* path)
+    : m_os(path)
+{
+    m_os.write(MAGIC, sizeof(MAGIC));
+    m_os.write(reinterpret_cast<const char*>(&VERSION), sizeof(VERSION));
+    m_os.flush();
+}
+
+rocblas_binary_log* rocblas_binary_log::open(const char* path)
+{
+    static std::unique_ptr<rocblas_binary_log> log(path ? new rocblas_binary_log(path)
+                                                        : nullptr);
+    return log.get();
+}
+
+void rocblas_binary_log::flush()
+{
+    buffer().flush();
+}
+
+bool rocblas_binary_log::find(size_t hash, const void* const* sig, size_t n, uint32_t& id) const
+{
+    // Signatures with the same hash are told apart by comparing them
+    auto range = m_ids.equal_range(hash);
+    for(auto p = range.first; p != range.second; ++p)
+    {
+        if(std::equal(sig, sig + n, p->second.sig.begin(), p->second.sig.end()))
+        {
+            id = p->second.id;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t
+    rocblas_binary_log::define(size_t hash, const void* const* sig, size_t n, std::string& rec)
+{
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+
+    // Another thread may have defined the signature first
+    uint32_t id;
+    if(find(hash, sig, n, id))
+        return id;
+
+    // Fill in the ID, which follows the size and kind
+    id = m_next_id++;
+    memcpy(&rec[sizeof(uint32_t) + sizeof(uint8_t)], &id, sizeof(id));
+
+    // The definition is written before the ID can be used by other threads
+    write(rec);
+    m_ids.emplace(hash, definition_entry{{sig, sig + n}, id});
+    return id;
+}
+
+void rocblas_binary_log::define_enumerator(uint64_t key, const std::string& name)
+{
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+
+    // Another thread may have written the enumerator first
+    if(!m_enumerators.insert(key).second)
+        return;
+
+    std::string rec;
+    begin_record(rec, enumerator);
+    append(rec, uint32_t(key >> 32));
+    append(rec, uint32_t(key));
+    append(rec, name);
+    end_record(rec);
+    write(rec);
+}
+
+void rocblas_binary_log::write(const std::string& rec)
+{
+    // Records written immediately bypass the buffered call records of the thread
+    rocblas_internal_ostream& os = buffer().os;
+    os.write(rec.data(), rec.size());
+    os.flush();
+}
@@ -216,7 +216,10 @@ rocblas_status rocblas_iaminmax_reduction_strided_batched(rocblas_handle __restr
         // it must be a standard layout type and its first member must be of type Tr.
         static_assert(std::is_standard_layout<To>{}, "To must be a standard layout type");
 
-        bool reduceKernel = blocks > 1 || batch_count > 1;
+        // Deferred results are always finalized by kernel part2, so that they only
+        // need to be copied to the host
+        bool deferred     = handle->result_deferral;
+        bool reduceKernel = blocks > 1 || batch_count > 1 || deferred;
         if(reduceKernel)
         {
             hipLaunchKernelGGL(
@@ -230,7 +233,15 @@ rocblas_status rocblas_iaminmax_reduction_strided_batched(rocblas_handle __restr
                 (Tr*)(workspace + size_t(batch_count) * blocks));
         }
 
-        if(std::is_same<FINALIZE, rocblas_finalize_identity>{} || reduceKernel)
+        if(deferred)
+        {
+            // As in device pointer mode, the workspace may be released before the copy is done:
+            // the pool only lets other streams reuse it after waiting for the work queued on
+            // this stream, which includes the copy
+            return handle->defer_result((Tr*)(workspace + size_t(batch_count) * blocks),
+                                        batch_count * sizeof(Tr));
+        }
+        else if(std::is_same<FINALIZE, rocblas_finalize_identity>{} || reduceKernel)
         {
             // If FINALIZE is trivial or kernel part2 was called, result is in the
             // beginning of workspace[0]+offset, and can be copied directly.
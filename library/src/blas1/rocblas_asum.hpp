@@ -17,6 +17,12 @@ struct rocblas_fetch_asum
     }
 };
 
+template <class To>
+struct rocblas_repro_term<rocblas_fetch_asum<To>>
+{
+    using type = rocblas_repro_term_asum;
+};
+
 // allocate workspace inside this API
 template <rocblas_int NB, typename Ti, typename To>
 rocblas_status rocblas_asum_template(rocblas_handle handle,
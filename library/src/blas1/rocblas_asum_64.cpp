@@ -0,0 +1,138 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas_asum.hpp"
+#include "rocblas_reduction_impl_64.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_asum_name[] = "unknown";
+    template <>
+    constexpr char rocblas_asum_name<float>[] = "rocblas_sasum_64";
+    template <>
+    constexpr char rocblas_asum_name<double>[] = "rocblas_dasum_64";
+    template <>
+    constexpr char rocblas_asum_name<rocblas_float_complex>[] = "rocblas_scasum_64";
+    template <>
+    constexpr char rocblas_asum_name<rocblas_double_complex>[] = "rocblas_dzasum_64";
+
+    // allocate workspace inside this API
+    template <rocblas_int NB, typename Ti, typename To>
+    rocblas_status rocblas_asum_64_impl(
+        rocblas_handle handle, int64_t n, const Ti* x, int64_t incx, To* results)
+    {
+        static constexpr rocblas_int shiftx_0 = 0;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
+        size_t         dev_bytes     = 0;
+        rocblas_status checks_status = rocblas_reduction_64_setup<NB, To>(
+            handle, n, x, incx, results, rocblas_asum_name<Ti>, dev_bytes);
+        if(checks_status != rocblas_status_continue)
+        {
+            return checks_status;
+        }
+
+        auto check_numerics = handle->check_numerics;
+        if(check_numerics)
+        {
+            rocblas_status check_numerics_status = rocblas_reduction_64_check_numerics(
+                rocblas_asum_name<Ti>, handle, n, x, incx, check_numerics, true);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+        {
+            return rocblas_status_memory_error;
+        }
+
+        // Sums are reproducible in rocblas_reduction_mode_reproducible
+        auto algorithms = handle->push_reduction_algorithms();
+        rocblas_status status = rocblas_status_success;
+        if(n <= c_i64_chunk)
+        {
+            status = rocblas_asum_template<NB>(handle,
+                                               rocblas_int(n),
+                                               x,
+                                               shiftx_0,
+                                               rocblas_int(incx),
+                                               (To*)w_mem,
+                                               results);
+        }
+        else
+        {
+            // The sums of the chunks are summed on the host
+            auto pointer_mode = handle->pointer_mode;
+            To   sum(0);
+            {
+                auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+                for(int64_t start = 0; start < n; start += c_i64_chunk)
+                {
+                    To partial;
+                    status = rocblas_asum_template<NB>(
+                        handle,
+                        rocblas_int(std::min(n - start, c_i64_chunk)),
+                        x + start * incx,
+                        shiftx_0,
+                        rocblas_int(incx),
+                        (To*)w_mem,
+                        &partial);
+                    if(status != rocblas_status_success)
+                        return status;
+                    sum += partial;
+                }
+            }
+            status = rocblas_i64_set_result(handle, pointer_mode, results, sum);
+        }
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            rocblas_status check_numerics_status = rocblas_reduction_64_check_numerics(
+                rocblas_asum_name<Ti>, handle, n, x, incx, check_numerics, false);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL IS ALREADY DEFINED
+#endif
+
+#define IMPL(name_, typei_, typeo_)                                                       \
+    rocblas_status name_(                                                                 \
+        rocblas_handle handle, int64_t n, const typei_* x, int64_t incx, typeo_* results) \
+    try                                                                                   \
+    {                                                                                     \
+        constexpr rocblas_int NB = 512;                                                   \
+        return rocblas_asum_64_impl<NB>(handle, n, x, incx, results);                     \
+    }                                                                                     \
+    catch(...)                                                                            \
+    {                                                                                     \
+        return exception_to_rocblas_status();                                             \
+    }
+
+IMPL(rocblas_sasum_64, float, float);
+IMPL(rocblas_dasum_64, double, double);
+IMPL(rocblas_scasum_64, rocblas_float_complex, float);
+IMPL(rocblas_dzasum_64, rocblas_double_complex, double);
+
+#undef IMPL
+
+} // extern "C"
@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "check_numerics_vector.hpp"
+#include "handle.hpp"
+#include "rocblas.h"
+
+//!
+//! @brief General template to compute w = a * x + b * y. y and w may be the same vector, which
+//! computes y = a * x + b * y.
+//!
+template <int NB, typename T, typename Tx, typename Tw>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_waxpby_template(rocblas_handle handle,
+                                     rocblas_int    n,
+                                     const T*       alpha,
+                                     Tx             x,
+                                     rocblas_stride offset_x,
+                                     rocblas_int    incx,
+                                     rocblas_stride stride_x,
+                                     const T*       beta,
+                                     Tx             y,
+                                     rocblas_stride offset_y,
+                                     rocblas_int    incy,
+                                     rocblas_stride stride_y,
+                                     Tw             w,
+                                     rocblas_stride offset_w,
+                                     rocblas_int    incw,
+                                     rocblas_stride stride_w,
+                                     rocblas_int    batch_count);
+
+template <typename Tx, typename Tw>
+rocblas_status rocblas_waxpby_check_numerics(const char*    function_name,
+                                             rocblas_handle handle,
+                                             rocblas_int    n,
+                                             Tx             x,
+                                             rocblas_stride offset_x,
+                                             rocblas_int    inc_x,
+                                             rocblas_stride stride_x,
+                                             Tx             y,
+                                             rocblas_stride offset_y,
+                                             rocblas_int    inc_y,
+                                             rocblas_stride stride_y,
+                                             Tw             w,
+                                             rocblas_stride offset_w,
+                                             rocblas_int    inc_w,
+                                             rocblas_stride stride_w,
+                                             rocblas_int    batch_count,
+                                             const int      check_numerics,
+                                             bool           is_input)
+{
+    // The inputs x and y are checked before, and the output w after the computation
+    if(is_input)
+    {
+        rocblas_status check_numerics_status
+            = rocblas_internal_check_numerics_vector_template(function_name,
+                                                              handle,
+                                                              n,
+                                                              x,
+                                                              offset_x,
+                                                              inc_x,
+                                                              stride_x,
+                                                              batch_count,
+                                                              check_numerics,
+                                                              is_input);
+        if(check_numerics_status != rocblas_status_success)
+            return check_numerics_status;
+
+        return rocblas_internal_check_numerics_vector_template(function_name,
+                                                               handle,
+                                                               n,
+                                                               y,
+                                                               offset_y,
+                                                               inc_y,
+                                                               stride_y,
+                                                               batch_count,
+                                                               check_numerics,
+                                                               is_input);
+    }
+
+    return rocblas_internal_check_numerics_vector_template(function_name,
+                                                           handle,
+                                                           n,
+                                                           w,
+                                                           offset_w,
+                                                           inc_w,
+                                                           stride_w,
+                                                           batch_count,
+                                                           check_numerics,
+                                                           is_input);
+}
@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "rocblas_axpby.hpp"
+
+//!
+//! @brief General kernel (batched, strided batched) of waxpby. x is not read if alpha == 0, and y
+//! is not read if beta == 0, so that NaNs in them do not propagate to w.
+//! @remark y and w may be the same vector, so they are not restrict.
+//!
+template <rocblas_int NB, typename Ta, typename Tx, typename Tw>
+ROCBLAS_KERNEL(NB)
+waxpby_kernel(rocblas_int    n,
+              Ta             alpha_device_host,
+              Tx __restrict__ x,
+              ptrdiff_t      offset_x,
+              rocblas_int    incx,
+              rocblas_stride stride_x,
+              Ta             beta_device_host,
+              Tx             y,
+              ptrdiff_t      offset_y,
+              rocblas_int    incy,
+              rocblas_stride stride_y,
+              Tw             w,
+              ptrdiff_t      offset_w,
+              rocblas_int    incw,
+              rocblas_stride stride_w)
+{
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    ptrdiff_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(tid < n)
+    {
+        auto tw = load_ptr_batch(w, hipBlockIdx_y, offset_w + tid * incw, stride_w);
+
+        decltype(alpha) sum(0);
+        if(alpha != 0)
+            sum = alpha * (*load_ptr_batch(x, hipBlockIdx_y, offset_x + tid * incx, stride_x));
+        if(beta != 0)
+            sum += beta * (*load_ptr_batch(y, hipBlockIdx_y, offset_y + tid * incy, stride_y));
+
+        *tw = sum;
+    }
+}
+
+//!
+//! @brief General template to compute w = a * x + b * y.
+//!
+template <int NB, typename T, typename Tx, typename Tw>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_waxpby_template(rocblas_handle handle,
+                                     rocblas_int    n,
+                                     const T*       alpha,
+                                     Tx             x,
+                                     rocblas_stride offset_x,
+                                     rocblas_int    incx,
+                                     rocblas_stride stride_x,
+                                     const T*       beta,
+                                     Tx             y,
+                                     rocblas_stride offset_y,
+                                     rocblas_int    incy,
+                                     rocblas_stride stride_y,
+                                     Tw             w,
+                                     rocblas_stride offset_w,
+                                     rocblas_int    incw,
+                                     rocblas_stride stride_w,
+                                     rocblas_int    batch_count)
+{
+    if(n <= 0 || batch_count <= 0) // Quick return if possible. Not Argument error
+    {
+        return rocblas_status_success;
+    }
+
+    ptrdiff_t shift_x = offset_x + ((incx < 0) ? ptrdiff_t(incx) * (1 - n) : 0);
+    ptrdiff_t shift_y = offset_y + ((incy < 0) ? ptrdiff_t(incy) * (1 - n) : 0);
+    ptrdiff_t shift_w = offset_w + ((incw < 0) ? ptrdiff_t(incw) * (1 - n) : 0);
+
+    dim3 blocks((n - 1) / NB + 1, batch_count);
+    dim3 threads(NB);
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        // clang-format off
+        hipLaunchKernelGGL((waxpby_kernel<NB>), blocks, threads, 0, handle->get_stream(), n,
+                           alpha, x, shift_x, incx, stride_x, beta, y, shift_y, incy, stride_y,
+                           w, shift_w, incw, stride_w);
+        // clang-format on
+    }
+    else
+    {
+        // clang-format off
+        hipLaunchKernelGGL((waxpby_kernel<NB>), blocks, threads, 0, handle->get_stream(), n,
+                           *alpha, x, shift_x, incx, stride_x, *beta, y, shift_y, incy, stride_y,
+                           w, shift_w, incw, stride_w);
+        // clang-format on
+    }
+    return rocblas_status_success;
+}
+
+// If there are any changes in template parameters in the files *axpby*.cpp
+// instantiations below will need to be manually updated to match the changes.
+
+// clang-format off
+#ifdef INSTANTIATE_WAXPBY_TEMPLATE
+#error INSTANTIATE_WAXPBY_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_WAXPBY_TEMPLATE(NB_, T_, Tx_, Tw_)                        \
+template ROCBLAS_INTERNAL_EXPORT_NOINLINE                                     \
+rocblas_status rocblas_internal_waxpby_template<NB_, T_, Tx_, Tw_>            \
+                                                (rocblas_handle handle,       \
+                                                 rocblas_int    n,            \
+                                                 const T_*      alpha,        \
+                                                 Tx_            x,            \
+                                                 rocblas_stride offset_x,     \
+                                                 rocblas_int    incx,         \
+                                                 rocblas_stride stride_x,     \
+                                                 const T_*      beta,         \
+                                                 Tx_            y,            \
+                                                 rocblas_stride offset_y,     \
+                                                 rocblas_int    incy,         \
+                                                 rocblas_stride stride_y,     \
+                                                 Tw_            w,            \
+                                                 rocblas_stride offset_w,     \
+                                                 rocblas_int    incw,         \
+                                                 rocblas_stride stride_w,     \
+                                                 rocblas_int    batch_count);
+
+// rocblas_Xaxpby, rocblas_Xwaxpby and their strided batched forms
+INSTANTIATE_WAXPBY_TEMPLATE(256, float, float const*, float*)
+INSTANTIATE_WAXPBY_TEMPLATE(256, double, double const*, double*)
+INSTANTIATE_WAXPBY_TEMPLATE(256, rocblas_float_complex, rocblas_float_complex const*, rocblas_float_complex*)
+INSTANTIATE_WAXPBY_TEMPLATE(256, rocblas_double_complex, rocblas_double_complex const*, rocblas_double_complex*)
+
+// rocblas_Xaxpby_batched and rocblas_Xwaxpby_batched
+INSTANTIATE_WAXPBY_TEMPLATE(256, float, float const* const*, float* const*)
+INSTANTIATE_WAXPBY_TEMPLATE(256, double, double const* const*, double* const*)
+INSTANTIATE_WAXPBY_TEMPLATE(256, rocblas_float_complex, rocblas_float_complex const* const*, rocblas_float_complex* const*)
+INSTANTIATE_WAXPBY_TEMPLATE(256, rocblas_double_complex, rocblas_double_complex const* const*, rocblas_double_complex* const*)
+
+#undef INSTANTIATE_WAXPBY_TEMPLATE
+// clang-format on
@@ -0,0 +1,230 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "logging.hpp"
+#include "rocblas_axpby.hpp"
+
+namespace
+{
+
+    template <typename>
+    constexpr char rocblas_axpby_strided_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_axpby_strided_batched_name<float>[] = "rocblas_saxpby_strided_batched";
+    template <>
+    constexpr char rocblas_axpby_strided_batched_name<double>[] = "rocblas_daxpby_strided_batched";
+    template <>
+    constexpr char rocblas_axpby_strided_batched_name<rocblas_float_complex>[]
+        = "rocblas_caxpby_strided_batched";
+    template <>
+    constexpr char rocblas_axpby_strided_batched_name<rocblas_double_complex>[]
+        = "rocblas_zaxpby_strided_batched";
+
+    template <int NB, typename T>
+    rocblas_status rocblas_axpby_strided_batched_impl(rocblas_handle handle,
+                                                      rocblas_int    n,
+                                                      const T*       alpha,
+                                                      const T*       x,
+                                                      rocblas_int    incx,
+                                                      rocblas_stride stridex,
+                                                      const T*       beta,
+                                                      T*             y,
+                                                      rocblas_int    incy,
+                                                      rocblas_stride stridey,
+                                                      rocblas_int    batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_axpby_strided_batched_name<T>,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      x,
+                      incx,
+                      stridex,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      y,
+                      incy,
+                      stridey,
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      "./rocblas-bench -f axpby_strided_batched -r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                      "--incx",
+                      incx,
+                      "--stride_x",
+                      stridex,
+                      LOG_BENCH_SCALAR_VALUE(handle, beta),
+                      "--incy",
+                      incy,
+                      "--stride_y",
+                      stridey,
+                      "--batch_count",
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        rocblas_axpby_strided_batched_name<T>,
+                        "N",
+                        n,
+                        "incx",
+                        incx,
+                        "stride_x",
+                        stridex,
+                        "incy",
+                        incy,
+                        "stride_y",
+                        stridey,
+                        "batch_count",
+                        batch_count);
+
+        if(n <= 0 || batch_count <= 0) // Quick return if possible. Not Argument error
+            return rocblas_status_success;
+
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            if(*alpha == 0 && *beta == 1)
+                return rocblas_status_success;
+        }
+
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        static constexpr ptrdiff_t offset_0 = 0;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status axpby_check_numerics_status
+                = rocblas_waxpby_check_numerics(rocblas_axpby_strided_batched_name<T>,
+                                                handle,
+                                                n,
+                                                x,
+                                                offset_0,
+                                                incx,
+                                                stridex,
+                                                (const T*)y,
+                                                offset_0,
+                                                incy,
+                                                stridey,
+                                                y,
+                                                offset_0,
+                                                incy,
+                                                stridey,
+                                                batch_count,
+                                                check_numerics,
+                                                is_input);
+            if(axpby_check_numerics_status != rocblas_status_success)
+                return axpby_check_numerics_status;
+        }
+
+        rocblas_status status = rocblas_internal_waxpby_template<NB>(handle,
+                                                                     n,
+                                                                     alpha,
+                                                                     x,
+                                                                     offset_0,
+                                                                     incx,
+                                                                     stridex,
+                                                                     beta,
+                                                                     (const T*)y,
+                                                                     offset_0,
+                                                                     incy,
+                                                                     stridey,
+                                                                     y,
+                                                                     offset_0,
+                                                                     incy,
+                                                                     stridey,
+                                                                     batch_count);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status axpby_check_numerics_status
+                = rocblas_waxpby_check_numerics(rocblas_axpby_strided_batched_name<T>,
+                                                handle,
+                                                n,
+                                                x,
+                                                offset_0,
+                                                incx,
+                                                stridex,
+                                                (const T*)y,
+                                                offset_0,
+                                                incy,
+                                                stridey,
+                                                y,
+                                                offset_0,
+                                                incy,
+                                                stridey,
+                                                batch_count,
+                                                check_numerics,
+                                                is_input);
+            if(axpby_check_numerics_status != rocblas_status_success)
+                return axpby_check_numerics_status;
+        }
+        return status;
+    }
+
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                       \
+    rocblas_status routine_name_(rocblas_handle handle,                               \
+                                 rocblas_int    n,                                    \
+                                 const T_*      alpha,                                \
+                                 const T_*      x,                                    \
+                                 rocblas_int    incx,                                 \
+                                 rocblas_stride stridex,                              \
+                                 const T_*      beta,                                 \
+                                 T_*            y,                                    \
+                                 rocblas_int    incy,                                 \
+                                 rocblas_stride stridey,                              \
+                                 rocblas_int    batch_count)                          \
+    try                                                                               \
+    {                                                                                 \
+        return rocblas_axpby_strided_batched_impl<256>(                               \
+            handle, n, alpha, x, incx, stridex, beta, y, incy, stridey, batch_count); \
+    }                                                                                 \
+    catch(...)                                                                        \
+    {                                                                                 \
+        return exception_to_rocblas_status();                                         \
+    }
+
+IMPL(rocblas_saxpby_strided_batched, float);
+IMPL(rocblas_daxpby_strided_batched, double);
+IMPL(rocblas_caxpby_strided_batched, rocblas_float_complex);
+IMPL(rocblas_zaxpby_strided_batched, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
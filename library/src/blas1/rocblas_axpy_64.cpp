@@ -0,0 +1,180 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_axpy.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+
+namespace
+{
+
+    template <typename>
+    constexpr char rocblas_axpy_name[] = "unknown";
+    template <>
+    constexpr char rocblas_axpy_name<float>[] = "rocblas_saxpy_64";
+    template <>
+    constexpr char rocblas_axpy_name<double>[] = "rocblas_daxpy_64";
+    template <>
+    constexpr char rocblas_axpy_name<rocblas_half>[] = "rocblas_haxpy_64";
+    template <>
+    constexpr char rocblas_axpy_name<rocblas_float_complex>[] = "rocblas_caxpy_64";
+    template <>
+    constexpr char rocblas_axpy_name<rocblas_double_complex>[] = "rocblas_zaxpy_64";
+
+    template <typename T>
+    rocblas_status rocblas_axpy_64_check_numerics(rocblas_handle handle,
+                                                  int64_t        n,
+                                                  const T*       x,
+                                                  int64_t        incx,
+                                                  T*             y,
+                                                  int64_t        incy,
+                                                  const int      check_numerics,
+                                                  bool           is_input)
+    {
+        for(int64_t start = 0; start < n; start += c_i64_chunk)
+        {
+            rocblas_i64_elementwise_chunk chunk(n, start, incx, incy);
+            rocblas_status                status
+                = rocblas_axpy_check_numerics(rocblas_axpy_name<T>,
+                                              handle,
+                                              chunk.n(),
+                                              x + chunk.offset(incx),
+                                              0,
+                                              chunk.inc(incx),
+                                              chunk.stride(incx),
+                                              y + chunk.offset(incy),
+                                              0,
+                                              chunk.inc(incy),
+                                              chunk.stride(incy),
+                                              chunk.batch_count(),
+                                              check_numerics,
+                                              is_input);
+            if(status != rocblas_status_success)
+                return status;
+        }
+        return rocblas_status_success;
+    }
+
+    template <int NB, typename T>
+    rocblas_status rocblas_axpy_64_impl(rocblas_handle handle,
+                                        int64_t        n,
+                                        const T*       alpha,
+                                        const T*       x,
+                                        int64_t        incx,
+                                        T*             y,
+                                        int64_t        incy)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_axpy_name<T>,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      x,
+                      incx,
+                      y,
+                      incy);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, rocblas_axpy_name<T>, "N", n, "incx", incx, "incy", incy);
+
+        if(n <= 0) // Quick return if possible. Not Argument error
+            return rocblas_status_success;
+
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            if(*alpha == 0)
+                return rocblas_status_success;
+        }
+
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        if(check_numerics)
+        {
+            rocblas_status status = rocblas_axpy_64_check_numerics(
+                handle, n, x, incx, y, incy, check_numerics, true);
+            if(status != rocblas_status_success)
+                return status;
+        }
+
+        // The chunks are independent, and alpha is read by each of them in either pointer mode
+        for(int64_t start = 0; start < n; start += c_i64_chunk)
+        {
+            rocblas_i64_elementwise_chunk chunk(n, start, incx, incy);
+            rocblas_status                status
+                = rocblas_internal_axpy_template<NB, T>(handle,
+                                                        chunk.n(),
+                                                        alpha,
+                                                        0,
+                                                        x + chunk.offset(incx),
+                                                        0,
+                                                        chunk.inc(incx),
+                                                        chunk.stride(incx),
+                                                        y + chunk.offset(incy),
+                                                        0,
+                                                        chunk.inc(incy),
+                                                        chunk.stride(incy),
+                                                        chunk.batch_count());
+            if(status != rocblas_status_success)
+                return status;
+        }
+
+        if(check_numerics)
+            return rocblas_axpy_64_check_numerics(
+                handle, n, x, incx, y, incy, check_numerics, false);
+
+        return rocblas_status_success;
+    }
+
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                               \
+    rocblas_status routine_name_(rocblas_handle handle,                       \
+                                 int64_t        n,                            \
+                                 const T_*      alpha,                        \
+                                 const T_*      x,                            \
+                                 int64_t        incx,                         \
+                                 T_*            y,                            \
+                                 int64_t        incy)                         \
+    try                                                                       \
+    {                                                                         \
+        return rocblas_axpy_64_impl<256>(handle, n, alpha, x, incx, y, incy); \
+    }                                                                         \
+    catch(...)                                                                \
+    {                                                                         \
+        return exception_to_rocblas_status();                                 \
+    }
+
+IMPL(rocblas_saxpy_64, float);
+IMPL(rocblas_daxpy_64, double);
+IMPL(rocblas_caxpy_64, rocblas_float_complex);
+IMPL(rocblas_zaxpy_64, rocblas_double_complex);
+IMPL(rocblas_haxpy_64, rocblas_half);
+
+#undef IMPL
+
+} // extern "C"
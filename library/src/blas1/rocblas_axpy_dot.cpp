@@ -0,0 +1,227 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_axpy_dot.hpp"
+#include "logging.hpp"
+
+namespace
+{
+
+    // HIP support up to 1024 threads/work itemes per thread block/work group
+    // setting to 512 for gfx803.
+    constexpr int NB = 512;
+
+    template <typename>
+    constexpr char rocblas_axpy_dot_name[] = "unknown";
+    template <>
+    constexpr char rocblas_axpy_dot_name<float>[] = "rocblas_saxpy_dot";
+    template <>
+    constexpr char rocblas_axpy_dot_name<double>[] = "rocblas_daxpy_dot";
+    template <>
+    constexpr char rocblas_axpy_dot_name<rocblas_float_complex>[] = "rocblas_caxpy_dotc";
+    template <>
+    constexpr char rocblas_axpy_dot_name<rocblas_double_complex>[] = "rocblas_zaxpy_dotc";
+
+    // allocate workspace inside this API
+    template <typename T>
+    rocblas_status rocblas_axpy_dot_impl(rocblas_handle handle,
+                                         rocblas_int    n,
+                                         const T*       alpha,
+                                         const T*       x,
+                                         rocblas_int    incx,
+                                         T*             y,
+                                         rocblas_int    incy,
+                                         const T*       z,
+                                         rocblas_int    incz,
+                                         T*             result)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
+        size_t dev_bytes = rocblas_axpy_dot_workspace_size<NB, T>(handle, n, 1, 1);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_axpy_dot_name<T>,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      x,
+                      incx,
+                      y,
+                      incy,
+                      z,
+                      incz);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      "./rocblas-bench -f axpy_dot -r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                      "--incx",
+                      incx,
+                      "--incy",
+                      incy,
+                      "--incz",
+                      incz);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(
+                handle, rocblas_axpy_dot_name<T>, "N", n, "incx", incx, "incy", incy, "incz", incz);
+
+        // Quick return if possible.
+        if(n <= 0)
+        {
+            if(!result)
+                return rocblas_status_invalid_pointer;
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+                RETURN_IF_HIP_ERROR(
+                    hipMemsetAsync(result, 0, sizeof(*result), handle->get_stream()));
+            else
+                *result = T(0);
+            return rocblas_status_success;
+        }
+
+        if(!alpha || !x || !y || !z || !result)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        static constexpr rocblas_stride stride_0 = 0;
+        static constexpr rocblas_stride offset_0 = 0;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status axpy_dot_check_numerics_status
+                = rocblas_axpy_dot_check_numerics(rocblas_axpy_dot_name<T>,
+                                                  handle,
+                                                  n,
+                                                  x,
+                                                  offset_0,
+                                                  incx,
+                                                  stride_0,
+                                                  y,
+                                                  offset_0,
+                                                  incy,
+                                                  stride_0,
+                                                  z,
+                                                  offset_0,
+                                                  incz,
+                                                  stride_0,
+                                                  1,
+                                                  check_numerics,
+                                                  is_input);
+            if(axpy_dot_check_numerics_status != rocblas_status_success)
+                return axpy_dot_check_numerics_status;
+        }
+
+        // Sums are reproducible in rocblas_reduction_mode_reproducible
+        auto algorithms = handle->push_reduction_algorithms();
+        rocblas_status status
+            = rocblas_internal_axpy_dot_template<NB, is_complex<T>>(handle,
+                                                                    n,
+                                                                    alpha,
+                                                                    x,
+                                                                    offset_0,
+                                                                    incx,
+                                                                    stride_0,
+                                                                    y,
+                                                                    offset_0,
+                                                                    incy,
+                                                                    stride_0,
+                                                                    z,
+                                                                    offset_0,
+                                                                    incz,
+                                                                    stride_0,
+                                                                    1,
+                                                                    result,
+                                                                    (T*)w_mem);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status axpy_dot_check_numerics_status
+                = rocblas_axpy_dot_check_numerics(rocblas_axpy_dot_name<T>,
+                                                  handle,
+                                                  n,
+                                                  x,
+                                                  offset_0,
+                                                  incx,
+                                                  stride_0,
+                                                  y,
+                                                  offset_0,
+                                                  incy,
+                                                  stride_0,
+                                                  z,
+                                                  offset_0,
+                                                  incz,
+                                                  stride_0,
+                                                  1,
+                                                  check_numerics,
+                                                  is_input);
+            if(axpy_dot_check_numerics_status != rocblas_status_success)
+                return axpy_dot_check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                            \
+    rocblas_status routine_name_(rocblas_handle handle,                                    \
+                                 rocblas_int    n,                                         \
+                                 const T_*      alpha,                                     \
+                                 const T_*      x,                                         \
+                                 rocblas_int    incx,                                      \
+                                 T_*            y,                                         \
+                                 rocblas_int    incy,                                      \
+                                 const T_*      z,                                         \
+                                 rocblas_int    incz,                                      \
+                                 T_*            result)                                    \
+    try                                                                                    \
+    {                                                                                      \
+        return rocblas_axpy_dot_impl(handle, n, alpha, x, incx, y, incy, z, incz, result); \
+    }                                                                                      \
+    catch(...)                                                                             \
+    {                                                                                      \
+        return exception_to_rocblas_status();                                              \
+    }
+
+IMPL(rocblas_saxpy_dot, float);
+IMPL(rocblas_daxpy_dot, double);
+IMPL(rocblas_caxpy_dotc, rocblas_float_complex);
+IMPL(rocblas_zaxpy_dotc, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
@@ -0,0 +1,466 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "check_numerics_vector.hpp"
+#include "handle.hpp"
+#include "rocblas_axpy.hpp"
+#include "rocblas_dot.hpp"
+
+// Fused kernels of the Krylov solvers, which read each vector once instead of once per call of
+// axpy and dot. Their partial sums are reduced as in rocblas_internal_dot_template.
+
+template <rocblas_int NB,
+          rocblas_int WIN,
+          bool        CONJ,
+          typename T,
+          typename Ta,
+          typename Tx,
+          typename Ty>
+ROCBLAS_KERNEL(NB)
+rocblas_axpy_dot_kernel(rocblas_int n,
+                        Ta          alpha_device_host,
+                        Tx __restrict__ xa,
+                        rocblas_stride shiftx,
+                        rocblas_int    incx,
+                        rocblas_stride stridex,
+                        Ty             ya,
+                        rocblas_stride shifty,
+                        rocblas_int    incy,
+                        rocblas_stride stridey,
+                        Tx             za,
+                        rocblas_stride shiftz,
+                        rocblas_int    incz,
+                        rocblas_stride stridez,
+                        bool           z_is_y,
+                        T* __restrict__ workspace,
+                        T* __restrict__ out)
+{
+    auto     alpha = load_scalar(alpha_device_host);
+    const T* x     = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
+    T*       y     = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
+    const T* z     = load_ptr_batch(za, hipBlockIdx_y, shiftz, stridez);
+
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    T sum = 0;
+
+    // update and sum WIN elements per thread
+    int inc = hipBlockDim_x * hipGridDim_x;
+    for(int j = 0; j < WIN && i < n; j++, i += inc)
+    {
+        T yi = y[i * incy];
+        if(alpha != 0)
+        {
+            yi += alpha * x[i * incx];
+            y[i * incy] = yi;
+        }
+
+        // if z is y, reuse the updated element instead of reading it again
+        sum += (z_is_y ? yi : z[i * incz]) * (CONJ ? conj(yi) : yi);
+    }
+    sum = rocblas_dot_block_reduce<NB>(sum);
+
+    rocblas_dot_save_sum<false>(sum, workspace, out);
+}
+
+template <rocblas_int NB, rocblas_int WIN, bool CONJ, typename T, typename Tx>
+ROCBLAS_KERNEL(NB)
+rocblas_dot2_kernel(rocblas_int n,
+                    Tx __restrict__ xa,
+                    rocblas_stride shiftx,
+                    rocblas_int    incx,
+                    rocblas_stride stridex,
+                    Tx __restrict__ ya,
+                    rocblas_stride shifty,
+                    rocblas_int    incy,
+                    rocblas_stride stridey,
+                    Tx __restrict__ za,
+                    rocblas_stride shiftz,
+                    rocblas_int    incz,
+                    rocblas_stride stridez,
+                    T* __restrict__ workspace,
+                    T* __restrict__ out)
+{
+    const T* x = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
+    const T* y = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
+    const T* z = load_ptr_batch(za, hipBlockIdx_y, shiftz, stridez);
+
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    T sum_y = 0, sum_z = 0;
+
+    // sum WIN elements per thread, reading each element of x once for both sums
+    int inc = hipBlockDim_x * hipGridDim_x;
+    for(int j = 0; j < WIN && i < n; j++, i += inc)
+    {
+        T xi = CONJ ? conj(x[i * incx]) : x[i * incx];
+        sum_y += y[i * incy] * xi;
+        sum_z += z[i * incz] * xi;
+    }
+    sum_y = rocblas_dot_block_reduce<NB>(sum_y);
+    __syncthreads(); // the two block reductions share their shared memory
+    sum_z = rocblas_dot_block_reduce<NB>(sum_z);
+
+    // the sums with z are stored after those with y of all of the batches
+    if(hipThreadIdx_x == 0)
+    {
+        if(hipGridDim_x == 1) // small N avoid second kernel
+        {
+            out[hipBlockIdx_y]                = sum_y;
+            out[hipBlockIdx_y + hipGridDim_y] = sum_z;
+        }
+        else
+        {
+            workspace[hipBlockIdx_x + hipBlockIdx_y * hipGridDim_x] = sum_y;
+            workspace[hipBlockIdx_x + (hipBlockIdx_y + hipGridDim_y) * hipGridDim_x] = sum_z;
+        }
+    }
+}
+
+/*! \brief rocblas_axpy_dot_workspace_size
+    Work area of axpy_dot (n_dots = 1) and dot2 (n_dots = 2): the partial sums of the blocks
+    and the results in host pointer mode, or the work area of the dot products of
+    rocblas_reduction_mode_reproducible
+    ********************************************************************/
+template <rocblas_int NB, typename T>
+size_t rocblas_axpy_dot_workspace_size(rocblas_handle handle,
+                                       rocblas_int    n,
+                                       rocblas_int    batch_count,
+                                       rocblas_int    n_dots)
+{
+    static constexpr int WIN = rocblas_dot_WIN<T>();
+
+    size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB * WIN, T>(
+        n, batch_count > 0 ? n_dots * batch_count : 1);
+    if(handle->reduction_mode == rocblas_reduction_mode_reproducible)
+        dev_bytes = std::max(dev_bytes, rocblas_reduction_repro_workspace_size(n, batch_count));
+    return dev_bytes;
+}
+
+// Launch the second kernel of the reduction, if there is more than one block, and copy the
+// results of host pointer mode to the host
+template <rocblas_int NB, rocblas_int WIN, typename T>
+rocblas_status rocblas_axpy_dot_finish(rocblas_handle handle,
+                                       rocblas_int    blocks,
+                                       rocblas_int    n_results,
+                                       T*             workspace,
+                                       T*             output,
+                                       T*             results)
+{
+    if(blocks > 1) // if single block first kernel did all work
+        hipLaunchKernelGGL((rocblas_dot_kernel_reduce<NB, WIN>),
+                           dim3(1, n_results),
+                           dim3(NB),
+                           0,
+                           handle->get_stream(),
+                           blocks,
+                           workspace,
+                           output);
+
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[0],
+                                           output,
+                                           sizeof(T) * n_results,
+                                           hipMemcpyDeviceToHost,
+                                           handle->get_stream()));
+
+    return rocblas_status_success;
+}
+
+/*! \brief
+
+    \details
+    rocblas_internal_axpy_dot_template computes y := alpha * x + y, and the dot product of the
+    updated y and z, conjugating y if CONJ, reading y once. z may be the same vector as y, but
+    must not overlap y otherwise.
+    When the API call selects the reproducible algorithms of rocblas_reduction_mode_reproducible,
+    axpy is followed by the reproducible dot product.
+    The workspace must have rocblas_axpy_dot_workspace_size<NB, T>(handle, n, batch_count, 1)
+    bytes, and n and batch_count must be positive.
+    ********************************************************************/
+template <rocblas_int NB, bool CONJ, typename T, typename Tx, typename Ty>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_axpy_dot_template(rocblas_handle __restrict__ handle,
+                                       rocblas_int    n,
+                                       const T*       alpha,
+                                       Tx             x,
+                                       rocblas_stride offsetx,
+                                       rocblas_int    incx,
+                                       rocblas_stride stridex,
+                                       Ty             y,
+                                       rocblas_stride offsety,
+                                       rocblas_int    incy,
+                                       rocblas_stride stridey,
+                                       Tx             z,
+                                       rocblas_stride offsetz,
+                                       rocblas_int    incz,
+                                       rocblas_stride stridez,
+                                       rocblas_int    batch_count,
+                                       T* __restrict__ results,
+                                       T* __restrict__ workspace)
+{
+    static constexpr int WIN = rocblas_dot_WIN<T>();
+
+    if(handle->reduction_algorithms.reproducible)
+    {
+        static constexpr rocblas_stride stride_0 = 0;
+        RETURN_IF_ROCBLAS_ERROR((rocblas_internal_axpy_template<256, T>(handle,
+                                                                        n,
+                                                                        alpha,
+                                                                        stride_0,
+                                                                        x,
+                                                                        offsetx,
+                                                                        incx,
+                                                                        stridex,
+                                                                        y,
+                                                                        offsety,
+                                                                        incy,
+                                                                        stridey,
+                                                                        batch_count)));
+
+        return rocblas_internal_dot_template<NB, CONJ, T>(handle,
+                                                          n,
+                                                          Tx(y),
+                                                          offsety,
+                                                          incy,
+                                                          stridey,
+                                                          z,
+                                                          offsetz,
+                                                          incz,
+                                                          stridez,
+                                                          batch_count,
+                                                          results,
+                                                          workspace);
+    }
+
+    bool z_is_y = z == y && offsetz == offsety && incz == incy && stridez == stridey;
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
+    auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
+    auto shiftz = incz < 0 ? offsetz - ptrdiff_t(incz) * (n - 1) : offsetz;
+
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+    dim3        grid(blocks, batch_count);
+    dim3        threads(NB);
+    T*          output = results;
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+        output = workspace + size_t(batch_count) * blocks;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+        hipLaunchKernelGGL((rocblas_axpy_dot_kernel<NB, WIN, CONJ, T>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           n,
+                           alpha,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           z,
+                           shiftz,
+                           incz,
+                           stridez,
+                           z_is_y,
+                           workspace,
+                           output);
+    else
+        hipLaunchKernelGGL((rocblas_axpy_dot_kernel<NB, WIN, CONJ, T>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           n,
+                           *alpha,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           z,
+                           shiftz,
+                           incz,
+                           stridez,
+                           z_is_y,
+                           workspace,
+                           output);
+
+    return rocblas_axpy_dot_finish<NB, WIN>(
+        handle, blocks, batch_count, workspace, output, results);
+}
+
+/*! \brief
+
+    \details
+    rocblas_internal_dot2_template computes the dot products of x and y, and of x and z,
+    conjugating x if CONJ, reading x once. results[b] is the product of x_b and y_b, and
+    results[batch_count + b] the product of x_b and z_b.
+    When the API call selects the reproducible algorithms of rocblas_reduction_mode_reproducible,
+    the two products are the reproducible dot products.
+    The workspace must have rocblas_axpy_dot_workspace_size<NB, T>(handle, n, batch_count, 2)
+    bytes, and n and batch_count must be positive.
+    ********************************************************************/
+template <rocblas_int NB, bool CONJ, typename T, typename Tx>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_dot2_template(rocblas_handle __restrict__ handle,
+                                   rocblas_int    n,
+                                   Tx             x,
+                                   rocblas_stride offsetx,
+                                   rocblas_int    incx,
+                                   rocblas_stride stridex,
+                                   Tx             y,
+                                   rocblas_stride offsety,
+                                   rocblas_int    incy,
+                                   rocblas_stride stridey,
+                                   Tx             z,
+                                   rocblas_stride offsetz,
+                                   rocblas_int    incz,
+                                   rocblas_stride stridez,
+                                   rocblas_int    batch_count,
+                                   T* __restrict__ results,
+                                   T* __restrict__ workspace)
+{
+    static constexpr int WIN = rocblas_dot_WIN<T>();
+
+    if(handle->reduction_algorithms.reproducible)
+    {
+        RETURN_IF_ROCBLAS_ERROR((rocblas_internal_dot_template<NB, CONJ, T>(handle,
+                                                                            n,
+                                                                            x,
+                                                                            offsetx,
+                                                                            incx,
+                                                                            stridex,
+                                                                            y,
+                                                                            offsety,
+                                                                            incy,
+                                                                            stridey,
+                                                                            batch_count,
+                                                                            results,
+                                                                            workspace)));
+
+        return rocblas_internal_dot_template<NB, CONJ, T>(handle,
+                                                          n,
+                                                          x,
+                                                          offsetx,
+                                                          incx,
+                                                          stridex,
+                                                          z,
+                                                          offsetz,
+                                                          incz,
+                                                          stridez,
+                                                          batch_count,
+                                                          results + batch_count,
+                                                          workspace);
+    }
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
+    auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
+    auto shiftz = incz < 0 ? offsetz - ptrdiff_t(incz) * (n - 1) : offsetz;
+
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+    dim3        grid(blocks, batch_count);
+    dim3        threads(NB);
+    T*          output = results;
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+        output = workspace + size_t(2) * batch_count * blocks;
+
+    hipLaunchKernelGGL((rocblas_dot2_kernel<NB, WIN, CONJ, T>),
+                       grid,
+                       threads,
+                       0,
+                       handle->get_stream(),
+                       n,
+                       x,
+                       shiftx,
+                       incx,
+                       stridex,
+                       y,
+                       shifty,
+                       incy,
+                       stridey,
+                       z,
+                       shiftz,
+                       incz,
+                       stridez,
+                       workspace,
+                       output);
+
+    return rocblas_axpy_dot_finish<NB, WIN>(
+        handle, blocks, 2 * batch_count, workspace, output, results);
+}
+
+template <typename Tx, typename Ty>
+rocblas_status rocblas_axpy_dot_check_numerics(const char*    function_name,
+                                               rocblas_handle handle,
+                                               rocblas_int    n,
+                                               Tx             x,
+                                               rocblas_stride offset_x,
+                                               rocblas_int    inc_x,
+                                               rocblas_stride stride_x,
+                                               Ty             y,
+                                               rocblas_stride offset_y,
+                                               rocblas_int    inc_y,
+                                               rocblas_stride stride_y,
+                                               Tx             z,
+                                               rocblas_stride offset_z,
+                                               rocblas_int    inc_z,
+                                               rocblas_stride stride_z,
+                                               rocblas_int    batch_count,
+                                               const int      check_numerics,
+                                               bool           is_input)
+{
+    // The constant vectors x and z are checked only once if is_input is true
+    if(is_input)
+    {
+        rocblas_status check_numerics_status
+            = rocblas_internal_check_numerics_vector_template(function_name,
+                                                              handle,
+                                                              n,
+                                                              x,
+                                                              offset_x,
+                                                              inc_x,
+                                                              stride_x,
+                                                              batch_count,
+                                                              check_numerics,
+                                                              is_input);
+        if(check_numerics_status != rocblas_status_success)
+            return check_numerics_status;
+
+        check_numerics_status = rocblas_internal_check_numerics_vector_template(function_name,
+                                                                                handle,
+                                                                                n,
+                                                                                z,
+                                                                                offset_z,
+                                                                                inc_z,
+                                                                                stride_z,
+                                                                                batch_count,
+                                                                                check_numerics,
+                                                                                is_input);
+        if(check_numerics_status != rocblas_status_success)
+            return check_numerics_status;
+    }
+
+    return rocblas_internal_check_numerics_vector_template(function_name,
+                                                           handle,
+                                                           n,
+                                                           y,
+                                                           offset_y,
+                                                           inc_y,
+                                                           stride_y,
+                                                           batch_count,
+                                                           check_numerics,
+                                                           is_input);
+}
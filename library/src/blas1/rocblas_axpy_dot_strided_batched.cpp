@@ -0,0 +1,280 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "logging.hpp"
+#include "rocblas_axpy_dot.hpp"
+
+namespace
+{
+
+    // HIP support up to 1024 threads/work itemes per thread block/work group
+    // setting to 512 for gfx803.
+    constexpr int NB = 512;
+
+    template <typename>
+    constexpr char rocblas_axpy_dot_strided_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_axpy_dot_strided_batched_name<float>[]
+        = "rocblas_saxpy_dot_strided_batched";
+    template <>
+    constexpr char rocblas_axpy_dot_strided_batched_name<double>[]
+        = "rocblas_daxpy_dot_strided_batched";
+    template <>
+    constexpr char rocblas_axpy_dot_strided_batched_name<rocblas_float_complex>[]
+        = "rocblas_caxpy_dotc_strided_batched";
+    template <>
+    constexpr char rocblas_axpy_dot_strided_batched_name<rocblas_double_complex>[]
+        = "rocblas_zaxpy_dotc_strided_batched";
+
+    // allocate workspace inside this API
+    template <typename T>
+    rocblas_status rocblas_axpy_dot_strided_batched_impl(rocblas_handle handle,
+                                                         rocblas_int    n,
+                                                         const T*       alpha,
+                                                         const T*       x,
+                                                         rocblas_int    incx,
+                                                         rocblas_stride stridex,
+                                                         T*             y,
+                                                         rocblas_int    incy,
+                                                         rocblas_stride stridey,
+                                                         const T*       z,
+                                                         rocblas_int    incz,
+                                                         rocblas_stride stridez,
+                                                         rocblas_int    batch_count,
+                                                         T*             results)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
+        size_t dev_bytes = rocblas_axpy_dot_workspace_size<NB, T>(handle, n, batch_count, 1);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || batch_count <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_axpy_dot_strided_batched_name<T>,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      x,
+                      incx,
+                      stridex,
+                      y,
+                      incy,
+                      stridey,
+                      z,
+                      incz,
+                      stridez,
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      "./rocblas-bench -f axpy_dot_strided_batched -r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                      "--incx",
+                      incx,
+                      "--stride_x",
+                      stridex,
+                      "--incy",
+                      incy,
+                      "--stride_y",
+                      stridey,
+                      "--incz",
+                      incz,
+                      "--batch_count",
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        rocblas_axpy_dot_strided_batched_name<T>,
+                        "N",
+                        n,
+                        "incx",
+                        incx,
+                        "stride_x",
+                        stridex,
+                        "incy",
+                        incy,
+                        "stride_y",
+                        stridey,
+                        "incz",
+                        incz,
+                        "stride_z",
+                        stridez,
+                        "batch_count",
+                        batch_count);
+
+        // Quick return if possible.
+        if(batch_count <= 0)
+            return rocblas_status_success;
+
+        if(n <= 0)
+        {
+            if(!results)
+                return rocblas_status_invalid_pointer;
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                    results, 0, sizeof(*results) * batch_count, handle->get_stream()));
+            else
+                memset(results, 0, sizeof(*results) * batch_count);
+            return rocblas_status_success;
+        }
+
+        if(!alpha || !x || !y || !z || !results)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        static constexpr rocblas_stride offset_0 = 0;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status axpy_dot_check_numerics_status
+                = rocblas_axpy_dot_check_numerics(rocblas_axpy_dot_strided_batched_name<T>,
+                                                  handle,
+                                                  n,
+                                                  x,
+                                                  offset_0,
+                                                  incx,
+                                                  stridex,
+                                                  y,
+                                                  offset_0,
+                                                  incy,
+                                                  stridey,
+                                                  z,
+                                                  offset_0,
+                                                  incz,
+                                                  stridez,
+                                                  batch_count,
+                                                  check_numerics,
+                                                  is_input);
+            if(axpy_dot_check_numerics_status != rocblas_status_success)
+                return axpy_dot_check_numerics_status;
+        }
+
+        // Sums are reproducible in rocblas_reduction_mode_reproducible
+        auto algorithms = handle->push_reduction_algorithms();
+        rocblas_status status
+            = rocblas_internal_axpy_dot_template<NB, is_complex<T>>(handle,
+                                                                    n,
+                                                                    alpha,
+                                                                    x,
+                                                                    offset_0,
+                                                                    incx,
+                                                                    stridex,
+                                                                    y,
+                                                                    offset_0,
+                                                                    incy,
+                                                                    stridey,
+                                                                    z,
+                                                                    offset_0,
+                                                                    incz,
+                                                                    stridez,
+                                                                    batch_count,
+                                                                    results,
+                                                                    (T*)w_mem);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status axpy_dot_check_numerics_status
+                = rocblas_axpy_dot_check_numerics(rocblas_axpy_dot_strided_batched_name<T>,
+                                                  handle,
+                                                  n,
+                                                  x,
+                                                  offset_0,
+                                                  incx,
+                                                  stridex,
+                                                  y,
+                                                  offset_0,
+                                                  incy,
+                                                  stridey,
+                                                  z,
+                                                  offset_0,
+                                                  incz,
+                                                  stridez,
+                                                  batch_count,
+                                                  check_numerics,
+                                                  is_input);
+            if(axpy_dot_check_numerics_status != rocblas_status_success)
+                return axpy_dot_check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                   \
+    rocblas_status routine_name_(rocblas_handle handle,           \
+                                 rocblas_int    n,                \
+                                 const T_*      alpha,            \
+                                 const T_*      x,                \
+                                 rocblas_int    incx,             \
+                                 rocblas_stride stridex,          \
+                                 T_*            y,                \
+                                 rocblas_int    incy,             \
+                                 rocblas_stride stridey,          \
+                                 const T_*      z,                \
+                                 rocblas_int    incz,             \
+                                 rocblas_stride stridez,          \
+                                 rocblas_int    batch_count,      \
+                                 T_*            results)          \
+    try                                                           \
+    {                                                             \
+        return rocblas_axpy_dot_strided_batched_impl(handle,      \
+                                                     n,           \
+                                                     alpha,       \
+                                                     x,           \
+                                                     incx,        \
+                                                     stridex,     \
+                                                     y,           \
+                                                     incy,        \
+                                                     stridey,     \
+                                                     z,           \
+                                                     incz,        \
+                                                     stridez,     \
+                                                     batch_count, \
+                                                     results);    \
+    }                                                             \
+    catch(...)                                                    \
+    {                                                             \
+        return exception_to_rocblas_status();                     \
+    }
+
+IMPL(rocblas_saxpy_dot_strided_batched, float);
+IMPL(rocblas_daxpy_dot_strided_batched, double);
+IMPL(rocblas_caxpy_dotc_strided_batched, rocblas_float_complex);
+IMPL(rocblas_zaxpy_dotc_strided_batched, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
@@ -0,0 +1,150 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_copy.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_copy_name[] = "unknown";
+    template <>
+    constexpr char rocblas_copy_name<float>[] = "rocblas_scopy_64";
+    template <>
+    constexpr char rocblas_copy_name<double>[] = "rocblas_dcopy_64";
+    template <>
+    constexpr char rocblas_copy_name<rocblas_half>[] = "rocblas_hcopy_64";
+    template <>
+    constexpr char rocblas_copy_name<rocblas_float_complex>[] = "rocblas_ccopy_64";
+    template <>
+    constexpr char rocblas_copy_name<rocblas_double_complex>[] = "rocblas_zcopy_64";
+
+    template <typename T>
+    rocblas_status rocblas_copy_64_check_numerics(rocblas_handle handle,
+                                                  int64_t        n,
+                                                  const T*       x,
+                                                  int64_t        incx,
+                                                  T*             y,
+                                                  int64_t        incy,
+                                                  const int      check_numerics,
+                                                  bool           is_input)
+    {
+        for(int64_t start = 0; start < n; start += c_i64_chunk)
+        {
+            rocblas_i64_elementwise_chunk chunk(n, start, incx, incy);
+            rocblas_status                status
+                = rocblas_copy_check_numerics(rocblas_copy_name<T>,
+                                              handle,
+                                              chunk.n(),
+                                              x + chunk.offset(incx),
+                                              0,
+                                              chunk.inc(incx),
+                                              chunk.stride(incx),
+                                              y + chunk.offset(incy),
+                                              0,
+                                              chunk.inc(incy),
+                                              chunk.stride(incy),
+                                              chunk.batch_count(),
+                                              check_numerics,
+                                              is_input);
+            if(status != rocblas_status_success)
+                return status;
+        }
+        return rocblas_status_success;
+    }
+
+    template <rocblas_int NB, typename T>
+    rocblas_status rocblas_copy_64_impl(
+        rocblas_handle handle, int64_t n, const T* x, int64_t incx, T* y, int64_t incy)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, rocblas_copy_name<T>, n, x, incx, y, incy);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, rocblas_copy_name<T>, "N", n, "incx", incx, "incy", incy);
+
+        if(n <= 0)
+            return rocblas_status_success;
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        if(check_numerics)
+        {
+            rocblas_status status = rocblas_copy_64_check_numerics(
+                handle, n, x, incx, y, incy, check_numerics, true);
+            if(status != rocblas_status_success)
+                return status;
+        }
+
+        for(int64_t start = 0; start < n; start += c_i64_chunk)
+        {
+            rocblas_i64_elementwise_chunk chunk(n, start, incx, incy);
+            rocblas_status                status
+                = rocblas_copy_template<false, NB>(handle,
+                                                   chunk.n(),
+                                                   x + chunk.offset(incx),
+                                                   0,
+                                                   chunk.inc(incx),
+                                                   chunk.stride(incx),
+                                                   y + chunk.offset(incy),
+                                                   0,
+                                                   chunk.inc(incy),
+                                                   chunk.stride(incy),
+                                                   chunk.batch_count());
+            if(status != rocblas_status_success)
+                return status;
+        }
+
+        if(check_numerics)
+            return rocblas_copy_64_check_numerics(
+                handle, n, x, incx, y, incy, check_numerics, false);
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                           \
+    rocblas_status routine_name_(                                                         \
+        rocblas_handle handle, int64_t n, const T_* x, int64_t incx, T_* y, int64_t incy) \
+    try                                                                                   \
+    {                                                                                     \
+        constexpr int NB = 256;                                                           \
+        return rocblas_copy_64_impl<NB>(handle, n, x, incx, y, incy);                     \
+    }                                                                                     \
+    catch(...)                                                                            \
+    {                                                                                     \
+        return exception_to_rocblas_status();                                             \
+    }
+
+IMPL(rocblas_scopy_64, float);
+IMPL(rocblas_dcopy_64, double);
+IMPL(rocblas_hcopy_64, rocblas_half);
+IMPL(rocblas_ccopy_64, rocblas_float_complex);
+IMPL(rocblas_zcopy_64, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
@@ -47,7 +47,11 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
         size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB * WIN, T2>(n);
+        if(handle->reduction_mode == rocblas_reduction_mode_reproducible)
+            dev_bytes = std::max(dev_bytes, rocblas_reduction_repro_workspace_size(n));
         if(handle->is_device_memory_size_query())
         {
             if(n <= 0)
@@ -117,6 +121,8 @@ namespace
                 return dot_check_numerics_status;
         }
 
+        // Sums are reproducible in rocblas_reduction_mode_reproducible
+        auto algorithms = handle->push_reduction_algorithms();
         rocblas_status status = rocblas_internal_dot_template<NB, CONJ, T>(
             handle, n, x, 0, incx, 0, y, 0, incy, 0, 1, result, (T2*)w_mem);
         if(status != rocblas_status_success)
@@ -7,7 +7,9 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
+#include "reduction.hpp"
 #include "rocblas_reduction.hpp"
+#include "rocblas_reduction_repro.hpp"
 
 template <bool ONE_BLOCK, typename V, typename T>
 __inline__ __device__ void
@@ -325,6 +327,22 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
     auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
 
+    if(handle->reduction_algorithms.reproducible)
+        return rocblas_reduction_repro_template<rocblas_repro_term_dot<CONJ>,
+                                                rocblas_finalize_identity>(handle,
+                                                                           n,
+                                                                           x,
+                                                                           shiftx,
+                                                                           incx,
+                                                                           stridex,
+                                                                           y,
+                                                                           shifty,
+                                                                           incy,
+                                                                           stridey,
+                                                                           batch_count,
+                                                                           results,
+                                                                           (void*)workspace);
+
     int single_block_threshold = 32768;
     if(std::is_same<T, float>{})
         single_block_threshold = 31000;
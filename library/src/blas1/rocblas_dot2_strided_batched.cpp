@@ -0,0 +1,242 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "logging.hpp"
+#include "rocblas_axpy_dot.hpp"
+
+namespace
+{
+
+    // HIP support up to 1024 threads/work itemes per thread block/work group
+    // setting to 512 for gfx803.
+    constexpr int NB = 512;
+
+    template <typename>
+    constexpr char rocblas_dot2_strided_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_dot2_strided_batched_name<float>[] = "rocblas_sdot2_strided_batched";
+    template <>
+    constexpr char rocblas_dot2_strided_batched_name<double>[] = "rocblas_ddot2_strided_batched";
+    template <>
+    constexpr char rocblas_dot2_strided_batched_name<rocblas_float_complex>[]
+        = "rocblas_cdotc2_strided_batched";
+    template <>
+    constexpr char rocblas_dot2_strided_batched_name<rocblas_double_complex>[]
+        = "rocblas_zdotc2_strided_batched";
+
+    // allocate workspace inside this API
+    template <typename T>
+    rocblas_status rocblas_dot2_strided_batched_impl(rocblas_handle handle,
+                                                     rocblas_int    n,
+                                                     const T*       x,
+                                                     rocblas_int    incx,
+                                                     rocblas_stride stridex,
+                                                     const T*       y,
+                                                     rocblas_int    incy,
+                                                     rocblas_stride stridey,
+                                                     const T*       z,
+                                                     rocblas_int    incz,
+                                                     rocblas_stride stridez,
+                                                     rocblas_int    batch_count,
+                                                     T*             results)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
+        size_t dev_bytes = rocblas_axpy_dot_workspace_size<NB, T>(handle, n, batch_count, 2);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || batch_count <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_dot2_strided_batched_name<T>,
+                      n,
+                      x,
+                      incx,
+                      stridex,
+                      y,
+                      incy,
+                      stridey,
+                      z,
+                      incz,
+                      stridez,
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      "./rocblas-bench -f dot2_strided_batched -r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      "--incx",
+                      incx,
+                      "--stride_x",
+                      stridex,
+                      "--incy",
+                      incy,
+                      "--stride_y",
+                      stridey,
+                      "--incz",
+                      incz,
+                      "--batch_count",
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        rocblas_dot2_strided_batched_name<T>,
+                        "N",
+                        n,
+                        "incx",
+                        incx,
+                        "stride_x",
+                        stridex,
+                        "incy",
+                        incy,
+                        "stride_y",
+                        stridey,
+                        "incz",
+                        incz,
+                        "stride_z",
+                        stridez,
+                        "batch_count",
+                        batch_count);
+
+        // Quick return if possible.
+        if(batch_count <= 0)
+            return rocblas_status_success;
+
+        if(n <= 0)
+        {
+            if(!results)
+                return rocblas_status_invalid_pointer;
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                    results, 0, sizeof(*results) * 2 * batch_count, handle->get_stream()));
+            else
+                memset(results, 0, sizeof(*results) * 2 * batch_count);
+            return rocblas_status_success;
+        }
+
+        if(!x || !y || !z || !results)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        static constexpr rocblas_stride offset_0 = 0;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status dot2_check_numerics_status
+                = rocblas_axpy_dot_check_numerics(rocblas_dot2_strided_batched_name<T>,
+                                                  handle,
+                                                  n,
+                                                  x,
+                                                  offset_0,
+                                                  incx,
+                                                  stridex,
+                                                  y,
+                                                  offset_0,
+                                                  incy,
+                                                  stridey,
+                                                  z,
+                                                  offset_0,
+                                                  incz,
+                                                  stridez,
+                                                  batch_count,
+                                                  check_numerics,
+                                                  is_input);
+            if(dot2_check_numerics_status != rocblas_status_success)
+                return dot2_check_numerics_status;
+        }
+
+        // Sums are reproducible in rocblas_reduction_mode_reproducible
+        auto algorithms = handle->push_reduction_algorithms();
+        return rocblas_internal_dot2_template<NB, is_complex<T>>(handle,
+                                                                 n,
+                                                                 x,
+                                                                 offset_0,
+                                                                 incx,
+                                                                 stridex,
+                                                                 y,
+                                                                 offset_0,
+                                                                 incy,
+                                                                 stridey,
+                                                                 z,
+                                                                 offset_0,
+                                                                 incz,
+                                                                 stridez,
+                                                                 batch_count,
+                                                                 results,
+                                                                 (T*)w_mem);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                               \
+    rocblas_status routine_name_(rocblas_handle handle,       \
+                                 rocblas_int    n,            \
+                                 const T_*      x,            \
+                                 rocblas_int    incx,         \
+                                 rocblas_stride stridex,      \
+                                 const T_*      y,            \
+                                 rocblas_int    incy,         \
+                                 rocblas_stride stridey,      \
+                                 const T_*      z,            \
+                                 rocblas_int    incz,         \
+                                 rocblas_stride stridez,      \
+                                 rocblas_int    batch_count,  \
+                                 T_*            results)      \
+    try                                                       \
+    {                                                         \
+        return rocblas_dot2_strided_batched_impl(handle,      \
+                                                 n,           \
+                                                 x,           \
+                                                 incx,        \
+                                                 stridex,     \
+                                                 y,           \
+                                                 incy,        \
+                                                 stridey,     \
+                                                 z,           \
+                                                 incz,        \
+                                                 stridez,     \
+                                                 batch_count, \
+                                                 results);    \
+    }                                                         \
+    catch(...)                                                \
+    {                                                         \
+        return exception_to_rocblas_status();                 \
+    }
+
+IMPL(rocblas_sdot2_strided_batched, float);
+IMPL(rocblas_ddot2_strided_batched, double);
+IMPL(rocblas_cdotc2_strided_batched, rocblas_float_complex);
+IMPL(rocblas_zdotc2_strided_batched, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
@@ -0,0 +1,251 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_dot.hpp"
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    // HIP support up to 1024 threads/work itemes per thread block/work group
+    // setting to 512 for gfx803.
+    constexpr int NB = 512;
+
+    template <bool, typename>
+    constexpr char rocblas_dot_name[] = "unknown";
+    template <bool CONJ>
+    constexpr char rocblas_dot_name<CONJ, float>[] = "rocblas_sdot_64";
+    template <bool CONJ>
+    constexpr char rocblas_dot_name<CONJ, double>[] = "rocblas_ddot_64";
+    template <bool CONJ>
+    constexpr char rocblas_dot_name<CONJ, rocblas_half>[] = "rocblas_hdot_64";
+    template <bool CONJ>
+    constexpr char rocblas_dot_name<CONJ, rocblas_bfloat16>[] = "rocblas_bfdot_64";
+    template <>
+    constexpr char rocblas_dot_name<true, rocblas_float_complex>[] = "rocblas_cdotc_64";
+    template <>
+    constexpr char rocblas_dot_name<false, rocblas_float_complex>[] = "rocblas_cdotu_64";
+    template <>
+    constexpr char rocblas_dot_name<true, rocblas_double_complex>[] = "rocblas_zdotc_64";
+    template <>
+    constexpr char rocblas_dot_name<false, rocblas_double_complex>[] = "rocblas_zdotu_64";
+
+    // The results of the chunks of 16 bit types are summed in float
+    template <typename T>
+    using rocblas_dot_64_sum_t = std::conditional_t<std::is_same<T, rocblas_half>{}
+                                                        || std::is_same<T, rocblas_bfloat16>{},
+                                                    float,
+                                                    T>;
+
+    template <bool CONJ, typename T>
+    rocblas_status rocblas_dot_64_check_numerics(rocblas_handle handle,
+                                                 int64_t        n,
+                                                 const T*       x,
+                                                 int64_t        incx,
+                                                 const T*       y,
+                                                 int64_t        incy,
+                                                 const int      check_numerics,
+                                                 bool           is_input)
+    {
+        for(int64_t start = 0; start < n; start += c_i64_chunk)
+        {
+            int64_t        count = std::min(n - start, c_i64_chunk);
+            rocblas_status status
+                = rocblas_dot_check_numerics(rocblas_dot_name<CONJ, T>,
+                                             handle,
+                                             rocblas_int(count),
+                                             x + rocblas_i64_chunk_offset(n, start, count, incx),
+                                             0,
+                                             rocblas_int(incx),
+                                             0,
+                                             y + rocblas_i64_chunk_offset(n, start, count, incy),
+                                             0,
+                                             rocblas_int(incy),
+                                             0,
+                                             1,
+                                             check_numerics,
+                                             is_input);
+            if(status != rocblas_status_success)
+                return status;
+        }
+        return rocblas_status_success;
+    }
+
+    // allocate workspace inside this API
+    template <bool CONJ, typename T, typename T2 = T>
+    inline rocblas_status rocblas_dot_64_impl(rocblas_handle handle,
+                                              int64_t        n,
+                                              const T*       x,
+                                              int64_t        incx,
+                                              const T*       y,
+                                              int64_t        incy,
+                                              T*             result)
+    {
+        static constexpr int WIN = rocblas_dot_WIN<T>();
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
+        // The workspace of one chunk is reused by all of them
+        rocblas_int n_chunk   = rocblas_int(std::min(n, c_i64_chunk));
+        size_t      dev_bytes = rocblas_reduction_kernel_workspace_size<NB * WIN, T2>(n_chunk);
+        if(handle->reduction_mode == rocblas_reduction_mode_reproducible)
+            dev_bytes = std::max(dev_bytes, rocblas_reduction_repro_workspace_size(n_chunk));
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, rocblas_dot_name<CONJ, T>, n, x, incx, y, incy);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, rocblas_dot_name<CONJ, T>, "N", n, "incx", incx, "incy", incy);
+
+        // Quick return if possible.
+        if(n <= 0)
+        {
+            if(!result)
+                return rocblas_status_invalid_pointer;
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+                RETURN_IF_HIP_ERROR(
+                    hipMemsetAsync(result, 0, sizeof(*result), handle->get_stream()));
+            else
+                *result = T(0);
+            return rocblas_status_success;
+        }
+
+        if(!x || !y || !result)
+            return rocblas_status_invalid_pointer;
+
+        if(!rocblas_i64_fits(incx) || !rocblas_i64_fits(incy))
+            return rocblas_status_invalid_size;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        if(check_numerics)
+        {
+            rocblas_status status = rocblas_dot_64_check_numerics<CONJ>(
+                handle, n, x, incx, y, incy, check_numerics, true);
+            if(status != rocblas_status_success)
+                return status;
+        }
+
+        // Sums are reproducible in rocblas_reduction_mode_reproducible
+        auto algorithms = handle->push_reduction_algorithms();
+        rocblas_status status = rocblas_status_success;
+        if(n <= c_i64_chunk)
+        {
+            status = rocblas_internal_dot_template<NB, CONJ, T>(handle,
+                                                               rocblas_int(n),
+                                                               x,
+                                                               0,
+                                                               rocblas_int(incx),
+                                                               0,
+                                                               y,
+                                                               0,
+                                                               rocblas_int(incy),
+                                                               0,
+                                                               1,
+                                                               result,
+                                                               (T2*)w_mem);
+        }
+        else
+        {
+            // The results of the chunks are summed on the host, and the sum is then written in
+            // the caller's pointer mode
+            auto                    pointer_mode = handle->pointer_mode;
+            rocblas_dot_64_sum_t<T> sum(0);
+            {
+                auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+                for(int64_t start = 0; start < n; start += c_i64_chunk)
+                {
+                    int64_t count = std::min(n - start, c_i64_chunk);
+                    T       partial;
+                    status = rocblas_internal_dot_template<NB, CONJ, T>(
+                        handle,
+                        rocblas_int(count),
+                        x + rocblas_i64_chunk_offset(n, start, count, incx),
+                        0,
+                        rocblas_int(incx),
+                        0,
+                        y + rocblas_i64_chunk_offset(n, start, count, incy),
+                        0,
+                        rocblas_int(incy),
+                        0,
+                        1,
+                        &partial,
+                        (T2*)w_mem);
+                    if(status != rocblas_status_success)
+                        return status;
+                    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+                    sum += rocblas_dot_64_sum_t<T>(partial);
+                }
+            }
+            status = rocblas_i64_set_result(handle, pointer_mode, result, T(sum));
+        }
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+            return rocblas_dot_64_check_numerics<CONJ>(
+                handle, n, x, incx, y, incy, check_numerics, false);
+
+        return status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, CONJ_, T_, T2_)                                              \
+    rocblas_status routine_name_(rocblas_handle handle,                                  \
+                                 int64_t        n,                                       \
+                                 const T_*      x,                                       \
+                                 int64_t        incx,                                    \
+                                 const T_*      y,                                       \
+                                 int64_t        incy,                                    \
+                                 T_*            result)                                  \
+    try                                                                                  \
+    {                                                                                    \
+        return rocblas_dot_64_impl<CONJ_, T_, T2_>(handle, n, x, incx, y, incy, result); \
+    }                                                                                    \
+    catch(...)                                                                           \
+    {                                                                                    \
+        return exception_to_rocblas_status();                                            \
+    }
+
+IMPL(rocblas_sdot_64, false, float, float);
+IMPL(rocblas_ddot_64, false, double, double);
+IMPL(rocblas_hdot_64, false, rocblas_half, rocblas_half);
+IMPL(rocblas_bfdot_64, false, rocblas_bfloat16, float);
+IMPL(rocblas_cdotu_64, false, rocblas_float_complex, rocblas_float_complex);
+IMPL(rocblas_zdotu_64, false, rocblas_double_complex, rocblas_double_complex);
+IMPL(rocblas_cdotc_64, true, rocblas_float_complex, rocblas_float_complex);
+IMPL(rocblas_zdotc_64, true, rocblas_double_complex, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas_iamax.hpp"
+#include "rocblas_reduction_impl_64.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_iamax_name[] = "unknown";
+    template <>
+    constexpr char rocblas_iamax_name<float>[] = "rocblas_isamax_64";
+    template <>
+    constexpr char rocblas_iamax_name<double>[] = "rocblas_idamax_64";
+    template <>
+    constexpr char rocblas_iamax_name<rocblas_float_complex>[] = "rocblas_icamax_64";
+    template <>
+    constexpr char rocblas_iamax_name<rocblas_double_complex>[] = "rocblas_izamax_64";
+
+    // allocate workspace inside this API
+    template <typename S, typename T>
+    rocblas_status rocblas_iamax_64_impl(
+        rocblas_handle handle, int64_t n, const T* x, int64_t incx, int64_t* result)
+    {
+        static constexpr bool           isbatched     = false;
+        static constexpr rocblas_int    shiftx_0      = 0;
+        static constexpr rocblas_stride stridex_0     = 0;
+        static constexpr rocblas_int    batch_count_1 = 1;
+        static constexpr int            NB            = 1024;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
+        size_t         dev_bytes     = 0;
+        rocblas_status checks_status = rocblas_reduction_64_setup<NB, rocblas_index_value_t<S>>(
+            handle, n, x, incx, result, rocblas_iamax_name<T>, dev_bytes);
+        if(checks_status != rocblas_status_continue)
+        {
+            return checks_status;
+        }
+
+        auto check_numerics = handle->check_numerics;
+        if(check_numerics)
+        {
+            rocblas_status check_numerics_status = rocblas_reduction_64_check_numerics(
+                rocblas_iamax_name<T>, handle, n, x, incx, check_numerics, true);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+        {
+            return rocblas_status_memory_error;
+        }
+
+        // The rocblas_int index of each chunk is computed in host pointer mode, and the chunks are
+        // compared on the host by their elements at those indices. Ties keep the smallest index.
+        auto    pointer_mode = handle->pointer_mode;
+        int64_t index        = 0;
+        S       value(0);
+        {
+            auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+            for(int64_t start = 0; start < n; start += c_i64_chunk)
+            {
+                rocblas_int    chunk_index;
+                rocblas_status status = rocblas_internal_iamax_template<NB, isbatched>(
+                    handle,
+                    rocblas_int(std::min(n - start, c_i64_chunk)),
+                    x + start * incx,
+                    shiftx_0,
+                    rocblas_int(incx),
+                    stridex_0,
+                    batch_count_1,
+                    &chunk_index,
+                    (rocblas_index_value_t<S>*)w_mem);
+                if(status != rocblas_status_success)
+                    return status;
+
+                T element;
+                RETURN_IF_HIP_ERROR(hipMemcpy(&element,
+                                              x + (start + chunk_index - 1) * incx,
+                                              sizeof(T),
+                                              hipMemcpyDeviceToHost));
+                S chunk_value = fetch_asum(element);
+                if(!index || chunk_value > value)
+                {
+                    index = start + chunk_index;
+                    value = chunk_value;
+                }
+            }
+        }
+
+        rocblas_status status = rocblas_i64_set_result(handle, pointer_mode, result, index);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            rocblas_status check_numerics_status = rocblas_reduction_64_check_numerics(
+                rocblas_iamax_name<T>, handle, n, x, incx, check_numerics, false);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+
+        return status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL IS ALREADY DEFINED
+#endif
+
+#define IMPL(name_, typei_, typew_)                                        \
+    rocblas_status name_(rocblas_handle handle,                            \
+                         int64_t        n,                                 \
+                         const typei_*  x,                                 \
+                         int64_t        incx,                              \
+                         int64_t*       results)                           \
+    try                                                                    \
+    {                                                                      \
+        return rocblas_iamax_64_impl<typew_>(handle, n, x, incx, results); \
+    }                                                                      \
+    catch(...)                                                             \
+    {                                                                      \
+        return exception_to_rocblas_status();                              \
+    }
+
+IMPL(rocblas_isamax_64, float, float);
+IMPL(rocblas_idamax_64, double, double);
+IMPL(rocblas_icamax_64, rocblas_float_complex, float);
+IMPL(rocblas_izamax_64, rocblas_double_complex, double);
+
+#undef IMPL
+
+} // extern "C"
@@ -35,6 +35,8 @@ namespace
         static constexpr rocblas_stride shiftx_0  = 0;
         static constexpr int            NB        = 1024;
 
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
         size_t         dev_bytes = 0;
         rocblas_status checks_status
             = rocblas_reduction_setup<NB, isbatched, rocblas_index_value_t<S>>(
@@ -77,6 +79,8 @@ namespace
         {
             return rocblas_status_memory_error;
         }
+        // Results in host pointer mode are deferred in rocblas_result_mode_deferred
+        auto deferred = handle->push_result_deferral();
         rocblas_status status
             = rocblas_internal_iamin_template<NB, isbatched>(handle,
                                                              n,
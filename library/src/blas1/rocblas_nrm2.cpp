@@ -31,6 +31,9 @@ namespace
         static constexpr rocblas_stride stridex_0     = 0;
         static constexpr rocblas_int    batch_count_1 = 1;
         static constexpr rocblas_int    shiftx_0      = 0;
+        static constexpr bool           is_nrm2       = true;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
 
         size_t         dev_bytes = 0;
         rocblas_status checks_status
@@ -43,7 +46,8 @@ namespace
                                                          results,
                                                          rocblas_nrm2_name<Ti>,
                                                          "nrm2",
-                                                         dev_bytes);
+                                                         dev_bytes,
+                                                         is_nrm2);
         if(checks_status != rocblas_status_continue)
         {
             return checks_status;
@@ -73,6 +77,10 @@ namespace
         {
             return rocblas_status_memory_error;
         }
+        // Sums are reproducible in rocblas_reduction_mode_reproducible
+        auto algorithms = handle->push_reduction_algorithms();
+        // Results in host pointer mode are deferred in rocblas_result_mode_deferred
+        auto deferred = handle->push_result_deferral();
         rocblas_status status = rocblas_internal_nrm2_template<NB, isbatched>(
             handle, n, x, shiftx_0, incx, stridex_0, batch_count_1, results, (To*)w_mem);
         if(status != rocblas_status_success)
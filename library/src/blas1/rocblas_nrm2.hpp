@@ -5,6 +5,7 @@
 #pragma once
 
 #include "rocblas_reduction_template.hpp"
+#include <limits>
 
 template <typename T, std::enable_if_t<!std::is_same<T, rocblas_half>{}, int> = 0>
 __device__ __host__ inline auto fetch_abs2(T A)
@@ -27,6 +28,12 @@ struct rocblas_fetch_nrm2
     }
 };
 
+template <class To>
+struct rocblas_repro_term<rocblas_fetch_nrm2<To>>
+{
+    using type = rocblas_repro_term_nrm2;
+};
+
 struct rocblas_finalize_nrm2
 {
     template <class To>
@@ -36,6 +43,130 @@ struct rocblas_finalize_nrm2
     }
 };
 
+// Exponents of the thresholds and scaling factors of Blue's algorithm
+constexpr int rocblas_nrm2_floor_half(int a)
+{
+    return a >= 0 ? a / 2 : -((1 - a) / 2);
+}
+
+constexpr int rocblas_nrm2_ceil_half(int a)
+{
+    return -rocblas_nrm2_floor_half(-a);
+}
+
+template <typename T>
+constexpr T rocblas_nrm2_pow2(int e)
+{
+    T r = 1;
+    for(; e > 0; e--)
+        r *= 2;
+    for(; e < 0; e++)
+        r /= 2;
+    return r;
+}
+
+// Constants of Blue's algorithm for the real type T, as in the nrm2 of LAPACK 3.10. The squares
+// of the terms below tsml are accumulated after scaling them up by ssml, and those of the terms
+// above tbig after scaling them down by sbig. The factors are powers of 2, so scaling is exact.
+template <typename T>
+struct rocblas_nrm2_blue_constants
+{
+    static constexpr int t    = std::numeric_limits<T>::digits;
+    static constexpr int emin = std::numeric_limits<T>::min_exponent;
+    static constexpr int emax = std::numeric_limits<T>::max_exponent;
+
+    static constexpr T tsml = rocblas_nrm2_pow2<T>(rocblas_nrm2_ceil_half(emin - 1));
+    static constexpr T tbig = rocblas_nrm2_pow2<T>(rocblas_nrm2_floor_half(emax - t + 1));
+    static constexpr T ssml = rocblas_nrm2_pow2<T>(-rocblas_nrm2_floor_half(emin - t));
+    static constexpr T sbig = rocblas_nrm2_pow2<T>(-rocblas_nrm2_ceil_half(emax + t - 1));
+};
+
+// Fetches the Blue's accumulators of a term, treating the real and imaginary parts of complex
+// terms as two real terms
+template <class To>
+struct rocblas_fetch_nrm2_scaled
+{
+    using C = rocblas_nrm2_blue_constants<To>;
+
+    __forceinline__ __device__ static void accumulate(rocblas_nrm2_blue<To>& acc, To ax)
+    {
+        if(ax > C::tbig)
+        {
+            ax *= C::sbig;
+            acc.abig += ax * ax;
+        }
+        else if(ax < C::tsml)
+        {
+            ax *= C::ssml;
+            acc.asml += ax * ax;
+        }
+        else
+        {
+            acc.amed += ax * ax;
+        }
+    }
+
+    template <class Ti>
+    __forceinline__ __device__ rocblas_nrm2_blue<To> operator()(Ti x) const
+    {
+        rocblas_nrm2_blue<To> acc{};
+        if constexpr(is_complex<Ti>)
+        {
+            accumulate(acc, std::abs(To(x.real())));
+            accumulate(acc, std::abs(To(x.imag())));
+        }
+        else
+        {
+            accumulate(acc, std::abs(To(x)));
+        }
+        return acc;
+    }
+};
+
+// Combines the Blue's accumulators into the norm. The medium sum is negligible next to a nonzero
+// big sum, and the small sum next to a nonzero medium sum, unless they are NaN.
+struct rocblas_finalize_nrm2_scaled
+{
+    template <class T>
+    __forceinline__ __host__ __device__ T operator()(const rocblas_nrm2_blue<T>& acc) const
+    {
+        using C = rocblas_nrm2_blue_constants<T>;
+
+        T asml = acc.asml, amed = acc.amed, abig = acc.abig;
+        T scl, sumsq;
+        if(abig > 0)
+        {
+            if(amed > 0 || amed != amed)
+                abig += (amed * C::sbig) * C::sbig;
+            scl   = 1 / C::sbig;
+            sumsq = abig;
+        }
+        else if(asml > 0)
+        {
+            if(amed > 0 || amed != amed)
+            {
+                amed   = sqrt(amed);
+                asml   = sqrt(asml) / C::ssml;
+                T ymin = asml > amed ? amed : asml;
+                T ymax = asml > amed ? asml : amed;
+                scl    = 1;
+                sumsq  = ymax * ymax * (1 + (ymin / ymax) * (ymin / ymax));
+            }
+            else
+            {
+                scl   = 1 / C::ssml;
+                sumsq = asml;
+            }
+        }
+        else
+        {
+            scl   = 1;
+            sumsq = amed;
+        }
+        return scl * sqrt(sumsq);
+    }
+};
+
 template <rocblas_int NB, bool ISBATCHED, typename Ti, typename To, typename Tex = To>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     rocblas_internal_nrm2_template(rocblas_handle handle,
@@ -48,6 +179,28 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                    To*            results,
                                    Tex*           workspace)
 {
+    // When an API call in rocblas_nrm2_mode_scaled sized the workspace for them, the norms of
+    // float and double execution types are computed in one pass with Blue's accumulators, unless
+    // the sums must be reproducible
+    if constexpr(std::is_floating_point<Tex>{})
+    {
+        if(handle->reduction_algorithms.scaled_nrm2 && !handle->reduction_algorithms.reproducible)
+            return rocblas_reduction_template<NB,
+                                              ISBATCHED,
+                                              rocblas_fetch_nrm2_scaled<Tex>,
+                                              rocblas_reduce_sum,
+                                              rocblas_finalize_nrm2_scaled>(
+                handle,
+                n,
+                x,
+                shiftx,
+                incx,
+                stridex,
+                batch_count,
+                results,
+                (rocblas_nrm2_blue<Tex>*)workspace);
+    }
+
     return rocblas_reduction_template<NB,
                                       ISBATCHED,
                                       rocblas_fetch_nrm2<To>,
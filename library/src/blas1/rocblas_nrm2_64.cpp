@@ -0,0 +1,159 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas_nrm2.hpp"
+#include "rocblas_reduction_impl_64.hpp"
+
+namespace
+{
+
+    template <typename>
+    constexpr char rocblas_nrm2_name[] = "unknown";
+    template <>
+    constexpr char rocblas_nrm2_name<float>[] = "rocblas_snrm2_64";
+    template <>
+    constexpr char rocblas_nrm2_name<double>[] = "rocblas_dnrm2_64";
+    template <>
+    constexpr char rocblas_nrm2_name<rocblas_float_complex>[] = "rocblas_scnrm2_64";
+    template <>
+    constexpr char rocblas_nrm2_name<rocblas_double_complex>[] = "rocblas_dznrm2_64";
+
+    // allocate workspace inside this API
+    template <rocblas_int NB, typename Ti, typename To>
+    rocblas_status rocblas_nrm2_64_impl(
+        rocblas_handle handle, int64_t n, const Ti* x, int64_t incx, To* results)
+    {
+        static constexpr bool           isbatched     = false;
+        static constexpr rocblas_stride stridex_0     = 0;
+        static constexpr rocblas_int    batch_count_1 = 1;
+        static constexpr rocblas_int    shiftx_0      = 0;
+        static constexpr bool           is_nrm2       = true;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
+        size_t         dev_bytes     = 0;
+        rocblas_status checks_status = rocblas_reduction_64_setup<NB, To>(
+            handle, n, x, incx, results, rocblas_nrm2_name<Ti>, dev_bytes, is_nrm2);
+        if(checks_status != rocblas_status_continue)
+        {
+            return checks_status;
+        }
+
+        auto check_numerics = handle->check_numerics;
+        if(check_numerics)
+        {
+            rocblas_status check_numerics_status = rocblas_reduction_64_check_numerics(
+                rocblas_nrm2_name<Ti>, handle, n, x, incx, check_numerics, true);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+        {
+            return rocblas_status_memory_error;
+        }
+
+        // Sums are reproducible in rocblas_reduction_mode_reproducible
+        auto algorithms = handle->push_reduction_algorithms();
+        rocblas_status status = rocblas_status_success;
+        if(n <= c_i64_chunk)
+        {
+            status = rocblas_internal_nrm2_template<NB, isbatched>(handle,
+                                                                   rocblas_int(n),
+                                                                   x,
+                                                                   shiftx_0,
+                                                                   rocblas_int(incx),
+                                                                   stridex_0,
+                                                                   batch_count_1,
+                                                                   results,
+                                                                   (To*)w_mem);
+        }
+        else
+        {
+            // The norms of the chunks are combined on the host as a scaled sum of squares, as in
+            // LAPACK's xLASSQ, so that their squares cannot overflow
+            auto pointer_mode = handle->pointer_mode;
+            To   scale(0), ssq(1);
+            {
+                auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+                for(int64_t start = 0; start < n; start += c_i64_chunk)
+                {
+                    To norm;
+                    status = rocblas_internal_nrm2_template<NB, isbatched>(
+                        handle,
+                        rocblas_int(std::min(n - start, c_i64_chunk)),
+                        x + start * incx,
+                        shiftx_0,
+                        rocblas_int(incx),
+                        stridex_0,
+                        batch_count_1,
+                        &norm,
+                        (To*)w_mem);
+                    if(status != rocblas_status_success)
+                        return status;
+
+                    if(norm != 0)
+                    {
+                        if(scale < norm)
+                        {
+                            ssq   = 1 + ssq * (scale / norm) * (scale / norm);
+                            scale = norm;
+                        }
+                        else
+                            ssq += norm == scale ? 1 : (norm / scale) * (norm / scale);
+                    }
+                }
+            }
+            status = rocblas_i64_set_result(
+                handle, pointer_mode, results, To(scale * std::sqrt(ssq)));
+        }
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            rocblas_status check_numerics_status = rocblas_reduction_64_check_numerics(
+                rocblas_nrm2_name<Ti>, handle, n, x, incx, check_numerics, false);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL IS ALREADY DEFINED
+#endif
+
+#define IMPL(name_, typei_, typeo_)                                                       \
+    rocblas_status name_(                                                                 \
+        rocblas_handle handle, int64_t n, const typei_* x, int64_t incx, typeo_* results) \
+    try                                                                                   \
+    {                                                                                     \
+        constexpr rocblas_int NB = 512;                                                   \
+        return rocblas_nrm2_64_impl<NB>(handle, n, x, incx, results);                     \
+    }                                                                                     \
+    catch(...)                                                                            \
+    {                                                                                     \
+        return exception_to_rocblas_status();                                             \
+    }
+
+IMPL(rocblas_snrm2_64, float, float);
+IMPL(rocblas_dnrm2_64, double, double);
+IMPL(rocblas_scnrm2_64, rocblas_float_complex, float);
+IMPL(rocblas_dznrm2_64, rocblas_double_complex, double);
+
+#undef IMPL
+
+} // extern "C"
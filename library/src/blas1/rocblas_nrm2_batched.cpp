@@ -32,6 +32,9 @@ namespace
         static constexpr bool           isbatched = true;
         static constexpr rocblas_int    shiftx_0  = 0;
         static constexpr rocblas_stride stridex_0 = 0;
+        static constexpr bool           is_nrm2   = true;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
 
         size_t         dev_bytes = 0;
         rocblas_status checks_status
@@ -44,7 +47,8 @@ namespace
                                                          results,
                                                          rocblas_nrm2_batched_name<Ti>,
                                                          "nrm2_batched",
-                                                         dev_bytes);
+                                                         dev_bytes,
+                                                         is_nrm2);
         if(checks_status != rocblas_status_continue)
         {
             return checks_status;
@@ -74,6 +78,10 @@ namespace
         {
             return rocblas_status_memory_error;
         }
+        // Sums are reproducible in rocblas_reduction_mode_reproducible
+        auto algorithms = handle->push_reduction_algorithms();
+        // Results in host pointer mode are deferred in rocblas_result_mode_deferred
+        auto deferred = handle->push_result_deferral();
         rocblas_status status = rocblas_internal_nrm2_template<NB, isbatched>(
             handle, n, x, shiftx_0, incx, stridex_0, batch_count, results, (To*)w_mem);
         if(status != rocblas_status_success)
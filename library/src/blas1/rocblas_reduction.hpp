@@ -99,6 +99,84 @@ __inline__ __device__ rocblas_half wavefront_reduce(rocblas_half val)
     return val;
 }
 
+// Pre-rounded bins of a reproducible sum. The bins only hold multiples of their own quantum, and
+// are small enough that adding them is exact, so that they can be reduced in any order.
+template <int NBINS>
+struct rocblas_repro_bins
+{
+    double bin[NBINS];
+
+    rocblas_repro_bins() = default;
+
+    __device__ __host__ explicit rocblas_repro_bins(double val)
+    {
+        for(int b = 0; b < NBINS; b++)
+            bin[b] = val;
+    }
+
+    __device__ __host__ rocblas_repro_bins& operator+=(const rocblas_repro_bins& rhs)
+    {
+        for(int b = 0; b < NBINS; b++)
+            bin[b] += rhs.bin[b];
+        return *this;
+    }
+};
+
+template <int N, int NBINS>
+__inline__ __device__ rocblas_repro_bins<NBINS> wavefront_reduce(rocblas_repro_bins<NBINS> val)
+{
+    constexpr int WFBITS = rocblas_log2ui(N);
+    int           offset = 1 << (WFBITS - 1);
+    for(int i = 0; i < WFBITS; i++)
+    {
+        for(int b = 0; b < NBINS; b++)
+            val.bin[b] += __shfl_down(val.bin[b], offset);
+        offset >>= 1;
+    }
+    return val;
+}
+
+// Blue's accumulators of a scaled sum of squares: the squares of the small, medium and big terms
+// are accumulated separately, after scaling the small and big terms towards 1, so that none of
+// the sums can underflow or overflow. Partial sums are combined by adding each accumulator.
+template <typename T>
+struct rocblas_nrm2_blue
+{
+    T asml, amed, abig;
+
+    rocblas_nrm2_blue() = default;
+
+    __device__ __host__ explicit rocblas_nrm2_blue(double val)
+        : asml(val)
+        , amed(val)
+        , abig(val)
+    {
+    }
+
+    __device__ __host__ rocblas_nrm2_blue& operator+=(const rocblas_nrm2_blue& rhs)
+    {
+        asml += rhs.asml;
+        amed += rhs.amed;
+        abig += rhs.abig;
+        return *this;
+    }
+};
+
+template <int N, typename T>
+__inline__ __device__ rocblas_nrm2_blue<T> wavefront_reduce(rocblas_nrm2_blue<T> val)
+{
+    constexpr int WFBITS = rocblas_log2ui(N);
+    int           offset = 1 << (WFBITS - 1);
+    for(int i = 0; i < WFBITS; i++)
+    {
+        val.asml += __shfl_down(val.asml, offset);
+        val.amed += __shfl_down(val.amed, offset);
+        val.abig += __shfl_down(val.abig, offset);
+        offset >>= 1;
+    }
+    return val;
+}
+
 template <rocblas_int NB, typename T>
 __inline__ __device__ T rocblas_dot_block_reduce(T val)
 {
@@ -194,3 +272,33 @@ size_t rocblas_reduction_kernel_workspace_size(rocblas_int      n,
         return 0;
     }
 }
+
+/*! \brief rocblas_nrm2_scaled_workspace_size
+    Work area of nrm2 in rocblas_nrm2_mode_scaled, whose partial results are the Blue's
+    accumulators of the real execution type Tw
+
+    @param[in]
+    batch_count rocblas_int
+        Number of batches
+    ********************************************************************/
+template <rocblas_int NB, typename Tw>
+size_t rocblas_nrm2_scaled_workspace_size(rocblas_int n, rocblas_int batch_count = 1)
+{
+    return rocblas_reduction_kernel_workspace_size<NB, rocblas_nrm2_blue<Tw>>(n, batch_count);
+}
+
+template <rocblas_int NB>
+size_t rocblas_nrm2_scaled_workspace_size(rocblas_int      n,
+                                          rocblas_int      batch_count,
+                                          rocblas_datatype type)
+{
+    switch(type)
+    {
+    case rocblas_datatype_f32_r:
+        return rocblas_nrm2_scaled_workspace_size<NB, float>(n, batch_count);
+    case rocblas_datatype_f64_r:
+        return rocblas_nrm2_scaled_workspace_size<NB, double>(n, batch_count);
+    default:
+        return 0;
+    }
+}
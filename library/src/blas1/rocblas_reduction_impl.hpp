@@ -148,7 +148,8 @@ inline rocblas_status rocblas_reduction_setup(rocblas_handle handle,
                                               Tr*            results,
                                               const char*    name,
                                               const char*    name_bench,
-                                              size_t&        work_size)
+                                              size_t&        work_size,
+                                              bool           is_nrm2 = false)
 {
     if(!handle)
     {
@@ -156,6 +157,13 @@ inline rocblas_status rocblas_reduction_setup(rocblas_handle handle,
     }
 
     size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB, Tw>(n, batch_count);
+    if(rocblas_reduction_repro_supported<Tw>
+       && handle->reduction_mode == rocblas_reduction_mode_reproducible)
+        dev_bytes = std::max(dev_bytes, rocblas_reduction_repro_workspace_size(n, batch_count));
+    // Only nrm2 needs room for the Blue's accumulators
+    if(is_nrm2 && std::is_floating_point<Tw>{} && handle->nrm2_mode == rocblas_nrm2_mode_scaled)
+        dev_bytes
+            = std::max(dev_bytes, rocblas_nrm2_scaled_workspace_size<NB, Tw>(n, batch_count));
 
     if(handle->is_device_memory_size_query())
     {
@@ -169,6 +177,9 @@ inline rocblas_status rocblas_reduction_setup(rocblas_handle handle,
         }
     }
 
+    // Results which are not deferred have no token
+    handle->last_result_token = 0;
+
     auto layer_mode = handle->layer_mode;
     if(layer_mode & rocblas_layer_mode_log_trace)
     {
@@ -238,6 +249,8 @@ rocblas_status rocblas_reduction_impl(rocblas_handle handle,
                                       const char*    name,
                                       const char*    name_bench)
 {
+    rocblas_profile_timing_scope profile_timing_scope(handle);
+
     size_t         dev_bytes     = 0;
     rocblas_status checks_status = rocblas_reduction_setup<NB, ISBATCHED, Tw>(
         handle, n, x, incx, stridex, batch_count, results, name, name_bench, dev_bytes);
@@ -264,6 +277,10 @@ rocblas_status rocblas_reduction_impl(rocblas_handle handle,
     }
 
     static constexpr rocblas_int shiftx_0 = 0;
+    // Sums are reproducible in rocblas_reduction_mode_reproducible
+    auto algorithms = handle->push_reduction_algorithms();
+    // Results in host pointer mode are deferred in rocblas_result_mode_deferred
+    auto deferred = handle->push_result_deferral();
     rocblas_status status = rocblas_reduction_template<NB, ISBATCHED, FETCH, REDUCE, FINALIZE>(
         handle, n, x, shiftx_0, incx, stridex, batch_count, results, (Tw*)w_mem);
     if(status != rocblas_status_success)
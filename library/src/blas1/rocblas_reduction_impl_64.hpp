@@ -0,0 +1,128 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "check_numerics_vector.hpp"
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_reduction_template.hpp"
+#include "utility.hpp"
+
+// Checks and logging of the _64 reductions of one vector, as rocblas_reduction_setup() does for
+// the rocblas_int reductions. The workspace is sized for one chunk, and reused by all of them.
+template <rocblas_int NB, typename Tw, typename Ti, typename Tr>
+inline rocblas_status rocblas_reduction_64_setup(rocblas_handle handle,
+                                                 int64_t        n,
+                                                 const Ti*      x,
+                                                 int64_t        incx,
+                                                 Tr*            results,
+                                                 const char*    name,
+                                                 size_t&        work_size,
+                                                 bool           is_nrm2 = false)
+{
+    if(!handle)
+    {
+        return rocblas_status_invalid_handle;
+    }
+
+    rocblas_int n_chunk   = rocblas_int(std::min(n, c_i64_chunk));
+    size_t      dev_bytes = rocblas_reduction_kernel_workspace_size<NB, Tw>(n_chunk);
+    if(rocblas_reduction_repro_supported<Tw>
+       && handle->reduction_mode == rocblas_reduction_mode_reproducible)
+        dev_bytes = std::max(dev_bytes, rocblas_reduction_repro_workspace_size(n_chunk));
+    // Only nrm2 needs room for the Blue's accumulators
+    if(is_nrm2 && std::is_floating_point<Tw>{} && handle->nrm2_mode == rocblas_nrm2_mode_scaled)
+        dev_bytes = std::max(dev_bytes, rocblas_nrm2_scaled_workspace_size<NB, Tw>(n_chunk));
+
+    if(handle->is_device_memory_size_query())
+    {
+        if(n <= 0 || incx <= 0)
+        {
+            return rocblas_status_size_unchanged;
+        }
+        else
+        {
+            return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+    }
+
+    // Results which are not deferred have no token
+    handle->last_result_token = 0;
+
+    auto layer_mode = handle->layer_mode;
+    if(layer_mode & rocblas_layer_mode_log_trace)
+    {
+        log_trace(handle, name, n, x, incx);
+    }
+
+    if(layer_mode & rocblas_layer_mode_log_profile)
+    {
+        log_profile(handle, name, "N", n, "incx", incx);
+    }
+
+    if(!results)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+
+    // Quick return if possible.
+    if(n <= 0 || incx <= 0)
+    {
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(results, 0, sizeof(Tr), handle->get_stream()));
+        }
+        else
+        {
+            memset(results, 0, sizeof(Tr));
+        }
+        return rocblas_status_success;
+    }
+
+    if(!x)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+
+    if(!rocblas_i64_fits(incx))
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    work_size = dev_bytes;
+
+    return rocblas_status_continue;
+}
+
+// Checks the numerics of the chunks of a vector with a positive increment
+template <typename Ti>
+rocblas_status rocblas_reduction_64_check_numerics(const char*    name,
+                                                   rocblas_handle handle,
+                                                   int64_t        n,
+                                                   const Ti*      x,
+                                                   int64_t        incx,
+                                                   const int      check_numerics,
+                                                   bool           is_input)
+{
+    for(int64_t start = 0; start < n; start += c_i64_chunk)
+    {
+        rocblas_status status = rocblas_internal_check_numerics_vector_template(
+            name,
+            handle,
+            rocblas_int(std::min(n - start, c_i64_chunk)),
+            x + start * incx,
+            0,
+            rocblas_int(incx),
+            0,
+            1,
+            check_numerics,
+            is_input);
+        if(status != rocblas_status_success)
+            return status;
+    }
+    return rocblas_status_success;
+}
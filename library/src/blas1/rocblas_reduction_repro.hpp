@@ -0,0 +1,490 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas_reduction.hpp"
+#include "utility.hpp"
+#include <limits>
+
+/*
+ * Reproducible sums of rocblas_reduction_mode_reproducible
+ *
+ * The terms of a sum are computed in double precision and pre-rounded into c_repro_bins bins, as
+ * in ReproBLAS (Demmel and Nguyen, "Fast Reproducible Floating-Point Summation"). With M the
+ * largest magnitude of the n terms and L = ceil(log2(n)), bin j takes the leading bits of what
+ * is left of a term t, with sigma_j = 1.5 * 2^k_j:
+ *
+ *     q_j = (sigma_j + r_j) - sigma_j,    r_0 = t,    r_{j+1} = r_j - q_j
+ *
+ * where M < 2^(k_0 - L - 1) and k_{j+1} = k_j - (52 - L). The q_j of a bin are multiples of the
+ * same quantum ulp(sigma_j), and n of them add up to less than 2^(k_j + 1), so every partial sum
+ * of a bin is exact, whatever the order of the additions, the grid and the wavefront size. The
+ * remainders after the last bin, less than 2^(k_{K-1} - 53) per term, are dropped, and the bins
+ * are added from the smallest to the largest once they are reduced.
+ *
+ * A sum takes three kernels, which read the vectors twice:
+ *     kernel max:   the largest magnitude of the terms of each block, to find M
+ *     kernel bins:  the bins of the terms of each block
+ *     kernel final: the sum of the bins of the blocks, finalized and converted to the result
+ *
+ * The terms are scaled down by a power of 2 if 2^k_0 would overflow. If a term is not finite,
+ * the sum is the sum of the terms which are not finite, which does not depend on their order
+ * either. The host reference of the clients implements the same algorithm.
+ */
+
+// Number of bins of each real component of a sum
+static constexpr int c_repro_bins = 3;
+
+// Threads per block, and blocks per sum at most, of the reproducible kernels
+static constexpr rocblas_int c_repro_NB         = 256;
+static constexpr rocblas_int c_repro_max_blocks = 512;
+
+// Magnitude of a term, where NaN is infinite so that the largest magnitude is not finite
+__device__ __host__ inline double rocblas_repro_abs(double t)
+{
+    return t < 0 ? -t : t == t ? t : std::numeric_limits<double>::infinity();
+}
+
+__device__ __host__ inline double rocblas_repro_abs(const rocblas_double_complex& t)
+{
+    double re = rocblas_repro_abs(t.real());
+    double im = rocblas_repro_abs(t.imag());
+    return re > im ? re : im;
+}
+
+// Values in double precision. The products of two half, bfloat16 or float values are exact.
+template <typename T>
+__device__ __host__ inline double rocblas_repro_real(T x)
+{
+    return double(float(x));
+}
+
+__device__ __host__ inline double rocblas_repro_real(double x)
+{
+    return x;
+}
+
+// Terms of the sums. Contractions are turned off so that the terms are rounded as on the host.
+struct rocblas_repro_term_asum
+{
+    static constexpr bool binary = false;
+
+    template <typename Ti>
+    __device__ __host__ double operator()(Ti x) const
+    {
+        if constexpr(is_complex<Ti>)
+        {
+            double re = rocblas_repro_real(x.real());
+            double im = rocblas_repro_real(x.imag());
+            return (re < 0 ? -re : re) + (im < 0 ? -im : im);
+        }
+        else
+        {
+            double re = rocblas_repro_real(x);
+            return re < 0 ? -re : re;
+        }
+    }
+};
+
+struct rocblas_repro_term_nrm2
+{
+    static constexpr bool binary = false;
+
+    template <typename Ti>
+    __device__ __host__ double operator()(Ti x) const
+    {
+#pragma clang fp contract(off)
+        if constexpr(is_complex<Ti>)
+        {
+            double re = rocblas_repro_real(x.real());
+            double im = rocblas_repro_real(x.imag());
+            return re * re + im * im;
+        }
+        else
+        {
+            double re = rocblas_repro_real(x);
+            return re * re;
+        }
+    }
+};
+
+template <bool CONJ>
+struct rocblas_repro_term_dot
+{
+    static constexpr bool binary = true;
+
+    template <typename Tx, typename Ty>
+    __device__ __host__ auto operator()(Tx x, Ty y) const
+    {
+#pragma clang fp contract(off)
+        if constexpr(is_complex<Tx>)
+        {
+            double xr = rocblas_repro_real(x.real());
+            double xi = rocblas_repro_real(x.imag());
+            double yr = rocblas_repro_real(y.real());
+            double yi = rocblas_repro_real(y.imag());
+            if(CONJ)
+                xi = -xi;
+            return rocblas_double_complex(xr * yr - xi * yi, xr * yi + xi * yr);
+        }
+        else
+        {
+            return rocblas_repro_real(x) * rocblas_repro_real(y);
+        }
+    }
+};
+
+// The term of the reproducible sum of a default reduction with FETCH, or void if it has none
+template <typename FETCH>
+struct rocblas_repro_term
+{
+    using type = void;
+};
+
+template <typename TERM, typename Tx, typename Ty>
+__device__ __host__ inline auto
+    rocblas_repro_fetch(const Tx* x, rocblas_int incx, const Ty* y, rocblas_int incy, ptrdiff_t i)
+{
+    if constexpr(TERM::binary)
+        return TERM{}(x[i * incx], y[i * incy]);
+    else
+        return TERM{}(x[i * incx]);
+}
+
+// Extraction constants of the bins of a sum of 2^log2n terms of magnitude at most amax
+struct rocblas_repro_sigma
+{
+    double sigma[c_repro_bins];
+    int    scale;
+    bool   finite;
+
+    __device__ __host__ rocblas_repro_sigma(double amax, int log2n)
+    {
+        // sigma_j + t stays below 2^1023, and ulp(sigma_j) is at least the smallest denormal
+        constexpr int kmax = std::numeric_limits<double>::max_exponent - 2;
+        constexpr int kmin = std::numeric_limits<double>::min_exponent - 1;
+
+        int e  = 0;
+        finite = amax <= std::numeric_limits<double>::max();
+        if(finite)
+            frexp(amax, &e); // amax < 2^e
+
+        int k = e + log2n + 1;
+        scale = k > kmax ? k - kmax : 0;
+        k -= scale;
+        for(int j = 0; j < c_repro_bins; j++)
+        {
+            sigma[j] = ldexp(1.5, k > kmin ? k : kmin);
+            k -= std::numeric_limits<double>::digits - 1 - log2n;
+        }
+    }
+
+    // Adds the pre-rounded parts of the term t to bin[0], ..., bin[c_repro_bins - 1]
+    __device__ __host__ void deposit(double* bin, double t) const
+    {
+        if(!finite)
+        {
+            if(!(rocblas_repro_abs(t) <= std::numeric_limits<double>::max()))
+                bin[0] += t;
+            return;
+        }
+
+        if(scale)
+            t = ldexp(t, -scale);
+
+        for(int j = 0; j < c_repro_bins; j++)
+        {
+            double q = (sigma[j] + t) - sigma[j];
+            bin[j] += q;
+            t -= q;
+        }
+    }
+
+    template <int NBINS>
+    __device__ __host__ void deposit(rocblas_repro_bins<NBINS>& acc, double t) const
+    {
+        deposit(acc.bin, t);
+    }
+
+    template <int NBINS>
+    __device__ __host__ void deposit(rocblas_repro_bins<NBINS>& acc,
+                                     const rocblas_double_complex& t) const
+    {
+        deposit(acc.bin, t.real());
+        deposit(acc.bin + c_repro_bins, t.imag());
+    }
+
+    // Sum of the bins, from the smallest to the largest
+    __device__ __host__ double sum(const double* bin) const
+    {
+        double s = bin[c_repro_bins - 1];
+        for(int j = c_repro_bins - 2; j >= 0; j--)
+            s += bin[j];
+        return scale ? ldexp(s, scale) : s;
+    }
+};
+
+// Conversion of a sum to the type of the result, through float for 16 bit types
+template <typename Tr>
+__device__ __host__ inline Tr rocblas_repro_convert(double val)
+{
+    if constexpr(std::is_same<Tr, rocblas_half>{} || std::is_same<Tr, rocblas_bfloat16>{})
+        return Tr(float(val));
+    else
+        return Tr(val);
+}
+
+template <typename Tr, typename FINALIZE, int NBINS>
+__device__ __host__ inline Tr rocblas_repro_result(const rocblas_repro_sigma&       sigma,
+                                                   const rocblas_repro_bins<NBINS>& acc)
+{
+    if constexpr(is_complex<Tr>)
+        return Tr(rocblas_repro_convert<real_t<Tr>>(FINALIZE{}(sigma.sum(acc.bin))),
+                  rocblas_repro_convert<real_t<Tr>>(FINALIZE{}(sigma.sum(acc.bin + c_repro_bins))));
+    else
+        return rocblas_repro_convert<Tr>(FINALIZE{}(sigma.sum(acc.bin)));
+}
+
+// Largest value of a block, returned to all of its threads
+template <rocblas_int NB>
+__inline__ __device__ double rocblas_repro_block_max(double val)
+{
+    static constexpr rocblas_int num_wavefronts = NB / warpSize;
+    __shared__ double            pmax[num_wavefronts];
+
+    for(int offset = warpSize / 2; offset > 0; offset >>= 1)
+    {
+        double other = __shfl_xor(val, offset);
+        val          = other > val ? other : val;
+    }
+    if(hipThreadIdx_x % warpSize == 0)
+        pmax[hipThreadIdx_x / warpSize] = val;
+
+    __syncthreads();
+
+    val = pmax[0];
+    for(rocblas_int w = 1; w < num_wavefronts; w++)
+        val = pmax[w] > val ? pmax[w] : val;
+    return val;
+}
+
+// kernel max writes the largest magnitude of the terms of each block in wmax
+template <rocblas_int NB, typename TERM, typename TPtrX, typename TPtrY>
+ROCBLAS_KERNEL(NB)
+rocblas_reduction_repro_kernel_max(rocblas_int    n,
+                                   TPtrX          xvec,
+                                   rocblas_stride shiftx,
+                                   rocblas_int    incx,
+                                   rocblas_stride stridex,
+                                   TPtrY          yvec,
+                                   rocblas_stride shifty,
+                                   rocblas_int    incy,
+                                   rocblas_stride stridey,
+                                   double*        wmax)
+{
+    const auto* x = load_ptr_batch(xvec, hipBlockIdx_y, shiftx, stridex);
+    const auto* y = load_ptr_batch(yvec, hipBlockIdx_y, shifty, stridey);
+
+    double amax = 0;
+    for(ptrdiff_t i = hipBlockIdx_x * NB + hipThreadIdx_x; i < n; i += NB * hipGridDim_x)
+    {
+        double a = rocblas_repro_abs(rocblas_repro_fetch<TERM>(x, incx, y, incy, i));
+        amax     = a > amax ? a : amax;
+    }
+
+    amax = rocblas_repro_block_max<NB>(amax);
+
+    if(hipThreadIdx_x == 0)
+        wmax[hipBlockIdx_y * hipGridDim_x + hipBlockIdx_x] = amax;
+}
+
+// kernel bins writes the bins of the terms of each block in wbins, with the grid of kernel max
+template <rocblas_int NB, typename TERM, int NBINS, typename TPtrX, typename TPtrY>
+ROCBLAS_KERNEL(NB)
+rocblas_reduction_repro_kernel_bins(rocblas_int    n,
+                                    int            log2n,
+                                    TPtrX          xvec,
+                                    rocblas_stride shiftx,
+                                    rocblas_int    incx,
+                                    rocblas_stride stridex,
+                                    TPtrY          yvec,
+                                    rocblas_stride shifty,
+                                    rocblas_int    incy,
+                                    rocblas_stride stridey,
+                                    const double*  wmax,
+                                    rocblas_repro_bins<NBINS>* __restrict__ wbins)
+{
+    const auto* x = load_ptr_batch(xvec, hipBlockIdx_y, shiftx, stridex);
+    const auto* y = load_ptr_batch(yvec, hipBlockIdx_y, shifty, stridey);
+
+    const double* bmax = wmax + hipBlockIdx_y * hipGridDim_x;
+    double        amax = 0;
+    for(rocblas_int b = hipThreadIdx_x; b < hipGridDim_x; b += NB)
+        amax = bmax[b] > amax ? bmax[b] : amax;
+
+    rocblas_repro_sigma sigma(rocblas_repro_block_max<NB>(amax), log2n);
+
+    rocblas_repro_bins<NBINS> acc(0);
+    for(ptrdiff_t i = hipBlockIdx_x * NB + hipThreadIdx_x; i < n; i += NB * hipGridDim_x)
+        sigma.deposit(acc, rocblas_repro_fetch<TERM>(x, incx, y, incy, i));
+
+    acc = rocblas_dot_block_reduce<NB>(acc); // exact
+
+    if(hipThreadIdx_x == 0)
+        wbins[hipBlockIdx_y * hipGridDim_x + hipBlockIdx_x] = acc;
+}
+
+// kernel final adds the bins of the blocks of each batch, and finalizes their sum in result
+template <rocblas_int NB, typename FINALIZE, int NBINS, typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_reduction_repro_kernel_final(rocblas_int   nblocks,
+                                     int           log2n,
+                                     const double* wmax,
+                                     const rocblas_repro_bins<NBINS>* __restrict__ wbins,
+                                     Tr* __restrict__ result)
+{
+    const double* bmax = wmax + hipBlockIdx_y * nblocks;
+    double        amax = 0;
+    for(rocblas_int b = hipThreadIdx_x; b < nblocks; b += NB)
+        amax = bmax[b] > amax ? bmax[b] : amax;
+
+    rocblas_repro_sigma sigma(rocblas_repro_block_max<NB>(amax), log2n);
+
+    const auto*               bins = wbins + hipBlockIdx_y * nblocks;
+    rocblas_repro_bins<NBINS> acc(0);
+    for(rocblas_int b = hipThreadIdx_x; b < nblocks; b += NB)
+        acc += bins[b];
+
+    acc = rocblas_dot_block_reduce<NB>(acc); // exact
+
+    if(hipThreadIdx_x == 0)
+        result[hipBlockIdx_y] = rocblas_repro_result<Tr, FINALIZE>(sigma, acc);
+}
+
+// Whether reductions with the work type To have reproducible sums, which iamax and iamin do not
+template <typename To>
+constexpr bool rocblas_reduction_repro_supported
+    = std::is_floating_point<To>{} || is_complex<To> || std::is_same<To, rocblas_half>{}
+      || std::is_same<To, rocblas_bfloat16>{};
+
+inline rocblas_int rocblas_reduction_repro_block_count(rocblas_int n)
+{
+    return rocblas_int(
+        std::min(rocblas_reduction_kernel_block_count(n, c_repro_NB), size_t(c_repro_max_blocks)));
+}
+
+/*! \brief rocblas_reduction_repro_workspace_size
+    Work area of the reproducible kernels: the result of each batch in host pointer mode, and the
+    largest magnitude and the bins of each block of each batch
+
+    @param[in]
+    batch_count rocblas_int
+        Number of batches
+    ********************************************************************/
+inline size_t rocblas_reduction_repro_workspace_size(rocblas_int n, rocblas_int batch_count = 1)
+{
+    if(batch_count <= 0)
+        batch_count = 1;
+    size_t blocks = rocblas_reduction_repro_block_count(n);
+    return sizeof(double) * batch_count * (2 + blocks * (1 + 2 * c_repro_bins));
+}
+
+/*! \brief
+
+    \details
+    rocblas_reduction_repro_template computes the reproducible sums of the terms TERM of the
+    vectors x_i, or of x_i and y_i for dot products, for rocblas_reduction_mode_reproducible.
+    The results do not depend on the launch configuration, and are the same in the batched and
+    non-batched functions. n and batch_count must be positive, and workspace must hold
+    rocblas_reduction_repro_workspace_size(n, batch_count) bytes.
+    ********************************************************************/
+template <typename TERM, typename FINALIZE, typename TPtrX, typename TPtrY, typename Tr>
+rocblas_status rocblas_reduction_repro_template(rocblas_handle __restrict__ handle,
+                                                rocblas_int    n,
+                                                TPtrX          x,
+                                                rocblas_stride shiftx,
+                                                rocblas_int    incx,
+                                                rocblas_stride stridex,
+                                                TPtrY          y,
+                                                rocblas_stride shifty,
+                                                rocblas_int    incy,
+                                                rocblas_stride stridey,
+                                                rocblas_int    batch_count,
+                                                Tr*            results,
+                                                void*          workspace)
+{
+    static constexpr int NBINS = (is_complex<Tr> ? 2 : 1) * c_repro_bins;
+    using bins_t               = rocblas_repro_bins<NBINS>;
+
+    int log2n = 0;
+    while((int64_t(1) << log2n) < n)
+        log2n++;
+
+    rocblas_int blocks = rocblas_reduction_repro_block_count(n);
+    double*     wmax   = (double*)workspace + 2 * size_t(batch_count);
+    bins_t*     wbins  = (bins_t*)(wmax + size_t(batch_count) * blocks);
+    Tr*         output = results;
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+        output = (Tr*)workspace;
+
+    dim3 grid(blocks, batch_count);
+    hipLaunchKernelGGL((rocblas_reduction_repro_kernel_max<c_repro_NB, TERM>),
+                       grid,
+                       c_repro_NB,
+                       0,
+                       handle->get_stream(),
+                       n,
+                       x,
+                       shiftx,
+                       incx,
+                       stridex,
+                       y,
+                       shifty,
+                       incy,
+                       stridey,
+                       wmax);
+
+    hipLaunchKernelGGL((rocblas_reduction_repro_kernel_bins<c_repro_NB, TERM>),
+                       grid,
+                       c_repro_NB,
+                       0,
+                       handle->get_stream(),
+                       n,
+                       log2n,
+                       x,
+                       shiftx,
+                       incx,
+                       stridex,
+                       y,
+                       shifty,
+                       incy,
+                       stridey,
+                       wmax,
+                       wbins);
+
+    hipLaunchKernelGGL((rocblas_reduction_repro_kernel_final<c_repro_NB, FINALIZE>),
+                       dim3(1, batch_count),
+                       c_repro_NB,
+                       0,
+                       handle->get_stream(),
+                       blocks,
+                       log2n,
+                       wmax,
+                       wbins,
+                       output);
+
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(results,
+                                           output,
+                                           sizeof(Tr) * batch_count,
+                                           hipMemcpyDeviceToHost,
+                                           handle->get_stream()));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+    }
+
+    return rocblas_status_success;
+}
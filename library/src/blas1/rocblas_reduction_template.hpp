@@ -6,6 +6,7 @@
 
 #include "handle.hpp"
 #include "reduction_strided_batched.hpp"
+#include "rocblas_reduction_repro.hpp"
 
 template <rocblas_int NB,
           bool        ISBATCHED,
@@ -25,6 +26,27 @@ rocblas_status rocblas_reduction_template(rocblas_handle handle,
                                           Tr*            results,
                                           Tw*            workspace)
 {
+    // Sums with a reproducible term are reproducible when the API call selects the reproducible
+    // algorithms of rocblas_reduction_mode_reproducible
+    using TERM = typename rocblas_repro_term<FETCH>::type;
+    if constexpr(!std::is_void<TERM>{})
+    {
+        if(handle->reduction_algorithms.reproducible)
+            return rocblas_reduction_repro_template<TERM, FINALIZE>(handle,
+                                                                    n,
+                                                                    x,
+                                                                    shiftx,
+                                                                    incx,
+                                                                    stridex,
+                                                                    x,
+                                                                    shiftx,
+                                                                    incx,
+                                                                    stridex,
+                                                                    batch_count,
+                                                                    results,
+                                                                    (void*)workspace);
+    }
+
     return rocblas_reduction_strided_batched<NB, FETCH, REDUCE, FINALIZE>(
         handle, n, x, shiftx, incx, stridex, batch_count, workspace, results);
 }
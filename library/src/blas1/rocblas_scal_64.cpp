@@ -0,0 +1,147 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_scal.hpp"
+#include "check_numerics_vector.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+
+namespace
+{
+    template <typename T, typename = T>
+    constexpr char rocblas_scal_name[] = "unknown";
+    template <>
+    constexpr char rocblas_scal_name<float>[] = "rocblas_sscal_64";
+    template <>
+    constexpr char rocblas_scal_name<double>[] = "rocblas_dscal_64";
+    template <>
+    constexpr char rocblas_scal_name<rocblas_float_complex>[] = "rocblas_cscal_64";
+    template <>
+    constexpr char rocblas_scal_name<rocblas_double_complex>[] = "rocblas_zscal_64";
+    template <>
+    constexpr char rocblas_scal_name<rocblas_float_complex, float>[] = "rocblas_csscal_64";
+    template <>
+    constexpr char rocblas_scal_name<rocblas_double_complex, double>[] = "rocblas_zdscal_64";
+
+    template <typename T, typename U>
+    rocblas_status rocblas_scal_64_check_numerics(rocblas_handle handle,
+                                                  int64_t        n,
+                                                  T*             x,
+                                                  int64_t        incx,
+                                                  const int      check_numerics,
+                                                  bool           is_input)
+    {
+        for(int64_t start = 0; start < n; start += c_i64_chunk)
+        {
+            rocblas_i64_elementwise_chunk chunk(n, start, incx);
+            rocblas_status                status = rocblas_internal_check_numerics_vector_template(
+                rocblas_scal_name<T, U>,
+                handle,
+                chunk.n(),
+                x + chunk.offset(incx),
+                0,
+                chunk.inc(incx),
+                chunk.stride(incx),
+                chunk.batch_count(),
+                check_numerics,
+                is_input);
+            if(status != rocblas_status_success)
+                return status;
+        }
+        return rocblas_status_success;
+    }
+
+    template <rocblas_int NB, typename T, typename U>
+    rocblas_status
+        rocblas_scal_64_impl(rocblas_handle handle, int64_t n, const U* alpha, T* x, int64_t incx)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(
+                handle, rocblas_scal_name<T, U>, n, LOG_TRACE_SCALAR_VALUE(handle, alpha), x, incx);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, rocblas_scal_name<T, U>, "N", n, "incx", incx);
+
+        if(n <= 0 || incx <= 0)
+            return rocblas_status_success;
+        if(!x || !alpha)
+            return rocblas_status_invalid_pointer;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(check_numerics)
+        {
+            rocblas_status status = rocblas_scal_64_check_numerics<T, U>(
+                handle, n, x, incx, check_numerics, true);
+            if(status != rocblas_status_success)
+                return status;
+        }
+
+        for(int64_t start = 0; start < n; start += c_i64_chunk)
+        {
+            rocblas_i64_elementwise_chunk chunk(n, start, incx);
+            rocblas_status                status
+                = rocblas_internal_scal_template<NB, T>(handle,
+                                                        chunk.n(),
+                                                        alpha,
+                                                        0,
+                                                        x + chunk.offset(incx),
+                                                        0,
+                                                        chunk.inc(incx),
+                                                        chunk.stride(incx),
+                                                        chunk.batch_count());
+            if(status != rocblas_status_success)
+                return status;
+        }
+
+        if(check_numerics)
+            return rocblas_scal_64_check_numerics<T, U>(handle, n, x, incx, check_numerics, false);
+
+        return rocblas_status_success;
+    }
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_, U_)                                             \
+    rocblas_status routine_name_(                                               \
+        rocblas_handle handle, int64_t n, const U_* alpha, T_* x, int64_t incx) \
+    try                                                                         \
+    {                                                                           \
+        constexpr rocblas_int NB = 256;                                         \
+        return rocblas_scal_64_impl<NB>(handle, n, alpha, x, incx);             \
+    }                                                                           \
+    catch(...)                                                                  \
+    {                                                                           \
+        return exception_to_rocblas_status();                                   \
+    }
+
+IMPL(rocblas_sscal_64, float, float);
+IMPL(rocblas_dscal_64, double, double);
+IMPL(rocblas_cscal_64, rocblas_float_complex, rocblas_float_complex);
+IMPL(rocblas_zscal_64, rocblas_double_complex, rocblas_double_complex);
+// Scal with a real alpha & complex vector
+IMPL(rocblas_csscal_64, rocblas_float_complex, float);
+IMPL(rocblas_zdscal_64, rocblas_double_complex, double);
+
+#undef IMPL
+
+} // extern "C"
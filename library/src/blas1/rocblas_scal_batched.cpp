@@ -36,6 +36,8 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
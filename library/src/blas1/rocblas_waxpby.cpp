@@ -0,0 +1,197 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "logging.hpp"
+#include "rocblas_axpby.hpp"
+
+namespace
+{
+
+    template <typename>
+    constexpr char rocblas_waxpby_name[] = "unknown";
+    template <>
+    constexpr char rocblas_waxpby_name<float>[] = "rocblas_swaxpby";
+    template <>
+    constexpr char rocblas_waxpby_name<double>[] = "rocblas_dwaxpby";
+    template <>
+    constexpr char rocblas_waxpby_name<rocblas_float_complex>[] = "rocblas_cwaxpby";
+    template <>
+    constexpr char rocblas_waxpby_name<rocblas_double_complex>[] = "rocblas_zwaxpby";
+
+    template <int NB, typename T>
+    rocblas_status rocblas_waxpby_impl(rocblas_handle handle,
+                                       rocblas_int    n,
+                                       const T*       alpha,
+                                       const T*       x,
+                                       rocblas_int    incx,
+                                       const T*       beta,
+                                       const T*       y,
+                                       rocblas_int    incy,
+                                       T*             w,
+                                       rocblas_int    incw)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_waxpby_name<T>,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      x,
+                      incx,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      y,
+                      incy,
+                      w,
+                      incw);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      "./rocblas-bench -f waxpby -r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                      "--incx",
+                      incx,
+                      LOG_BENCH_SCALAR_VALUE(handle, beta),
+                      "--incy",
+                      incy);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(
+                handle, rocblas_waxpby_name<T>, "N", n, "incx", incx, "incy", incy, "incw", incw);
+
+        if(n <= 0) // Quick return if possible. Not Argument error
+            return rocblas_status_success;
+
+        if(!alpha || !beta || !x || !y || !w)
+            return rocblas_status_invalid_pointer;
+
+        static constexpr rocblas_stride stride_0 = 0;
+        static constexpr ptrdiff_t      offset_0 = 0;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status waxpby_check_numerics_status
+                = rocblas_waxpby_check_numerics(rocblas_waxpby_name<T>,
+                                                handle,
+                                                n,
+                                                x,
+                                                offset_0,
+                                                incx,
+                                                stride_0,
+                                                y,
+                                                offset_0,
+                                                incy,
+                                                stride_0,
+                                                w,
+                                                offset_0,
+                                                incw,
+                                                stride_0,
+                                                1,
+                                                check_numerics,
+                                                is_input);
+            if(waxpby_check_numerics_status != rocblas_status_success)
+                return waxpby_check_numerics_status;
+        }
+
+        rocblas_status status = rocblas_internal_waxpby_template<NB>(handle,
+                                                                     n,
+                                                                     alpha,
+                                                                     x,
+                                                                     offset_0,
+                                                                     incx,
+                                                                     stride_0,
+                                                                     beta,
+                                                                     y,
+                                                                     offset_0,
+                                                                     incy,
+                                                                     stride_0,
+                                                                     w,
+                                                                     offset_0,
+                                                                     incw,
+                                                                     stride_0,
+                                                                     1);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status waxpby_check_numerics_status
+                = rocblas_waxpby_check_numerics(rocblas_waxpby_name<T>,
+                                                handle,
+                                                n,
+                                                x,
+                                                offset_0,
+                                                incx,
+                                                stride_0,
+                                                y,
+                                                offset_0,
+                                                incy,
+                                                stride_0,
+                                                w,
+                                                offset_0,
+                                                incw,
+                                                stride_0,
+                                                1,
+                                                check_numerics,
+                                                is_input);
+            if(waxpby_check_numerics_status != rocblas_status_success)
+                return waxpby_check_numerics_status;
+        }
+        return status;
+    }
+
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                             \
+    rocblas_status routine_name_(rocblas_handle handle,                                     \
+                                 rocblas_int    n,                                          \
+                                 const T_*      alpha,                                      \
+                                 const T_*      x,                                          \
+                                 rocblas_int    incx,                                       \
+                                 const T_*      beta,                                       \
+                                 const T_*      y,                                          \
+                                 rocblas_int    incy,                                       \
+                                 T_*            w,                                          \
+                                 rocblas_int    incw)                                       \
+    try                                                                                     \
+    {                                                                                       \
+        return rocblas_waxpby_impl<256>(handle, n, alpha, x, incx, beta, y, incy, w, incw); \
+    }                                                                                       \
+    catch(...)                                                                              \
+    {                                                                                       \
+        return exception_to_rocblas_status();                                               \
+    }
+
+IMPL(rocblas_swaxpby, float);
+IMPL(rocblas_dwaxpby, double);
+IMPL(rocblas_cwaxpby, rocblas_float_complex);
+IMPL(rocblas_zwaxpby, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
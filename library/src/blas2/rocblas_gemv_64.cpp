@@ -0,0 +1,335 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_gemv.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemv_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemv_name<float>[] = "rocblas_sgemv_64";
+    template <>
+    constexpr char rocblas_gemv_name<double>[] = "rocblas_dgemv_64";
+    template <>
+    constexpr char rocblas_gemv_name<rocblas_float_complex>[] = "rocblas_cgemv_64";
+    template <>
+    constexpr char rocblas_gemv_name<rocblas_double_complex>[] = "rocblas_zgemv_64";
+
+    // Computes one block of rows and columns of A with the rocblas_int template
+    template <typename T>
+    rocblas_status rocblas_gemv_64_block(rocblas_handle    handle,
+                                         rocblas_operation transA,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         const T*          alpha,
+                                         const T*          A,
+                                         rocblas_int       lda,
+                                         const T*          x,
+                                         rocblas_int       incx,
+                                         const T*          beta,
+                                         T*                y,
+                                         rocblas_int       incy,
+                                         T*                workspace,
+                                         const int         check_numerics)
+    {
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status gemv_check_numerics_status
+                = rocblas_gemv_check_numerics(rocblas_gemv_name<T>,
+                                              handle,
+                                              transA,
+                                              m,
+                                              n,
+                                              A,
+                                              0,
+                                              lda,
+                                              0,
+                                              x,
+                                              0,
+                                              incx,
+                                              0,
+                                              y,
+                                              0,
+                                              incy,
+                                              0,
+                                              1,
+                                              check_numerics,
+                                              is_input);
+            if(gemv_check_numerics_status != rocblas_status_success)
+                return gemv_check_numerics_status;
+        }
+
+        rocblas_status status = rocblas_internal_gemv_template<T>(handle,
+                                                                  transA,
+                                                                  m,
+                                                                  n,
+                                                                  alpha,
+                                                                  0,
+                                                                  A,
+                                                                  0,
+                                                                  lda,
+                                                                  0,
+                                                                  x,
+                                                                  0,
+                                                                  incx,
+                                                                  0,
+                                                                  beta,
+                                                                  0,
+                                                                  y,
+                                                                  0,
+                                                                  incy,
+                                                                  0,
+                                                                  1,
+                                                                  workspace);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status gemv_check_numerics_status
+                = rocblas_gemv_check_numerics(rocblas_gemv_name<T>,
+                                              handle,
+                                              transA,
+                                              m,
+                                              n,
+                                              A,
+                                              0,
+                                              lda,
+                                              0,
+                                              x,
+                                              0,
+                                              incx,
+                                              0,
+                                              y,
+                                              0,
+                                              incy,
+                                              0,
+                                              1,
+                                              check_numerics,
+                                              is_input);
+            if(gemv_check_numerics_status != rocblas_status_success)
+                return gemv_check_numerics_status;
+        }
+        return status;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemv_64_impl(rocblas_handle    handle,
+                                        rocblas_operation transA,
+                                        int64_t           m,
+                                        int64_t           n,
+                                        const T*          alpha,
+                                        const T*          A,
+                                        int64_t           lda,
+                                        const T*          x,
+                                        int64_t           incx,
+                                        const T*          beta,
+                                        T*                y,
+                                        int64_t           incy)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
+        // A is split into blocks of at most chunk_m rows and chunk_n columns. A block has a single
+        // column when lda does not fit in rocblas_int.
+        bool    trans   = transA != rocblas_operation_none;
+        int64_t chunk_m = c_i64_chunk;
+        int64_t chunk_n = rocblas_i64_fits(lda) ? c_i64_chunk : int64_t(1);
+
+        size_t dev_bytes = rocblas_internal_gemv_kernel_workspace_size<T>(
+            transA,
+            rocblas_int(std::min(std::max(m, int64_t(0)), chunk_m)),
+            rocblas_int(std::min(std::max(n, int64_t(0)), chunk_n)));
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_profile))
+        {
+            auto transA_letter = rocblas_transpose_letter(transA);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          rocblas_gemv_name<T>,
+                          transA,
+                          m,
+                          n,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          A,
+                          lda,
+                          x,
+                          incx,
+                          LOG_TRACE_SCALAR_VALUE(handle, beta),
+                          y,
+                          incy);
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_gemv_name<T>,
+                            "transA",
+                            transA_letter,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "lda",
+                            lda,
+                            "incx",
+                            incx,
+                            "incy",
+                            incy);
+        }
+
+        if(m < 0 || n < 0 || lda < m || lda < 1 || !incx || !incy || !rocblas_i64_fits(incx)
+           || !rocblas_i64_fits(incy))
+            return rocblas_status_invalid_size;
+
+        if(!m || !n)
+            return rocblas_status_success;
+
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && !*alpha)
+        {
+            if(*beta == 1)
+                return rocblas_status_success;
+        }
+        else
+        {
+            if(!A || !x)
+                return rocblas_status_invalid_pointer;
+        }
+
+        if(!y)
+            return rocblas_status_invalid_pointer;
+
+        rocblas_status perf_status = rocblas_status_success;
+        auto           w_mem       = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            perf_status = rocblas_status_perf_degraded;
+
+        rocblas_status status = rocblas_status_success;
+        if(m <= chunk_m && n <= chunk_n)
+        {
+            status = rocblas_gemv_64_block(handle,
+                                           transA,
+                                           rocblas_int(m),
+                                           rocblas_int(n),
+                                           alpha,
+                                           A,
+                                           rocblas_int(lda),
+                                           x,
+                                           rocblas_int(incx),
+                                           beta,
+                                           y,
+                                           rocblas_int(incy),
+                                           (T*)w_mem,
+                                           check_numerics);
+        }
+        else
+        {
+            // Each block of y is scaled by beta in its first block of A, and accumulated into by
+            // the others, so the scalars are copied to the host to pass beta or one per block
+            T alpha_h, beta_h;
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+            {
+                RETURN_IF_HIP_ERROR(hipMemcpy(&alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost));
+                RETURN_IF_HIP_ERROR(hipMemcpy(&beta_h, beta, sizeof(T), hipMemcpyDeviceToHost));
+                alpha = &alpha_h;
+                beta  = &beta_h;
+            }
+            auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+            static const T one = T(1);
+            int64_t        n_x = trans ? m : n;
+            int64_t        n_y = trans ? n : m;
+            for(int64_t j = 0; j < n; j += chunk_n)
+            {
+                int64_t count_n = std::min(n - j, chunk_n);
+                for(int64_t i = 0; i < m; i += chunk_m)
+                {
+                    int64_t count_m     = std::min(m - i, chunk_m);
+                    bool    first_block = !(trans ? i : j);
+                    int64_t offset_x    = rocblas_i64_chunk_offset(
+                        n_x, trans ? i : j, trans ? count_m : count_n, incx);
+                    int64_t offset_y    = rocblas_i64_chunk_offset(
+                        n_y, trans ? j : i, trans ? count_n : count_m, incy);
+
+                    status = rocblas_gemv_64_block(
+                        handle,
+                        transA,
+                        rocblas_int(count_m),
+                        rocblas_int(count_n),
+                        alpha,
+                        A + i + j * lda,
+                        rocblas_int(rocblas_i64_fits(lda) ? lda : count_m),
+                        x + offset_x,
+                        rocblas_int(incx),
+                        first_block ? beta : &one,
+                        y + offset_y,
+                        rocblas_int(incy),
+                        (T*)w_mem,
+                        check_numerics);
+                    if(status != rocblas_status_success)
+                        return status;
+                }
+            }
+        }
+
+        return status != rocblas_status_success ? status : perf_status;
+    }
+
+} // namespace
+
+/*
+* ===========================================================================
+*    C wrapper
+* ===========================================================================
+*/
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                           \
+    rocblas_status routine_name_(rocblas_handle    handle,                \
+                                 rocblas_operation transA,                \
+                                 int64_t           m,                     \
+                                 int64_t           n,                     \
+                                 const T_*         alpha,                 \
+                                 const T_*         A,                     \
+                                 int64_t           lda,                   \
+                                 const T_*         x,                     \
+                                 int64_t           incx,                  \
+                                 const T_*         beta,                  \
+                                 T_*               y,                     \
+                                 int64_t           incy)                  \
+    try                                                                   \
+    {                                                                     \
+        return rocblas_gemv_64_impl(                                      \
+            handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy); \
+    }                                                                     \
+    catch(...)                                                            \
+    {                                                                     \
+        return exception_to_rocblas_status();                             \
+    }
+
+IMPL(rocblas_sgemv_64, float);
+IMPL(rocblas_dgemv_64, double);
+IMPL(rocblas_cgemv_64, rocblas_float_complex);
+IMPL(rocblas_zgemv_64, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
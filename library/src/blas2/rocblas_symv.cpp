@@ -34,6 +34,8 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
         auto check_numerics = handle->check_numerics;
         if(!handle->is_device_memory_size_query())
         {
@@ -43,23 +43,24 @@ rocblas_status copy_alpha_beta_to_host_if_on_device(
 }
 /*******************************************************************************
  * Validate Arguments
+ * I is rocblas_int, or int64_t for the _64 interfaces
  ******************************************************************************/
-template <typename T>
+template <typename T, typename I>
 inline rocblas_status validateArgs(rocblas_handle    handle,
                                    rocblas_operation trans_a,
                                    rocblas_operation trans_b,
-                                   rocblas_int       m,
-                                   rocblas_int       n,
-                                   rocblas_int       k,
+                                   I                 m,
+                                   I                 n,
+                                   I                 k,
                                    const T*          alpha,
                                    const void*       a,
-                                   rocblas_int       lda,
+                                   I                 lda,
                                    const void*       b,
-                                   rocblas_int       ldb,
+                                   I                 ldb,
                                    const T*          beta,
                                    const void*       c,
-                                   rocblas_int       ldc,
-                                   rocblas_int       batch_count = 1)
+                                   I                 ldc,
+                                   I                 batch_count = 1)
 {
     // handle must be valid
     if(!handle)
@@ -69,9 +70,9 @@ inline rocblas_status validateArgs(rocblas_handle    handle,
     if(m < 0 || n < 0 || k < 0 || batch_count < 0)
         return rocblas_status_invalid_size;
 
-    rocblas_int num_rows_a = trans_a == rocblas_operation_none ? m : k;
-    rocblas_int num_rows_b = trans_b == rocblas_operation_none ? k : n;
-    rocblas_int num_rows_c = m;
+    I num_rows_a = trans_a == rocblas_operation_none ? m : k;
+    I num_rows_b = trans_b == rocblas_operation_none ? k : n;
+    I num_rows_c = m;
 
     // leading dimensions must be valid
     if(num_rows_a > lda || num_rows_b > ldb || num_rows_c > ldc)
@@ -0,0 +1,321 @@
+/**************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ ************************************************************************** */
+
+#include "gemm.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemm_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemm_name<rocblas_half>[] = "rocblas_hgemm_64";
+    template <>
+    constexpr char rocblas_gemm_name<float>[] = "rocblas_sgemm_64";
+    template <>
+    constexpr char rocblas_gemm_name<double>[] = "rocblas_dgemm_64";
+    template <>
+    constexpr char rocblas_gemm_name<rocblas_float_complex>[] = "rocblas_cgemm_64";
+    template <>
+    constexpr char rocblas_gemm_name<rocblas_double_complex>[] = "rocblas_zgemm_64";
+
+    // Computes one block of C, for one block of the k dimension, with the rocblas_int template
+    template <typename T>
+    rocblas_status rocblas_gemm_64_block(rocblas_handle    handle,
+                                         rocblas_operation trans_a,
+                                         rocblas_operation trans_b,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         rocblas_int       k,
+                                         const T*          alpha,
+                                         const T*          A,
+                                         rocblas_int       lda,
+                                         const T*          B,
+                                         rocblas_int       ldb,
+                                         const T*          beta,
+                                         T*                C,
+                                         rocblas_int       ldc,
+                                         const int         check_numerics)
+    {
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status gemm_check_numerics_status
+                = rocblas_gemm_check_numerics(rocblas_gemm_name<T>,
+                                              handle,
+                                              trans_a,
+                                              trans_b,
+                                              m,
+                                              n,
+                                              k,
+                                              A,
+                                              lda,
+                                              0,
+                                              B,
+                                              ldb,
+                                              0,
+                                              C,
+                                              ldc,
+                                              0,
+                                              1,
+                                              check_numerics,
+                                              is_input);
+            if(gemm_check_numerics_status != rocblas_status_success)
+                return gemm_check_numerics_status;
+        }
+
+        rocblas_status status = rocblas_internal_gemm_template<false>(handle,
+                                                                      trans_a,
+                                                                      trans_b,
+                                                                      m,
+                                                                      n,
+                                                                      k,
+                                                                      alpha,
+                                                                      A,
+                                                                      0,
+                                                                      lda,
+                                                                      0,
+                                                                      B,
+                                                                      0,
+                                                                      ldb,
+                                                                      0,
+                                                                      beta,
+                                                                      C,
+                                                                      0,
+                                                                      ldc,
+                                                                      0,
+                                                                      1);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status gemm_check_numerics_status
+                = rocblas_gemm_check_numerics(rocblas_gemm_name<T>,
+                                              handle,
+                                              trans_a,
+                                              trans_b,
+                                              m,
+                                              n,
+                                              k,
+                                              A,
+                                              lda,
+                                              0,
+                                              B,
+                                              ldb,
+                                              0,
+                                              C,
+                                              ldc,
+                                              0,
+                                              1,
+                                              check_numerics,
+                                              is_input);
+            if(gemm_check_numerics_status != rocblas_status_success)
+                return gemm_check_numerics_status;
+        }
+        return status;
+    }
+
+    /*******************************************************************************
+    * GEMM implementation of the _64 interfaces. The matrices are split into blocks
+    * of at most c_i64_chunk rows, columns and k, or of one of them when a leading
+    * dimension indexing it does not fit in rocblas_int, and the blocks of C are
+    * accumulated over the blocks of k.
+    ******************************************************************************/
+    template <typename T>
+    auto rocblas_gemm_64_impl(rocblas_handle    handle,
+                              rocblas_operation trans_a,
+                              rocblas_operation trans_b,
+                              int64_t           m,
+                              int64_t           n,
+                              int64_t           k,
+                              const T*          alpha,
+                              const T*          A,
+                              int64_t           lda,
+                              const T*          B,
+                              int64_t           ldb,
+                              const T*          beta,
+                              T*                C,
+                              int64_t           ldc)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        // Copy alpha and beta to host if on device. Only whether k is 0 matters to the copy.
+        T alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, rocblas_int(k != 0)));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_profile))
+        {
+            auto trans_a_letter = rocblas_transpose_letter(trans_a);
+            auto trans_b_letter = rocblas_transpose_letter(trans_b);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          rocblas_gemm_name<T>,
+                          trans_a,
+                          trans_b,
+                          m,
+                          n,
+                          k,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          A,
+                          lda,
+                          B,
+                          ldb,
+                          LOG_TRACE_SCALAR_VALUE(handle, beta),
+                          C,
+                          ldc);
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_gemm_name<T>,
+                            "transA",
+                            trans_a_letter,
+                            "transB",
+                            trans_b_letter,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "K",
+                            k,
+                            "alpha",
+                            value_category(*alpha),
+                            "lda",
+                            lda,
+                            "ldb",
+                            ldb,
+                            "beta",
+                            value_category(*beta),
+                            "ldc",
+                            ldc);
+        }
+
+        auto validArgs
+            = validateArgs(handle, trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+
+        if(validArgs != rocblas_status_continue)
+            return validArgs;
+
+        // A leading dimension which does not fit in rocblas_int limits the dimension of the
+        // columns it indexes to one per block, and a block then has one column of that matrix
+        bool    trans_a_none = trans_a == rocblas_operation_none;
+        bool    trans_b_none = trans_b == rocblas_operation_none;
+        int64_t chunk_m      = c_i64_chunk;
+        int64_t chunk_n      = c_i64_chunk;
+        int64_t chunk_k      = c_i64_chunk;
+        if(!rocblas_i64_fits(lda))
+        {
+            if(trans_a_none)
+                chunk_k = 1;
+            else
+                chunk_m = 1;
+        }
+        if(!rocblas_i64_fits(ldb))
+        {
+            if(trans_b_none)
+                chunk_n = 1;
+            else
+                chunk_k = 1;
+        }
+        if(!rocblas_i64_fits(ldc))
+            chunk_n = 1;
+
+        static const T one = T(1);
+        for(int64_t j = 0; j < n; j += chunk_n)
+        {
+            int64_t count_n = std::min(n - j, chunk_n);
+            for(int64_t i = 0; i < m; i += chunk_m)
+            {
+                int64_t count_m = std::min(m - i, chunk_m);
+                // C is scaled by beta in the first block of k, which may be empty
+                int64_t l = 0;
+                do
+                {
+                    int64_t count_k = std::min(k - l, chunk_k);
+                    int64_t rows_a  = trans_a_none ? count_m : count_k;
+                    int64_t rows_b  = trans_b_none ? count_k : count_n;
+
+                    rocblas_status status = rocblas_gemm_64_block(
+                        handle,
+                        trans_a,
+                        trans_b,
+                        rocblas_int(count_m),
+                        rocblas_int(count_n),
+                        rocblas_int(count_k),
+                        alpha,
+                        trans_a_none ? A + i + l * lda : A + l + i * lda,
+                        rocblas_int(rocblas_i64_fits(lda) ? lda : std::max(rows_a, int64_t(1))),
+                        trans_b_none ? B + l + j * ldb : B + j + l * ldb,
+                        rocblas_int(rocblas_i64_fits(ldb) ? ldb : std::max(rows_b, int64_t(1))),
+                        l ? &one : beta,
+                        C + i + j * ldc,
+                        rocblas_int(rocblas_i64_fits(ldc) ? ldc : count_m),
+                        check_numerics);
+                    if(status != rocblas_status_success)
+                        return status;
+
+                    l += chunk_k;
+                } while(l < k);
+            }
+        }
+
+        return rocblas_status_success;
+    }
+}
+
+/*******************************************************************************
+ * GEMM _64 APIs
+ ******************************************************************************/
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                      \
+    rocblas_status routine_name_(rocblas_handle    handle,                           \
+                                 rocblas_operation trans_a,                          \
+                                 rocblas_operation trans_b,                          \
+                                 int64_t           m,                                \
+                                 int64_t           n,                                \
+                                 int64_t           k,                                \
+                                 const T_*         alpha,                            \
+                                 const T_*         A,                                \
+                                 int64_t           lda,                              \
+                                 const T_*         B,                                \
+                                 int64_t           ldb,                              \
+                                 const T_*         beta,                             \
+                                 T_*               C,                                \
+                                 int64_t           ldc)                              \
+    try                                                                              \
+    {                                                                                \
+        return rocblas_gemm_64_impl(                                                 \
+            handle, trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc); \
+    }                                                                                \
+    catch(...)                                                                       \
+    {                                                                                \
+        return exception_to_rocblas_status();                                        \
+    }
+
+IMPL(rocblas_hgemm_64, rocblas_half);
+IMPL(rocblas_sgemm_64, float);
+IMPL(rocblas_dgemm_64, double);
+IMPL(rocblas_cgemm_64, rocblas_float_complex);
+IMPL(rocblas_zgemm_64, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
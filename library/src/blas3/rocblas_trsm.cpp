@@ -54,6 +54,8 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
         /////////////
         // LOGGING //
         /////////////
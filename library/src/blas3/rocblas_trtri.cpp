@@ -32,6 +32,8 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
         size_t size = rocblas_internal_trtri_temp_size<NB>(n, 1) * sizeof(T);
         if(handle->is_device_memory_size_query())
         {
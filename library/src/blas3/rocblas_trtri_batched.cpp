@@ -34,6 +34,8 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
         // Compute the optimal size for temporary device memory
         size_t els   = rocblas_internal_trtri_temp_size<NB>(n, 1);
         size_t size  = els * batch_count * sizeof(T);
@@ -36,6 +36,8 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
         // Compute the optimal size for temporary device memory
         size_t size = rocblas_internal_trtri_temp_size<NB>(n, batch_count) * sizeof(T);
         if(handle->is_device_memory_size_query())
@@ -31,8 +31,13 @@ namespace
             return rocblas_status_invalid_handle;
         }
 
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
         size_t dev_bytes
             = rocblas_reduction_kernel_workspace_size<NB>(n, batch_count, execution_type);
+        if(handle->reduction_mode == rocblas_reduction_mode_reproducible)
+            dev_bytes
+                = std::max(dev_bytes, rocblas_reduction_repro_workspace_size(n, batch_count));
         if(handle->is_device_memory_size_query())
         {
             if(n <= 0 || batch_count <= 0)
@@ -140,6 +145,8 @@ namespace
             return rocblas_status_memory_error;
 
         static constexpr rocblas_stride stride_0 = 0;
+        // Sums are reproducible in rocblas_reduction_mode_reproducible
+        auto algorithms = handle->push_reduction_algorithms();
         return rocblas_dot_ex_template<NB, true, CONJ>(handle,
                                                        n,
                                                        x,
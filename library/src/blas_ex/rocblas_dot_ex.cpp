@@ -30,7 +30,11 @@ namespace
             return rocblas_status_invalid_handle;
         }
 
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
         size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB>(n, 1, execution_type);
+        if(handle->reduction_mode == rocblas_reduction_mode_reproducible)
+            dev_bytes = std::max(dev_bytes, rocblas_reduction_repro_workspace_size(n));
         if(handle->is_device_memory_size_query())
         {
             if(n <= 0)
@@ -128,6 +132,8 @@ namespace
 
         static constexpr rocblas_int    batch_count_1 = 1;
         static constexpr rocblas_stride stride_0      = 0;
+        // Sums are reproducible in rocblas_reduction_mode_reproducible
+        auto algorithms = handle->push_reduction_algorithms();
         return rocblas_dot_ex_template<NB, false, CONJ>(handle,
                                                         n,
                                                         x,
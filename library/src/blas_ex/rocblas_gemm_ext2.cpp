@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocblas_gemm_ext2.hpp"
+#include "rocblas_gemm_ext2_host.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
@@ -10,78 +11,52 @@
 
 namespace
 {
-    template <typename Ti, typename To, typename Tc>
-    rocblas_status reference_gemm_ext2(rocblas_int    M,
-                                       rocblas_int    N,
-                                       rocblas_int    K,
-                                       const Tc*      alpha,
-                                       const Ti*      A,
-                                       rocblas_stride row_stride_a,
-                                       rocblas_stride col_stride_a,
-                                       const Ti*      B,
-                                       rocblas_stride row_stride_b,
-                                       rocblas_stride col_stride_b,
-                                       const Tc*      beta,
-                                       const To*      C,
-                                       rocblas_stride row_stride_c,
-                                       rocblas_stride col_stride_c,
-                                       To*            D,
-                                       rocblas_stride row_stride_d,
-                                       rocblas_stride col_stride_d)
-    {
-        for(rocblas_int row = 0; row < M; row++)
-            for(rocblas_int col = 0; col < N; col++)
-            {
-                Tc t{};
-                if(*alpha)
-                    for(rocblas_int k = 0; k < K; k++)
-                        t += Tc{A[row * row_stride_a + k * col_stride_a]}
-                             * Tc{B[k * row_stride_b + col * col_stride_b]};
-                D[row * row_stride_d + col * col_stride_d] = static_cast<To>(
-                    *beta ? *beta * C[row * row_stride_c + col * col_stride_c] + *alpha * t
-                          : *alpha * t);
-            }
-        return rocblas_status_success;
-    }
-
+    // On-host gemm_ext2 of device arrays, with the copies overlapped with the computation
     template <typename Ti, typename To = Ti, typename Tc = To>
-    struct reference_gemm_ext2_call
+    struct host_gemm_ext2_call
     {
-        rocblas_status operator()(rocblas_int    M,
+        rocblas_status operator()(rocblas_handle handle,
+                                  rocblas_int    M,
                                   rocblas_int    N,
                                   rocblas_int    K,
-                                  const void*    alpha,
-                                  const void*    A,
+                                  const void*    alpha_ptr,
+                                  const void*    a,
                                   rocblas_stride row_stride_a,
                                   rocblas_stride col_stride_a,
-                                  const void*    B,
+                                  const void*    b,
                                   rocblas_stride row_stride_b,
                                   rocblas_stride col_stride_b,
-                                  const void*    beta,
-                                  const void*    C,
+                                  const void*    beta_ptr,
+                                  const void*    c,
                                   rocblas_stride row_stride_c,
                                   rocblas_stride col_stride_c,
-                                  void*          D,
+                                  void*          d,
                                   rocblas_stride row_stride_d,
                                   rocblas_stride col_stride_d) const
         {
-            return reference_gemm_ext2(M,
-                                       N,
-                                       K,
-                                       static_cast<const Tc*>(alpha),
-                                       static_cast<const Ti*>(A),
-                                       row_stride_a,
-                                       col_stride_a,
-                                       static_cast<const Ti*>(B),
-                                       row_stride_b,
-                                       col_stride_b,
-                                       static_cast<const Tc*>(beta),
-                                       static_cast<const To*>(C),
-                                       row_stride_c,
-                                       col_stride_c,
-                                       static_cast<To*>(D),
-                                       row_stride_d,
-                                       col_stride_d);
+            // alpha may be nullptr when K is 0
+            const Tc alpha = alpha_ptr ? *static_cast<const Tc*>(alpha_ptr) : Tc{};
+            const Tc beta  = *static_cast<const Tc*>(beta_ptr);
+
+            RETURN_IF_HIP_ERROR(gemm_ext2_host_device(handle->getDevice(),
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      alpha,
+                                                      static_cast<const Ti*>(a),
+                                                      row_stride_a,
+                                                      col_stride_a,
+                                                      static_cast<const Ti*>(b),
+                                                      row_stride_b,
+                                                      col_stride_b,
+                                                      beta,
+                                                      static_cast<const To*>(c),
+                                                      row_stride_c,
+                                                      col_stride_c,
+                                                      static_cast<To*>(d),
+                                                      row_stride_d,
+                                                      col_stride_d));
+            return rocblas_status_success;
         }
     };
 
@@ -176,6 +151,8 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
         const bool HPA = compute_type == rocblas_datatype_f32_r
                          && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
 
@@ -428,63 +405,35 @@ namespace
         }
         catch(...)
         {
-            // Fall back on slow, naive algorithm if not implemented in Tensile
+            // Fall back on the host if not implemented in Tensile
             static auto& once = rocblas_cerr
                                 << "\nWarning: Using slow on-host algorithm, because it "
                                    "is not implemented in Tensile yet."
                                 << std::endl;
 
-            size_t size_a = size_t(m - 1) * row_stride_a + size_t(k - 1) * col_stride_a + 1;
-            size_t size_b = size_t(k - 1) * row_stride_b + size_t(n - 1) * col_stride_b + 1;
-            size_t size_c = size_t(m - 1) * row_stride_c + size_t(n - 1) * col_stride_c + 1;
-            size_t size_d = size_t(m - 1) * row_stride_d + size_t(n - 1) * col_stride_d + 1;
-
-            std::unique_ptr<char[]> ha{a ? new char[rocblas_sizeof_datatype(a_type) * size_a]
-                                         : nullptr};
-            std::unique_ptr<char[]> hb{b ? new char[rocblas_sizeof_datatype(b_type) * size_b]
-                                         : nullptr};
-            std::unique_ptr<char[]> hc{c ? new char[rocblas_sizeof_datatype(c_type) * size_c]
-                                         : nullptr};
-            std::unique_ptr<char[]> hd{new char[rocblas_sizeof_datatype(d_type) * size_d]};
-
-            if(a)
-                RETURN_IF_HIP_ERROR(hipMemcpy(
-                    ha.get(), a, rocblas_sizeof_datatype(a_type) * size_a, hipMemcpyDeviceToHost));
-            if(b)
-                RETURN_IF_HIP_ERROR(hipMemcpy(
-                    hb.get(), b, rocblas_sizeof_datatype(b_type) * size_b, hipMemcpyDeviceToHost));
-            if(c)
-                RETURN_IF_HIP_ERROR(hipMemcpy(
-                    hc.get(), c, rocblas_sizeof_datatype(c_type) * size_c, hipMemcpyDeviceToHost));
-
-            rocblas_status status = gemm_dispatch<reference_gemm_ext2_call>(a_type,
-                                                                            b_type,
-                                                                            c_type,
-                                                                            d_type,
-                                                                            compute_type,
-                                                                            m,
-                                                                            n,
-                                                                            k,
-                                                                            alpha,
-                                                                            ha.get(),
-                                                                            row_stride_a,
-                                                                            col_stride_a,
-                                                                            hb.get(),
-                                                                            row_stride_b,
-                                                                            col_stride_b,
-                                                                            beta,
-                                                                            hc.get(),
-                                                                            row_stride_c,
-                                                                            col_stride_c,
-                                                                            hd.get(),
-                                                                            row_stride_d,
-                                                                            col_stride_d);
-
-            if(status == rocblas_status_success)
-                RETURN_IF_HIP_ERROR(hipMemcpy(
-                    d, hd.get(), rocblas_sizeof_datatype(d_type) * size_d, hipMemcpyHostToDevice));
-
-            return status;
+            return gemm_dispatch<host_gemm_ext2_call>(a_type,
+                                                      b_type,
+                                                      c_type,
+                                                      d_type,
+                                                      compute_type,
+                                                      handle,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      a,
+                                                      row_stride_a,
+                                                      col_stride_a,
+                                                      b,
+                                                      row_stride_b,
+                                                      col_stride_b,
+                                                      beta,
+                                                      c,
+                                                      row_stride_c,
+                                                      col_stride_c,
+                                                      d,
+                                                      row_stride_d,
+                                                      col_stride_d);
         }
     }
 } // namespace
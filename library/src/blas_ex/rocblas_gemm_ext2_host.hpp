@@ -0,0 +1,486 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <hip/hip_runtime.h>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*******************************************************************************
+ * Host implementations of gemm_ext2, used when Tensile cannot compute a problem.
+ *
+ * D = alpha * A * B + beta * C, where the (row, col) element of X is at
+ * X[row * row_stride_x + col * col_stride_x]. C is not read when beta is 0.
+ ******************************************************************************/
+
+/*! \brief  Naive triple loop. It is the reference for the blocked implementation, and is used
+ *          when elements of D overlap, since it writes them in a well-defined order. */
+template <typename Ti, typename To, typename Tc>
+rocblas_status reference_gemm_ext2(rocblas_int    M,
+                                   rocblas_int    N,
+                                   rocblas_int    K,
+                                   const Tc*      alpha,
+                                   const Ti*      A,
+                                   rocblas_stride row_stride_a,
+                                   rocblas_stride col_stride_a,
+                                   const Ti*      B,
+                                   rocblas_stride row_stride_b,
+                                   rocblas_stride col_stride_b,
+                                   const Tc*      beta,
+                                   const To*      C,
+                                   rocblas_stride row_stride_c,
+                                   rocblas_stride col_stride_c,
+                                   To*            D,
+                                   rocblas_stride row_stride_d,
+                                   rocblas_stride col_stride_d)
+{
+    for(rocblas_int row = 0; row < M; row++)
+        for(rocblas_int col = 0; col < N; col++)
+        {
+            Tc t{};
+            if(*alpha)
+                for(rocblas_int k = 0; k < K; k++)
+                    t += Tc{A[row * row_stride_a + k * col_stride_a]}
+                         * Tc{B[k * row_stride_b + col * col_stride_b]};
+            D[row * row_stride_d + col * col_stride_d] = static_cast<To>(
+                *beta ? *beta * C[row * row_stride_c + col * col_stride_c] + *alpha * t
+                      : *alpha * t);
+        }
+    return rocblas_status_success;
+}
+
+/*! \brief  Whether the elements of an m x n matrix with the given strides are all distinct */
+inline bool gemm_ext2_host_distinct(rocblas_int    m,
+                                    rocblas_int    n,
+                                    rocblas_stride row_stride,
+                                    rocblas_stride col_stride)
+{
+    if(m <= 1 || n <= 1)
+        return (m <= 1 || row_stride > 0) && (n <= 1 || col_stride > 0);
+    return row_stride > 0 && col_stride > 0
+           && (row_stride >= col_stride * (n - 1) + 1 || col_stride >= row_stride * (m - 1) + 1);
+}
+
+/*! \brief  Run func(i) for i in [0, count) on all of the hardware threads */
+template <typename F>
+void gemm_ext2_host_parallel_for(size_t count, F&& func)
+{
+    size_t threads = std::min<size_t>(count, std::max(1u, std::thread::hardware_concurrency()));
+    if(threads <= 1)
+    {
+        for(size_t i = 0; i < count; ++i)
+            func(i);
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    auto                work = [&] {
+        for(size_t i; (i = next++) < count;)
+            func(i);
+    };
+
+    std::vector<std::thread> pool;
+    for(size_t t = 1; t < threads; ++t)
+        pool.emplace_back(work);
+    work();
+    for(auto& t : pool)
+        t.join();
+}
+
+/*******************************************************************************
+ * Packed, cache-blocked, threaded gemm_ext2.
+ *
+ * The constructor converts A to the compute type and packs it into panels of
+ * MR rows, each stored as K consecutive groups of MR values. operator() then
+ * computes a range of columns of D: it packs those columns of B into panels of
+ * NR columns, and computes D in MC x NC tiles spread across threads. Each tile
+ * accumulates over blocks of KC values of k, in MR x NR microtiles whose
+ * innermost loop runs over the rows of A, which the compiler vectorizes.
+ *
+ * The products of each element of D are summed in increasing order of k, as in
+ * reference_gemm_ext2(), so the results are identical. The elements of D must
+ * be distinct, as tested by gemm_ext2_host_distinct().
+ ******************************************************************************/
+template <typename Ti, typename To, typename Tc>
+class gemm_ext2_host
+{
+    static constexpr rocblas_int MR = 8;
+    static constexpr rocblas_int NR = 4;
+    static constexpr rocblas_int MC = 64;
+    static constexpr rocblas_int NC = 64;
+    static constexpr rocblas_int KC = 256;
+
+    static_assert(MC % MR == 0 && NC % NR == 0, "Tiles must be multiples of microtiles");
+
+    rocblas_int    M, N, K;
+    Tc             alpha, beta;
+    const Ti*      B;
+    rocblas_stride row_stride_b, col_stride_b;
+    const To*      C;
+    rocblas_stride row_stride_c, col_stride_c;
+    To*            D;
+    rocblas_stride row_stride_d, col_stride_d;
+
+    // Whether any products are added, and the packed panels of A
+    bool                  product;
+    rocblas_int           row_panels;
+    std::unique_ptr<Tc[]> A_packed;
+
+    // Add the products of an MR x kc panel of A and a kc x NR panel of B to an MR x NR
+    // microtile of the accumulators t, with leading dimension ldt
+    static void microtile(const Tc* a, const Tc* b, rocblas_int kc, Tc* t, rocblas_int ldt)
+    {
+        Tc acc[NR][MR];
+        for(rocblas_int j = 0; j < NR; ++j)
+            for(rocblas_int i = 0; i < MR; ++i)
+                acc[j][i] = t[i + j * ldt];
+
+        for(rocblas_int p = 0; p < kc; ++p, a += MR, b += NR)
+            for(rocblas_int j = 0; j < NR; ++j)
+                for(rocblas_int i = 0; i < MR; ++i)
+                    acc[j][i] += a[i] * b[j];
+
+        for(rocblas_int j = 0; j < NR; ++j)
+            for(rocblas_int i = 0; i < MR; ++i)
+                t[i + j * ldt] = acc[j][i];
+    }
+
+public:
+    gemm_ext2_host(rocblas_int    M,
+                   rocblas_int    N,
+                   rocblas_int    K,
+                   Tc             alpha,
+                   const Ti*      A,
+                   rocblas_stride row_stride_a,
+                   rocblas_stride col_stride_a,
+                   const Ti*      B,
+                   rocblas_stride row_stride_b,
+                   rocblas_stride col_stride_b,
+                   Tc             beta,
+                   const To*      C,
+                   rocblas_stride row_stride_c,
+                   rocblas_stride col_stride_c,
+                   To*            D,
+                   rocblas_stride row_stride_d,
+                   rocblas_stride col_stride_d)
+        : M(M)
+        , N(N)
+        , K(K)
+        , alpha(alpha)
+        , beta(beta)
+        , B(B)
+        , row_stride_b(row_stride_b)
+        , col_stride_b(col_stride_b)
+        , C(C)
+        , row_stride_c(row_stride_c)
+        , col_stride_c(col_stride_c)
+        , D(D)
+        , row_stride_d(row_stride_d)
+        , col_stride_d(col_stride_d)
+        , product(alpha && K > 0)
+        , row_panels((M + MR - 1) / MR)
+    {
+        if(!product)
+            return;
+
+        A_packed.reset(new Tc[size_t(row_panels) * MR * K]);
+        gemm_ext2_host_parallel_for(row_panels, [&](size_t panel) {
+            Tc* ap = A_packed.get() + panel * MR * K;
+            for(rocblas_int p = 0; p < K; ++p)
+                for(rocblas_int i = 0; i < MR; ++i)
+                {
+                    rocblas_int row = rocblas_int(panel) * MR + i;
+                    *ap++ = row < M ? Tc{A[row * row_stride_a + p * col_stride_a]} : Tc{};
+                }
+        });
+    }
+
+    // Compute columns [col_begin, col_end) of D. Only those columns of B and C are read.
+    void operator()(rocblas_int col_begin, rocblas_int col_end)
+    {
+        rocblas_int cols       = col_end - col_begin;
+        rocblas_int col_panels = (cols + NR - 1) / NR;
+        if(cols <= 0)
+            return;
+
+        std::unique_ptr<Tc[]> B_packed;
+        if(product)
+        {
+            B_packed.reset(new Tc[size_t(col_panels) * NR * K]);
+            gemm_ext2_host_parallel_for(col_panels, [&](size_t panel) {
+                Tc* bp = B_packed.get() + panel * NR * K;
+                for(rocblas_int p = 0; p < K; ++p)
+                    for(rocblas_int j = 0; j < NR; ++j)
+                    {
+                        rocblas_int col = col_begin + rocblas_int(panel) * NR + j;
+                        *bp++ = col < col_end ? Tc{B[p * row_stride_b + col * col_stride_b]}
+                                              : Tc{};
+                    }
+            });
+        }
+
+        rocblas_int row_tiles = (M + MC - 1) / MC;
+        rocblas_int col_tiles = (cols + NC - 1) / NC;
+
+        gemm_ext2_host_parallel_for(size_t(row_tiles) * col_tiles, [&](size_t tile) {
+            rocblas_int i0 = rocblas_int(tile % row_tiles) * MC;
+            rocblas_int j0 = rocblas_int(tile / row_tiles) * NC;
+            rocblas_int i1 = std::min(M, i0 + MC);
+            rocblas_int j1 = std::min(cols, j0 + NC);
+
+            // Accumulators of the tile, in column-major order
+            Tc t[MC * NC] = {};
+
+            if(product)
+                for(rocblas_int p0 = 0; p0 < K; p0 += KC)
+                {
+                    rocblas_int kc = std::min(KC, K - p0);
+                    for(rocblas_int j = j0; j < j1; j += NR)
+                        for(rocblas_int i = i0; i < i1; i += MR)
+                            microtile(A_packed.get() + (size_t(i) * K + size_t(p0) * MR),
+                                      B_packed.get() + (size_t(j) * K + size_t(p0) * NR),
+                                      kc,
+                                      t + (i - i0) + (j - j0) * MC,
+                                      MC);
+                }
+
+            for(rocblas_int j = j0; j < j1; ++j)
+            {
+                rocblas_int col = col_begin + j;
+                for(rocblas_int row = i0; row < i1; ++row)
+                {
+                    const Tc& s = t[(row - i0) + (j - j0) * MC];
+                    D[row * row_stride_d + col * col_stride_d] = static_cast<To>(
+                        beta ? beta * C[row * row_stride_c + col * col_stride_c] + alpha * s
+                             : alpha * s);
+                }
+            }
+        });
+    }
+};
+
+/*! \brief  Copy elements [done, end) of a device array to the host, and advance done to end */
+template <typename T>
+hipError_t gemm_ext2_fetch(T* host, const T* device, size_t& done, size_t end)
+{
+    if(end <= done)
+        return hipSuccess;
+    size_t     bytes  = (end - done) * sizeof(T);
+    hipError_t status = hipMemcpy(host + done, device + done, bytes, hipMemcpyDeviceToHost);
+    done              = end;
+    return status;
+}
+
+/*******************************************************************************
+ * On-host gemm_ext2 of arrays on a device, with the copies between the device
+ * and the host overlapped with the computation.
+ *
+ * D is computed in blocks of columns. While a block is computed, a thread
+ * copies the parts of B, C and D which the next blocks need to the host, and
+ * other threads copy the finished parts of D back to the device. With
+ * nonnegative strides, the elements of later columns are at higher offsets
+ * than the first element of a block, so each block needs a longer prefix of
+ * each array, and finishes a longer prefix of D. D is copied to the host first
+ * so that elements between those of the matrix are left unchanged.
+ *
+ * When the elements of D are not distinct, or the strides are negative, the
+ * naive reference_gemm_ext2() is used on whole copies of the arrays.
+ ******************************************************************************/
+template <typename Ti, typename To, typename Tc>
+hipError_t gemm_ext2_host_device(int            device,
+                                 rocblas_int    M,
+                                 rocblas_int    N,
+                                 rocblas_int    K,
+                                 Tc             alpha,
+                                 const Ti*      a,
+                                 rocblas_stride row_stride_a,
+                                 rocblas_stride col_stride_a,
+                                 const Ti*      b,
+                                 rocblas_stride row_stride_b,
+                                 rocblas_stride col_stride_b,
+                                 Tc             beta,
+                                 const To*      c,
+                                 rocblas_stride row_stride_c,
+                                 rocblas_stride col_stride_c,
+                                 To*            dD,
+                                 rocblas_stride row_stride_d,
+                                 rocblas_stride col_stride_d)
+{
+    const Ti* dA = alpha && K ? a : nullptr;
+    const Ti* dB = alpha && K ? b : nullptr;
+    const To* dC = beta ? c : nullptr;
+
+    // Offset one past the last element of an m x n matrix, or of its column col - 1
+    auto end = [](rocblas_int    m,
+                  rocblas_int    col,
+                  rocblas_stride row_stride,
+                  rocblas_stride col_stride) {
+        return m && col ? size_t(m - 1) * row_stride + size_t(col - 1) * col_stride + 1 : 0;
+    };
+    size_t size_a = dA ? end(M, K, row_stride_a, col_stride_a) : 0;
+    size_t size_b = dB ? end(K, N, row_stride_b, col_stride_b) : 0;
+    size_t size_c = dC ? end(M, N, row_stride_c, col_stride_c) : 0;
+    size_t size_d = end(M, N, row_stride_d, col_stride_d);
+
+    std::unique_ptr<Ti[]> hA{new Ti[size_a]}, hB{new Ti[size_b]};
+    std::unique_ptr<To[]> hC{new To[size_c]}, hD{new To[size_d]};
+    size_t                done_a = 0, done_b = 0, done_c = 0, done_d = 0;
+
+    bool blocked = std::min({row_stride_a,
+                             col_stride_a,
+                             row_stride_b,
+                             col_stride_b,
+                             row_stride_c,
+                             col_stride_c,
+                             row_stride_d,
+                             col_stride_d})
+                       >= 0
+                   && gemm_ext2_host_distinct(M, N, row_stride_d, col_stride_d);
+
+    if(!blocked)
+    {
+        hipError_t status = gemm_ext2_fetch(hA.get(), dA, done_a, size_a);
+        if(status == hipSuccess)
+            status = gemm_ext2_fetch(hB.get(), dB, done_b, size_b);
+        if(status == hipSuccess)
+            status = gemm_ext2_fetch(hC.get(), dC, done_c, size_c);
+        if(status == hipSuccess)
+            status = gemm_ext2_fetch(hD.get(), dD, done_d, size_d);
+        if(status != hipSuccess)
+            return status;
+        reference_gemm_ext2(M,
+                            N,
+                            K,
+                            &alpha,
+                            hA.get(),
+                            row_stride_a,
+                            col_stride_a,
+                            hB.get(),
+                            row_stride_b,
+                            col_stride_b,
+                            &beta,
+                            hC.get(),
+                            row_stride_c,
+                            col_stride_c,
+                            hD.get(),
+                            row_stride_d,
+                            col_stride_d);
+        return hipMemcpy(dD, hD.get(), size_d * sizeof(To), hipMemcpyHostToDevice);
+    }
+
+    // All of A is needed by every block
+    hipError_t status = gemm_ext2_fetch(hA.get(), dA, done_a, size_a);
+    if(status != hipSuccess)
+        return status;
+
+    // Blocks of columns, enough to overlap the copies with the computation
+    constexpr rocblas_int min_block = 64;
+    rocblas_int           block     = std::max(min_block, (N + 7) / 8);
+    rocblas_int           blocks    = (N + block - 1) / block;
+
+    // Offset of the first element of D which block i does not finish
+    auto finished = [&](rocblas_int i) {
+        return i + 1 < blocks ? std::min(size_d, size_t((i + 1) * block) * col_stride_d)
+                              : size_d;
+    };
+
+    // Fetch the data of the blocks in order, in a separate thread
+    std::mutex              mutex;
+    std::condition_variable cond;
+    rocblas_int             fetched      = 0;
+    hipError_t              fetch_status = hipSuccess;
+
+    std::thread fetcher([&] {
+        hipError_t status = hipSetDevice(device);
+        for(rocblas_int i = 0; i < blocks && status == hipSuccess; ++i)
+        {
+            rocblas_int cols  = std::min(N, (i + 1) * block);
+            size_t      end_b = dB ? end(K, cols, row_stride_b, col_stride_b) : 0;
+            size_t      end_c = dC ? end(M, cols, row_stride_c, col_stride_c) : 0;
+            size_t end_d = std::max(end(M, cols, row_stride_d, col_stride_d), finished(i));
+
+            status = gemm_ext2_fetch(hB.get(), dB, done_b, end_b);
+            if(status == hipSuccess)
+                status = gemm_ext2_fetch(hC.get(), dC, done_c, end_c);
+            if(status == hipSuccess)
+                status = gemm_ext2_fetch(hD.get(), dD, done_d, end_d);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            fetch_status = status;
+            if(status == hipSuccess)
+                fetched = i + 1;
+            cond.notify_one();
+        }
+    });
+
+    // Join the fetching thread if the computation throws
+    std::unique_ptr<std::thread, void (*)(std::thread*)> join_fetcher{
+        &fetcher, [](std::thread* t) { t->join(); }};
+
+    gemm_ext2_host<Ti, To, Tc> gemm(M,
+                                    N,
+                                    K,
+                                    alpha,
+                                    hA.get(),
+                                    row_stride_a,
+                                    col_stride_a,
+                                    hB.get(),
+                                    row_stride_b,
+                                    col_stride_b,
+                                    beta,
+                                    hC.get(),
+                                    row_stride_c,
+                                    col_stride_c,
+                                    hD.get(),
+                                    row_stride_d,
+                                    col_stride_d);
+
+    // Compute the blocks as they arrive, and store the finished parts of D
+    std::vector<std::future<hipError_t>> stores;
+    size_t                               stored = 0;
+    for(rocblas_int i = 0; i < blocks; ++i)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cond.wait(lock, [&] { return fetched > i || fetch_status != hipSuccess; });
+            status = fetch_status;
+        }
+        if(status != hipSuccess)
+            break;
+
+        gemm(i * block, std::min(N, (i + 1) * block));
+
+        size_t store_end = finished(i);
+        if(store_end > stored)
+        {
+            stores.push_back(std::async(std::launch::async, [&, stored, store_end] {
+                hipError_t store_status = hipSetDevice(device);
+                if(store_status == hipSuccess)
+                    store_status = hipMemcpy(dD + stored,
+                                             hD.get() + stored,
+                                             (store_end - stored) * sizeof(To),
+                                             hipMemcpyHostToDevice);
+                return store_status;
+            }));
+            stored = store_end;
+        }
+    }
+
+    join_fetcher.reset();
+    for(auto& store : stores)
+    {
+        hipError_t store_status = store.get();
+        if(status == hipSuccess)
+            status = store_status;
+    }
+    return status;
+}
@@ -0,0 +1,498 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+#include <mutex>
+
+/*******************************************************************************
+ * A rocblas_gemm_plan records the arguments of a strided batched gemm_ex call
+ * which do not change between calls, and the contraction plans captured by
+ * runContractionProblem for them. Executing the plan validates the new pointers
+ * and scalars and replays the captured solution with them, without going through
+ * rocblas_gemm_ex. Only when the problem no longer matches (e.g. alpha == 0, or a
+ * different workspace size) is the call made through rocblas_gemm_ex, which
+ * captures the solution again.
+ *
+ * Whether C == D and the category of beta (0, 1, -1 or other) are part of the
+ * Tensile problem, so a contraction plan is captured for each combination of
+ * them. Each captured plan is replaced when it no longer matches, so it is
+ * locked while the plan is executed from several threads.
+ ******************************************************************************/
+struct _rocblas_gemm_plan
+{
+    struct captured_contraction
+    {
+        std::mutex                              mutex;
+        std::unique_ptr<RocblasContractionPlan> plan;
+    };
+
+    static constexpr size_t N_BETA_CATEGORIES = 4;
+
+    rocblas_operation trans_a;
+    rocblas_operation trans_b;
+    rocblas_int       m;
+    rocblas_int       n;
+    rocblas_int       k;
+    rocblas_datatype  a_type;
+    rocblas_int       lda;
+    rocblas_stride    stride_a;
+    rocblas_datatype  b_type;
+    rocblas_int       ldb;
+    rocblas_stride    stride_b;
+    rocblas_datatype  c_type;
+    rocblas_int       ldc;
+    rocblas_stride    stride_c;
+    rocblas_datatype  d_type;
+    rocblas_int       ldd;
+    rocblas_stride    stride_d;
+    rocblas_int       batch_count;
+    rocblas_datatype  compute_type;
+    uint32_t          flags;
+
+    // Indexed by contraction_index()
+    std::array<captured_contraction, 2 * N_BETA_CATEGORIES> contractions;
+
+    bool is_HPA() const
+    {
+        return compute_type == rocblas_datatype_f32_r
+               && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
+    }
+
+    // Whether C and D may be the same matrix in an execution
+    bool allows_in_place() const
+    {
+        return c_type == d_type && ldc == ldd && stride_c == stride_d;
+    }
+
+    // The index of the contraction plan for an execution, with beta on the host
+    size_t contraction_index(const void* beta, bool in_place) const
+    {
+        double category = 0;
+        switch(compute_type)
+        {
+        case rocblas_datatype_f16_r:
+            category = value_category(*(const rocblas_half*)beta);
+            break;
+        case rocblas_datatype_f32_r:
+            category = value_category(*(const float*)beta);
+            break;
+        case rocblas_datatype_f64_r:
+            category = value_category(*(const double*)beta);
+            break;
+        case rocblas_datatype_i32_r:
+            category = value_category(*(const int32_t*)beta);
+            break;
+        case rocblas_datatype_f32_c:
+            category = value_category(*(const rocblas_float_complex*)beta);
+            break;
+        case rocblas_datatype_f64_c:
+            category = value_category(*(const rocblas_double_complex*)beta);
+            break;
+        default:
+            break;
+        }
+        return (in_place ? N_BETA_CATEGORIES : 0) + size_t(category + 1);
+    }
+
+    rocblas_status run(rocblas_handle handle,
+                       const void*    alpha,
+                       const void*    a,
+                       const void*    b,
+                       const void*    beta,
+                       const void*    c,
+                       void*          d)
+    {
+        return rocblas_gemm_ex_template<false>(handle,
+                                               trans_a,
+                                               trans_b,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               a,
+                                               a_type,
+                                               0,
+                                               lda,
+                                               stride_a,
+                                               b,
+                                               b_type,
+                                               0,
+                                               ldb,
+                                               stride_b,
+                                               beta,
+                                               c,
+                                               c_type,
+                                               0,
+                                               ldc,
+                                               stride_c,
+                                               d,
+                                               d_type,
+                                               0,
+                                               ldd,
+                                               stride_d,
+                                               batch_count,
+                                               compute_type,
+                                               flags);
+    }
+};
+
+namespace
+{
+    // Set a scalar of the compute type to 1
+    rocblas_status set_one(rocblas_union_t& x, rocblas_datatype compute_type)
+    {
+        switch(compute_type)
+        {
+        case rocblas_datatype_f16_r:
+            x.h = rocblas_half(1);
+            return rocblas_status_success;
+        case rocblas_datatype_f32_r:
+            x.s = 1;
+            return rocblas_status_success;
+        case rocblas_datatype_f64_r:
+            x.d = 1;
+            return rocblas_status_success;
+        case rocblas_datatype_i32_r:
+            x.i = 1;
+            return rocblas_status_success;
+        case rocblas_datatype_f32_c:
+            x.c = {1, 0};
+            return rocblas_status_success;
+        case rocblas_datatype_f64_c:
+            x.z = {1, 0};
+            return rocblas_status_success;
+        default:
+            return rocblas_status_not_implemented;
+        }
+    }
+
+    rocblas_status rocblas_gemm_plan_create_impl(rocblas_handle     handle,
+                                                 rocblas_gemm_plan* plan,
+                                                 rocblas_operation  trans_a,
+                                                 rocblas_operation  trans_b,
+                                                 rocblas_int        m,
+                                                 rocblas_int        n,
+                                                 rocblas_int        k,
+                                                 rocblas_datatype   a_type,
+                                                 rocblas_int        lda,
+                                                 rocblas_stride     stride_a,
+                                                 rocblas_datatype   b_type,
+                                                 rocblas_int        ldb,
+                                                 rocblas_stride     stride_b,
+                                                 rocblas_datatype   c_type,
+                                                 rocblas_int        ldc,
+                                                 rocblas_stride     stride_c,
+                                                 rocblas_datatype   d_type,
+                                                 rocblas_int        ldd,
+                                                 rocblas_stride     stride_d,
+                                                 rocblas_int        batch_count,
+                                                 rocblas_datatype   compute_type,
+                                                 uint32_t           flags)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(!plan)
+            return rocblas_status_invalid_pointer;
+        *plan = nullptr;
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      "rocblas_gemm_plan_create",
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      rocblas_datatype_string(a_type),
+                      lda,
+                      stride_a,
+                      rocblas_datatype_string(b_type),
+                      ldb,
+                      stride_b,
+                      rocblas_datatype_string(c_type),
+                      ldc,
+                      stride_c,
+                      rocblas_datatype_string(d_type),
+                      ldd,
+                      stride_d,
+                      batch_count,
+                      rocblas_datatype_string(compute_type),
+                      rocblas_gemm_flags(flags));
+
+        // sizes and leading dimensions are checked here; pointers are checked at execution
+        if(m < 0 || n < 0 || k < 0 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(ldc < m || ldd < m || lda < (trans_a == rocblas_operation_none ? m : k)
+           || ldb < (trans_b == rocblas_operation_none ? k : n))
+            return rocblas_status_invalid_size;
+
+        rocblas_union_t one;
+        RETURN_IF_ROCBLAS_ERROR(set_one(one, compute_type));
+
+        std::unique_ptr<_rocblas_gemm_plan> new_plan{new _rocblas_gemm_plan{trans_a,
+                                                                            trans_b,
+                                                                            m,
+                                                                            n,
+                                                                            k,
+                                                                            a_type,
+                                                                            lda,
+                                                                            stride_a,
+                                                                            b_type,
+                                                                            ldb,
+                                                                            stride_b,
+                                                                            c_type,
+                                                                            ldc,
+                                                                            stride_c,
+                                                                            d_type,
+                                                                            ldd,
+                                                                            stride_d,
+                                                                            batch_count,
+                                                                            compute_type,
+                                                                            flags}};
+
+        // Select the solutions for alpha = 1 and beta = 0 or 1, with C == D if it is allowed and
+        // with C != D, without launching any kernels. The placeholder matrices are not accessed.
+        if(m && n && batch_count)
+        {
+            rocblas_union_t zero, placeholder_c, placeholder_d;
+            memset(&zero, 0, sizeof(zero));
+
+            auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+            for(bool in_place : {false, true})
+            {
+                if(in_place && !new_plan->allows_in_place())
+                    continue;
+
+                const void* c = &placeholder_c;
+                void*       d = in_place ? &placeholder_c : &placeholder_d;
+                for(const rocblas_union_t* beta : {&zero, &one})
+                {
+                    size_t index      = new_plan->contraction_index(beta, in_place);
+                    auto   saved_plan = handle->push_contraction_plan(
+                        &new_plan->contractions[index].plan, true);
+
+                    auto capture = [&] {
+                        return new_plan->run(handle, &one, nullptr, nullptr, beta, c, d);
+                    };
+
+                    rocblas_status status;
+                    if(new_plan->is_HPA())
+                    {
+                        // Allocate GSU workspace in handle, so that the workspace size matches
+                        // execution
+                        auto gsu_malloc = handle->gsu_malloc();
+                        status          = capture();
+                    }
+                    else
+                    {
+                        status = capture();
+                    }
+
+                    if(status != rocblas_status_success)
+                        return status;
+                }
+            }
+        }
+
+        *plan = new_plan.release();
+        return rocblas_status_success;
+    }
+
+    rocblas_status rocblas_gemm_plan_execute_impl(rocblas_handle    handle,
+                                                  rocblas_gemm_plan plan,
+                                                  const void*       alpha,
+                                                  const void*       a,
+                                                  const void*       b,
+                                                  const void*       beta,
+                                                  const void*       c,
+                                                  void*             d)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(!plan)
+        {
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+            return rocblas_status_invalid_pointer;
+        }
+
+        if(!plan->is_HPA())
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        // Copy alpha and beta to host if on device
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, plan->k, plan->compute_type));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(!handle->is_device_memory_size_query()
+           && handle->layer_mode & rocblas_layer_mode_log_trace)
+        {
+            rocblas_internal_ostream alphass, betass;
+            if(log_trace_alpha_beta_ex(plan->compute_type, alpha, beta, alphass, betass)
+               == rocblas_status_success)
+            {
+                log_trace(handle,
+                          "rocblas_gemm_plan_execute",
+                          (const void*)plan,
+                          alphass.str(),
+                          a,
+                          b,
+                          betass.str(),
+                          c,
+                          d);
+            }
+        }
+
+        auto validArgs = validateArgs(handle,
+                                      plan->trans_a,
+                                      plan->trans_b,
+                                      plan->m,
+                                      plan->n,
+                                      plan->k,
+                                      alpha,
+                                      a,
+                                      plan->lda,
+                                      b,
+                                      plan->ldb,
+                                      beta,
+                                      c,
+                                      plan->c_type,
+                                      plan->ldc,
+                                      d,
+                                      plan->d_type,
+                                      plan->ldd,
+                                      plan->compute_type,
+                                      plan->batch_count);
+
+        if(validArgs == rocblas_status_continue)
+        {
+            if(c == d && plan->stride_c != plan->stride_d)
+                validArgs = rocblas_status_invalid_size;
+        }
+
+        if(validArgs != rocblas_status_continue)
+        {
+            if(validArgs == rocblas_status_success)
+                RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+            return validArgs;
+        }
+
+        // Replay the captured contraction plan, or capture a new one if it does not match
+        size_t                      index    = plan->contraction_index(beta, c == d);
+        auto&                       captured = plan->contractions[index];
+        std::lock_guard<std::mutex> lock(captured.mutex);
+        auto                        saved_plan = handle->push_contraction_plan(&captured.plan);
+
+        auto execute = [&] {
+            if(captured.plan && !handle->is_device_memory_size_query())
+            {
+                rocblas_status status = captured.plan->replay(handle, alpha, a, b, beta, c, d);
+                if(status != rocblas_status_continue)
+                    return status;
+            }
+            return plan->run(handle, alpha, a, b, beta, c, d);
+        };
+
+        if(plan->is_HPA() && !handle->is_device_memory_size_query())
+        {
+            // Allocate GSU workspace in handle
+            auto gsu_malloc = handle->gsu_malloc();
+            return execute();
+        }
+        else
+        {
+            return execute();
+        }
+    }
+} // namespace
+
+extern "C" rocblas_status rocblas_gemm_plan_create(rocblas_handle     handle,
+                                                   rocblas_gemm_plan* plan,
+                                                   rocblas_operation  trans_a,
+                                                   rocblas_operation  trans_b,
+                                                   rocblas_int        m,
+                                                   rocblas_int        n,
+                                                   rocblas_int        k,
+                                                   rocblas_datatype   a_type,
+                                                   rocblas_int        lda,
+                                                   rocblas_stride     stride_a,
+                                                   rocblas_datatype   b_type,
+                                                   rocblas_int        ldb,
+                                                   rocblas_stride     stride_b,
+                                                   rocblas_datatype   c_type,
+                                                   rocblas_int        ldc,
+                                                   rocblas_stride     stride_c,
+                                                   rocblas_datatype   d_type,
+                                                   rocblas_int        ldd,
+                                                   rocblas_stride     stride_d,
+                                                   rocblas_int        batch_count,
+                                                   rocblas_datatype   compute_type,
+                                                   uint32_t           flags)
+try
+{
+    return rocblas_gemm_plan_create_impl(handle,
+                                         plan,
+                                         trans_a,
+                                         trans_b,
+                                         m,
+                                         n,
+                                         k,
+                                         a_type,
+                                         lda,
+                                         stride_a,
+                                         b_type,
+                                         ldb,
+                                         stride_b,
+                                         c_type,
+                                         ldc,
+                                         stride_c,
+                                         d_type,
+                                         ldd,
+                                         stride_d,
+                                         batch_count,
+                                         compute_type,
+                                         flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_gemm_plan_execute(rocblas_handle    handle,
+                                                    rocblas_gemm_plan plan,
+                                                    const void*       alpha,
+                                                    const void*       a,
+                                                    const void*       b,
+                                                    const void*       beta,
+                                                    const void*       c,
+                                                    void*             d)
+try
+{
+    return rocblas_gemm_plan_execute_impl(handle, plan, alpha, a, b, beta, c, d);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_gemm_plan_destroy(rocblas_gemm_plan plan)
+try
+{
+    delete plan;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
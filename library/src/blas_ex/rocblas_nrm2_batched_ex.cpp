@@ -24,8 +24,16 @@ namespace
             return rocblas_status_invalid_handle;
         }
 
+        rocblas_profile_timing_scope profile_timing_scope(handle);
+
         size_t dev_bytes
             = rocblas_reduction_kernel_workspace_size<NB>(n, batch_count, execution_type);
+        if(handle->reduction_mode == rocblas_reduction_mode_reproducible)
+            dev_bytes
+                = std::max(dev_bytes, rocblas_reduction_repro_workspace_size(n, batch_count));
+        if(handle->nrm2_mode == rocblas_nrm2_mode_scaled)
+            dev_bytes = std::max(
+                dev_bytes, rocblas_nrm2_scaled_workspace_size<NB>(n, batch_count, execution_type));
 
         if(handle->is_device_memory_size_query())
         {
@@ -129,6 +137,10 @@ namespace
         static constexpr rocblas_stride stridex_0 = 0;
         static constexpr rocblas_int    shiftx_0  = 0;
 
+        // Sums are reproducible in rocblas_reduction_mode_reproducible
+        auto algorithms = handle->push_reduction_algorithms();
+        // Results in host pointer mode are deferred in rocblas_result_mode_deferred
+        auto deferred = handle->push_result_deferral();
         return rocblas_nrm2_ex_template<NB, isbatched>(handle,
                                                        n,
                                                        x,
@@ -0,0 +1,241 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "code_object_index.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+
+#ifndef WIN32
+#include <elf.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    // Version of the cached index file format. It must be incremented whenever
+    // the format, or the way kernel names are read, changes.
+    constexpr char CACHE_HEADER[] = "rocblas code object index 1";
+
+#ifndef WIN32
+    // Symbol type of kernels in code object v2
+    constexpr unsigned char STT_AMDGPU_HSA_KERNEL = 10;
+
+    // Read the kernel names from the symbol tables of a mapped ELF file
+    bool read_elf_kernels(const char* data, size_t size, std::vector<std::string>& kernels)
+    {
+        if(size < sizeof(Elf64_Ehdr) || memcmp(data, ELFMAG, SELFMAG)
+           || data[EI_CLASS] != ELFCLASS64)
+            return false;
+
+        auto ehdr = reinterpret_cast<const Elf64_Ehdr*>(data);
+        if(!ehdr->e_shoff || ehdr->e_shentsize != sizeof(Elf64_Shdr)
+           || ehdr->e_shoff + size_t(ehdr->e_shnum) * sizeof(Elf64_Shdr) > size)
+            return false;
+
+        auto shdr = reinterpret_cast<const Elf64_Shdr*>(data + ehdr->e_shoff);
+        for(size_t i = 0; i < ehdr->e_shnum; ++i)
+        {
+            if(shdr[i].sh_type != SHT_SYMTAB && shdr[i].sh_type != SHT_DYNSYM)
+                continue;
+
+            const auto& strtab = shdr[shdr[i].sh_link < ehdr->e_shnum ? shdr[i].sh_link : 0];
+            if(shdr[i].sh_offset + shdr[i].sh_size > size
+               || strtab.sh_offset + strtab.sh_size > size || !shdr[i].sh_entsize)
+                return false;
+
+            auto   syms     = reinterpret_cast<const Elf64_Sym*>(data + shdr[i].sh_offset);
+            size_t num_syms = shdr[i].sh_size / shdr[i].sh_entsize;
+            for(size_t s = 0; s < num_syms; ++s)
+            {
+                auto type = ELF64_ST_TYPE(syms[s].st_info);
+                auto bind = ELF64_ST_BIND(syms[s].st_info);
+                if(bind == STB_LOCAL || syms[s].st_name >= strtab.sh_size)
+                    continue;
+
+                const char* name = data + strtab.sh_offset + syms[s].st_name;
+                size_t      len  = strnlen(name, strtab.sh_size - syms[s].st_name);
+
+                // Kernels are functions, or are identified by their kernel descriptors
+                if(type == STT_FUNC || type == STT_AMDGPU_HSA_KERNEL)
+                    kernels.emplace_back(name, len);
+                else if(type == STT_OBJECT && len > 3 && !strncmp(name + len - 3, ".kd", 3))
+                    kernels.emplace_back(name, len - 3);
+            }
+        }
+        return true;
+    }
+#endif
+} // namespace
+
+bool rocblas_read_code_object_kernels(const std::string& path, std::vector<std::string>& kernels)
+{
+#ifdef WIN32
+    return false;
+#else
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(fd == -1)
+        return false;
+
+    bool        success = false;
+    struct stat st;
+    if(!fstat(fd, &st) && st.st_size > 0)
+    {
+        // Only the pages holding the ELF headers and symbol tables are read
+        void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(data != MAP_FAILED)
+        {
+            success = read_elf_kernels(static_cast<const char*>(data), st.st_size, kernels);
+            munmap(data, st.st_size);
+        }
+    }
+    close(fd);
+    return success;
+#endif
+}
+
+std::string rocblas_default_code_object_index_path(const std::string& dir,
+                                                   const std::string& processor)
+{
+#ifdef WIN32
+    return {};
+#else
+    std::string cache_dir;
+    if(const char* xdg = getenv("XDG_CACHE_HOME"))
+        cache_dir = xdg;
+    else if(const char* home = getenv("HOME"))
+        cache_dir = std::string(home) + "/.cache";
+    else
+        return {};
+
+    cache_dir += "/rocblas";
+    mkdir(cache_dir.c_str(), 0755);
+
+    // Libraries installed in different directories have different indices
+    std::ostringstream path;
+    path << cache_dir << "/code_object_index_" << processor << "_" << std::hex
+         << std::hash<std::string>{}(dir) << ".txt";
+    return path.str();
+#endif
+}
+
+rocblas_code_object_index::rocblas_code_object_index(std::vector<std::string> files,
+                                                     const std::string&       cache_path)
+{
+    m_files.reserve(files.size());
+    for(auto& path : files)
+    {
+        file_entry entry;
+        entry.path = std::move(path);
+#ifndef WIN32
+        struct stat st;
+        if(!stat(entry.path.c_str(), &st))
+        {
+            entry.size  = st.st_size;
+            entry.mtime = st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+        }
+#endif
+        m_files.push_back(std::move(entry));
+    }
+
+    // Files whose size and modification time match the cache do not need to be read
+    bool up_to_date = !cache_path.empty() && read_cache(cache_path);
+    for(auto& entry : m_files)
+    {
+        if(!entry.cached)
+        {
+            entry.indexed = rocblas_read_code_object_kernels(entry.path, entry.kernels);
+            up_to_date    = false;
+        }
+    }
+
+    if(!up_to_date && !cache_path.empty())
+        write_cache(cache_path);
+
+    for(size_t file = 0; file < m_files.size(); ++file)
+        for(const auto& kernel : m_files[file].kernels)
+            m_kernels.emplace(kernel, file);
+}
+
+// Read the cached index, filling in the entries of unchanged files.
+// Returns whether the cached index matches the files exactly.
+bool rocblas_code_object_index::read_cache(const std::string& cache_path)
+{
+    std::ifstream cache(cache_path);
+    std::string   line;
+    if(!std::getline(cache, line) || line != CACHE_HEADER)
+        return false;
+
+    std::unordered_map<std::string, file_entry*> entries;
+    for(auto& entry : m_files)
+        entries[entry.path] = &entry;
+
+    size_t cached_files = 0, matched_files = 0;
+    while(std::getline(cache, line))
+    {
+        // Each file is described by "size mtime indexed num_kernels path", followed by
+        // one kernel name per line
+        std::istringstream header(line);
+        size_t             size, num_kernels;
+        long long          mtime;
+        bool               indexed;
+        std::string        path;
+        if(!(header >> size >> mtime >> indexed >> num_kernels) || header.get() != ' '
+           || !std::getline(header, path))
+            return false;
+
+        std::vector<std::string> kernels;
+        for(size_t i = 0; i < num_kernels; ++i)
+        {
+            if(!std::getline(cache, line))
+                return false;
+            kernels.push_back(std::move(line));
+        }
+
+        ++cached_files;
+        auto it = entries.find(path);
+        if(it != entries.end() && it->second->size == size && it->second->mtime == mtime)
+        {
+            it->second->cached  = true;
+            it->second->indexed = indexed;
+            it->second->kernels = std::move(kernels);
+            ++matched_files;
+        }
+    }
+
+    return cached_files == m_files.size() && matched_files == m_files.size();
+}
+
+// Write the index to a temporary file, and atomically rename it to the cache file,
+// so that concurrent processes never read a partially written index
+void rocblas_code_object_index::write_cache(const std::string& cache_path) const
+{
+#ifndef WIN32
+    std::string tmp_path = cache_path + ".tmp" + std::to_string(getpid());
+    {
+        std::ofstream cache(tmp_path);
+        cache << CACHE_HEADER << '\n';
+        for(const auto& entry : m_files)
+        {
+            cache << entry.size << ' ' << entry.mtime << ' ' << entry.indexed << ' '
+                  << entry.kernels.size() << ' ' << entry.path << '\n';
+            for(const auto& kernel : entry.kernels)
+                cache << kernel << '\n';
+        }
+        if(!cache.flush())
+        {
+            cache.close();
+            unlink(tmp_path.c_str());
+            return;
+        }
+    }
+    if(rename(tmp_path.c_str(), cache_path.c_str()))
+        unlink(tmp_path.c_str());
+#endif
+}
@@ -2,8 +2,16 @@
  * Copyright 2016-2022 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 #include "handle.hpp"
+#include "binary_logging.hpp"
+#include "logging.hpp"
+#include "tuple_helper.hpp"
+#include <algorithm>
+#include <atomic>
 #include <cstdarg>
+#include <cstring>
 #include <limits>
+#include <mutex>
+#include <unordered_map>
 #ifdef WIN32
 #include <windows.h>
 #endif
@@ -13,11 +21,26 @@
 // see TensileHost.cpp for normal rocblas_initialize definition
 // it isn't compiled if not BUILD_WITH_TENSILE so defining here
 extern "C" void rocblas_initialize() {}
+
+extern "C" rocblas_status rocblas_get_tensile_load_stats(rocblas_tensile_load_stats* stats)
+{
+    return rocblas_status_not_implemented;
+}
+
+void rocblas_internal_flush_persistent_solution_cache() {}
 #endif
 
+// The number of live handles, so that state shared by all of them can be written out when the
+// last one is destroyed, while the HIP runtime is still alive
+static std::atomic<size_t> s_live_handles{0};
+
 // forcing early cleanup
 extern "C" void rocblas_shutdown()
 {
+    rocblas_internal_flush_persistent_solution_cache();
+    if(auto* log = rocblas_binary_log::open())
+        log->flush();
+    rocblas_internal_ostream::flush_workers();
     rocblas_internal_ostream::clear_workers();
 }
 
@@ -62,6 +85,47 @@ static inline int getActiveArch(int deviceId)
     return deviceProperties.gcnArch;
 }
 
+/*******************************************************************************
+ * Get the pool which the device memory of a handle is acquired from.
+ * ROCBLAS_WORKSPACE_POLICY selects what the pool does with the blocks returned
+ * to it: "free", "grow" (the default) or "high_water". If
+ * ROCBLAS_WORKSPACE_SHARED is set to a nonzero value, the handles of a device
+ * share one pool for as long as any of them exists.
+ ******************************************************************************/
+static std::shared_ptr<rocblas_workspace_pool> get_workspace_pool(int device)
+{
+    auto policy = rocblas_workspace_policy::grow;
+    if(const char* env = read_env("ROCBLAS_WORKSPACE_POLICY"))
+    {
+        if(!strcmp(env, "free"))
+            policy = rocblas_workspace_policy::free;
+        else if(!strcmp(env, "high_water"))
+            policy = rocblas_workspace_policy::high_water;
+    }
+
+    auto make_pool = [=] {
+        return std::make_shared<rocblas_workspace_pool>(
+            std::make_unique<rocblas_hip_workspace_backend>(device), policy);
+    };
+
+    const char* env = read_env("ROCBLAS_WORKSPACE_SHARED");
+    if(!env || !strtol(env, nullptr, 0))
+        return make_pool();
+
+    static std::mutex                                                     mutex;
+    static std::unordered_map<int, std::weak_ptr<rocblas_workspace_pool>> pools;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto pool = pools[device].lock();
+    if(!pool)
+    {
+        pool          = make_pool();
+        pools[device] = pool;
+    }
+    return pool;
+}
+
 /*******************************************************************************
  * constructor
  ******************************************************************************/
@@ -98,14 +162,20 @@ _rocblas_handle::_rocblas_handle()
     }
 
     // Allocate device memory
-    if(device_memory_size)
-        THROW_IF_HIP_ERROR((hipMalloc)(&device_memory, device_memory_size));
+    device_workspace = rocblas_workspace(get_workspace_pool(device));
+    if(device_memory_size && !acquire_device_memory(device_memory_size))
+        throw rocblas_status_memory_error;
+
+    // Workspace statistics which are written at destruction are recorded from the start
+    workspace_stats_enabled = read_env("ROCBLAS_WORKSPACE_STATS_PATH") != nullptr;
 
     // Initialize logging
     init_logging();
 
     // Initialize numerical checking
     init_check_numerics();
+
+    ++s_live_handles;
 }
 
 /*******************************************************************************
@@ -121,18 +191,67 @@ _rocblas_handle::~_rocblas_handle()
         rocblas_abort();
     }
 
-    // Free device memory unless it's user-owned
-    if(device_memory_owner != rocblas_device_memory_ownership::user_owned)
+    // Write the workspace statistics if requested
+    try
     {
-        auto hipStatus = (hipFree)(device_memory);
-        if(hipStatus != hipSuccess)
-        {
-            rocblas_cerr << "rocBLAS error during hipFree in handle destructor: "
-                         << rocblas_status_to_string(get_rocblas_status_for_hip_status(hipStatus))
-                         << std::endl;
-            rocblas_abort();
-        };
+        dump_workspace_stats();
     }
+    catch(...)
+    {
+    }
+
+    // Record the times of the profiled calls of this handle
+    if(profile_timing)
+        profile_timing_finish();
+
+    // Wait for the deferred results of this handle and free their buffers
+    result_ring_finish();
+
+    // Write the binary log records buffered by this thread
+    if(layer_mode & rocblas_layer_mode_log_binary)
+        if(auto* log = rocblas_binary_log::open())
+            log->flush();
+
+    // Wait for the log messages of this handle to be written
+    for(auto* os : {log_trace_os.get(), log_bench_os.get(), log_profile_os.get()})
+        if(os)
+            os->sync();
+
+    // Return device memory to the pool unless it's user-owned
+    if(device_memory_owner != rocblas_device_memory_ownership::user_owned)
+        release_device_memory();
+
+    // Write the solutions selected by all of the handles when the last one is destroyed
+    if(!--s_live_handles)
+        rocblas_internal_flush_persistent_solution_cache();
+}
+
+/*******************************************************************************
+ * helpers for acquiring and releasing device memory
+ ******************************************************************************/
+// The whole block is used if device memory is rocBLAS-managed, and only the
+// requested size otherwise
+bool _rocblas_handle::acquire_device_memory(size_t size)
+{
+    if(!device_workspace.acquire(size, device_memory_in_use != 0, stream) && device_memory_in_use)
+        return false;
+
+    const auto& block  = device_workspace.current();
+    device_memory      = block.ptr;
+    device_memory_size = !device_memory ? 0
+                         : device_memory_owner == rocblas_device_memory_ownership::rocblas_managed
+                             ? block.size
+                             : size;
+    return device_memory != nullptr;
+}
+
+void _rocblas_handle::release_device_memory()
+{
+    // The blocks may still be used by the kernels queued on the stream, so they are only
+    // reused by other streams after them
+    device_workspace.release(stream);
+    device_memory      = nullptr;
+    device_memory_size = 0;
 }
 
 /*******************************************************************************
@@ -144,26 +263,11 @@ bool _rocblas_handle::device_allocator(size_t size)
     bool success = size <= device_memory_size - device_memory_in_use;
     if(!success && device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
     {
-        if(device_memory_in_use)
-        {
-            rocblas_cerr << "rocBLAS internal error: Cannot reallocate device memory while it is "
-                            "already in use.";
-            rocblas_abort();
-        }
-
-        // Temporarily change the thread's default device ID to the handle's device ID
-        // cppcheck-suppress unreadVariable
-        auto saved_device_id = push_device_id();
-
-        device_memory_size = 0;
-        if(!device_memory || (hipFree)(device_memory) == hipSuccess)
-        {
-            success = (hipMalloc)(&device_memory, size) == hipSuccess;
-            if(success)
-                device_memory_size = size;
-            else
-                device_memory = nullptr;
-        }
+        // The new block has room for size bytes past the part in use, which stays in the
+        // current block until it is no longer in use. If no part is in use, the current
+        // block is returned to the pool, which may keep it for other handles.
+        success = acquire_device_memory(device_memory_in_use + size);
+        ++device_memory_reallocations;
     }
     return success;
 }
@@ -239,9 +343,9 @@ static rocblas_status free_existing_device_memory(rocblas_handle handle)
     if(handle->device_memory_in_use)
         return rocblas_status_internal_error;
 
-    // Free existing device memory in handle, unless owned by user
+    // Return existing device memory in handle to the pool, unless owned by user
     if(handle->device_memory_owner != rocblas_device_memory_ownership::user_owned)
-        RETURN_IF_HIP_ERROR((hipFree)(handle->device_memory));
+        handle->release_device_memory();
 
     // Clear the memory size and address, and set the memory to be rocBLAS-managed
     handle->device_memory_size  = 0;
@@ -273,24 +377,15 @@ try
     if(!size)
         return rocblas_status_success;
 
-    // Allocate size rounded up to MIN_CHUNK_SIZE
-    size           = roundup_device_memory_size(size);
-    auto hipStatus = (hipMalloc)(&handle->device_memory, size);
-
-    if(hipStatus != hipSuccess)
-    {
-        // If allocation fails, nullify device memory address and return error
-        // Leave the memory under rocBLAS management for future calls
-        handle->device_memory = nullptr;
-        return get_rocblas_status_for_hip_status(hipStatus);
-    }
-    else
+    // Acquire size rounded up to MIN_CHUNK_SIZE, marking it under user-management
+    handle->device_memory_owner = rocblas_device_memory_ownership::user_managed;
+    if(!handle->acquire_device_memory(roundup_device_memory_size(size)))
     {
-        // If allocation succeeds, set size, mark it under user-management, and return success
-        handle->device_memory_size  = size;
-        handle->device_memory_owner = rocblas_device_memory_ownership::user_managed;
-        return rocblas_status_success;
+        // If allocation fails, leave the memory under rocBLAS management for future calls
+        handle->device_memory_owner = rocblas_device_memory_ownership::rocblas_managed;
+        return rocblas_status_memory_error;
     }
+    return rocblas_status_success;
 }
 catch(...)
 {
@@ -352,6 +447,118 @@ extern "C" bool rocblas_is_user_managing_device_memory(rocblas_handle handle)
     return handle && handle->device_memory_owner == rocblas_device_memory_ownership::user_managed;
 }
 
+/*******************************************************************************
+ * Workspace statistics
+ ******************************************************************************/
+void _rocblas_handle::record_workspace_request(const char* function,
+                                               size_t      size,
+                                               size_t      in_use,
+                                               size_t      reallocations,
+                                               bool        success)
+{
+    auto& entry = workspace_stats[{function, rocblas_workspace_pool::size_class(size)}];
+    entry.requests += 1;
+    entry.peak_bytes = std::max(entry.peak_bytes, in_use + size);
+    entry.reallocations += reallocations;
+    entry.failures += !success;
+}
+
+std::vector<rocblas_workspace_stats> _rocblas_handle::get_workspace_stats() const
+{
+    // Merge the entries of functions with the same name
+    std::map<std::pair<std::string, size_t>, rocblas_workspace_stats> merged;
+    for(const auto& p : workspace_stats)
+    {
+        auto& stats = merged[{p.first.first, p.first.second}];
+        stats.function   = p.first.first;
+        stats.size_class = p.first.second;
+        stats.requests += p.second.requests;
+        stats.peak_bytes = std::max(stats.peak_bytes, p.second.peak_bytes);
+        stats.reallocations += p.second.reallocations;
+        stats.failures += p.second.failures;
+    }
+
+    std::vector<rocblas_workspace_stats> result;
+    result.reserve(merged.size());
+    for(const auto& p : merged)
+        result.push_back(p.second);
+    return result;
+}
+
+void _rocblas_handle::dump_workspace_stats() const
+{
+    const char* path = read_env("ROCBLAS_WORKSPACE_STATS_PATH");
+    if(!path || workspace_stats.empty())
+        return;
+
+    // The file is opened once, and shared by the handles of the process
+    static rocblas_internal_ostream stats_os(path);
+    auto                            os = stats_os.dup();
+
+    for(const auto& stats : get_workspace_stats())
+    {
+        os << "- ";
+        tuple_helper::print_tuple_pairs(os,
+                                        std::make_tuple("function",
+                                                        stats.function,
+                                                        "device",
+                                                        device,
+                                                        "device_memory_size",
+                                                        device_memory_size,
+                                                        "size_class",
+                                                        stats.size_class,
+                                                        "requests",
+                                                        stats.requests,
+                                                        "peak_bytes",
+                                                        stats.peak_bytes,
+                                                        "reallocations",
+                                                        stats.reallocations,
+                                                        "failures",
+                                                        stats.failures));
+    }
+    os.flush();
+}
+
+/*******************************************************************************
+ * Get the workspace statistics
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_workspace_stats(rocblas_handle           handle,
+                                                      rocblas_workspace_stats* stats,
+                                                      size_t*                  count)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!count || (!stats && *count))
+        return rocblas_status_invalid_pointer;
+
+    auto result = handle->get_workspace_stats();
+    std::copy_n(result.begin(), std::min(*count, result.size()), stats);
+    *count = result.size();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Reset the workspace statistics
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_reset_workspace_stats(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->workspace_stats.clear();
+    handle->workspace_stats_enabled = true;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /* \brief
    \details
    Returns true if the handle is in device memory size query mode.
@@ -580,7 +787,193 @@ void _rocblas_handle::init_logging()
         // open log_profile file
         if(layer_mode & rocblas_layer_mode_log_profile)
             log_profile_os = open_log_stream("ROCBLAS_LOG_PROFILE_PATH");
+
+        // open the process-wide binary log, which records the arguments passed to log_profile.
+        // The profile layer is turned on so that log_profile is called, but without a
+        // log_profile stream, log_profile only writes binary records.
+        if(layer_mode & rocblas_layer_mode_log_binary)
+        {
+            if(rocblas_binary_log::open(read_env("ROCBLAS_LOG_BINARY_PATH")))
+                layer_mode = static_cast<rocblas_layer_mode>(layer_mode
+                                                             | rocblas_layer_mode_log_profile);
+            else
+            {
+                rocblas_cerr << "rocBLAS warning: binary logging requires ROCBLAS_LOG_BINARY_PATH"
+                             << std::endl;
+                layer_mode = static_cast<rocblas_layer_mode>(layer_mode
+                                                             & ~rocblas_layer_mode_log_binary);
+            }
+        }
+
+        // time profiled calls on the device if requested
+        if(log_profile_os)
+        {
+            const char* env = read_env("ROCBLAS_LOG_PROFILE_TIMING");
+            profile_timing  = env && strtol(env, nullptr, 0);
+        }
+    }
+}
+
+/*******************************************************************************
+ * Device timing of profiled calls
+ *
+ * A call is timed from an event recorded when it is profiled, before its
+ * kernels are launched, to an event recorded by the rocblas_profile_timing_scope
+ * of the rocBLAS function when it returns, after its kernels are launched. The
+ * events are read without blocking when later calls are profiled, and waited
+ * for at handle destruction.
+ ******************************************************************************/
+void _rocblas_handle::profile_timing_begin(
+    const std::shared_ptr<argument_profile_timing>& timing)
+{
+    profile_timing_end();
+    profile_timing_resolve(false);
+
+    // Start the new call with a pair of unused events
+    while(profile_timing_events.size() < 2)
+    {
+        hipEvent_t event;
+        if(hipEventCreate(&event) != hipSuccess)
+            return;
+        profile_timing_events.push_back(event);
+    }
+
+    hipEvent_t start = profile_timing_events.back();
+    if(hipEventRecord(start, stream) != hipSuccess)
+        return;
+    profile_timing_events.pop_back();
+
+    profile_timing_open = {start, profile_timing_events.back(), timing};
+    profile_timing_events.pop_back();
+    profile_timing_stream = stream;
+}
+
+// End the open call on the stream it started on
+void _rocblas_handle::profile_timing_end()
+{
+    if(profile_timing_open.timing)
+    {
+        if(hipEventRecord(profile_timing_open.stop, profile_timing_stream) == hipSuccess)
+            profile_timing_pending.push_back(profile_timing_open);
+        else
+        {
+            profile_timing_events.push_back(profile_timing_open.start);
+            profile_timing_events.push_back(profile_timing_open.stop);
+        }
+        profile_timing_open = {};
+    }
+}
+
+void _rocblas_handle::profile_timing_resolve(bool wait)
+{
+    // Calls are read in the order they were profiled, stopping at the first unfinished one
+    while(!profile_timing_pending.empty())
+    {
+        auto&      call   = profile_timing_pending.front();
+        hipError_t status = wait ? hipEventSynchronize(call.stop) : hipEventQuery(call.stop);
+        if(status == hipErrorNotReady)
+            break;
+
+        float ms;
+        if(status == hipSuccess && hipEventElapsedTime(&ms, call.start, call.stop) == hipSuccess)
+            call.timing->record(ms * 1000.0);
+
+        profile_timing_events.push_back(call.start);
+        profile_timing_events.push_back(call.stop);
+        profile_timing_pending.pop_front();
+    }
+}
+
+void _rocblas_handle::profile_timing_finish()
+{
+    profile_timing_end();
+    profile_timing_resolve(true);
+
+    for(auto event : profile_timing_events)
+        (void)hipEventDestroy(event);
+    profile_timing_events.clear();
+}
+
+/*******************************************************************************
+ * Deferred results of reductions
+ *
+ * In rocblas_result_mode_deferred, the results of reductions in host pointer mode
+ * are copied asynchronously into a ring of pinned host buffers, followed by an
+ * event, instead of being copied to the result pointer with a blocking copy. A
+ * token numbers each deferred result, and the result stays in the slot of its
+ * token until RESULT_RING_SIZE more results have been deferred. Reusing a slot
+ * waits for its previous copy, which only blocks if that many copies are still
+ * in flight.
+ ******************************************************************************/
+rocblas_status _rocblas_handle::defer_result(const void* results, size_t size)
+{
+    if(result_ring.empty())
+        result_ring.resize(RESULT_RING_SIZE);
+
+    rocblas_result_token token = next_result_token;
+    result_slot&         slot  = result_ring[token % RESULT_RING_SIZE];
+
+    // The previous result of the slot is lost when the slot is reused
+    slot.token = 0;
+    if(slot.event)
+    {
+        RETURN_IF_HIP_ERROR(hipEventSynchronize(slot.event));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&slot.event, hipEventDisableTiming));
+    }
+
+    // Buffers are at least 256 bytes, so that most of them are allocated only once
+    if(size > slot.capacity)
+    {
+        if(slot.host)
+            RETURN_IF_HIP_ERROR(hipHostFree(slot.host));
+        slot.host     = nullptr;
+        slot.capacity = 0;
+
+        size_t capacity = std::max(size, size_t(256));
+        RETURN_IF_HIP_ERROR(hipHostMalloc(&slot.host, capacity, hipHostMallocDefault));
+        slot.capacity = capacity;
+    }
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(slot.host, results, size, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipEventRecord(slot.event, stream));
+
+    slot.token        = token;
+    slot.size         = size;
+    next_result_token = token + 1;
+    last_result_token = token;
+    return rocblas_status_success;
+}
+
+rocblas_status _rocblas_handle::get_result(rocblas_result_token token, void* result)
+{
+    if(!token || result_ring.empty())
+        return rocblas_status_invalid_value;
+
+    const result_slot& slot = result_ring[token % RESULT_RING_SIZE];
+    if(slot.token != token)
+        return rocblas_status_invalid_value;
+
+    RETURN_IF_HIP_ERROR(hipEventSynchronize(slot.event));
+    memcpy(result, slot.host, slot.size);
+    return rocblas_status_success;
+}
+
+void _rocblas_handle::result_ring_finish()
+{
+    for(auto& slot : result_ring)
+    {
+        if(slot.event)
+        {
+            (void)hipEventSynchronize(slot.event);
+            (void)hipEventDestroy(slot.event);
+        }
+        if(slot.host)
+            (void)hipHostFree(slot.host);
     }
+    result_ring.clear();
 }
 
 /*******************************************************************************
@@ -596,6 +989,30 @@ extern "C" rocblas_status rocblas_set_solution_fitness_query(rocblas_handle hand
     return rocblas_status_success;
 }
 
+/*******************************************************************************
+ * Tensile solution cache statistics
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_get_solution_cache_stats(rocblas_handle handle, size_t* hits, size_t* misses)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!hits || !misses)
+        return rocblas_status_invalid_pointer;
+    *hits   = handle->solution_cache_hits;
+    *misses = handle->solution_cache_misses;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocblas_reset_solution_cache_stats(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->solution_cache_hits   = 0;
+    handle->solution_cache_misses = 0;
+    return rocblas_status_success;
+}
+
 /*******************************************************************************
  * Choose performance metric used to select solution
  ******************************************************************************/
@@ -0,0 +1,380 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_ostream.hpp"
+#include "tuple_helper.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/*******************************************************************************
+ * rocblas_binary_log writes the profile arguments of rocBLAS calls to a file
+ * as fixed-layout binary records, which are much cheaper to produce than the
+ * text of the trace, bench and profile logs. The files are converted into
+ * rocblas-bench commands and profile YAML by
+ * scripts/utilities/rocblas-decode-binary-log.py.
+ *
+ * The file starts with the 8-byte magic "RBBINLOG" and a 32-bit version. It is
+ * followed by records, in host byte order, which start with their size in a
+ * 32-bit word which does not include itself, and their kind in a byte:
+ *
+ * - A definition record assigns a 32-bit ID to a function and its argument
+ *   list: ID, 16-bit number of arguments, function name, and for each
+ *   argument, its name and a type code. The type code of an enumeration is
+ *   followed by the 32-bit ID of its enumeration type. A definition record is
+ *   written before the first call record which uses its ID.
+ *
+ * - An enumerator record holds the name of a value of an enumeration type, as
+ *   it is formatted in the profile log: enumeration type ID, 32-bit value and
+ *   name. It is written before the first call record which uses the value.
+ *
+ * - A call record holds the arguments of a call: ID, 64-bit timestamp in
+ *   nanoseconds since the epoch, and the argument values.
+ *
+ * Strings are a 16-bit length followed by their characters. The type codes
+ * are 'i' and 'l' for 32-bit and 64-bit signed integers, 'u' and 'U' for
+ * 32-bit and 64-bit unsigned integers, 'f' and 'd' for float and double, 'c'
+ * for characters, 'b' for bools, 's' for strings, 'e' for enumerations, whose
+ * values are 32-bit integers, and 'y' for strings holding other values already
+ * formatted as YAML.
+ *
+ * Definition and enumerator records are written as soon as they are created.
+ * Each thread buffers its call records, and writes them when the buffer holds
+ * FLUSH_BYTES bytes, when FLUSH_NS nanoseconds have passed since it last wrote
+ * them, when it destroys a handle, and when it exits.
+ ******************************************************************************/
+class ROCBLAS_INTERNAL_EXPORT rocblas_binary_log
+{
+public:
+    static constexpr char     MAGIC[8] = {'R', 'B', 'B', 'I', 'N', 'L', 'O', 'G'};
+    static constexpr uint32_t VERSION  = 2;
+
+    static constexpr size_t   FLUSH_BYTES = 64 * 1024;
+    static constexpr uint64_t FLUSH_NS    = 100'000'000;
+
+    enum record_kind : uint8_t
+    {
+        definition = 1,
+        call       = 2,
+        enumerator = 3,
+    };
+
+    // Open the process-wide binary log on the first call, writing to path.
+    // Later calls return the same log. Returns nullptr if no log is open.
+    static rocblas_binary_log* open(const char* path = nullptr);
+
+    // Write the call records buffered by the calling thread
+    void flush();
+
+    // Write a call record for a tuple (name1, value1, name2, value2, ...), whose
+    // first value is the function name
+    template <typename TUP>
+    void operator()(const TUP& tup)
+    {
+        static_assert(std::tuple_size<TUP>{} % 2 == 0, "Tuple size must be even");
+
+        // The function name and argument names are string literals, so their addresses
+        // identify the definition, together with the tuple type
+        signature<std::tuple_size<TUP>{} / 2 + 2> sig;
+        size_t                                    n = 0;
+        sig[n++]                                    = &type_tag<TUP>;
+        tuple_helper::apply_pairs(
+            [&](const char* name, const auto& value) {
+                sig[n++] = name;
+                if(n == 2)
+                    sig[n++] = function_name(value);
+            },
+            tup);
+
+        uint32_t id = find_or_define(sig, tup);
+
+        uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::system_clock::now().time_since_epoch())
+                           .count();
+
+        // Build the record in place in the calling thread's buffer
+        thread_buffer& buf   = buffer();
+        size_t         start = begin_record(buf.data, call);
+        append(buf.data, id);
+        append(buf.data, now);
+
+        bool first = true;
+        tuple_helper::apply_pairs(
+            [&](const char*, const auto& value) {
+                if(!first)
+                    append_value(buf.data, value);
+                first = false;
+            },
+            tup);
+
+        end_record(buf.data, start);
+
+        if(buf.data.size() >= FLUSH_BYTES || now - buf.last_flush >= FLUSH_NS)
+        {
+            buf.flush();
+            buf.last_flush = now;
+        }
+    }
+
+private:
+    explicit rocblas_binary_log(const char* path);
+
+    // Call records buffered by a thread, which are written when the thread exits
+    struct thread_buffer
+    {
+        rocblas_internal_ostream os;
+        std::string              data;
+        uint64_t                 last_flush = 0;
+
+        explicit thread_buffer(rocblas_internal_ostream os)
+            : os(std::move(os))
+        {
+        }
+
+        void flush()
+        {
+            if(data.size())
+            {
+                os.write(data.data(), data.size());
+                os.flush();
+                data.clear();
+            }
+        }
+
+        ~thread_buffer()
+        {
+            flush();
+        }
+    };
+
+    // The calling thread's buffer, with its own duplicate of the stream
+    thread_buffer& buffer()
+    {
+        thread_local thread_buffer t_buffer(m_os.dup());
+        return t_buffer;
+    }
+
+    template <typename>
+    static constexpr char type_tag = 0;
+
+    // A signature is the address of the tuple type's tag, followed by the addresses of the
+    // names and of the function name
+    template <size_t N>
+    using signature = std::array<const void*, N>;
+
+    template <typename T>
+    static const void* function_name(const T&)
+    {
+        return nullptr;
+    }
+
+    static const void* function_name(const char* s)
+    {
+        return s;
+    }
+
+    /*************************************************************************
+     * Encoding of values                                                    *
+     *************************************************************************/
+    template <typename T>
+    static void append(std::string& rec, T x)
+    {
+        rec.append(reinterpret_cast<const char*>(&x), sizeof(x));
+    }
+
+    static void append(std::string& rec, const char* s)
+    {
+        uint16_t len = uint16_t(std::min<size_t>(strlen(s), UINT16_MAX));
+        append(rec, len);
+        rec.append(s, len);
+    }
+
+    static void append(std::string& rec, const std::string& s)
+    {
+        append(rec, s.c_str());
+    }
+
+    template <typename T>
+    static constexpr char type_code()
+    {
+        using U = std::decay_t<T>;
+        if(std::is_same<U, bool>{})
+            return 'b';
+        else if(std::is_same<U, char>{})
+            return 'c';
+        else if(std::is_same<U, float>{})
+            return 'f';
+        else if(std::is_same<U, double>{})
+            return 'd';
+        else if(std::is_integral<U>{} && std::is_signed<U>{})
+            return sizeof(U) <= 4 ? 'i' : 'l';
+        else if(std::is_integral<U>{})
+            return sizeof(U) <= 4 ? 'u' : 'U';
+        else if(std::is_same<U, const char*>{} || std::is_same<U, char*>{}
+                || std::is_same<U, std::string>{})
+            return 's';
+        else if(std::is_enum<U>{})
+            return 'e';
+        else
+            return 'y';
+    }
+
+    // Arithmetic values are written in binary, widened to 32 bits if smaller
+    template <typename T, std::enable_if_t<std::is_arithmetic<T>{}, int> = 0>
+    static void append_value(std::string& rec, const T& x)
+    {
+        constexpr char code = type_code<T>();
+        if constexpr(code == 'i')
+            append(rec, int32_t(x));
+        else if constexpr(code == 'u')
+            append(rec, uint32_t(x));
+        else
+            append(rec, x);
+    }
+
+    static void append_value(std::string& rec, const char* s)
+    {
+        append(rec, s);
+    }
+
+    static void append_value(std::string& rec, const std::string& s)
+    {
+        append(rec, s);
+    }
+
+    // Enumerations are written as integers, after their enumerator record
+    template <typename T, std::enable_if_t<std::is_enum<T>{}, int> = 0>
+    void append_value(std::string& rec, const T& x)
+    {
+        uint64_t key = uint64_t(enum_type_id<T>()) << 32 | uint32_t(x);
+
+        // Each thread remembers the enumerators which have been written
+        thread_local std::unordered_set<uint64_t> t_enumerators;
+        if(t_enumerators.find(key) == t_enumerators.end())
+        {
+            rocblas_internal_ostream os;
+            os << rocblas_internal_ostream::yaml_on << x;
+            define_enumerator(key, os.str());
+            t_enumerators.insert(key);
+        }
+        append(rec, int32_t(x));
+    }
+
+    // Other values are formatted as they are in the profile log
+    template <typename T,
+              std::enable_if_t<!std::is_arithmetic<T>{} && !std::is_enum<T>{}, int> = 0>
+    static void append_value(std::string& rec, const T& x)
+    {
+        rocblas_internal_ostream os;
+        os << rocblas_internal_ostream::yaml_on << x;
+        append(rec, os.str());
+    }
+
+    // Appends the size and kind of a record, returning the offset of the record
+    static size_t begin_record(std::string& rec, record_kind kind)
+    {
+        size_t start = rec.size();
+        append(rec, uint32_t(0));
+        append(rec, uint8_t(kind));
+        return start;
+    }
+
+    // Fill in the size of the record which starts at offset start
+    static void end_record(std::string& rec, size_t start = 0)
+    {
+        uint32_t size = uint32_t(rec.size() - start - sizeof(uint32_t));
+        memcpy(&rec[start], &size, sizeof(size));
+    }
+
+    // The ID of an enumeration type, assigned on first use
+    template <typename T>
+    uint32_t enum_type_id()
+    {
+        static const uint32_t id = m_next_enum_type_id++;
+        return id;
+    }
+
+    // Look up the ID of a signature, writing a definition record if it is new
+    template <size_t N, typename TUP>
+    uint32_t find_or_define(const signature<N>& sig, const TUP& tup)
+    {
+        size_t hash = 0;
+        for(const void* p : sig)
+            hash ^= reinterpret_cast<size_t>(p) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+            uint32_t                                  id;
+            if(find(hash, sig.data(), N, id))
+                return id;
+        }
+
+        std::string rec;
+        begin_record(rec, definition);
+        append(rec, uint32_t(0)); // ID, filled in by define()
+        append(rec, uint16_t(std::tuple_size<TUP>{} / 2 - 1));
+
+        bool first = true;
+        tuple_helper::apply_pairs(
+            [&](const char* name, const auto& value) {
+                using T = std::decay_t<decltype(value)>;
+                if(first)
+                    append(rec, value);
+                else
+                {
+                    append(rec, name);
+                    append(rec, uint8_t(type_code<T>()));
+                    if constexpr(std::is_enum<T>{})
+                        append(rec, enum_type_id<T>());
+                }
+                first = false;
+            },
+            tup);
+
+        end_record(rec);
+        return define(hash, sig.data(), N, rec);
+    }
+
+    // Find the ID of a signature with a hash, comparing the whole signature
+    bool find(size_t hash, const void* const* sig, size_t n, uint32_t& id) const;
+
+    // Assign an ID to a new signature and write its definition record
+    uint32_t define(size_t hash, const void* const* sig, size_t n, std::string& rec);
+
+    // Write the enumerator record of an enumeration type ID and value, if it is new
+    void define_enumerator(uint64_t key, const std::string& name);
+
+    // Write a record immediately
+    void write(const std::string& rec);
+
+    rocblas_internal_ostream m_os;
+
+    // Map from signature hashes to signatures and their IDs, and the next ID
+    struct definition_entry
+    {
+        std::vector<const void*> sig;
+        uint32_t                 id;
+    };
+    mutable std::shared_timed_mutex                   m_mutex;
+    std::unordered_multimap<size_t, definition_entry> m_ids;
+    uint32_t                                          m_next_id = 0;
+
+    // Enumerators which have been written, and the next enumeration type ID
+    std::unordered_set<uint64_t> m_enumerators;
+    std::atomic<uint32_t>        m_next_enum_type_id{0};
+};
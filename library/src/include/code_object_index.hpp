@@ -0,0 +1,81 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*******************************************************************************
+ * rocblas_code_object_index maps kernel names to the code object files which
+ * contain them, so that code object files can be loaded the first time one of
+ * their kernels is needed, instead of all of them being loaded at startup.
+ *
+ * The kernel names are read from the ELF symbol tables of the code object
+ * files. Since reading every file is still costly, the index is cached in a
+ * text file, and only files whose size or modification time changed since the
+ * cached index was written are read again.
+ ******************************************************************************/
+class rocblas_code_object_index
+{
+public:
+    static constexpr size_t npos = ~size_t{0};
+
+    // Index the code object files. If cache_path is not empty, the cached index
+    // is read from it, and it is rewritten if any code object file changed.
+    rocblas_code_object_index(std::vector<std::string> files, const std::string& cache_path);
+
+    // Number of code object files
+    size_t size() const
+    {
+        return m_files.size();
+    }
+
+    // Path of a code object file
+    const std::string& path(size_t file) const
+    {
+        return m_files[file].path;
+    }
+
+    // Whether the kernels of a code object file are known. Files which are not
+    // indexed (e.g., offload bundles which are not ELF files) must be loaded eagerly.
+    bool indexed(size_t file) const
+    {
+        return m_files[file].indexed;
+    }
+
+    // Return the code object file containing a kernel, or npos if no file is known to
+    // contain it
+    size_t find(const std::string& kernel) const
+    {
+        auto it = m_kernels.find(kernel);
+        return it == m_kernels.end() ? npos : it->second;
+    }
+
+private:
+    struct file_entry
+    {
+        std::string              path;
+        size_t                   size    = 0;
+        long long                mtime   = 0;
+        bool                     cached  = false;
+        bool                     indexed = false;
+        std::vector<std::string> kernels;
+    };
+
+    bool read_cache(const std::string& cache_path);
+    void write_cache(const std::string& cache_path) const;
+
+    std::vector<file_entry>                 m_files;
+    std::unordered_map<std::string, size_t> m_kernels;
+};
+
+// Read the names of the kernels defined in an ELF code object file.
+// Returns false if the file cannot be read or is not an ELF file.
+bool rocblas_read_code_object_kernels(const std::string& path, std::vector<std::string>& kernels);
+
+// Default path of the cached code object index for the code objects of a processor in a directory
+std::string rocblas_default_code_object_index_path(const std::string& dir,
+                                                   const std::string& processor);
@@ -7,13 +7,17 @@
 #include "macros.hpp"
 #include "rocblas.h"
 #include "rocblas_ostream.hpp"
+#include "rocblas_workspace_pool.hpp"
 #include "utility.hpp"
 #include <array>
 #include <cstddef>
+#include <deque>
 #include <hip/hip_runtime.h>
+#include <map>
 #include <memory>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 #ifdef WIN32
 #include <stdio.h>
 #define STDOUT_FILENO _fileno(stdout)
@@ -23,6 +27,8 @@
 #endif
 #include <utility>
 
+class argument_profile_timing;
+
 // forcing early cleanup
 extern "C" ROCBLAS_EXPORT void rocblas_shutdown();
 
@@ -55,6 +61,13 @@ enum class rocblas_device_memory_ownership
 // helper function in handle.cpp
 static rocblas_status free_existing_device_memory(rocblas_handle);
 
+// Contraction plan captured by runContractionProblem (defined in tensile_host.hpp)
+struct RocblasContractionPlan;
+
+// Merge the new entries of the persistent Tensile solution cache into its file. It is called when
+// the last handle is destroyed (defined in tensile_host.cpp).
+void rocblas_internal_flush_persistent_solution_cache();
+
 /*******************************************************************************
  * \brief rocblas_handle is a structure holding the rocblas library context.
  * It must be initialized using rocblas_create_handle() and the returned handle mus
@@ -193,6 +206,15 @@ public:
     // default atomics mode allows atomic operations
     rocblas_atomics_mode atomics_mode = rocblas_atomics_allowed;
 
+    // default reduction mode accumulates sums in the order of the fastest algorithm
+    rocblas_reduction_mode reduction_mode = rocblas_reduction_mode_default;
+
+    // default nrm2 mode sums the squares of the elements without scaling
+    rocblas_nrm2_mode nrm2_mode = rocblas_nrm2_mode_default;
+
+    // default result mode writes the results of reductions to the host before returning
+    rocblas_result_mode result_mode = rocblas_result_mode_blocking;
+
     // Selects the benchmark library to be used for solution selection
     rocblas_performance_metric performance_metric = rocblas_default_performance_metric;
 
@@ -206,6 +228,16 @@ public:
     void                                      init_logging();
     void                                      init_check_numerics();
 
+    // Device timing of profiled calls, turned on by ROCBLAS_LOG_PROFILE_TIMING
+    bool profile_timing = false;
+
+    // Start timing a profiled call on the current stream. The call ends when the
+    // rocBLAS function returns, after its kernels are launched.
+    void profile_timing_begin(const std::shared_ptr<argument_profile_timing>& timing);
+
+    // End the open call by recording its stop event
+    void profile_timing_end();
+
     // C interfaces for manipulating device memory
     friend rocblas_status(::rocblas_start_device_memory_size_query)(_rocblas_handle*);
     friend rocblas_status(::rocblas_stop_device_memory_size_query)(_rocblas_handle*, size_t*);
@@ -216,6 +248,10 @@ public:
     friend bool(::rocblas_is_managing_device_memory)(_rocblas_handle*);
     friend bool(::rocblas_is_user_managing_device_memory)(_rocblas_handle*);
     friend rocblas_status(::rocblas_set_stream)(_rocblas_handle*, hipStream_t);
+    friend rocblas_status(::rocblas_get_workspace_stats)(_rocblas_handle*,
+                                                         rocblas_workspace_stats*,
+                                                         size_t*);
+    friend rocblas_status(::rocblas_reset_workspace_stats)(_rocblas_handle*);
 
     // C interfaces that interact with the solution selection process
     friend rocblas_status(::rocblas_set_solution_fitness_query)(_rocblas_handle*, double*);
@@ -236,6 +272,10 @@ public:
         return solution_fitness_query;
     }
 
+    // Tensile solution cache hits and misses for calls made with this handle
+    size_t solution_cache_hits   = 0;
+    size_t solution_cache_misses = 0;
+
     // Sets the optimal size(s) of device memory for a kernel call
     // Maximum size is accumulated in device_memory_query_size
     // Returns rocblas_status_size_increased or rocblas_status_size_unchanged
@@ -266,6 +306,62 @@ public:
         return _pushed_state<rocblas_pointer_mode>(pointer_mode, mode);
     }
 
+    // Whether reductions in host pointer mode copy their results into the result ring
+    bool result_deferral = false;
+
+    // Let the reductions of an API call defer their results if the result mode is deferred,
+    // returning object which restores the old state when destroyed. Reductions called through
+    // the rocblas_internal_* templates by other libraries do not defer their results.
+    auto push_result_deferral()
+    {
+        return _pushed_state<bool>(result_deferral, result_mode == rocblas_result_mode_deferred);
+    }
+
+    // Algorithms of the reductions, selected by the reduction and nrm2 modes for API calls
+    struct reduction_algorithm_state
+    {
+        bool reproducible = false; // sums are reproducible
+        bool scaled_nrm2  = false; // nrm2 sums in Blue's scaled accumulators
+    } reduction_algorithms;
+
+    // Let the reductions of an API call use the algorithms of the reduction and nrm2 modes,
+    // returning an object which restores the old algorithms when destroyed. The API call sizes
+    // its workspace for them. Reductions called through the rocblas_internal_* templates by other
+    // libraries use the default algorithms, for which their callers size the workspace.
+    auto push_reduction_algorithms()
+    {
+        return _pushed_state<reduction_algorithm_state>(
+            reduction_algorithms,
+            {reduction_mode == rocblas_reduction_mode_reproducible,
+             nrm2_mode == rocblas_nrm2_mode_scaled});
+    }
+
+    // Token of the last deferred result, reset to 0 by reductions which do not defer it
+    rocblas_result_token last_result_token = 0;
+
+    // Copy size bytes of results from device memory into the result ring without waiting,
+    // making its token the last result token
+    rocblas_status defer_result(const void* results, size_t size);
+
+    // Write a deferred result to the host, waiting for its copy to complete
+    rocblas_status get_result(rocblas_result_token token, void* result);
+
+    // Contraction plan which runContractionProblem reuses if it matches the problem,
+    // or replaces with a newly captured plan if it does not (used by rocblas_gemm_plan).
+    // If capture_only is set, the plan is captured but no kernels are launched.
+    struct contraction_plan_state
+    {
+        std::unique_ptr<RocblasContractionPlan>* plan         = nullptr;
+        bool                                     capture_only = false;
+    } contraction_plan;
+
+    // Temporarily use a contraction plan, returning object which restores old plan when destroyed
+    auto push_contraction_plan(std::unique_ptr<RocblasContractionPlan>* plan,
+                               bool                                     capture_only = false)
+    {
+        return _pushed_state<contraction_plan_state>(contraction_plan, {plan, capture_only});
+    }
+
     // Whether to use any_order scheduling in Tensile calls
     bool any_order = false;
 
@@ -293,6 +389,101 @@ private:
     rocblas_device_memory_ownership device_memory_owner;
     size_t                          device_memory_query_size;
 
+    // Device memory acquired from a pool, unless it is user-owned
+    rocblas_workspace device_workspace;
+
+    // Acquire device memory from the pool, returning whether it succeeded. While device
+    // memory is in use, it stays valid until it is no longer in use, and it is kept if
+    // the acquisition fails.
+    bool acquire_device_memory(size_t size);
+
+    // Return device memory to the pool
+    void release_device_memory();
+
+    // Statistics of the workspace requested through device_malloc(), device_malloc_count()
+    // and gsu_malloc(), by requesting function and size class of the request. Functions are
+    // identified by the addresses of their names, so a function may have several entries.
+    // They are only recorded once rocblas_reset_workspace_stats() is called, or from the
+    // creation of the handle if ROCBLAS_WORKSPACE_STATS_PATH is set.
+    bool workspace_stats_enabled = false;
+    struct workspace_stats_entry
+    {
+        size_t requests      = 0;
+        size_t peak_bytes    = 0;
+        size_t reallocations = 0;
+        size_t failures      = 0;
+    };
+    std::map<std::pair<const char*, size_t>, workspace_stats_entry> workspace_stats;
+
+    // Number of times device memory was reallocated by device_allocator()
+    size_t device_memory_reallocations = 0;
+
+    // Record a request of size bytes by a function, made while in_use bytes of the device
+    // memory were in use, which needed some reallocations
+    void record_workspace_request(const char* function,
+                                  size_t      size,
+                                  size_t      in_use,
+                                  size_t      reallocations,
+                                  bool        success);
+
+    // Record the GSU workspace of size bytes used by a Tensile solution, which is requested
+    // from the memory held by gsu_malloc()
+    void record_gsu_workspace_request(size_t size)
+    {
+        if(workspace_stats_enabled && gsu_workspace_function && size)
+            record_workspace_request(gsu_workspace_function,
+                                     size,
+                                     device_memory_in_use - gsu_workspace_size,
+                                     0,
+                                     size <= gsu_workspace_size);
+    }
+
+    // Workspace statistics merged by function name, sorted by function name and size class
+    std::vector<rocblas_workspace_stats> get_workspace_stats() const;
+
+    // Append the workspace statistics to the file named by ROCBLAS_WORKSPACE_STATS_PATH
+    void dump_workspace_stats() const;
+
+    // A profiled call being timed by a pair of events
+    struct profile_timing_call
+    {
+        hipEvent_t                               start;
+        hipEvent_t                               stop;
+        std::shared_ptr<argument_profile_timing> timing;
+    };
+
+    // The open call, whose stop event has not been recorded yet, and the stream it started on
+    profile_timing_call profile_timing_open{};
+    hipStream_t         profile_timing_stream = 0;
+
+    // Calls whose times have not been read yet, and unused events
+    std::deque<profile_timing_call> profile_timing_pending;
+    std::vector<hipEvent_t>         profile_timing_events;
+
+    // Record the times of the finished pending calls, waiting for all of them if wait is true
+    void profile_timing_resolve(bool wait);
+
+    // End the open call, and record the times of all calls and destroy the events
+    void profile_timing_finish();
+
+    // A pinned host buffer of the result ring, and the event recorded after the copy into it
+    struct result_slot
+    {
+        rocblas_result_token token    = 0;
+        hipEvent_t           event    = nullptr;
+        void*                host     = nullptr;
+        size_t               capacity = 0;
+        size_t               size     = 0;
+    };
+
+    // The result of a token is kept in slot token % RESULT_RING_SIZE until it is reused
+    static constexpr size_t  RESULT_RING_SIZE = 64;
+    std::vector<result_slot> result_ring;
+    rocblas_result_token     next_result_token = 1;
+
+    // Wait for the copies into the result ring, and free its buffers and events
+    void result_ring_finish();
+
     // Solution fitness query (used for internal testing)
     double* solution_fitness_query = nullptr;
 
@@ -324,9 +515,29 @@ private:
     private:
         std::vector<void*> pointers; // Important: must come last
 
+        // Check that size bytes can be borrowed from the handle, reallocating its device
+        // memory if needed, and record the request of a function in the workspace statistics
+        // unless the function is nullptr
+        bool borrow(const char* function)
+        {
+#if ROCBLAS_REALLOC_ON_DEMAND
+            size_t reallocations = handle->device_memory_reallocations;
+            bool   success       = handle->device_allocator(size);
+            reallocations        = handle->device_memory_reallocations - reallocations;
+#else
+            size_t available     = handle->device_memory_size - handle->device_memory_in_use;
+            size_t reallocations = 0;
+            bool   success       = size <= available;
+#endif
+            if(size && function && handle->workspace_stats_enabled)
+                handle->record_workspace_request(
+                    function, size, handle->device_memory_in_use, reallocations, success);
+            return success;
+        }
+
         // Allocate one or more pointers to buffers of different sizes
         template <typename... Ss>
-        decltype(pointers) allocate_pointers(Ss... sizes)
+        decltype(pointers) allocate_pointers(const char* function, Ss... sizes)
         {
             // This creates a list of partial sums which are the offsets of each of the allocated
             // arrays. The sizes are rounded up to the next multiple of MIN_CHUNK_SIZE.
@@ -335,11 +546,7 @@ private:
             size_t old;
             size_t offsets[] = {(old = size, size += roundup_device_memory_size(sizes), old)...};
 
-#if ROCBLAS_REALLOC_ON_DEMAND
-            success = handle->device_allocator(size);
-#else
-            success = size <= handle->device_memory_size - handle->device_memory_in_use;
-#endif
+            success = borrow(function);
 
             // If allocation failed, return an array of nullptr's
             // If total size is 0, return an array of nullptr's, but leave it marked as successful
@@ -359,27 +566,25 @@ private:
     public:
         // Constructor
         template <typename... Ss>
-        explicit _device_malloc(rocblas_handle handle, Ss... sizes)
+        explicit _device_malloc(rocblas_handle handle, const char* function, Ss... sizes)
             : handle(handle)
             , prev_device_memory_in_use(handle->device_memory_in_use)
             , size(0)
             , success(false)
-            , pointers(allocate_pointers(size_t(sizes)...))
+            , pointers(allocate_pointers(function, size_t(sizes)...))
         {
         }
 
         // Constructor for allocating count pointers of a certain total size
-        explicit _device_malloc(rocblas_handle handle, std::nullptr_t, size_t count, size_t total)
+        explicit _device_malloc(rocblas_handle handle,
+                                const char*    function,
+                                std::nullptr_t,
+                                size_t count,
+                                size_t total)
             : handle(handle)
             , prev_device_memory_in_use(handle->device_memory_in_use)
             , size(roundup_device_memory_size(total))
-            , success(
-                    #if ROCBLAS_REALLOC_ON_DEMAND
-                        handle->device_allocator(size)
-                    #else
-                        size <= handle->device_memory_size - handle->device_memory_in_use
-                    #endif
-                     )
+            , success(borrow(function))
             , pointers(count,
                        success ? static_cast<char*>(handle->device_memory)
                                      + handle->device_memory_in_use
@@ -439,6 +644,10 @@ private:
                         << std::endl;
                     rocblas_abort();
                 }
+
+                // Blocks replaced while the device memory was in use are no longer used
+                if(!handle->device_memory_in_use)
+                    handle->device_workspace.release_retired(handle->stream);
             }
         }
 
@@ -469,24 +678,30 @@ private:
     };
     // clang-format on
 
-    // For HPA kernel calls, all available device memory is allocated and passed to Tensile
+    // For HPA kernel calls, all available device memory is allocated and passed to Tensile.
+    // Only the part of it which the selected solution uses is recorded in the workspace
+    // statistics, by record_gsu_workspace_request().
     // clang-format off
     class [[nodiscard]] _gsu_malloc final : _device_malloc
     {
     public:
-        explicit _gsu_malloc(rocblas_handle handle)
-            : _device_malloc(handle, handle->device_memory_size - handle->device_memory_in_use)
+        explicit _gsu_malloc(rocblas_handle handle, const char* function)
+            : _device_malloc(handle,
+                             static_cast<const char*>(nullptr),
+                             handle->device_memory_size - handle->device_memory_in_use)
         {
-            handle->gsu_workspace_size = success ? size : 0;
-            handle->gsu_workspace      = static_cast<void*>(*this);
+            handle->gsu_workspace_size     = success ? size : 0;
+            handle->gsu_workspace          = static_cast<void*>(*this);
+            handle->gsu_workspace_function = success ? function : nullptr;
         }
 
         ~_gsu_malloc()
         {
             if(success)
             {
-                handle->gsu_workspace_size = 0;
-                handle->gsu_workspace      = nullptr;
+                handle->gsu_workspace_size     = 0;
+                handle->gsu_workspace          = nullptr;
+                handle->gsu_workspace_function = nullptr;
             }
         }
 
@@ -496,30 +711,45 @@ private:
     // clang-format on
 
 public:
+    // First size passed to device_malloc(), which also records the name of the calling
+    // function for the workspace statistics
+    struct first_device_malloc_size
+    {
+        size_t      size;
+        const char* function;
+
+        first_device_malloc_size(size_t size, const char* function = __builtin_FUNCTION())
+            : size(size)
+            , function(function)
+        {
+        }
+    };
+
     // Allocate one or more sizes
     template <typename... Ss,
-              std::enable_if_t<sizeof...(Ss) && conjunction<std::is_convertible<Ss, size_t>...>{},
-                               int> = 0>
-    auto device_malloc(Ss... sizes)
+              std::enable_if_t<conjunction<std::is_convertible<Ss, size_t>...>{}, int> = 0>
+    auto device_malloc(first_device_malloc_size first, Ss... sizes)
     {
-        return _device_malloc(this, size_t(sizes)...);
+        return _device_malloc(this, first.function, first.size, size_t(sizes)...);
     }
 
     // Allocate count pointers, reserving "size" total bytes
-    auto device_malloc_count(size_t count, size_t size)
+    auto device_malloc_count(size_t count, size_t size, const char* function = __builtin_FUNCTION())
     {
-        return _device_malloc(this, nullptr, count, size);
+        return _device_malloc(this, function, nullptr, count, size);
     }
 
-    // Variables holding state of GSU device memory allocation
-    size_t gsu_workspace_size = 0;
-    void*  gsu_workspace      = nullptr;
+    // Variables holding state of GSU device memory allocation, and the function which
+    // requested it
+    size_t      gsu_workspace_size     = 0;
+    void*       gsu_workspace          = nullptr;
+    const char* gsu_workspace_function = nullptr;
 
     // gsu_malloc() returns a proxy object which manages GSU memory for the handle.
     // The returned object needs to be kept alive for as long as the GSU memory is needed.
-    auto gsu_malloc()
+    auto gsu_malloc(const char* function = __builtin_FUNCTION())
     {
-        return _gsu_malloc(this);
+        return _gsu_malloc(this, function);
     };
 };
 
@@ -533,6 +763,29 @@ public:
             return rocblas_status_size_unchanged;    \
     } while(0)
 
+// rocBLAS functions which profile their calls declare a rocblas_profile_timing_scope
+// before they are profiled, which ends the device timing of the call when the
+// function returns, right after its kernels are launched
+class rocblas_profile_timing_scope
+{
+    rocblas_handle m_handle;
+
+public:
+    explicit rocblas_profile_timing_scope(rocblas_handle handle)
+        : m_handle(handle)
+    {
+    }
+
+    rocblas_profile_timing_scope(const rocblas_profile_timing_scope&) = delete;
+    rocblas_profile_timing_scope& operator=(const rocblas_profile_timing_scope&) = delete;
+
+    ~rocblas_profile_timing_scope()
+    {
+        if(m_handle && m_handle->profile_timing)
+            m_handle->profile_timing_end();
+    }
+};
+
 // Warn about potentially unsafe and synchronizing uses of hipMalloc and hipFree
 #define hipMalloc(ptr, size)                                                                     \
     _Pragma(                                                                                     \
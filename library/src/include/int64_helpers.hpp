@@ -0,0 +1,100 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+/*******************************************************************************
+ * Helpers of the ILP64 (_64 suffixed) interfaces. Their int64_t sizes and
+ * increments are split into chunks which the rocblas_int templates process.
+ ******************************************************************************/
+
+// Most elements, rows or columns passed to the rocblas_int templates at a time. It is a power of
+// two, so that every chunk but the last keeps the alignment which vectorized kernels test for.
+constexpr int64_t c_i64_chunk = int64_t(1) << 30;
+
+// Whether an increment or leading dimension can be passed to the rocblas_int templates
+inline bool rocblas_i64_fits(int64_t value)
+{
+    return value >= -std::numeric_limits<rocblas_int>::max()
+           && value <= std::numeric_limits<rocblas_int>::max();
+}
+
+// Offset of the chunk [start, start + count) of the n elements of a vector with increment inc.
+// The templates index a vector with a negative increment backwards from its end, so the first
+// elements of such a vector are at the end of its memory.
+inline int64_t rocblas_i64_chunk_offset(int64_t n, int64_t start, int64_t count, int64_t inc)
+{
+    return inc >= 0 ? start * inc : (n - start - count) * -inc;
+}
+
+// Arguments of the rocblas_int templates for the chunk of elements [start, start + c_i64_chunk)
+// of the n elements of the vectors of an elementwise operation. When an increment does not fit in
+// rocblas_int, the chunk is passed as a strided batch of vectors of one element, with the
+// increments as the strides, so that it is still processed by a single call.
+class rocblas_i64_elementwise_chunk
+{
+    int64_t m_n, m_start, m_count;
+    bool    m_batched;
+
+public:
+    rocblas_i64_elementwise_chunk(int64_t n, int64_t start, int64_t incx, int64_t incy = 1)
+        : m_n(n)
+        , m_start(start)
+        , m_count(std::min(n - start, c_i64_chunk))
+        , m_batched(!rocblas_i64_fits(incx) || !rocblas_i64_fits(incy))
+    {
+    }
+
+    rocblas_int n() const
+    {
+        return rocblas_int(m_batched ? 1 : m_count);
+    }
+
+    rocblas_int batch_count() const
+    {
+        return rocblas_int(m_batched ? m_count : 1);
+    }
+
+    // Offset of the chunk of a vector with increment inc
+    int64_t offset(int64_t inc) const
+    {
+        return m_batched && inc < 0 ? (m_n - 1 - m_start) * -inc
+                                    : rocblas_i64_chunk_offset(m_n, m_start, m_count, inc);
+    }
+
+    rocblas_int inc(int64_t inc) const
+    {
+        return m_batched ? 1 : rocblas_int(inc);
+    }
+
+    rocblas_stride stride(int64_t inc) const
+    {
+        return m_batched ? inc : 0;
+    }
+};
+
+// Writes a result combined on the host from the results of the chunks, which were computed in
+// host pointer mode, to result in the caller's pointer mode
+template <typename T>
+rocblas_status rocblas_i64_set_result(rocblas_handle       handle,
+                                      rocblas_pointer_mode pointer_mode,
+                                      T*                   result,
+                                      const T&             value)
+{
+    if(pointer_mode == rocblas_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            result, &value, sizeof(T), hipMemcpyHostToDevice, handle->get_stream()));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+    }
+    else
+        *result = value;
+    return rocblas_status_success;
+}
@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include "binary_logging.hpp"
 #include "handle.hpp"
 #include "rocblas_ostream.hpp"
 #include "tuple_helper.hpp"
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
 #include <iomanip>
@@ -15,12 +18,90 @@
 #include <map>
 #include <memory>
 #include <mutex>
-#include <shared_mutex>
 #include <string>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+
+/************************************************************************************
+ * Device timing statistics of the calls with an argument tuple
+ ************************************************************************************/
+class ROCBLAS_INTERNAL_EXPORT argument_profile_timing
+{
+public:
+    // Times are bucketed by powers of two microseconds. Bucket 0 holds times below 1us,
+    // and bucket b > 0 holds times in [2^(b-1), 2^b) us.
+    static constexpr int BUCKETS = 32;
+
+    struct stats
+    {
+        size_t count = 0;
+        double total = 0; // microseconds
+        double min   = 0;
+        double max   = 0;
+        size_t histogram[BUCKETS]{};
+
+        // Merge the statistics of other calls
+        stats& operator+=(const stats& other)
+        {
+            if(other.count)
+            {
+                min = count && min < other.min ? min : other.min;
+                max = count && max > other.max ? max : other.max;
+                count += other.count;
+                total += other.total;
+                for(int b = 0; b < BUCKETS; ++b)
+                    histogram[b] += other.histogram[b];
+            }
+            return *this;
+        }
+    };
+
+    // Record the time of a call in microseconds
+    void record(double us);
+
+    // Copy of the current statistics
+    stats get() const;
+
+private:
+    mutable std::mutex m_mutex;
+    stats              m_stats;
+};
+
+// Histogram of an argument_profile_timing, printed as a YAML map from the upper bound of
+// each nonempty bucket in microseconds to its count
+struct argument_profile_histogram
+{
+    const argument_profile_timing::stats& stats;
+
+    friend std::ostream& operator<<(std::ostream& os, const argument_profile_histogram& h)
+    {
+        const char* delim = "{ ";
+        for(int b = 0; b < argument_profile_timing::BUCKETS; ++b)
+        {
+            if(h.stats.histogram[b])
+            {
+                os << delim << (size_t{1} << b) << ": " << h.stats.histogram[b];
+                delim = ", ";
+            }
+        }
+        return os << " }";
+    }
+};
+
+// Compute the GFLOP and GB counts of a profiled call from its rocBLAS function name and its
+// numeric and character or string arguments, using the formulas which the clients use.
+// Returns false for the counts which are not known.
+ROCBLAS_INTERNAL_EXPORT void
+    argument_profile_gflop_gbyte_count(const char*                               function,
+                                       const std::map<std::string, double>&      values,
+                                       const std::map<std::string, std::string>& strings,
+                                       bool&                                     has_gflop,
+                                       double&                                   gflop,
+                                       bool&                                     has_gbyte,
+                                       double&                                   gbyte);
 
 /************************************************************************************
  * Profile kernel arguments
@@ -31,46 +112,187 @@ class argument_profile
     // Output stream
     mutable rocblas_internal_ostream os;
 
-    // Mutex for multithreaded access to table
-    mutable std::shared_timed_mutex mutex;
+    // Number of calls and timing statistics for a tuple
+    // The timing statistics are shared with the handles whose timing of the call is pending.
+    struct entry
+    {
+        size_t                                   call_count = 0;
+        std::shared_ptr<argument_profile_timing> timing
+            = std::make_shared<argument_profile_timing>();
+    };
+
+    using map_t = std::unordered_map<TUP,
+                                     entry,
+                                     typename tuple_helper::hash_t<TUP>,
+                                     typename tuple_helper::equal_t<TUP>>;
+
+    // Number of calls and timing statistics for a tuple, merged from several tables
+    struct merged_entry
+    {
+        size_t                         call_count = 0;
+        argument_profile_timing::stats stats;
+    };
+
+    using merged_map_t = std::unordered_map<TUP,
+                                            merged_entry,
+                                            typename tuple_helper::hash_t<TUP>,
+                                            typename tuple_helper::equal_t<TUP>>;
+
+    // Each thread counts its calls in its own table, so that threads do not contend for
+    // a lock to the profile. The mutex of a table is only contended during a dump.
+    struct table
+    {
+        std::mutex mutex;
+        map_t      map;
+    };
+
+    // Mutex for the list of tables and the retired entries
+    mutable std::mutex tables_mutex;
 
-    // Table mapping argument tuples into counts
-    // size_t is used for the map target type since atomic types are not movable, and
-    // the map elements will only be moved when we hold an exclusive lock to the map.
-    std::unordered_map<TUP,
-                       size_t,
-                       typename tuple_helper::hash_t<TUP>,
-                       typename tuple_helper::equal_t<TUP>>
-        map;
+    // Tables of the threads which have profiled calls
+    std::vector<std::shared_ptr<table>> tables;
 
-public:
-    // A tuple of arguments is looked up in an unordered map.
-    // A count of the number of calls with these arguments is kept.
-    // arg is assumed to be an rvalue for efficiency
-    void operator()(TUP&& arg)
+    // Entries of the tables of threads which have exited
+    merged_map_t retired;
+
+    // Each profile has a slot in the per-thread list of tables of its tuple type
+    const size_t slot = next_slot()++;
+
+    static std::atomic<size_t>& next_slot()
+    {
+        static std::atomic<size_t> n{0};
+        return n;
+    }
+
+    static void merge(merged_map_t& merged, const map_t& map)
     {
-        { // Acquire a shared lock for reading map
-            std::shared_lock<std::shared_timed_mutex> lock(mutex);
+        for(const auto& p : map)
+        {
+            auto& e = merged[p.first];
+            e.call_count += p.second.call_count;
+            e.stats += p.second.timing->get();
+        }
+    }
 
-            // Look up the tuple in the map
-            auto p = map.find(arg);
+    // Merge the tables of threads which have exited into the retired entries, once no
+    // handle has pending timing of their calls. Called with tables_mutex held.
+    void retire_tables()
+    {
+        auto retired_table = [&](const std::shared_ptr<table>& t) {
+            if(t.use_count() != 1)
+                return false;
+            for(const auto& p : t->map)
+                if(p.second.timing.use_count() != 1)
+                    return false;
+            merge(retired, t->map);
+            return true;
+        };
+        tables.erase(std::remove_if(tables.begin(), tables.end(), retired_table), tables.end());
+    }
 
-            // If tuple already exists, atomically increment count and return
-            if(p != map.end())
-            {
-                __atomic_fetch_add(&p->second, 1, __ATOMIC_SEQ_CST);
-                return;
-            }
-        } // Release shared lock
+    // Table of the calling thread, which is created on its first call
+    table& thread_table()
+    {
+        // The tables of the thread, indexed by the slots of the profiles of this tuple
+        // type. A thread's table is only released when the thread exits.
+        thread_local std::vector<std::shared_ptr<table>> t_tables;
 
-        { // Acquire an exclusive lock for modifying map
-            std::lock_guard<std::shared_timed_mutex> lock(mutex);
+        if(slot < t_tables.size() && t_tables[slot])
+            return *t_tables[slot];
 
-            // If doesn't already exist, insert tuple by moving arg and initializing count to 0.
-            // Increment the count after searching for tuple and returning old or new match.
-            // We hold a lock to the map, so we don't have to increment the count atomically.
-            map.emplace(std::move(arg), 0).first->second++;
-        } // Release exclusive lock
+        auto t = std::make_shared<table>();
+        {
+            std::lock_guard<std::mutex> lock(tables_mutex);
+            retire_tables();
+            tables.push_back(t);
+        }
+        if(slot >= t_tables.size())
+            t_tables.resize(slot + 1);
+        t_tables[slot] = std::move(t);
+        return *t_tables[slot];
+    }
+
+    // Collect the numeric and character or string arguments of a tuple by name
+    static void collect_arguments(const TUP&                          tup,
+                                  std::map<std::string, double>&      values,
+                                  std::map<std::string, std::string>& strings)
+    {
+        auto collect = [&](const char* name, const auto& value) {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr(std::is_same<T, char>{})
+                strings[name] = std::string(1, value);
+            else if constexpr(std::is_same<T, const char*>{} || std::is_same<T, std::string>{})
+                strings[name] = value;
+            else if constexpr(std::is_arithmetic<T>{})
+                values[name] = double(value);
+        };
+        tuple_helper::apply_pairs(collect, tup);
+    }
+
+    // Print a tuple with its call count and timing statistics
+    void print(const TUP& tup, size_t call_count, const argument_profile_timing::stats& stats) const
+    {
+        // delim starts as "{ " and becomes ", " afterwards
+        const char* delim      = "{ ";
+        auto        print_pair = [&](const char* name, const auto& value) {
+            os << delim << std::make_pair(name, value);
+            delim = ", ";
+        };
+
+        os << "- ";
+        tuple_helper::apply_pairs(print_pair, tup);
+        print_pair("call_count", call_count);
+
+        if(stats.count)
+        {
+            print_pair("timed_calls", stats.count);
+            print_pair("total_time_us", stats.total);
+            print_pair("min_time_us", stats.min);
+            print_pair("max_time_us", stats.max);
+            print_pair("time_histogram_us", argument_profile_histogram{stats});
+
+            // Derived rates, from the average time of the timed calls
+            std::map<std::string, double>      values;
+            std::map<std::string, std::string> strings;
+            collect_arguments(tup, values, strings);
+
+            bool   has_gflop, has_gbyte;
+            double gflop, gbyte;
+            argument_profile_gflop_gbyte_count(
+                std::get<1>(tup), values, strings, has_gflop, gflop, has_gbyte, gbyte);
+
+            double seconds = stats.total / stats.count * 1e-6;
+            if(has_gflop && seconds > 0)
+                print_pair("gflop_per_s", gflop / seconds);
+            if(has_gbyte && seconds > 0)
+                print_pair("gbyte_per_s", gbyte / seconds);
+        }
+
+        os << " }\n";
+    }
+
+public:
+    // A tuple of arguments is looked up in the unordered map of the calling thread.
+    // A count of the number of calls with these arguments is kept.
+    // arg is assumed to be an rvalue for efficiency
+    // Returns the timing statistics of the tuple
+    const std::shared_ptr<argument_profile_timing>& operator()(TUP&& arg)
+    {
+        table& t = thread_table();
+
+        // Only a dump contends for the lock of the thread's table
+        std::lock_guard<std::mutex> lock(t.mutex);
+
+        // Insert tuple by moving arg if it doesn't already exist, and increment its count
+        auto p = t.map.find(arg);
+        if(p == t.map.end())
+            p = t.map
+                    .emplace(std::piecewise_construct,
+                             std::forward_as_tuple(std::move(arg)),
+                             std::forward_as_tuple())
+                    .first;
+        p->second.call_count++;
+        return p->second.timing;
     }
 
     // Constructor
@@ -83,19 +305,24 @@ public:
     // Dump the current profile
     void dump() const
     {
-        // Acquire an exclusive lock to use map
-        std::lock_guard<std::shared_timed_mutex> lock(mutex);
+        // Merge the tables of the threads with the retired entries
+        merged_map_t merged;
+        {
+            std::lock_guard<std::mutex> lock(tables_mutex);
+            merged = retired;
+            for(const auto& t : tables)
+            {
+                std::lock_guard<std::mutex> table_lock(t->mutex);
+                merge(merged, t->map);
+            }
+        }
 
         // Clear the output buffer
         os.clear();
 
-        // Print all of the tuples in the map
-        for(const auto& p : map)
-        {
-            os << "- ";
-            tuple_helper::print_tuple_pairs(
-                os, std::tuple_cat(p.first, std::make_tuple("call_count", p.second)));
-        }
+        // Print all of the tuples in the merged map
+        for(const auto& p : merged)
+            print(p.first, p.second.call_count, p.second.stats);
 
         // Flush out the dump
         os.flush();
@@ -124,14 +351,24 @@ void log_profile(rocblas_handle handle, const char* func, Ts&&... xs)
     auto tup = std::make_tuple(
         "rocblas_function", func, "atomics_mode", handle->atomics_mode, std::forward<Ts>(xs)...);
 
+    // Write a binary record of the tuple if binary logging is turned on
+    if(handle->layer_mode & rocblas_layer_mode_log_binary)
+        (*rocblas_binary_log::open())(tup);
+
+    // The profile layer may only be turned on for binary logging
+    if(!handle->log_profile_os)
+        return;
+
     // Set up profile
     static argument_profile<decltype(tup)> profile(*handle->log_profile_os);
 
     // Add at_quick_exit handler in case the program exits early
     static int aqe = at_quick_exit([] { profile.~argument_profile(); });
 
-    // Profile the tuple
-    profile(std::move(tup));
+    // Profile the tuple, timing the call on the device if requested
+    auto& timing = profile(std::move(tup));
+    if(handle->profile_timing && !handle->is_device_memory_size_query())
+        handle->profile_timing_begin(timing);
 }
 
 /********************************************
@@ -160,6 +397,7 @@ void log_trace(rocblas_handle handle, Ts&&... xs)
 // (handle->layer_mode & rocblas_layer_mode_log_bench) != 0
 // log_bench will call log_arguments to log a string that
 // can be input to the executable rocblas-bench.
+// rocblas-bench has no ILP64 (_64 suffixed) functions, so those are not bench logged.
 template <typename... Ts>
 void log_bench(rocblas_handle handle, Ts&&... xs)
 {
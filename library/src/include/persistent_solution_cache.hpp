@@ -0,0 +1,89 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*******************************************************************************
+ * rocblas_persistent_solution_cache maps problem keys to the indices of the
+ * solutions selected for them, in a file which persists between processes.
+ *
+ * The file is a hash table with open addressing, which is memory-mapped and
+ * probed in place. It records the processor and a build ID of the library the
+ * solutions were selected from, and is ignored if either does not match.
+ *
+ * New entries are kept in memory and merged into the file by flush(), which is
+ * called when enough entries are pending, and by the library when its last
+ * handle is destroyed. Entries which are still pending on destruction are not
+ * written, since destruction happens during static destruction. Concurrent
+ * writers serialize on a lock file, merge the entries already in the file with
+ * their own, and atomically replace the file, so that readers always see a
+ * complete file.
+ *
+ * Lookups take a shared lock. The file is written without holding it, and the
+ * lock is only taken exclusively to insert entries and to swap in the mapping
+ * of the new file.
+ ******************************************************************************/
+class rocblas_persistent_solution_cache
+{
+public:
+    rocblas_persistent_solution_cache(std::string path,
+                                      std::string processor,
+                                      uint64_t    build_id,
+                                      size_t      key_words);
+    ~rocblas_persistent_solution_cache();
+
+    rocblas_persistent_solution_cache(const rocblas_persistent_solution_cache&) = delete;
+    rocblas_persistent_solution_cache& operator=(const rocblas_persistent_solution_cache&) = delete;
+
+    // Look up a key of key_words words. Returns whether it was found.
+    bool find(const uint64_t* key, int64_t& solution) const;
+
+    // Add a key and the index of its solution
+    void insert(const uint64_t* key, int64_t solution);
+
+    // Merge the pending entries into the file
+    void flush();
+
+    // Number of entries in the mapped file
+    size_t size() const;
+
+private:
+    struct mapping
+    {
+        const char* data = nullptr;
+        size_t      size = 0;
+    };
+
+    mapping  map_file(const std::string& path) const;
+    void     unmap_file(mapping& m) const;
+    bool     valid(const mapping& m) const;
+    uint64_t hash(const uint64_t* key) const;
+    bool     find_mapped(const mapping&  m,
+                         const uint64_t* key,
+                         uint64_t        h,
+                         int64_t&        solution) const;
+    void     write_file(const std::string&                              path,
+                        const std::unordered_map<std::string, int64_t>& entries) const;
+
+    static constexpr size_t FLUSH_THRESHOLD = 64;
+
+    std::string m_path;
+    char        m_processor[64] = {};
+    uint64_t    m_build_id;
+    size_t      m_key_words;
+    mapping     m_mapping;
+
+    mutable std::shared_mutex                m_mutex;
+    std::unordered_map<std::string, int64_t> m_pending;
+
+    // Serializes flush() within the process
+    std::mutex m_flush_mutex;
+};
@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <deque>
 #include <future>
 #include <iomanip>
 #include <map>
@@ -24,6 +25,7 @@
 #include <sys/stat.h>
 #include <thread>
 #include <utility>
+#include <vector>
 #ifdef WIN32
 #include <io.h>
 #include <iostream>
@@ -49,6 +51,27 @@
 #define rocblas_cout (rocblas_internal_ostream::cout())
 #define rocblas_cerr (rocblas_internal_ostream::cerr())
 
+/***************************************************************************
+ * Asynchronous logging. In asynchronous mode, flushing a stream queues    *
+ * its contents for the worker thread of its file without waiting for them *
+ * to be written. When the queue is full, the policy selects whether to    *
+ * wait for room in the queue, to drop the contents, or to drop them and   *
+ * write the number of dropped messages to the file.                       *
+ ***************************************************************************/
+enum class rocblas_log_queue_policy
+{
+    block,
+    drop,
+    count,
+};
+
+struct rocblas_log_async_options
+{
+    bool                     enabled    = false;
+    size_t                   queue_size = 4096;
+    rocblas_log_queue_policy policy     = rocblas_log_queue_policy::block;
+};
+
 /***************************************************************************
  * The rocblas_internal_ostream class performs atomic IO on log files, and provides *
  * consistent formatting                                                   *
@@ -61,64 +84,54 @@ class ROCBLAS_INTERNAL_EXPORT rocblas_internal_ostream
      **************************************************************************/
     class worker
     {
-        // task_t represents a payload of data and a promise to finish
-        class task_t
-        {
-            std::string        m_str;
-            std::promise<void> m_promise;
-
-        public:
-            // The task takes ownership of the string payload and promise
-            task_t(std::string&& str, std::promise<void>&& promise)
-                : m_str(std::move(str))
-                , m_promise(std::move(promise))
-            {
-            }
-
-            // Notify the future to wake up
-            void set_value()
-            {
-                m_promise.set_value();
-            }
-
-            // Size of the string payload
-            size_t size() const
-            {
-                return m_str.size();
-            }
-
-            // Data of the string payload
-            const char* data() const
-            {
-                return m_str.data();
-            }
-        };
-
         // FILE is used for safety in the presence of signals
         FILE* m_file = nullptr;
 
         // This worker's thread
         std::thread m_thread;
 
+        // Options for asynchronous writes, fixed when the worker is created
+        const rocblas_log_async_options m_options;
+
         // Condition variable for worker notification
         std::condition_variable m_cond;
 
+        // Condition variable for notifying senders of written strings and free queue space
+        std::condition_variable m_written_cond;
+
         // Mutex for this thread's queue
         std::mutex m_mutex;
 
-        // Queue of tasks
-        std::queue<task_t> m_queue;
+        // Queue of strings to be written
+        std::deque<std::string> m_queue;
+
+        // Number of strings queued and written so far, used to wait for strings to be written
+        uint64_t m_queued  = 0;
+        uint64_t m_written = 0;
+
+        // Number of strings dropped because the queue was full, not yet reported
+        uint64_t m_dropped = 0;
+
+        // Whether the worker thread has been told to exit, and whether it has exited
+        bool m_exit   = false;
+        bool m_exited = false;
 
-        // Worker thread which waits for and handles tasks sequentially
+        // Worker thread which waits for queued strings and writes them in batches
         void thread_function();
 
+        // Write a batch of strings, returning false on error
+        bool write_batch(const std::vector<std::string>& batch);
+
     public:
         // Worker constructor creates a worker thread for a raw filehandle
-        explicit worker(int fd);
+        worker(int fd, const rocblas_log_async_options& options);
 
-        // Send a string to be written
+        // Send a string to be written. In synchronous mode, wait until it has been written.
         void send(std::string);
 
+        // Wait until all strings sent so far have been written
+        void wait();
+
         // Destroy a worker when all std::shared_ptr references to it are gone
         ~worker();
     };
@@ -157,6 +170,10 @@ class ROCBLAS_INTERNAL_EXPORT rocblas_internal_ostream
         return map_mutex;
     }
 
+    // Options for the asynchronous writes of new workers, initialized from the environment
+    // Implemented as singleton to avoid the static initialization order fiasco
+    static rocblas_log_async_options& async_options();
+
     // Output buffer for formatted IO
     std::ostringstream m_os;
 
@@ -212,12 +229,26 @@ public:
     // For testing to allow file closing and deletion
     static void clear_workers();
 
+    // Wait until everything sent to all workers has been written
+    static void flush_workers();
+
+    // For testing to set the options for the asynchronous writes of workers created later,
+    // returning the previous options
+    static rocblas_log_async_options set_async_options(const rocblas_log_async_options& options);
+
     // Convert stream output to string
     std::string str() const
     {
         return m_os.str();
     }
 
+    // Write raw bytes to the buffer, which may include null characters
+    rocblas_internal_ostream& write(const char* data, size_t size)
+    {
+        m_os.write(data, size);
+        return *this;
+    }
+
     // Clear the buffer
     void clear()
     {
@@ -228,6 +259,9 @@ public:
     // Flush the output
     void flush();
 
+    // Flush the output, and wait until everything sent to this stream's file has been written
+    void sync();
+
     // Destroy the rocblas_internal_ostream
     virtual ~rocblas_internal_ostream();
 
@@ -446,6 +480,30 @@ public:
         return os;
     }
 
+    // reduction mode output
+    friend rocblas_internal_ostream& operator<<(rocblas_internal_ostream& os,
+                                                rocblas_reduction_mode    mode)
+    {
+        os.m_os << rocblas_reduction_mode_to_string(mode);
+        return os;
+    }
+
+    // nrm2 mode output
+    friend rocblas_internal_ostream& operator<<(rocblas_internal_ostream& os,
+                                                rocblas_nrm2_mode         mode)
+    {
+        os.m_os << rocblas_nrm2_mode_to_string(mode);
+        return os;
+    }
+
+    // result mode output
+    friend rocblas_internal_ostream& operator<<(rocblas_internal_ostream& os,
+                                                rocblas_result_mode       mode)
+    {
+        os.m_os << rocblas_result_mode_to_string(mode);
+        return os;
+    }
+
     // gemm flags output
     friend rocblas_internal_ostream& operator<<(rocblas_internal_ostream& os,
                                                 rocblas_gemm_flags        flags)
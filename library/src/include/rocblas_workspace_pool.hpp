@@ -0,0 +1,267 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*******************************************************************************
+ * Backends allocate the memory of workspace pools. Allocation returns nullptr
+ * on failure.
+ *
+ * Backends also order the reuse of blocks after the work queued on the stream
+ * which released them. A fence is recorded on that stream when a block is
+ * released; a stream which acquires the block waits for the fence, and the
+ * host waits for it before the block is deallocated. A null fence is complete.
+ ******************************************************************************/
+class ROCBLAS_INTERNAL_EXPORT rocblas_workspace_backend
+{
+public:
+    virtual ~rocblas_workspace_backend()                      = default;
+    virtual void* allocate(size_t size)                       = 0;
+    virtual void  deallocate(void* ptr, size_t size)          = 0;
+    virtual void* record_fence(hipStream_t stream)            = 0;
+    virtual void  wait_fence(void* fence, hipStream_t stream) = 0;
+    virtual void  synchronize_fence(void* fence)              = 0;
+    virtual void  destroy_fence(void* fence)                  = 0;
+};
+
+// Backend allocating device memory on a HIP device
+class ROCBLAS_INTERNAL_EXPORT rocblas_hip_workspace_backend : public rocblas_workspace_backend
+{
+public:
+    explicit rocblas_hip_workspace_backend(int device)
+        : m_device(device)
+    {
+    }
+
+    void* allocate(size_t size) override;
+    void  deallocate(void* ptr, size_t size) override;
+    void* record_fence(hipStream_t stream) override;
+    void  wait_fence(void* fence, hipStream_t stream) override;
+    void  synchronize_fence(void* fence) override;
+    void  destroy_fence(void* fence) override;
+
+private:
+    int m_device;
+};
+
+// Backend allocating host memory, used to test workspace pools without a device.
+// Allocations fail if they would exceed a limit on the total allocated size. Its
+// fences are only counted, and are always complete.
+class ROCBLAS_INTERNAL_EXPORT rocblas_host_workspace_backend : public rocblas_workspace_backend
+{
+public:
+    explicit rocblas_host_workspace_backend(size_t limit = ~size_t{0})
+        : m_limit(limit)
+    {
+    }
+
+    void* allocate(size_t size) override;
+    void  deallocate(void* ptr, size_t size) override;
+    void* record_fence(hipStream_t stream) override;
+    void  wait_fence(void* fence, hipStream_t stream) override;
+    void  synchronize_fence(void* fence) override;
+    void  destroy_fence(void* fence) override;
+
+    // Number of fences recorded and destroyed, and of waits of streams for fences
+    size_t fences_recorded() const
+    {
+        return m_fences_recorded;
+    }
+    size_t fences_destroyed() const
+    {
+        return m_fences_destroyed;
+    }
+    size_t fence_waits() const
+    {
+        return m_fence_waits;
+    }
+
+    // Number of calls to allocate() which succeeded, and to deallocate()
+    size_t allocations() const
+    {
+        return m_allocations;
+    }
+    size_t deallocations() const
+    {
+        return m_deallocations;
+    }
+
+    // Total size currently allocated
+    size_t allocated_size() const
+    {
+        return m_allocated_size;
+    }
+
+private:
+    size_t m_limit;
+    size_t m_allocations      = 0;
+    size_t m_deallocations    = 0;
+    size_t m_allocated_size   = 0;
+    size_t m_fences_recorded  = 0;
+    size_t m_fences_destroyed = 0;
+    size_t m_fence_waits      = 0;
+};
+
+// What a workspace pool does with the blocks returned to it
+enum class rocblas_workspace_policy
+{
+    free,       // deallocate returned blocks
+    grow,       // cache returned blocks for reuse, until the pool grows past them
+    high_water, // only allocate and cache blocks of the largest size class acquired so far
+};
+
+/*******************************************************************************
+ * rocblas_workspace_pool hands out the device memory which handles use as
+ * their workspace. Blocks are allocated in power-of-two size classes, so that
+ * a workspace growing to fit larger and larger problems is reallocated at most
+ * once per doubling.
+ *
+ * With the grow policy, blocks which are returned to the pool are kept for
+ * later acquisitions, so that shrinking and regrowing a workspace does not
+ * free, and synchronize the device. When a block of a new largest size class
+ * is allocated, the cached blocks of the smaller size classes are deallocated,
+ * so that the pool does not keep blocks which are too small for the problems
+ * already seen, which would double its size. With the high_water policy,
+ * every acquisition is rounded up to the largest size class acquired so far,
+ * so that when a pool is shared between handles, new handles start with a
+ * workspace which is large enough for the problems already seen, and only
+ * blocks of that size class are kept.
+ *
+ * Blocks are released with the stream which last used them, and acquired with
+ * the stream which will use them. A stream acquiring a block released by
+ * another stream waits for the work which was queued on that stream when the
+ * block was released, so that a pool can be shared between handles on
+ * different streams without synchronizing the host.
+ *
+ * Pools are thread-safe, and can be shared between the handles of a device.
+ ******************************************************************************/
+class ROCBLAS_INTERNAL_EXPORT rocblas_workspace_pool
+{
+public:
+    struct block
+    {
+        void*  ptr  = nullptr;
+        size_t size = 0;
+    };
+
+    // Smallest size class
+    static constexpr size_t MIN_SIZE_CLASS = size_t{1} << 16;
+
+    rocblas_workspace_pool(std::unique_ptr<rocblas_workspace_backend> backend,
+                           rocblas_workspace_policy                   policy);
+    ~rocblas_workspace_pool();
+
+    rocblas_workspace_pool(const rocblas_workspace_pool&) = delete;
+    rocblas_workspace_pool& operator=(const rocblas_workspace_pool&) = delete;
+
+    // Smallest size class which holds size bytes
+    static size_t size_class(size_t size);
+
+    // Acquire a block of at least size bytes for use on a stream, reusing a cached
+    // block if possible. If the backend cannot allocate a new block, the cached blocks
+    // are deallocated and the allocation is retried. Returns a block with a nullptr on
+    // failure, and an empty block if size is 0.
+    block acquire(size_t size, hipStream_t stream);
+
+    // Return a block, which may still be used by the work queued on a stream, to the
+    // pool, which caches or deallocates it
+    void release(const block& b, hipStream_t stream);
+
+    // Deallocate all cached blocks
+    void trim();
+
+    rocblas_workspace_policy policy() const
+    {
+        return m_policy;
+    }
+
+    // Largest size class acquired
+    size_t high_water() const;
+
+    // Total size of the cached blocks
+    size_t cached_size() const;
+
+    // Total size of the blocks allocated by the backend, cached or in use
+    size_t allocated_size() const;
+
+private:
+    // A cached block, and the fence of the stream which released it
+    struct cached_block
+    {
+        void*       ptr;
+        hipStream_t stream;
+        void*       fence;
+    };
+
+    void deallocate_block(void* ptr, size_t size, void* fence);
+    void deallocate_cached(size_t below);
+
+    std::unique_ptr<rocblas_workspace_backend> m_backend;
+    rocblas_workspace_policy                   m_policy;
+
+    mutable std::mutex                          m_mutex;
+    std::map<size_t, std::vector<cached_block>> m_cached;
+    size_t                               m_high_water     = 0;
+    size_t                               m_cached_size    = 0;
+    size_t                               m_allocated_size = 0;
+};
+
+/*******************************************************************************
+ * rocblas_workspace is the device memory of a handle, acquired from a pool.
+ * The parts of it which are in use are at fixed addresses, so when it grows
+ * while parts of it are in use, a new block is acquired and the current block
+ * is retired: it is kept until the workspace is no longer in use, and is then
+ * returned to the pool.
+ ******************************************************************************/
+class ROCBLAS_INTERNAL_EXPORT rocblas_workspace
+{
+public:
+    rocblas_workspace() = default;
+    explicit rocblas_workspace(std::shared_ptr<rocblas_workspace_pool> pool)
+        : m_pool(std::move(pool))
+    {
+    }
+
+    // The current block
+    const rocblas_workspace_pool::block& current() const
+    {
+        return m_current;
+    }
+
+    // Number of retired blocks
+    size_t retired() const
+    {
+        return m_retired.size();
+    }
+
+    // Replace the current block with a block of at least size bytes for use on a stream.
+    // If the workspace is not in use, the current block is returned to the pool first.
+    // Otherwise it is retired, and it is kept if the new block cannot be acquired.
+    // Returns whether a block was acquired.
+    bool acquire(size_t size, bool in_use, hipStream_t stream);
+
+    // Return the retired blocks to the pool, once the workspace is no longer in use
+    void release_retired(hipStream_t stream)
+    {
+        if(!m_retired.empty())
+            release_retired_blocks(stream);
+    }
+
+    // Return the current and retired blocks to the pool
+    void release(hipStream_t stream);
+
+private:
+    void release_retired_blocks(hipStream_t stream);
+
+    std::shared_ptr<rocblas_workspace_pool>    m_pool;
+    rocblas_workspace_pool::block              m_current;
+    std::vector<rocblas_workspace_pool::block> m_retired;
+};
@@ -349,6 +349,28 @@ struct RocblasContractionProblem
     };
 };
 
+/*******************************************************************************
+ * RocblasContractionPlan holds the Tensile problem and solution selected for a *
+ * RocblasContractionProblem, so that later calls with the same problem but    *
+ * different pointers and scalars can launch the solution directly. Plans are  *
+ * captured through _rocblas_handle::push_contraction_plan().                  *
+ *******************************************************************************/
+struct RocblasContractionPlan
+{
+    virtual ~RocblasContractionPlan() = default;
+
+    // Launch the captured solution for new matrices and scalars of the captured types, with
+    // alpha and beta on the host. Returns rocblas_status_continue without launching anything
+    // if the problem no longer matches the plan, in which case it must be captured again.
+    virtual rocblas_status replay(rocblas_handle handle,
+                                  const void*    alpha,
+                                  const void*    a,
+                                  const void*    b,
+                                  const void*    beta,
+                                  const void*    c,
+                                  void*          d) const = 0;
+};
+
 /*******************************************************************************
  * runContractionProblem() solves a RocblasContractionProblem                  *
  *******************************************************************************/
@@ -319,6 +319,25 @@ constexpr const char* rocblas_atomics_mode_to_string(rocblas_atomics_mode mode)
     return mode != rocblas_atomics_not_allowed ? "atomics_allowed" : "atomics_not_allowed";
 }
 
+// Convert reduction mode to string
+constexpr const char* rocblas_reduction_mode_to_string(rocblas_reduction_mode mode)
+{
+    return mode == rocblas_reduction_mode_reproducible ? "reduction_mode_reproducible"
+                                                       : "reduction_mode_default";
+}
+
+// Convert nrm2 mode to string
+constexpr const char* rocblas_nrm2_mode_to_string(rocblas_nrm2_mode mode)
+{
+    return mode == rocblas_nrm2_mode_scaled ? "nrm2_mode_scaled" : "nrm2_mode_default";
+}
+
+// Convert result mode to string
+constexpr const char* rocblas_result_mode_to_string(rocblas_result_mode mode)
+{
+    return mode == rocblas_result_mode_deferred ? "result_mode_deferred" : "result_mode_blocking";
+}
+
 // Convert gemm flags to string
 constexpr const char* rocblas_gemm_flags_to_string(rocblas_gemm_flags type)
 {
@@ -0,0 +1,289 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "persistent_solution_cache.hpp"
+#include <cstdio>
+#include <cstring>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    // The version must be incremented whenever the file format changes
+    constexpr char     MAGIC[8] = "rbsolnc";
+    constexpr uint32_t VERSION  = 1;
+
+    struct file_header
+    {
+        char     magic[8];
+        uint32_t version;
+        uint32_t key_words;
+        uint64_t build_id;
+        char     processor[64];
+        uint64_t capacity; // number of slots, a power of 2
+        uint64_t count; // number of occupied slots
+    };
+
+    // Each slot holds the key hash (0 if the slot is empty), the solution index and the key
+    constexpr size_t slot_words(size_t key_words)
+    {
+        return 2 + key_words;
+    }
+} // namespace
+
+rocblas_persistent_solution_cache::rocblas_persistent_solution_cache(std::string path,
+                                                                     std::string processor,
+                                                                     uint64_t    build_id,
+                                                                     size_t      key_words)
+    : m_path(std::move(path))
+    , m_build_id(build_id)
+    , m_key_words(key_words)
+{
+    strncpy(m_processor, processor.c_str(), sizeof(m_processor) - 1);
+    m_mapping = map_file(m_path);
+    if(!valid(m_mapping))
+        unmap_file(m_mapping);
+}
+
+rocblas_persistent_solution_cache::~rocblas_persistent_solution_cache()
+{
+    unmap_file(m_mapping);
+}
+
+uint64_t rocblas_persistent_solution_cache::hash(const uint64_t* key) const
+{
+    // FNV-1a, with 0 reserved for empty slots
+    uint64_t h = 14695981039346656037ull;
+    for(size_t i = 0; i < m_key_words; ++i)
+        h = (h ^ key[i]) * 1099511628211ull;
+    return h ? h : 1;
+}
+
+auto rocblas_persistent_solution_cache::map_file(const std::string& path) const -> mapping
+{
+    mapping m;
+#ifndef WIN32
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(fd == -1)
+        return m;
+
+    struct stat st;
+    if(!fstat(fd, &st) && size_t(st.st_size) >= sizeof(file_header))
+    {
+        void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if(data != MAP_FAILED)
+        {
+            m.data = static_cast<const char*>(data);
+            m.size = st.st_size;
+        }
+    }
+    close(fd);
+#endif
+    return m;
+}
+
+void rocblas_persistent_solution_cache::unmap_file(mapping& m) const
+{
+#ifndef WIN32
+    if(m.data)
+        munmap(const_cast<char*>(m.data), m.size);
+#endif
+    m = {};
+}
+
+// Whether a mapped file has a valid header for this processor, build and key size
+bool rocblas_persistent_solution_cache::valid(const mapping& m) const
+{
+    if(!m.data)
+        return false;
+
+    file_header header;
+    memcpy(&header, m.data, sizeof(header));
+    return !memcmp(header.magic, MAGIC, sizeof(MAGIC)) && header.version == VERSION
+           && header.key_words == m_key_words && header.build_id == m_build_id
+           && !strncmp(header.processor, m_processor, sizeof(m_processor))
+           && header.capacity && !(header.capacity & (header.capacity - 1))
+           && header.capacity <= (m.size - sizeof(header)) / (slot_words(m_key_words) * 8);
+}
+
+bool rocblas_persistent_solution_cache::find_mapped(const mapping&  m,
+                                                    const uint64_t* key,
+                                                    uint64_t        h,
+                                                    int64_t&        solution) const
+{
+    if(!m.data)
+        return false;
+
+    file_header header;
+    memcpy(&header, m.data, sizeof(header));
+
+    auto   slots = reinterpret_cast<const uint64_t*>(m.data + sizeof(header));
+    size_t words = slot_words(m_key_words);
+    size_t mask  = header.capacity - 1;
+
+    // Linear probing, until the key or an empty slot is found
+    for(size_t i = h & mask, n = 0; n < header.capacity; i = (i + 1) & mask, ++n)
+    {
+        const uint64_t* slot = slots + i * words;
+        if(!slot[0])
+            return false;
+        if(slot[0] == h && !memcmp(slot + 2, key, m_key_words * 8))
+        {
+            solution = int64_t(slot[1]);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool rocblas_persistent_solution_cache::find(const uint64_t* key, int64_t& solution) const
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    auto it = m_pending.find(std::string(reinterpret_cast<const char*>(key), m_key_words * 8));
+    if(it != m_pending.end())
+    {
+        solution = it->second;
+        return true;
+    }
+    return find_mapped(m_mapping, key, hash(key), solution);
+}
+
+void rocblas_persistent_solution_cache::insert(const uint64_t* key, int64_t solution)
+{
+    {
+        std::lock_guard<std::shared_mutex> lock(m_mutex);
+        m_pending[std::string(reinterpret_cast<const char*>(key), m_key_words * 8)] = solution;
+        if(m_pending.size() < FLUSH_THRESHOLD)
+            return;
+    }
+    flush();
+}
+
+size_t rocblas_persistent_solution_cache::size() const
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    if(!m_mapping.data)
+        return 0;
+    file_header header;
+    memcpy(&header, m_mapping.data, sizeof(header));
+    return header.count;
+}
+
+void rocblas_persistent_solution_cache::write_file(
+    const std::string& path, const std::unordered_map<std::string, int64_t>& entries) const
+{
+    file_header header{};
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version   = VERSION;
+    header.key_words = m_key_words;
+    header.build_id  = m_build_id;
+    memcpy(header.processor, m_processor, sizeof(m_processor));
+    header.count    = entries.size();
+    header.capacity = 16;
+    while(header.capacity < 2 * header.count)
+        header.capacity *= 2;
+
+    size_t                words = slot_words(m_key_words);
+    std::vector<uint64_t> slots(header.capacity * words);
+    for(const auto& entry : entries)
+    {
+        auto     key = reinterpret_cast<const uint64_t*>(entry.first.data());
+        uint64_t h   = hash(key);
+        size_t   i   = h & (header.capacity - 1);
+        while(slots[i * words])
+            i = (i + 1) & (header.capacity - 1);
+        slots[i * words]     = h;
+        slots[i * words + 1] = uint64_t(entry.second);
+        memcpy(&slots[i * words + 2], key, m_key_words * 8);
+    }
+
+    FILE* file = fopen(path.c_str(), "wb");
+    if(!file)
+        return;
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1
+              && fwrite(slots.data(), sizeof(uint64_t), slots.size(), file) == slots.size();
+    if(fclose(file) || !ok)
+        remove(path.c_str());
+}
+
+void rocblas_persistent_solution_cache::flush()
+{
+#ifndef WIN32
+    std::lock_guard<std::mutex> flush_lock(m_flush_mutex);
+
+    // The entries pending now are written; entries inserted while writing stay pending
+    std::unordered_map<std::string, int64_t> flushed;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        if(m_pending.empty())
+            return;
+        flushed = m_pending;
+    }
+
+    // Serialize writers from all processes
+    int lock_fd = open((m_path + ".lock").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if(lock_fd == -1 || flock(lock_fd, LOCK_EX))
+    {
+        if(lock_fd != -1)
+            close(lock_fd);
+        return;
+    }
+
+    // Merge the entries written by other processes since the file was mapped
+    std::unordered_map<std::string, int64_t> entries;
+    mapping                                  current = map_file(m_path);
+    if(valid(current))
+    {
+        file_header header;
+        memcpy(&header, current.data, sizeof(header));
+        auto   slots = reinterpret_cast<const uint64_t*>(current.data + sizeof(header));
+        size_t words = slot_words(m_key_words);
+        for(size_t i = 0; i < header.capacity; ++i)
+            if(slots[i * words])
+                entries.emplace(
+                    std::string(reinterpret_cast<const char*>(slots + i * words + 2),
+                                m_key_words * 8),
+                    int64_t(slots[i * words + 1]));
+    }
+    unmap_file(current);
+
+    for(auto& entry : flushed)
+        entries[entry.first] = entry.second;
+
+    // Replace the file atomically, so that readers never see a partial file
+    std::string tmp_path = m_path + ".tmp" + std::to_string(getpid());
+    write_file(tmp_path, entries);
+    if(!rename(tmp_path.c_str(), m_path.c_str()))
+    {
+        mapping written = map_file(m_path);
+        if(!valid(written))
+            unmap_file(written);
+
+        // Swap in the new file, whose entries are no longer pending
+        {
+            std::lock_guard<std::shared_mutex> lock(m_mutex);
+            std::swap(m_mapping, written);
+            for(auto& entry : flushed)
+            {
+                auto it = m_pending.find(entry.first);
+                if(it != m_pending.end() && it->second == entry.second)
+                    m_pending.erase(it);
+            }
+        }
+        unmap_file(written);
+    }
+    else
+        remove(tmp_path.c_str());
+
+    flock(lock_fd, LOCK_UN);
+    close(lock_fd);
+#endif
+}
@@ -102,6 +102,179 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * ! \brief get reduction mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_reduction_mode(rocblas_handle          handle,
+                                                     rocblas_reduction_mode* mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+    *mode = handle->reduction_mode;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_reduction_mode", *mode);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set reduction mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_reduction_mode(rocblas_handle         handle,
+                                                     rocblas_reduction_mode mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_reduction_mode", mode);
+    if(mode != rocblas_reduction_mode_default && mode != rocblas_reduction_mode_reproducible)
+        return rocblas_status_invalid_value;
+    handle->reduction_mode = mode;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get nrm2 mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_nrm2_mode(rocblas_handle handle, rocblas_nrm2_mode* mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+    *mode = handle->nrm2_mode;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_nrm2_mode", *mode);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set nrm2 mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_nrm2_mode(rocblas_handle handle, rocblas_nrm2_mode mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_nrm2_mode", mode);
+    if(mode != rocblas_nrm2_mode_default && mode != rocblas_nrm2_mode_scaled)
+        return rocblas_status_invalid_value;
+    handle->nrm2_mode = mode;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get result mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_result_mode(rocblas_handle       handle,
+                                                  rocblas_result_mode* result_mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!result_mode)
+        return rocblas_status_invalid_pointer;
+    *result_mode = handle->result_mode;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_result_mode", *result_mode);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set result mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_result_mode(rocblas_handle      handle,
+                                                  rocblas_result_mode result_mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_result_mode", result_mode);
+    if(result_mode != rocblas_result_mode_blocking && result_mode != rocblas_result_mode_deferred)
+        return rocblas_status_invalid_value;
+    handle->result_mode = result_mode;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get the token of the last result deferred by a reduction
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_result_token(rocblas_handle        handle,
+                                                   rocblas_result_token* token)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!token)
+        return rocblas_status_invalid_pointer;
+    *token = handle->last_result_token;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_result_token", *token);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief wait for a deferred result and copy it to result
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_get_result(rocblas_handle handle, rocblas_result_token token, void* result)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_result", token, result);
+    if(!result)
+        return rocblas_status_invalid_pointer;
+    return handle->get_result(token, result);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * ! \brief query the preferable supported int8 input layout for gemm by device
  ******************************************************************************/
@@ -6,7 +6,10 @@
 static void rocblas_abort_once [[noreturn]] ();
 
 #include "rocblas_ostream.hpp"
+#include <algorithm>
+#include <cerrno>
 #include <csignal>
+#include <cstring>
 #include <fcntl.h>
 #include <iostream>
 #include <type_traits>
@@ -20,6 +23,9 @@ static void rocblas_abort_once [[noreturn]] ();
 #define OPEN(A) _open(A, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_APPEND, _S_IREAD | _S_IWRITE);
 #define CLOSE(A) _close(A)
 #else
+#include <climits>
+#include <sys/uio.h>
+
 #define FDOPEN(A, B) fdopen(A, B)
 #define OPEN(A) open(A, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644);
 #define CLOSE(A) close(A)
@@ -48,7 +54,8 @@ static void rocblas_abort_once()
     alarm(5);
 #endif
 
-    // Clear the map, stopping all workers
+    // Write everything queued, and clear the map, stopping all workers
+    rocblas_internal_ostream::flush_workers();
     rocblas_internal_ostream::clear_workers();
 
     // Flush all
@@ -121,7 +128,10 @@ std::shared_ptr<rocblas_internal_ostream::worker> rocblas_internal_ostream::get_
 
     // If a new entry was inserted, or an old entry is empty, create new worker
     if(!worker_ptr)
-        worker_ptr = std::make_shared<worker>(fd);
+        worker_ptr = std::make_shared<worker>(fd, async_options());
+
+    // Write everything queued to the workers on quick_exit()
+    static int once = at_quick_exit(flush_workers);
 
     // Return the existing or new worker matching the file
     return worker_ptr;
@@ -165,7 +175,7 @@ void rocblas_internal_ostream::flush()
         // The contents of the string buffer
         auto str = m_os.str();
 
-        // Empty string buffers kill the worker thread, so they are not flushed here
+        // Empty string buffers have nothing to write, so they are not sent
         if(str.size())
             m_worker_ptr->send(std::move(str));
 
@@ -174,12 +184,59 @@ void rocblas_internal_ostream::flush()
     }
 }
 
+// Flush the output, and wait for it to be written
+void rocblas_internal_ostream::sync()
+{
+    flush();
+    if(m_worker_ptr)
+        m_worker_ptr->wait();
+}
+
 void rocblas_internal_ostream::clear_workers()
 {
     std::lock_guard<std::recursive_mutex> lock(worker_map_mutex());
     worker_map().clear();
 }
 
+void rocblas_internal_ostream::flush_workers()
+{
+    std::lock_guard<std::recursive_mutex> lock(worker_map_mutex());
+    for(auto& p : worker_map())
+        if(p.second)
+            p.second->wait();
+}
+
+// Read the options for asynchronous writes from the environment
+rocblas_log_async_options& rocblas_internal_ostream::async_options()
+{
+    static rocblas_log_async_options options = [] {
+        rocblas_log_async_options options;
+
+        const char* env = getenv("ROCBLAS_LOG_ASYNC");
+        options.enabled = env && strtol(env, nullptr, 0);
+
+        env = getenv("ROCBLAS_LOG_QUEUE_SIZE");
+        if(env && strtoull(env, nullptr, 0))
+            options.queue_size = strtoull(env, nullptr, 0);
+
+        env = getenv("ROCBLAS_LOG_QUEUE_FULL");
+        if(env && !strcmp(env, "drop"))
+            options.policy = rocblas_log_queue_policy::drop;
+        else if(env && !strcmp(env, "count"))
+            options.policy = rocblas_log_queue_policy::count;
+
+        return options;
+    }();
+    return options;
+}
+
+rocblas_log_async_options
+    rocblas_internal_ostream::set_async_options(const rocblas_log_async_options& options)
+{
+    std::lock_guard<std::recursive_mutex> lock(worker_map_mutex());
+    return std::exchange(async_options(), options);
+}
+
 // YAML Manipulators (only used for their addresses now)
 std::ostream& rocblas_internal_ostream::yaml_on(std::ostream& os)
 {
@@ -196,45 +253,85 @@ std::ostream& rocblas_internal_ostream::yaml_off(std::ostream& os)
  ***********************************************************************/
 
 // Send a string to the worker thread for this stream's device/inode
-// Empty strings tell the worker thread to exit
 void rocblas_internal_ostream::worker::send(std::string str)
 {
-    // Create a promise to wait for the operation to complete
-    std::promise<void> promise;
+    // Submit the string to the worker assigned to this device/inode
+    // Hold mutex for as short as possible, to reduce contention
+    std::unique_lock<std::mutex> lock(m_mutex);
 
-    // The future indicating when the operation has completed
-    auto future = promise.get_future();
+    // In asynchronous mode, the queue is bounded, and the policy decides what to do when it is full
+    if(m_options.enabled && m_queue.size() >= m_options.queue_size)
+    {
+        if(m_options.policy != rocblas_log_queue_policy::block)
+        {
+            ++m_dropped;
+            return;
+        }
+        m_written_cond.wait(lock,
+                            [&] { return m_queue.size() < m_options.queue_size || m_exited; });
+    }
 
-#ifdef WIN32
-    // Passing an empty string will make the worker thread exit.
-    // The below flag will be used to handle worker thread exit condition for Windows
-    bool empty_string = str.empty();
-#endif
+    // Strings sent after the worker thread has exited are discarded
+    if(m_exited)
+        return;
 
-    // task_t consists of string and promise
-    // std::move transfers ownership of str and promise to task
-    task_t worker_task(std::move(str), std::move(promise));
+    m_queue.push_back(std::move(str));
+    uint64_t seq = ++m_queued;
 
-    // Submit the task to the worker assigned to this device/inode
-    // Hold mutex for as short as possible, to reduce contention
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_queue.push(std::move(worker_task));
+    // no lock needed for notification but keeping here
+    m_cond.notify_one();
 
-        // no lock needed for notification but keeping here
-        m_cond.notify_one();
-    }
+    // In synchronous mode, wait for the string to be written, to ensure flushed IO
+    if(!m_options.enabled)
+        m_written_cond.wait(lock, [&] { return m_written >= seq || m_exited; });
+}
+
+// Wait until all strings sent so far have been written
+void rocblas_internal_ostream::worker::wait()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    uint64_t                     seq = m_queued;
+    m_written_cond.wait(lock, [&] { return m_written >= seq || m_exited; });
+}
 
-// Wait for the task to be completed, to ensure flushed IO
+// Write a batch of strings with as few system calls as possible
+bool rocblas_internal_ostream::worker::write_batch(const std::vector<std::string>& batch)
+{
 #ifdef WIN32
-    if(empty_string)
-        // Occassionaly this thread is not getting the promise set by the 'worker' thread during exit condition.
-        // Added a timed wait to exit after one second, if we do not get the promise from worker thread.
-        future.wait_for(std::chrono::seconds(1));
-    else
-        future.get();
+    for(const auto& str : batch)
+        fwrite(str.data(), 1, str.size(), m_file);
+
+    // Detect any error and flush the C FILE stream
+    return !ferror(m_file) && !fflush(m_file);
 #else
-    future.get();
+    // Gather the strings into one writev() call per IOV_MAX strings
+    std::vector<iovec> iov;
+    iov.reserve(batch.size());
+    for(const auto& str : batch)
+        if(str.size())
+            iov.push_back({const_cast<char*>(str.data()), str.size()});
+
+    int fd = fileno(m_file);
+    for(size_t i = 0; i < iov.size();)
+    {
+        ssize_t written = writev(fd, &iov[i], int(std::min<size_t>(iov.size() - i, IOV_MAX)));
+        if(written < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            return false;
+        }
+
+        // Skip the strings which have been written, and resume a partially written one
+        while(i < iov.size() && size_t(written) >= iov[i].iov_len)
+            written -= iov[i++].iov_len;
+        if(written)
+        {
+            iov[i].iov_base = static_cast<char*>(iov[i].iov_base) + written;
+            iov[i].iov_len -= written;
+        }
+    }
+    return true;
 #endif
 }
 
@@ -244,52 +341,65 @@ void rocblas_internal_ostream::worker::thread_function()
     // Clear any errors in the FILE
     clearerr(m_file);
 
+    // Batch of strings taken from the queue
+    std::vector<std::string> batch;
+
     // Lock the mutex in preparation for cond.wait
     std::unique_lock<std::mutex> lock(m_mutex);
 
     while(true)
     {
-        // Wait for any data, ignoring spurious wakeups, locks lock on continue
-        m_cond.wait(lock, [&] { return !m_queue.empty(); });
+        // Wait for any data or the closing of the stream, ignoring spurious wakeups
+        m_cond.wait(lock, [&] { return !m_queue.empty() || m_exit; });
+
+        // The worker thread exits when the stream is closed and everything has been written,
+        // including the number of dropped strings
+        if(m_queue.empty() && (!m_dropped || m_options.policy != rocblas_log_queue_policy::count))
+            break;
 
-        // With the mutex locked, get and pop data from the front of queue
-        task_t task = std::move(m_queue.front());
-        m_queue.pop();
+        // With the mutex locked, take all of the queued strings
+        batch.assign(std::make_move_iterator(m_queue.begin()),
+                     std::make_move_iterator(m_queue.end()));
+        m_queue.clear();
+        uint64_t seq     = m_queued;
+        uint64_t dropped = 0;
+        if(m_options.policy == rocblas_log_queue_policy::count)
+            std::swap(dropped, m_dropped);
+
+        // Notify senders waiting for room in the queue
+        m_written_cond.notify_all();
 
         // Temporarily unlock queue mutex, unblocking other threads
         lock.unlock();
 
-        // An empty message indicates the closing of the stream
-        if(!task.size())
-        {
-            // Tell future to wake up
-            task.set_value();
-            break;
-        }
+        if(dropped)
+            batch.push_back("# rocBLAS dropped " + std::to_string(dropped)
+                            + " log messages because the log queue was full\n");
 
         // Write the data
-        fwrite(task.data(), 1, task.size(), m_file);
+        bool success = write_batch(batch);
+        batch.clear();
 
-        // Detect any error and flush the C FILE stream
-        if(ferror(m_file) || fflush(m_file))
+        // Re-lock the mutex, and notify senders that the data has been written
+        lock.lock();
+        m_written = seq;
+        m_written_cond.notify_all();
+
+        if(!success)
         {
             perror("Error writing log file");
-
-            // Tell future to wake up
-            task.set_value();
             break;
         }
-
-        // Promise that the data has been written
-        task.set_value();
-
-        // Re-lock the mutex in preparation for cond.wait
-        lock.lock();
     }
+
+    // Wake up everyone waiting for this thread
+    m_exited = true;
+    m_written_cond.notify_all();
 }
 
 // Constructor creates a worker thread from a file descriptor
-rocblas_internal_ostream::worker::worker(int fd)
+rocblas_internal_ostream::worker::worker(int fd, const rocblas_log_async_options& options)
+    : m_options(options)
 {
     // The worker duplicates the file descriptor (RAII)
 #ifdef WIN32
@@ -314,8 +424,19 @@ rocblas_internal_ostream::worker::worker(int fd)
 
 rocblas_internal_ostream::worker::~worker()
 {
-    // Tell worker thread to exit, by sending it an empty string
-    send({});
+    // Tell worker thread to exit after writing everything queued, and wait for it
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_exit = true;
+        m_cond.notify_one();
+#ifdef WIN32
+        // Occassionaly this thread is not notified by the 'worker' thread during exit condition.
+        // Added a timed wait to exit after one second, if we are not notified by the worker.
+        m_written_cond.wait_for(lock, std::chrono::seconds(1), [&] { return m_exited; });
+#else
+        m_written_cond.wait(lock, [&] { return m_exited; });
+#endif
+    }
 
     // Close the FILE
     if(m_file)
@@ -0,0 +1,337 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas_workspace_pool.hpp"
+#include "rocblas_ostream.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <hip/hip_runtime.h>
+
+/*******************************************************************************
+ * HIP backend
+ ******************************************************************************/
+namespace
+{
+    // Class for temporarily setting the default device ID
+    class saved_device_id
+    {
+        int old_device_id = -1;
+        int device_id;
+
+    public:
+        explicit saved_device_id(int device_id)
+            : device_id(device_id)
+        {
+            if(hipGetDevice(&old_device_id) == hipSuccess && old_device_id != device_id)
+                hipSetDevice(device_id);
+        }
+
+        ~saved_device_id()
+        {
+            if(old_device_id != -1 && old_device_id != device_id)
+                hipSetDevice(old_device_id);
+        }
+
+        saved_device_id(const saved_device_id&) = delete;
+        saved_device_id& operator=(const saved_device_id&) = delete;
+    };
+} // namespace
+
+void* rocblas_hip_workspace_backend::allocate(size_t size)
+{
+    saved_device_id device_id(m_device);
+    void*           ptr = nullptr;
+    return hipMalloc(&ptr, size) == hipSuccess ? ptr : nullptr;
+}
+
+void rocblas_hip_workspace_backend::deallocate(void* ptr, size_t)
+{
+    saved_device_id device_id(m_device);
+    auto            hipStatus = hipFree(ptr);
+    if(hipStatus != hipSuccess)
+        rocblas_cerr << "rocBLAS error during hipFree in workspace pool: "
+                     << rocblas_status_to_string(get_rocblas_status_for_hip_status(hipStatus))
+                     << std::endl;
+}
+
+// The fences are events, which streams acquiring a block wait for on the device
+void* rocblas_hip_workspace_backend::record_fence(hipStream_t stream)
+{
+    saved_device_id device_id(m_device);
+    hipEvent_t      event;
+    if(hipEventCreateWithFlags(&event, hipEventDisableTiming) != hipSuccess)
+    {
+        // Without an event, the block is only released once the stream is idle
+        hipStreamSynchronize(stream);
+        return nullptr;
+    }
+    if(hipEventRecord(event, stream) != hipSuccess)
+    {
+        hipEventDestroy(event);
+        hipStreamSynchronize(stream);
+        return nullptr;
+    }
+    return event;
+}
+
+void rocblas_hip_workspace_backend::wait_fence(void* fence, hipStream_t stream)
+{
+    saved_device_id device_id(m_device);
+    if(hipStreamWaitEvent(stream, hipEvent_t(fence), 0) != hipSuccess)
+        hipEventSynchronize(hipEvent_t(fence));
+}
+
+void rocblas_hip_workspace_backend::synchronize_fence(void* fence)
+{
+    hipEventSynchronize(hipEvent_t(fence));
+}
+
+void rocblas_hip_workspace_backend::destroy_fence(void* fence)
+{
+    saved_device_id device_id(m_device);
+    hipEventDestroy(hipEvent_t(fence));
+}
+
+/*******************************************************************************
+ * Host backend
+ ******************************************************************************/
+void* rocblas_host_workspace_backend::allocate(size_t size)
+{
+    if(size > m_limit - m_allocated_size)
+        return nullptr;
+    void* ptr = malloc(size);
+    if(ptr)
+    {
+        m_allocated_size += size;
+        ++m_allocations;
+    }
+    return ptr;
+}
+
+void rocblas_host_workspace_backend::deallocate(void* ptr, size_t size)
+{
+    free(ptr);
+    m_allocated_size -= size;
+    ++m_deallocations;
+}
+
+void* rocblas_host_workspace_backend::record_fence(hipStream_t)
+{
+    // Any non-null value identifies a fence
+    return reinterpret_cast<void*>(++m_fences_recorded);
+}
+
+void rocblas_host_workspace_backend::wait_fence(void*, hipStream_t)
+{
+    ++m_fence_waits;
+}
+
+void rocblas_host_workspace_backend::synchronize_fence(void*) {}
+
+void rocblas_host_workspace_backend::destroy_fence(void*)
+{
+    ++m_fences_destroyed;
+}
+
+/*******************************************************************************
+ * Workspace pool
+ ******************************************************************************/
+rocblas_workspace_pool::rocblas_workspace_pool(std::unique_ptr<rocblas_workspace_backend> backend,
+                                               rocblas_workspace_policy                   policy)
+    : m_backend(std::move(backend))
+    , m_policy(policy)
+{
+}
+
+rocblas_workspace_pool::~rocblas_workspace_pool()
+{
+    trim();
+}
+
+size_t rocblas_workspace_pool::size_class(size_t size)
+{
+    // Sizes which have no power-of-two size class are their own size class
+    if(size > (~size_t{0} >> 1) + 1)
+        return size;
+
+    size_t cls = MIN_SIZE_CLASS;
+    while(cls < size)
+        cls *= 2;
+    return cls;
+}
+
+// Deallocate a block once the work on the stream which released it is done.
+// m_mutex must be held.
+void rocblas_workspace_pool::deallocate_block(void* ptr, size_t size, void* fence)
+{
+    if(fence)
+    {
+        m_backend->synchronize_fence(fence);
+        m_backend->destroy_fence(fence);
+    }
+    m_backend->deallocate(ptr, size);
+    m_allocated_size -= size;
+}
+
+// Deallocate the cached blocks of size classes below a size, or all cached blocks
+// if the size is 0. m_mutex must be held.
+void rocblas_workspace_pool::deallocate_cached(size_t below)
+{
+    for(auto it = m_cached.begin(); it != m_cached.end() && (!below || it->first < below);)
+    {
+        for(auto& cached : it->second)
+            deallocate_block(cached.ptr, it->first, cached.fence);
+        m_cached_size -= it->first * it->second.size();
+        it = m_cached.erase(it);
+    }
+}
+
+auto rocblas_workspace_pool::acquire(size_t size, hipStream_t stream) -> block
+{
+    if(!size)
+        return {};
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    size_t cls = size_class(size);
+    if(m_policy == rocblas_workspace_policy::high_water && cls < m_high_water)
+        cls = m_high_water;
+
+    // Reuse the smallest cached block which is large enough, or allocate a new block,
+    // releasing the cached blocks to make room if needed
+    block b;
+    auto  it = m_cached.lower_bound(cls);
+    if(it != m_cached.end())
+    {
+        // Prefer a block released by the same stream, which needs no wait
+        auto& blocks = it->second;
+        auto  same   = std::find_if(blocks.begin(), blocks.end(), [=](const cached_block& c) {
+            return c.stream == stream;
+        });
+        if(same != blocks.end())
+            std::swap(*same, blocks.back());
+
+        cached_block cached = blocks.back();
+        b                   = {cached.ptr, it->first};
+        blocks.pop_back();
+        if(blocks.empty())
+            m_cached.erase(it);
+
+        if(cached.fence)
+        {
+            if(cached.stream != stream)
+                m_backend->wait_fence(cached.fence, stream);
+            m_backend->destroy_fence(cached.fence);
+        }
+        m_cached_size -= b.size;
+    }
+    else
+    {
+        void* ptr = m_backend->allocate(cls);
+        if(!ptr && !m_cached.empty())
+        {
+            deallocate_cached(0);
+            ptr = m_backend->allocate(cls);
+        }
+        if(!ptr)
+            return {};
+
+        b = {ptr, cls};
+        m_allocated_size += cls;
+    }
+
+    if(cls > m_high_water)
+    {
+        m_high_water = cls;
+
+        // Blocks below the high water mark are never acquired again with the high_water
+        // policy, and are only kept for shrinking workspaces with the grow policy
+        if(m_policy != rocblas_workspace_policy::free)
+            deallocate_cached(m_high_water);
+    }
+    return b;
+}
+
+void rocblas_workspace_pool::release(const block& b, hipStream_t stream)
+{
+    if(!b.ptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // The block may still be in use by the work queued on the stream
+    void* fence = m_backend->record_fence(stream);
+
+    if(m_policy == rocblas_workspace_policy::free
+       || (m_policy == rocblas_workspace_policy::high_water && b.size < m_high_water))
+    {
+        deallocate_block(b.ptr, b.size, fence);
+    }
+    else
+    {
+        m_cached[b.size].push_back({b.ptr, stream, fence});
+        m_cached_size += b.size;
+    }
+}
+
+void rocblas_workspace_pool::trim()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    deallocate_cached(0);
+}
+
+size_t rocblas_workspace_pool::high_water() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_high_water;
+}
+
+size_t rocblas_workspace_pool::cached_size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cached_size;
+}
+
+size_t rocblas_workspace_pool::allocated_size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_allocated_size;
+}
+
+/*******************************************************************************
+ * Workspace of a handle
+ ******************************************************************************/
+bool rocblas_workspace::acquire(size_t size, bool in_use, hipStream_t stream)
+{
+    if(!in_use)
+    {
+        // The current block is returned to the pool, which may reuse it for the new block
+        release(stream);
+        m_current = m_pool->acquire(size, stream);
+        return m_current.ptr != nullptr;
+    }
+
+    // The current block is still referenced by the parts of the workspace in use
+    auto b = m_pool->acquire(size, stream);
+    if(!b.ptr)
+        return false;
+    m_retired.push_back(m_current);
+    m_current = b;
+    return true;
+}
+
+void rocblas_workspace::release(hipStream_t stream)
+{
+    release_retired(stream);
+    m_pool->release(m_current, stream);
+    m_current = {};
+}
+
+void rocblas_workspace::release_retired_blocks(hipStream_t stream)
+{
+    for(auto& b : m_retired)
+        m_pool->release(b, stream);
+    m_retired.clear();
+}
@@ -14,6 +14,9 @@ extern "C" void rocblas_shutdown();
  *****************************************************************************/
 
 #include "tensile_host.hpp"
+#include "code_object_index.hpp"
+#include "persistent_solution_cache.hpp"
+#include "utility.hpp"
 //#include <Tensile/AMDGPU.hpp>
 #include <Tensile/Contractions.hpp>
 #include <Tensile/EmbeddedLibrary.hpp>
@@ -24,7 +27,9 @@ extern "C" void rocblas_shutdown();
 #include <Tensile/hip/HipHardware.hpp>
 #include <Tensile/hip/HipSolutionAdapter.hpp>
 #include <Tensile/hip/HipUtils.hpp>
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <complex>
 #include <exception>
 #include <future>
@@ -41,11 +46,13 @@ extern "C" void rocblas_shutdown();
 #include <fileapi.h>
 #include <io.h>
 #include <libloaderapi.h>
+#include <sys/stat.h>
 #define ROCBLAS_LIB_PATH "C:/hipSDK/rocblas/bin"
 #else
 #include <glob.h>
 #include <libgen.h>
 #include <link.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #define ROCBLAS_LIB_PATH "/opt/rocm/lib/rocblas"
 #endif
@@ -196,6 +203,34 @@ namespace
         }
     };
 
+    /*************************************************************************
+     * Size of the GSU workspace passed to Tensile, rounded down to multiples *
+     * of HPA_GSU_WORKSPACE_SIZE_GRANULARITY. We set it to max size_t if this *
+     * is a size query.                                                       *
+     *************************************************************************/
+    size_t TensileWorkspaceSize(rocblas_handle handle)
+    {
+        return handle->is_device_memory_size_query()
+                   ? ~size_t{0}
+                   : (handle->gsu_workspace_size / HPA_GSU_WORKSPACE_SIZE_GRANULARITY)
+                         * HPA_GSU_WORKSPACE_SIZE_GRANULARITY;
+    }
+
+    /*****************************************************************
+     * The alpha restriction which Tensile uses in solution selection *
+     *****************************************************************/
+    template <typename Ti, typename To, typename Tc>
+    auto TensileAlphaRestriction(const RocblasContractionProblem<Ti, To, Tc>& prob)
+    {
+        // If k==0, we do not need to dereference prob.alpha and can set tensileAlpha=0
+        typename AlphaBeta<Ti, To, Tc>::tensile_type tensileAlpha;
+        if(prob.k)
+            AlphaBeta<Ti, To, Tc>::copy(&tensileAlpha, prob.alpha);
+        else
+            memset(&tensileAlpha, 0, sizeof(tensileAlpha));
+        return Tensile::toScalarValueEnum(tensileAlpha);
+    }
+
     /****************************************************************
      * Construct a Tensile Problem from a RocblasContractionProblem *
      ****************************************************************/
@@ -302,11 +337,7 @@ namespace
                                     prob.buffer_offset_d};
 
         // Size of GSU workspace. We set it to max size_t if this is a size query.
-        size_t workspace_size
-            = prob.handle->is_device_memory_size_query()
-                  ? ~size_t{0}
-                  : (prob.handle->gsu_workspace_size / HPA_GSU_WORKSPACE_SIZE_GRANULARITY)
-                        * HPA_GSU_WORKSPACE_SIZE_GRANULARITY;
+        size_t workspace_size = TensileWorkspaceSize(prob.handle);
 
         // The ContractionProblem
         Tensile::ContractionProblem tensileProblem{a,
@@ -357,14 +388,7 @@ namespace
 
         // alpha and beta are stored by value in Tensile::TypedContractionInputs
         // alpha and beta are copied from host to Tensile::TypedContractionInputs
-        // If k==0, we do not need to dereference prob.alpha and can set tensileAlpha=0
-        // Not positive if this is necessary here as well
-        typename AlphaBeta<Ti, To, Tc>::tensile_type tensileAlpha;
-        if(prob.k)
-            AlphaBeta<Ti, To, Tc>::copy(&tensileAlpha, prob.alpha);
-        else
-            memset(&tensileAlpha, 0, sizeof(tensileAlpha));
-        tensileProblem.setAlphaRestriction(Tensile::toScalarValueEnum(tensileAlpha));
+        tensileProblem.setAlphaRestriction(TensileAlphaRestriction(prob));
 
         // Add problem predicates for CEqualsD
         tensileProblem.setCEqualsD(prob.C == prob.D);
@@ -435,6 +459,495 @@ namespace
         return inputs;
     }
 
+    /***************************************************************************
+     * SolutionCacheKey captures every property of a RocblasContractionProblem *
+     * which can influence Tensile's solution selection: the data types,       *
+     * transposes, sizes, strides, offsets, flags, atomics mode, performance   *
+     * metric and workspace size. The matrix pointers and the values of alpha  *
+     * and beta are not part of the key, except for their value categories     *
+     * and whether C==D.                                                       *
+     **************************************************************************/
+    struct SolutionCacheKey
+    {
+        static constexpr size_t NWORDS = 33;
+        std::array<size_t, NWORDS> words;
+
+        // FNV-1a hash of the key words
+        size_t hash() const
+        {
+            size_t h = 14695981039346656037ull;
+            for(auto w : words)
+                h = (h ^ w) * 1099511628211ull;
+            return h;
+        }
+
+        bool operator==(const SolutionCacheKey& other) const
+        {
+            return words == other.words;
+        }
+    };
+
+    template <typename Ti, typename To, typename Tc>
+    SolutionCacheKey GetSolutionCacheKey(const RocblasContractionProblem<Ti, To, Tc>& prob)
+    {
+        // alpha==0 is folded into K=0, exactly as in ConstructTensileProblem
+        size_t k = prob.k && *prob.alpha ? prob.k : 0;
+
+        // clang-format off
+        return {{size_t(tensile_datatype<Ti>),
+                 size_t(tensile_datatype<To>),
+                 size_t(tensile_datatype<Tc>),
+                 size_t(prob.trans_a),
+                 size_t(prob.trans_b),
+                 size_t(prob.flags),
+                 size_t(prob.handle->atomics_mode),
+                 size_t(prob.handle->performance_metric),
+                 size_t(prob.strided_batch),
+                 size_t(prob.C == prob.D),
+                 size_t(value_category(*prob.beta) + 1),
+                 size_t(TensileAlphaRestriction(prob)),
+                 prob.m, prob.n, k, prob.batch_count,
+                 prob.row_stride_a, prob.col_stride_a, prob.batch_stride_a, prob.buffer_offset_a,
+                 prob.row_stride_b, prob.col_stride_b, prob.batch_stride_b, prob.buffer_offset_b,
+                 prob.row_stride_c, prob.col_stride_c, prob.batch_stride_c, prob.buffer_offset_c,
+                 prob.row_stride_d, prob.col_stride_d, prob.batch_stride_d, prob.buffer_offset_d,
+                 TensileWorkspaceSize(prob.handle)}};
+        // clang-format on
+    }
+
+    /***************************************************************************
+     * SolutionCache memoizes the results of findBestSolution for one device.  *
+     * Each entry also keeps the Tensile ContractionProblem built for its key  *
+     * and the device's Tensile Hardware, so that a hit needs neither of them  *
+     * to be constructed again.                                                *
+     *                                                                         *
+     * It is a set-associative table of SolutionCache::WAYS slots per set with *
+     * CLOCK (second chance) replacement within each set, which approximates   *
+     * LRU eviction while keeping the total number of entries bounded.         *
+     *                                                                         *
+     * Lookups do not take the insert mutex: each slot holds a shared_ptr to   *
+     * an immutable Entry, which is read and replaced with std::atomic_load    *
+     * and std::atomic_store, so an entry which is evicted while a lookup is   *
+     * still using it stays alive until that lookup releases it. The hash of   *
+     * each slot is kept apart from its entry, so that only the slots whose    *
+     * hash matches are loaded. Inserts are serialized by a mutex.             *
+     **************************************************************************/
+    class SolutionCache
+    {
+    public:
+        using solution_ptr = std::shared_ptr<Tensile::ContractionSolution>;
+
+        struct Entry
+        {
+            SolutionCacheKey                   key;
+            Tensile::ContractionProblem        problem;
+            std::shared_ptr<Tensile::Hardware> hardware;
+            solution_ptr                       solution;
+
+            Entry(const SolutionCacheKey&            key,
+                  Tensile::ContractionProblem        problem,
+                  std::shared_ptr<Tensile::Hardware> hardware)
+                : key(key)
+                , problem(std::move(problem))
+                , hardware(std::move(hardware))
+            {
+            }
+        };
+
+        using entry_ptr = std::shared_ptr<const Entry>;
+
+        // Number of slots in each set
+        static constexpr size_t WAYS = 8;
+
+        // Default number of entries, unless ROCBLAS_TENSILE_SOLUTION_CACHE_SIZE is set
+        static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    private:
+        struct Slot
+        {
+            std::atomic<size_t> hash{0};
+            entry_ptr           entry; // only accessed with std::atomic_load and atomic_store
+            std::atomic<bool>   referenced{false};
+        };
+
+        size_t                  m_sets = 0;
+        std::unique_ptr<Slot[]> m_slots;
+        std::mutex              m_mutex;
+        std::vector<size_t>     m_hands;
+
+        // Number of entries requested through the environment, rounded up to whole sets
+        static size_t RequestedSets()
+        {
+            static const size_t sets = [] {
+                const char* env      = getenv("ROCBLAS_TENSILE_SOLUTION_CACHE_SIZE");
+                size_t      capacity = env ? strtoul(env, nullptr, 0) : DEFAULT_CAPACITY;
+                return (capacity + WAYS - 1) / WAYS;
+            }();
+            return sets;
+        }
+
+        // Read a slot without taking m_mutex. Returns nullptr if the slot does not hold key.
+        static entry_ptr ReadSlot(const Slot& slot, const SolutionCacheKey& key, size_t hash)
+        {
+            if(slot.hash.load(std::memory_order_relaxed) != hash)
+                return nullptr;
+
+            // The hash is only a hint, since the slot may be replaced after it was read
+            auto entry = std::atomic_load(&slot.entry);
+            return entry && entry->key == key ? entry : nullptr;
+        }
+
+        // Write a slot while holding m_mutex
+        static void WriteSlot(Slot& slot, size_t hash, entry_ptr entry)
+        {
+            std::atomic_store(&slot.entry, std::move(entry));
+            slot.hash.store(hash, std::memory_order_relaxed);
+            slot.referenced.store(false, std::memory_order_relaxed);
+        }
+
+    public:
+        SolutionCache()
+            : m_sets(RequestedSets())
+            , m_slots(m_sets ? new Slot[m_sets * WAYS] : nullptr)
+            , m_hands(m_sets)
+        {
+        }
+
+        SolutionCache(const SolutionCache&) = delete;
+        SolutionCache& operator=(const SolutionCache&) = delete;
+
+        // Whether the cache is enabled
+        explicit operator bool() const
+        {
+            return m_sets != 0;
+        }
+
+        // Look up a key, returning nullptr if it is not cached
+        entry_ptr find(const SolutionCacheKey& key) const
+        {
+            size_t hash = key.hash();
+            Slot*  set  = &m_slots[(hash % m_sets) * WAYS];
+            for(size_t way = 0; way < WAYS; ++way)
+            {
+                auto entry = ReadSlot(set[way], key, hash);
+                if(entry)
+                {
+                    // Mark the slot as recently used
+                    if(!set[way].referenced.load(std::memory_order_relaxed))
+                        set[way].referenced.store(true, std::memory_order_relaxed);
+                    return entry;
+                }
+            }
+            return nullptr;
+        }
+
+        // Insert an entry, evicting the least recently used entry of its set
+        void insert(entry_ptr entry)
+        {
+            if(!entry || !entry->solution)
+                return;
+
+            size_t hash = entry->key.hash();
+            size_t idx  = hash % m_sets;
+            Slot*  set  = &m_slots[idx * WAYS];
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            // Another thread may have inserted the same key in the meantime
+            for(size_t way = 0; way < WAYS; ++way)
+                if(ReadSlot(set[way], entry->key, hash))
+                    return;
+
+            // Use an empty slot if there is one
+            for(size_t way = 0; way < WAYS; ++way)
+            {
+                if(!std::atomic_load(&set[way].entry))
+                {
+                    WriteSlot(set[way], hash, std::move(entry));
+                    return;
+                }
+            }
+
+            // CLOCK replacement: skip over recently used slots, clearing their
+            // referenced bits, until a slot which has not been used is found
+            size_t& hand = m_hands[idx];
+            while(set[hand].referenced.exchange(false, std::memory_order_relaxed))
+                hand = (hand + 1) % WAYS;
+            WriteSlot(set[hand], hash, std::move(entry));
+            hand = (hand + 1) % WAYS;
+        }
+    };
+
+    /*****************************************************************************
+     * The persistent solution cache is opened when Tensile is initialized, if   *
+     * ROCBLAS_TENSILE_PERSISTENT_SOLUTION_CACHE names a directory for it. It is *
+     * consulted when a problem misses the in-memory SolutionCache, or when the  *
+     * in-memory SolutionCache is disabled, before findBestSolution is called.   *
+     *****************************************************************************/
+    std::unique_ptr<rocblas_persistent_solution_cache>& persistent_solution_cache()
+    {
+        static std::unique_ptr<rocblas_persistent_solution_cache> cache;
+        return cache;
+    }
+
+    void OpenPersistentSolutionCache(const std::string& library_path, const std::string& processor)
+    {
+        const char* dir = getenv("ROCBLAS_TENSILE_PERSISTENT_SOLUTION_CACHE");
+        if(!dir || !*dir)
+            return;
+
+        // The build ID changes whenever rocBLAS or its Tensile library changes
+        char version[64] = "";
+        rocblas_get_version_string(version, sizeof(version));
+        std::string id = std::string(version) + "\n" + library_path;
+        struct stat st;
+        if(!stat(library_path.c_str(), &st))
+            id += "\n" + std::to_string(st.st_size) + "\n" + std::to_string(st.st_mtime);
+
+        uint64_t build_id = 14695981039346656037ull;
+        for(unsigned char c : id)
+            build_id = (build_id ^ c) * 1099511628211ull;
+
+        static_assert(sizeof(size_t) == sizeof(uint64_t), "SolutionCacheKey words must be 64-bit");
+        persistent_solution_cache() = std::make_unique<rocblas_persistent_solution_cache>(
+            std::string(dir) + "/solution_cache_" + processor + ".bin",
+            processor,
+            build_id,
+            SolutionCacheKey::NWORDS);
+    }
+
+    // Return the solution of the library with an index, if it supports the problem and hardware
+    using ContractionLibrary = Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>;
+    std::shared_ptr<Tensile::ContractionSolution>
+        GetSolutionByIndex(const ContractionLibrary&          library,
+                           int64_t                            index,
+                           const Tensile::ContractionProblem& problem,
+                           const Tensile::Hardware&           hardware)
+    {
+        auto it = library.solutions.find(index);
+        if(it == library.solutions.end() || !(*it->second->hardwarePredicate)(hardware)
+           || !(*it->second->problemPredicate)(problem))
+            return nullptr;
+        return it->second;
+    }
+
+    /***********************************************************************
+     * Statistics of Tensile initialization and code object loading, which *
+     * are returned by rocblas_get_tensile_load_stats()                    *
+     ***********************************************************************/
+    struct TensileLoadStats
+    {
+        std::atomic<size_t> init_nanoseconds{0};
+        std::atomic<size_t> code_objects_total{0};
+        std::atomic<size_t> code_objects_loaded{0};
+        std::atomic<size_t> code_object_bytes_loaded{0};
+        std::atomic<size_t> resident_bytes_loaded{0};
+    };
+
+    TensileLoadStats& tensile_load_stats()
+    {
+        static TensileLoadStats stats;
+        return stats;
+    }
+
+    // Resident memory size of the process in bytes, or 0 if it is not known
+    size_t ResidentMemorySize()
+    {
+#ifdef WIN32
+        return 0;
+#else
+        size_t total_pages, resident_pages = 0;
+        FILE*  statm = fopen("/proc/self/statm", "r");
+        if(statm)
+        {
+            if(fscanf(statm, "%zu %zu", &total_pages, &resident_pages) != 2)
+                resident_pages = 0;
+            fclose(statm);
+        }
+        return resident_pages * sysconf(_SC_PAGESIZE);
+#endif
+    }
+
+    /*******************************************************************************
+     * CodeObjectFiles holds the code object files for the current processor.      *
+     * Unless ROCBLAS_TENSILE_LAZY_LOADING=0, it also indexes the kernels in them, *
+     * so that each file can be loaded when a solution first needs it. The index   *
+     * is cached in the file named by ROCBLAS_TENSILE_CODE_OBJECT_INDEX, or in     *
+     * $XDG_CACHE_HOME/rocblas if it is not set. It is not cached if               *
+     * ROCBLAS_TENSILE_CODE_OBJECT_INDEX is set to an empty string.                *
+     *******************************************************************************/
+    struct CodeObjectFiles
+    {
+        std::vector<std::string>                   paths;
+        std::unique_ptr<rocblas_code_object_index> index;
+
+        CodeObjectFiles(std::vector<std::string> files,
+                        const std::string&       dir,
+                        const std::string&       processor)
+            : paths(files)
+        {
+#ifndef WIN32
+            const char* lazy = getenv("ROCBLAS_TENSILE_LAZY_LOADING");
+            if(!lazy || strtol(lazy, nullptr, 0))
+            {
+                const char* cache_path = getenv("ROCBLAS_TENSILE_CODE_OBJECT_INDEX");
+                index = std::make_unique<rocblas_code_object_index>(
+                    std::move(files),
+                    cache_path ? cache_path
+                               : rocblas_default_code_object_index_path(dir, processor));
+            }
+#endif
+            tensile_load_stats().code_objects_total = paths.size();
+        }
+    };
+
+    /**************************************************************************
+     * CodeObjectLoader loads the code object files into the adapter of one   *
+     * device, either all of them at initialization, or each of them when one *
+     * of its kernels is about to be launched for the first time.             *
+     **************************************************************************/
+    class CodeObjectLoader
+    {
+        const CodeObjectFiles*               m_files = nullptr;
+        std::unique_ptr<std::atomic<bool>[]> m_loaded;
+        std::mutex                           m_mutex;
+
+        // Load a code object file if it has not been loaded. m_mutex must be held.
+        void LoadFile(Tensile::hip::SolutionAdapter& adapter, size_t file)
+        {
+            if(m_loaded[file].load(std::memory_order_relaxed))
+                return;
+
+            auto&  stats    = tensile_load_stats();
+            auto&  path     = m_files->paths[file];
+            size_t resident = ResidentMemorySize();
+
+            adapter.loadCodeObjectFile(path);
+
+            size_t new_resident = ResidentMemorySize();
+            if(new_resident > resident)
+                stats.resident_bytes_loaded += new_resident - resident;
+
+            struct stat st;
+            if(!stat(path.c_str(), &st))
+                stats.code_object_bytes_loaded += st.st_size;
+            ++stats.code_objects_loaded;
+
+            m_loaded[file].store(true, std::memory_order_release);
+        }
+
+    public:
+        // Set the code object files, and load the files which are not loaded lazily
+        void Initialize(Tensile::hip::SolutionAdapter& adapter, const CodeObjectFiles& files)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_files = &files;
+            m_loaded.reset(new std::atomic<bool>[files.paths.size()]{});
+            for(size_t file = 0; file < files.paths.size(); ++file)
+                if(!files.index || !files.index->indexed(file))
+                    LoadFile(adapter, file);
+        }
+
+        // Load the code object files containing the kernels which are about to be launched
+        void Load(Tensile::hip::SolutionAdapter&                adapter,
+                  const std::vector<Tensile::KernelInvocation>& kernels)
+        {
+            if(!m_files || !m_files->index)
+                return;
+
+            for(const auto& kernel : kernels)
+            {
+                size_t file = m_files->index->find(kernel.kernelName);
+                if(file != rocblas_code_object_index::npos
+                   && m_loaded[file].load(std::memory_order_acquire))
+                    continue;
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if(file != rocblas_code_object_index::npos)
+                    LoadFile(adapter, file);
+                else
+                {
+                    // The kernel is not in the index, so every code object file is loaded
+                    for(file = 0; file < m_files->paths.size(); ++file)
+                        LoadFile(adapter, file);
+                }
+            }
+        }
+    };
+
+    /**************************************************************************
+     * TensileContractionPlan is the RocblasContractionPlan captured by       *
+     * runContractionProblem. replay() launches its solution for new matrices *
+     * and scalars as long as the problem has the same SolutionCacheKey and   *
+     * is run on the same device.                                             *
+     **************************************************************************/
+    template <typename Ti, typename To, typename Tc>
+    struct TensileContractionPlan : RocblasContractionPlan
+    {
+        SolutionCacheKey                              key;
+        int                                           device;
+        RocblasContractionProblem<Ti, To, Tc>         prob;
+        Tensile::ContractionProblem                   tensile_prob;
+        std::shared_ptr<Tensile::ContractionSolution> solution;
+        std::shared_ptr<Tensile::Hardware>            hardware;
+        Tensile::hip::SolutionAdapter&                adapter;
+        CodeObjectLoader&                             loader;
+
+        TensileContractionPlan(const SolutionCacheKey&                       key,
+                               int                                           device,
+                               const RocblasContractionProblem<Ti, To, Tc>&  prob,
+                               Tensile::ContractionProblem                   tensile_prob,
+                               std::shared_ptr<Tensile::ContractionSolution> solution,
+                               std::shared_ptr<Tensile::Hardware>            hardware,
+                               Tensile::hip::SolutionAdapter&                adapter,
+                               CodeObjectLoader&                             loader)
+            : key(key)
+            , device(device)
+            , prob(prob)
+            , tensile_prob(std::move(tensile_prob))
+            , solution(std::move(solution))
+            , hardware(std::move(hardware))
+            , adapter(adapter)
+            , loader(loader)
+        {
+        }
+
+        rocblas_status replay(rocblas_handle handle,
+                              const void*    alpha,
+                              const void*    a,
+                              const void*    b,
+                              const void*    beta,
+                              const void*    c,
+                              void*          d) const override
+        {
+            if(!isAligned(a, sizeof(Ti)) || !isAligned(b, sizeof(Ti)) || !isAligned(c, sizeof(To))
+               || !isAligned(d, sizeof(To)))
+                return rocblas_status_invalid_size;
+
+            // Only the handle, pointers and scalars differ from the captured problem
+            auto replayed   = prob;
+            replayed.handle = handle;
+            replayed.alpha  = static_cast<const Tc*>(alpha);
+            replayed.A      = static_cast<const Ti*>(a);
+            replayed.B      = static_cast<const Ti*>(b);
+            replayed.beta   = static_cast<const Tc*>(beta);
+            replayed.C      = static_cast<const To*>(c);
+            replayed.D      = static_cast<To*>(d);
+
+            // e.g. alpha == 0 folds into K == 0, and the handle's workspace or modes may change
+            if(handle->getDevice() != device || !(GetSolutionCacheKey(replayed) == key))
+                return rocblas_status_continue;
+
+            auto kernels = solution->solve(tensile_prob, GetTensileInputs(replayed), *hardware);
+            if(handle->workspace_stats_enabled)
+                handle->record_gsu_workspace_request(solution->requiredWorkspaceSize(tensile_prob));
+            loader.Load(adapter, kernels);
+            adapter.launchKernels(
+                kernels, handle->get_stream(), handle->startEvent, handle->stopEvent);
+            return rocblas_status_success;
+        }
+    };
+
     /**************************************************
      * The TensileHost struct interfaces with Tensile *
      **************************************************/
@@ -450,9 +963,11 @@ namespace
         {
             mutable std::atomic<Tensile::hip::SolutionAdapter*> adapter{nullptr};
             mutable std::mutex                                  mutex;
+            mutable SolutionCache                               solution_cache;
+            mutable CodeObjectLoader                            loader;
         };
 
-        // Each device contains an adapter
+        // Each device contains an adapter, a solution cache and a code object loader
         std::vector<adapter_s> const m_adapters;
 
     public:
@@ -519,7 +1034,9 @@ namespace
          * Initialize adapter and library according to environment variables *
          * and default paths based on librocblas.so location and GPU         *
          *********************************************************************/
-        void initialize(Tensile::hip::SolutionAdapter& adapter, rocblas_int deviceId)
+        void initialize(Tensile::hip::SolutionAdapter& adapter,
+                        CodeObjectLoader&              loader,
+                        rocblas_int                    deviceId)
         {
             std::string path;
             std::string tensileLibraryPath;
@@ -608,10 +1125,17 @@ namespace
                                              Tensile::LoadLibraryFile<Tensile::ContractionProblem>,
                                              tensileLibraryPath);
 
+            // The persistent solution cache is opened once, for the library being loaded
+            static std::once_flag persistent_once;
+            std::call_once(persistent_once, [&] {
+                OpenPersistentSolutionCache(tensileLibraryPath, processor);
+            });
+
             // only load modules for the current architecture
             auto dir = path + "/*" + processor + "*co";
 
-            bool no_match = false;
+            std::vector<std::string> code_object_paths;
+            bool                     no_match = false;
 #ifdef WIN32
             std::replace(dir.begin(), dir.end(), '/', '\\');
             WIN32_FIND_DATAA finddata;
@@ -620,8 +1144,7 @@ namespace
             {
                 do
                 {
-                    std::string codeObjectFile = path + "\\" + finddata.cFileName;
-                    adapter.loadCodeObjectFile(codeObjectFile.c_str());
+                    code_object_paths.push_back(path + "\\" + finddata.cFileName);
                 } while(FindNextFileA(hfine, &finddata));
             }
             else
@@ -634,8 +1157,8 @@ namespace
             int    g = glob(dir.c_str(), GLOB_NOSORT, nullptr, &glob_result);
             if(!g)
             {
-                for(size_t i = 0; i < glob_result.gl_pathc; ++i)
-                    adapter.loadCodeObjectFile(glob_result.gl_pathv[i]);
+                code_object_paths.assign(glob_result.gl_pathv,
+                                         glob_result.gl_pathv + glob_result.gl_pathc);
             }
             else if(g == GLOB_NOMATCH)
             {
@@ -662,6 +1185,11 @@ namespace
                                     << std::endl;
             }
 
+            // The code object files are found and indexed once, and loaded for each device
+            static const CodeObjectFiles code_objects(
+                std::move(code_object_paths), path, processor);
+            loader.Initialize(adapter, code_objects);
+
             {
                 static int once = [&] {
                     auto lib = ftr_lib.get();
@@ -694,8 +1222,10 @@ namespace
     auto& get_library_and_adapter(
         std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>>* library
         = nullptr,
-        std::shared_ptr<hipDeviceProp_t>* deviceProp = nullptr,
-        int                               device     = -1)
+        std::shared_ptr<hipDeviceProp_t>* deviceProp     = nullptr,
+        int                               device         = -1,
+        SolutionCache**                   solution_cache = nullptr,
+        CodeObjectLoader**                loader         = nullptr)
     try
     {
         // TensileHost is initialized on the first call
@@ -721,7 +1251,12 @@ namespace
                 adapter = new Tensile::hip::SolutionAdapter;
 
                 // Initialize the adapter and possibly the library
-                host.initialize(*adapter, device);
+                auto start = std::chrono::steady_clock::now();
+                host.initialize(*adapter, a.loader, device);
+                tensile_load_stats().init_nanoseconds
+                    += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
 
                 // Atomically change the adapter stored for this device ID
                 a.adapter.store(adapter, std::memory_order_release);
@@ -733,6 +1268,10 @@ namespace
             *library = host.get_library();
         if(deviceProp)
             *deviceProp = host.get_device_property();
+        if(solution_cache)
+            *solution_cache = &a.solution_cache;
+        if(loader)
+            *loader = &a.loader;
 
         return *adapter;
     }
@@ -784,18 +1323,75 @@ rocblas_status runContractionProblem(const RocblasContractionProblem<Ti, To, Tc>
 
     try
     {
+        using Plan          = TensileContractionPlan<Ti, To, Tc>;
+        auto  handle        = prob.handle;
+        auto* fitness_query = handle->get_solution_fitness_query();
+        auto  plan_state    = handle->contraction_plan;
+        bool  use_plan
+            = plan_state.plan && !fitness_query && !handle->is_device_memory_size_query();
+
         std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>> library;
         std::shared_ptr<hipDeviceProp_t>                                             deviceProp;
-        std::shared_ptr<Tensile::Hardware>                                           hardware;
+        SolutionCache*                                                               cache;
+        CodeObjectLoader*                                                            loader;
 
-        auto& adapter = get_library_and_adapter(&library, &deviceProp, prob.handle->getDevice());
+        auto& adapter = get_library_and_adapter(
+            &library, &deviceProp, prob.handle->getDevice(), &cache, &loader);
 
-        hardware            = Tensile::hip::GetDevice(*deviceProp);
-        auto  tensile_prob  = ConstructTensileProblem(prob);
-        auto  handle        = prob.handle;
-        auto* fitness_query = handle->get_solution_fitness_query();
+        // A cache hit reuses the Tensile problem and hardware of the entry, so that neither is
+        // constructed again. Solution fitness queries always go through findBestSolution.
+        SolutionCacheKey         key{};
+        SolutionCache::entry_ptr entry;
+        if(!fitness_query)
+        {
+            key = GetSolutionCacheKey(prob);
+            if(*cache)
+                entry = cache->find(key);
+        }
+
+        if(entry)
+        {
+            ++handle->solution_cache_hits;
+            solution = entry->solution;
+        }
+        else
+        {
+            auto fresh = std::make_shared<SolutionCache::Entry>(
+                key, ConstructTensileProblem(prob), Tensile::hip::GetDevice(*deviceProp));
+            const auto& tensile_prob = fresh->problem;
+            const auto& hardware     = *fresh->hardware;
+
+            if(fitness_query)
+            {
+                solution = library->findBestSolution(tensile_prob, hardware, fitness_query);
+            }
+            else
+            {
+                if(*cache)
+                    ++handle->solution_cache_misses;
+
+                // Solutions found in the persistent cache do not need to be selected again
+                auto&   persistent = persistent_solution_cache();
+                auto*   words      = reinterpret_cast<const uint64_t*>(key.words.data());
+                int64_t index;
+                if(persistent && persistent->find(words, index))
+                    solution = GetSolutionByIndex(*library, index, tensile_prob, hardware);
 
-        solution = library->findBestSolution(tensile_prob, *hardware, fitness_query);
+                if(!solution)
+                {
+                    solution = library->findBestSolution(tensile_prob, hardware, fitness_query);
+                    if(persistent && solution)
+                        persistent->insert(words, solution->index);
+                }
+            }
+
+            fresh->solution = solution;
+            entry           = std::move(fresh);
+            if(*cache && !fitness_query)
+                cache->insert(entry);
+        }
+
+        const auto& tensile_prob = entry->problem;
 
         if(!solution)
         {
@@ -817,11 +1413,28 @@ rocblas_status runContractionProblem(const RocblasContractionProblem<Ti, To, Tc>
             }
             else
             {
-                adapter.launchKernels(
-                    solution->solve(tensile_prob, GetTensileInputs(prob), *hardware),
-                    handle->get_stream(),
-                    handle->startEvent,
-                    handle->stopEvent);
+                if(!(use_plan && plan_state.capture_only))
+                {
+                    auto kernels
+                        = solution->solve(tensile_prob, GetTensileInputs(prob), *entry->hardware);
+                    if(handle->workspace_stats_enabled)
+                        handle->record_gsu_workspace_request(
+                            solution->requiredWorkspaceSize(tensile_prob));
+                    loader->Load(adapter, kernels);
+                    adapter.launchKernels(
+                        kernels, handle->get_stream(), handle->startEvent, handle->stopEvent);
+                }
+
+                // Capture the solution so that matching calls can replay it
+                if(use_plan)
+                    *plan_state.plan = std::make_unique<Plan>(key,
+                                                              handle->getDevice(),
+                                                              prob,
+                                                              tensile_prob,
+                                                              solution,
+                                                              entry->hardware,
+                                                              adapter,
+                                                              *loader);
                 status = rocblas_status_success;
             }
         }
@@ -851,6 +1464,45 @@ extern "C" void rocblas_initialize()
     get_library_and_adapter();
 }
 
+/*****************************************************************************
+ * Merge the new entries of the persistent solution cache into its file. It  *
+ * is called when the last handle is destroyed and by rocblas_shutdown(), so *
+ * that the file is not written during static destruction.                   *
+ *****************************************************************************/
+void rocblas_internal_flush_persistent_solution_cache()
+try
+{
+    auto& persistent = persistent_solution_cache();
+    if(persistent)
+        persistent->flush();
+}
+catch(...)
+{
+}
+
+/***********************************************************************
+ * ! \brief  Get statistics of Tensile initialization and code object *
+ * loading                                                             *
+ ***********************************************************************/
+extern "C" rocblas_status rocblas_get_tensile_load_stats(rocblas_tensile_load_stats* stats)
+try
+{
+    if(!stats)
+        return rocblas_status_invalid_pointer;
+
+    auto& load_stats                = tensile_load_stats();
+    stats->init_seconds             = load_stats.init_nanoseconds * 1e-9;
+    stats->code_objects_total       = load_stats.code_objects_total;
+    stats->code_objects_loaded      = load_stats.code_objects_loaded;
+    stats->code_object_bytes_loaded = load_stats.code_object_bytes_loaded;
+    stats->resident_bytes_loaded    = load_stats.resident_bytes_loaded;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /******************************************************************************
  * Intantiate the cases of runContractionProblem which are needed to satisfy  *
  * rocBLAS dependencies. This file's template functions are not defined in a  *
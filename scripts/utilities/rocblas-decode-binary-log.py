@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""Decode rocBLAS binary logs into rocblas-bench commands and profile YAML.
+
+Binary logs are written when ROCBLAS_LAYER includes 8 and ROCBLAS_LOG_BINARY_PATH
+names the log file. See library/src/include/binary_logging.hpp for the format.
+
+Usage:
+python3 rocblas-decode-binary-log.py [-b bench_file] [-p profile_file] log_file ...
+
+Without -b or -p, rocblas-bench commands are written to standard output.
+"""
+
+import argparse
+import math
+import re
+import struct
+import sys
+from collections import OrderedDict
+
+MAGIC = b'RBBINLOG'
+VERSION = 2
+DEFINITION = 1
+CALL = 2
+ENUMERATOR = 3
+
+# Fixed-size value encodings, by type code
+FIXED = {'i': '<i', 'l': '<q', 'u': '<I', 'U': '<Q', 'f': '<f', 'd': '<d', 'b': '<?', 'c': '<c'}
+
+PRECISIONS = {'h': 'f16_r', 's': 'f32_r', 'd': 'f64_r', 'c': 'f32_c', 'z': 'f64_c', 'bf': 'bf16_r'}
+
+# Profile argument names and the rocblas-bench options they correspond to
+BENCH_OPTIONS = {
+    'M': '-m', 'N': '-n', 'K': '-k', 'm': '-m', 'n': '-n', 'k': '-k',
+    'kl': '--kl', 'ku': '--ku',
+    'lda': '--lda', 'ldb': '--ldb', 'ldc': '--ldc', 'ldd': '--ldd',
+    'incx': '--incx', 'incy': '--incy',
+    'stride_a': '--stride_a', 'stride_b': '--stride_b', 'stride_c': '--stride_c',
+    'stride_d': '--stride_d', 'stride_x': '--stride_x', 'stride_y': '--stride_y',
+    'stride_A': '--stride_a', 'stride_B': '--stride_b',
+    'batch_count': '--batch_count', 'batch': '--batch_count',
+    'transA': '--transposeA', 'transB': '--transposeB', 'trans': '--transposeA',
+    'transa': '--transposeA',
+    'side': '--side', 'uplo': '--uplo', 'diag': '--diag',
+    'alpha': '--alpha', 'beta': '--beta',
+    'a_type': '--a_type', 'b_type': '--b_type', 'c_type': '--c_type', 'd_type': '--d_type',
+    'compute_type': '--compute_type',
+    'algo': '--algo', 'solution_index': '--solution_index', 'flags': '--flags',
+}
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def fixed(self, fmt):
+        value, = struct.unpack_from(fmt, self.data, self.pos)
+        self.pos += struct.calcsize(fmt)
+        return value
+
+    def string(self):
+        length = self.fixed('<H')
+        value = self.data[self.pos:self.pos + length].decode('utf-8', 'replace')
+        self.pos += length
+        return value
+
+    def value(self, code):
+        if code in FIXED:
+            value = self.fixed(FIXED[code])
+            return value.decode('latin-1') if code == 'c' else value
+        return self.string()
+
+
+def read_log(path):
+    """Yield (function, [(name, type code, value), ...], timestamp) for each call"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != MAGIC:
+        raise ValueError(path + ' is not a rocBLAS binary log')
+    version, = struct.unpack_from('<I', data, 8)
+    if version != VERSION:
+        raise ValueError(path + ': unsupported binary log version ' + str(version))
+
+    definitions = {}
+    enumerators = {}
+    pos = 12
+    while pos + 5 <= len(data):
+        size, = struct.unpack_from('<I', data, pos)
+        if pos + 4 + size > len(data):
+            sys.stderr.write(path + ': truncated record at offset ' + str(pos) + '\n')
+            break
+        record = Reader(data[pos + 4:pos + 4 + size])
+        pos += 4 + size
+
+        kind = record.fixed('<B')
+        if kind == DEFINITION:
+            id = record.fixed('<I')
+            nargs = record.fixed('<H')
+            function = record.string()
+            args = []
+            for _ in range(nargs):
+                name = record.string()
+                code = chr(record.fixed('<B'))
+                # Enumerations are followed by the ID of their enumeration type
+                enum_type = record.fixed('<I') if code == 'e' else None
+                args.append((name, code, enum_type))
+            definitions[id] = (function, args)
+        elif kind == ENUMERATOR:
+            enum_type = record.fixed('<I')
+            value = record.fixed('<i')
+            enumerators[(enum_type, value)] = record.string()
+        elif kind == CALL:
+            id = record.fixed('<I')
+            timestamp = record.fixed('<Q')
+            function, args = definitions[id]
+            values = []
+            for name, code, enum_type in args:
+                if code == 'e':
+                    # Enumerations are decoded to the names which the profile log would show
+                    value = record.fixed('<i')
+                    values.append((name, 'y', enumerators.get((enum_type, value), str(value))))
+                else:
+                    values.append((name, code, record.value(code)))
+            yield function, values, timestamp
+
+
+def yaml_value(code, value):
+    """Format a value as the profile log does"""
+    if code == 's':
+        return '"' + value.replace('\\', '\\\\').replace('"', '\\"') + '"'
+    if code == 'c':
+        return "'" + value.replace('\\', '\\\\').replace("'", "\\'") + "'"
+    if code == 'b':
+        return 'true' if value else 'false'
+    if code == 'd':
+        if math.isnan(value):
+            return '.nan'
+        if math.isinf(value):
+            return '-.inf' if value < 0 else '.inf'
+        s = '%.17g' % value
+        return s if re.search('[.eE]', s) else s + '.0'
+    if code == 'f':
+        return '%g' % value
+    return str(value)
+
+
+def bench_value(code, value):
+    if code in 'fd' and float(value).is_integer():
+        return str(int(value))
+    return str(value)
+
+
+def bench_function(function):
+    """Return the rocblas-bench function name and precision options for a rocBLAS function"""
+    base = function[len('rocblas_'):] if function.startswith('rocblas_') else function
+
+    # Functions with explicit types take them from their arguments
+    if re.search('_ex(t2)?$', base):
+        return base, []
+
+    # i?amax and i?amin
+    iamax = re.match('i(bf|[hsdcz])(ama[xn].*)$', base)
+    if iamax:
+        prefix, name = iamax.group(1), 'i' + iamax.group(2)
+    elif base[:2] in ('bf', 'cs', 'zd', 'sc', 'dz'):
+        prefix, name = base[:2], base[2:]
+    elif base[:1] in PRECISIONS:
+        prefix, name = base[:1], base[1:]
+    else:
+        return base, []
+
+    if prefix in ('cs', 'zd'):
+        return name, ['--a_type', PRECISIONS[prefix[0]], '--b_type', PRECISIONS[prefix[1]]]
+    if prefix in ('sc', 'dz'):
+        return name, ['-r', PRECISIONS[prefix[1]]]
+    return name, ['-r', PRECISIONS[prefix]]
+
+
+def bench_command(function, args):
+    name, options = bench_function(function)
+    command = ['./rocblas-bench', '-f', name] + options
+    for arg, code, value in args:
+        if arg == 'atomics_mode':
+            if value == 'atomics_not_allowed':
+                command.append('--atomics_not_allowed')
+        elif arg in BENCH_OPTIONS:
+            command += [BENCH_OPTIONS[arg], bench_value(code, value)]
+    return ' '.join(command)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('logs', nargs='+', help='binary log files')
+    parser.add_argument('-b', '--bench', help='file to write rocblas-bench commands to')
+    parser.add_argument('-p', '--profile', help='file to write profile YAML to')
+    args = parser.parse_args()
+
+    bench = open(args.bench, 'w') if args.bench else None
+    if not args.bench and not args.profile:
+        bench = sys.stdout
+
+    # Map from (function, arguments) to call counts, in order of first call
+    profile = OrderedDict()
+
+    for log in args.logs:
+        for function, fargs, timestamp in read_log(log):
+            if bench:
+                bench.write(bench_command(function, fargs) + '\n')
+            key = (function, tuple((name, code, value) for name, code, value in fargs))
+            profile[key] = profile.get(key, 0) + 1
+
+    if args.profile:
+        with open(args.profile, 'w') as f:
+            for (function, fargs), count in profile.items():
+                pairs = ['rocblas_function: ' + yaml_value('s', function)]
+                pairs += [name + ': ' + yaml_value(code, value) for name, code, value in fargs]
+                pairs.append('call_count: ' + str(count))
+                f.write('- { ' + ', '.join(pairs) + ' }\n')
+
+    if bench and bench is not sys.stdout:
+        bench.close()
+
+
+if __name__ == '__main__':
+    main()